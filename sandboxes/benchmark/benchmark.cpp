@@ -0,0 +1,267 @@
+// Reproducible performance benchmarks of the slicing pipeline and of the core geometry kernels.
+//
+// Usage: benchmark [--repeat N] [--output results.json] [--no-sla] [model.obj ...]
+//
+// Without any model given, the models of tests/data are measured together with a large generated sphere.
+// The results are written as JSON, one record per measurement, so that they may be compared across releases.
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+#include <boost/nowide/fstream.hpp>
+
+#include <libslic3r/libslic3r.h>
+#include <libslic3r/AABBMesh.hpp>
+#include <libslic3r/BoundingBox.hpp>
+#include <libslic3r/ClipperUtils.hpp>
+#include <libslic3r/Format/OBJ.hpp>
+#include <libslic3r/GCode/GCodeProcessor.hpp>
+#include <libslic3r/Geometry/Voronoi.hpp>
+#include <libslic3r/Model.hpp>
+#include <libslic3r/Print.hpp>
+#include <libslic3r/SLAPrint.hpp>
+#include <libslic3r/TriangleMesh.hpp>
+#include <libslic3r/TriangleMeshSlicer.hpp>
+
+#include "libnest2d/tools/benchmark.h"
+
+using namespace Slic3r;
+
+namespace {
+
+struct Measurement
+{
+    std::string         name;
+    std::string         input;
+    // Wall clock time of each repetition.
+    std::vector<double> seconds;
+};
+
+class Benchmarks
+{
+public:
+    explicit Benchmarks(int repeat) : m_repeat(std::max(1, repeat)) {}
+
+    // Measure fn() m_repeat times. The size returned by fn() is accumulated, so that the measured work is not optimized out.
+    void measure(const std::string &name, const std::string &input, const std::function<size_t()> &fn)
+    {
+        Measurement m { name, input, {} };
+        for (int i = 0; i < m_repeat; ++ i) {
+            ::Benchmark b;
+            b.start();
+            m_sink += fn();
+            b.stop();
+            m.seconds.emplace_back(b.getElapsedSec());
+        }
+        std::cerr << input << ": " << name << " " << *std::min_element(m.seconds.begin(), m.seconds.end()) << " s" << std::endl;
+        m_measurements.emplace_back(std::move(m));
+    }
+
+    void write_json(std::ostream &out) const
+    {
+        out << "{\n  \"repeat\": " << m_repeat << ",\n  \"measurements\": [";
+        for (size_t i = 0; i < m_measurements.size(); ++ i) {
+            const Measurement &m = m_measurements[i];
+            double sum = 0.;
+            for (double s : m.seconds)
+                sum += s;
+            out << (i == 0 ? "\n" : ",\n")
+                << "    { \"name\": \"" << m.name << "\", \"input\": \"" << m.input << "\""
+                << ", \"min\": "  << *std::min_element(m.seconds.begin(), m.seconds.end())
+                << ", \"max\": "  << *std::max_element(m.seconds.begin(), m.seconds.end())
+                << ", \"mean\": " << sum / double(m.seconds.size()) << " }";
+        }
+        out << "\n  ]\n}\n";
+    }
+
+private:
+    int                      m_repeat;
+    std::vector<Measurement> m_measurements;
+    size_t                   m_sink { 0 };
+};
+
+std::vector<float> layer_zs(const indexed_triangle_set &its, float layer_height)
+{
+    const BoundingBoxf3 bbox = TriangleMesh(its).bounding_box();
+    std::vector<float> zs;
+    for (float z = float(bbox.min.z()) + 0.5f * layer_height; z < bbox.max.z(); z += layer_height)
+        zs.emplace_back(z);
+    return zs;
+}
+
+void measure_kernels(Benchmarks &benchmarks, const std::string &input, const indexed_triangle_set &its)
+{
+    const std::vector<float>      zs     = layer_zs(its, 0.2f);
+    const std::vector<ExPolygons> slices = slice_mesh_ex(its, zs);
+
+    benchmarks.measure("slice_mesh_ex", input, [&its, &zs]() {
+        return slice_mesh_ex(its, zs).size();
+    });
+    benchmarks.measure("offset_ex", input, [&slices]() {
+        size_t n = 0;
+        for (const ExPolygons &slice : slices)
+            n += offset_ex(slice, scaled<float>(-0.4)).size();
+        return n;
+    });
+    benchmarks.measure("union_ex", input, [&slices]() {
+        size_t n = 0;
+        for (size_t i = 1; i < slices.size(); ++ i) {
+            Polygons polygons = to_polygons(slices[i - 1]);
+            append(polygons, to_polygons(slices[i]));
+            n += union_ex(polygons).size();
+        }
+        return n;
+    });
+    benchmarks.measure("construct_voronoi", input, [&slices]() {
+        size_t n = 0;
+        for (const ExPolygons &slice : slices) {
+            Lines                    lines = to_lines(slice);
+            Geometry::VoronoiDiagram vd;
+            boost::polygon::construct_voronoi(lines.begin(), lines.end(), &vd);
+            n += vd.num_vertices();
+        }
+        return n;
+    });
+    benchmarks.measure("AABBMesh build", input, [&its]() {
+        return AABBMesh(its).vertices().size();
+    });
+    {
+        const AABBMesh       aabb(its);
+        const Vec3d          center = TriangleMesh(its).bounding_box().center();
+        std::vector<Vec3d>   dirs;
+        std::mt19937         rng(0);
+        std::normal_distribution<double> dist;
+        for (size_t i = 0; i < 100000; ++ i)
+            dirs.emplace_back(Vec3d(dist(rng), dist(rng), dist(rng)).normalized());
+        benchmarks.measure("AABBMesh raycast 100k", input, [&aabb, &center, &dirs]() {
+            size_t n = 0;
+            for (const Vec3d &dir : dirs)
+                if (aabb.query_ray_hit(center, dir).is_hit())
+                    ++ n;
+            return n;
+        });
+    }
+}
+
+Model make_model(const indexed_triangle_set &its, const std::string &name)
+{
+    Model        model;
+    ModelObject *object = model.add_object();
+    object->name = name;
+    object->add_volume(TriangleMesh(its));
+    object->add_instance();
+    model.center_instances_around_point({ 100, 100 });
+    for (ModelObject *mo : model.objects)
+        mo->ensure_on_bed();
+    return model;
+}
+
+void measure_fff(Benchmarks &benchmarks, const std::string &input, const indexed_triangle_set &its)
+{
+    const std::string gcode_path = (boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("benchmark-%%%%-%%%%.gcode")).string();
+    Model             model      = make_model(its, input);
+    DynamicPrintConfig config    = DynamicPrintConfig::full_print_config();
+
+    benchmarks.measure("Print::process", input, [&model, &config]() {
+        Print print;
+        for (ModelObject *mo : model.objects)
+            print.auto_assign_extruders(mo);
+        print.apply(model, config);
+        print.validate();
+        print.set_status_silent();
+        print.process();
+        return print.objects().front()->layer_count();
+    });
+    {
+        Print print;
+        for (ModelObject *mo : model.objects)
+            print.auto_assign_extruders(mo);
+        print.apply(model, config);
+        print.validate();
+        print.set_status_silent();
+        print.process();
+        // With complete_objects disabled, export_gcode() keeps the print valid, thus it may be exported repeatedly.
+        benchmarks.measure("Print::export_gcode", input, [&print, &gcode_path]() {
+            GCodeProcessorResult result;
+            print.export_gcode(gcode_path, &result, nullptr);
+            return result.moves.size();
+        });
+    }
+    benchmarks.measure("GCodeProcessor::process_file", input, [&gcode_path]() {
+        GCodeProcessor processor;
+        processor.process_file(gcode_path);
+        return processor.get_result().moves.size();
+    });
+    boost::filesystem::remove(gcode_path);
+}
+
+void measure_sla(Benchmarks &benchmarks, const std::string &input, const indexed_triangle_set &its)
+{
+    Model              model = make_model(its, input);
+    SLAFullPrintConfig fullcfg;
+    fullcfg.printer_technology.setInt(ptSLA);
+    DynamicPrintConfig config;
+    config.apply(fullcfg);
+
+    benchmarks.measure("SLAPrint::process", input, [&model, &config]() {
+        SLAPrint print;
+        print.set_status_callback([](const PrintBase::SlicingStatus&) {});
+        print.apply(model, config);
+        print.process();
+        return print.objects().size();
+    });
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    int                      repeat   = 3;
+    bool                     sla      = true;
+    std::string              output   = "benchmark.json";
+    std::vector<std::string> models;
+    for (int i = 1; i < argc; ++ i) {
+        if (std::strcmp(argv[i], "--repeat") == 0 && i + 1 < argc)
+            repeat = std::atoi(argv[++ i]);
+        else if (std::strcmp(argv[i], "--output") == 0 && i + 1 < argc)
+            output = argv[++ i];
+        else if (std::strcmp(argv[i], "--no-sla") == 0)
+            sla = false;
+        else
+            models.emplace_back(argv[i]);
+    }
+    if (models.empty())
+        for (const char *name : { "20mm_cube", "extruder_idler", "frog_legs", "ipadstand", "pyramid", "bridge" })
+            models.emplace_back(std::string(BENCHMARK_DATA_DIR) + "/" + name + ".obj");
+
+    std::vector<std::pair<std::string, indexed_triangle_set>> inputs;
+    for (const std::string &path : models) {
+        TriangleMesh mesh;
+        if (! load_obj(path.c_str(), &mesh)) {
+            std::cerr << "Failed to load " << path << std::endl;
+            return EXIT_FAILURE;
+        }
+        inputs.emplace_back(boost::filesystem::path(path).stem().string(), std::move(mesh.its));
+    }
+    // A large generated mesh, about half a million triangles.
+    inputs.emplace_back("sphere_r50", its_make_sphere(50., PI / 512.));
+
+    Benchmarks benchmarks(repeat);
+    for (const auto &[name, its] : inputs) {
+        measure_kernels(benchmarks, name, its);
+        measure_fff(benchmarks, name, its);
+        if (sla)
+            measure_sla(benchmarks, name, its);
+    }
+
+    boost::nowide::ofstream out(output);
+    benchmarks.write_json(out);
+    return out.good() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
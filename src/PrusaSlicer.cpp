@@ -22,11 +22,17 @@
 #include <cstring>
 #include <iostream>
 #include <math.h>
+#include <algorithm>
+#include <atomic>
 #include <boost/algorithm/string/predicate.hpp>
+#include <boost/algorithm/string/trim.hpp>
+#include <boost/tokenizer.hpp>
 #include <boost/filesystem.hpp>
 #include <boost/nowide/args.hpp>
 #include <boost/nowide/cenv.hpp>
+#include <boost/nowide/fstream.hpp>
 #include <boost/nowide/iostream.hpp>
+#include <boost/log/trivial.hpp>
 #include <boost/nowide/integration/filesystem.hpp>
 #include <boost/dll/runtime_symbol_info.hpp>
 
@@ -52,8 +58,11 @@
 #include "libslic3r/Format/SL1.hpp"
 #include "libslic3r/Utils.hpp"
 #include "libslic3r/Thread.hpp"
+#include "libslic3r/Trace.hpp"
 #include "libslic3r/BlacklistedLibraryCheck.hpp"
 
+#include <tbb/task_arena.h>
+
 #include "PrusaSlicer.hpp"
 
 #ifdef SLIC3R_GUI
@@ -70,10 +79,12 @@ static PrinterTechnology get_printer_technology(const DynamicConfig &config)
 
 int CLI::run(int argc, char **argv)
 {
-    // Mark the main thread for the debugger and for runtime checks.
-    set_current_thread_name("slic3r_main");
-    // Save the thread ID of the main thread.
-    save_main_thread_id();
+    if (! m_batch_job) {
+        // Mark the main thread for the debugger and for runtime checks.
+        set_current_thread_name("slic3r_main");
+        // Save the thread ID of the main thread.
+        save_main_thread_id();
+    }
 
 #ifdef __WXGTK__
     // On Linux, wxGTK has no support for Wayland, and the app crashes on
@@ -105,6 +116,12 @@ int CLI::run(int argc, char **argv)
 	if (! this->setup(argc, argv))
 		return 1;
 
+    // Export the regions traced by all the actions or batch jobs once this CLI finishes. The GUI exports them after each background processing.
+    ScopeGuard trace_export_guard([this]() { if (trace_enabled() && ! m_batch_job) trace_export(); });
+
+    if (const std::string &batch = m_config.opt_string("batch"); ! batch.empty() && ! m_batch_job)
+        return this->run_batch(batch, argc > 0 ? argv[0] : SLIC3R_APP_KEY);
+
     m_extra_config.apply(m_config, true);
     m_extra_config.normalize_fdm();
     
@@ -115,6 +132,10 @@ int CLI::run(int argc, char **argv)
         std::find(m_transforms.begin(), m_transforms.end(), "cut") == m_transforms.end() &&
         std::find(m_transforms.begin(), m_transforms.end(), "cut_x") == m_transforms.end() &&
         std::find(m_transforms.begin(), m_transforms.end(), "cut_y") == m_transforms.end();
+    if (start_gui && m_batch_job) {
+        boost::nowide::cerr << "No action specified for a batch job" << std::endl;
+        return 1;
+    }
     bool                            start_downloader = false;
     bool                            delete_after_load = false;
     std::string                     download_url;
@@ -310,6 +331,47 @@ int CLI::run(int argc, char **argv)
             return 1;
         }
     }
+
+    // Load the configs of the G-code variants exported from a single slicing of the models, see --gcode_variant.
+    std::vector<std::pair<std::string, DynamicPrintConfig>> gcode_variants;
+    for (const std::string &file : m_config.option<ConfigOptionStrings>("gcode_variant", true)->values) {
+        DynamicPrintConfig config;
+        try {
+            config.load(file, config_substitution_rule);
+        } catch (std::exception &ex) {
+            boost::nowide::cerr << "Error while reading config file \"" << file << "\": " << ex.what() << std::endl;
+            return 1;
+        }
+        config.normalize_fdm();
+        if (printer_technology != ptFFF || get_printer_technology(config) == ptSLA) {
+            boost::nowide::cerr << "error: G-code variants are only supported for FFF configurations" << std::endl;
+            return 1;
+        }
+        // The variant overrides the --load files, the command line options override both.
+        DynamicPrintConfig variant_config = m_print_config;
+        variant_config.apply(config, true);
+        variant_config.apply(m_extra_config, true);
+        variant_config.normalize_fdm();
+        if (std::string validity = variant_config.validate(); ! validity.empty()) {
+            boost::nowide::cerr << "Error: The configation of the G-code variant " << file << " is not valid: " << validity << std::endl;
+            return 1;
+        }
+        gcode_variants.emplace_back(file, std::move(variant_config));
+    }
+
+    // Slicing worker of a distributed slicing, see --slice_shard.
+    int shard_idx  = -1;
+    int num_shards = 0;
+    if (const std::string &shard = m_config.opt_string("slice_shard"); ! shard.empty()) {
+        if (sscanf(shard.c_str(), "%d/%d", &shard_idx, &num_shards) != 2 || num_shards < 1 || shard_idx < 0 || shard_idx >= num_shards) {
+            boost::nowide::cerr << "error: invalid slice shard \"" << shard << "\", expected K/N with 0 <= K < N" << std::endl;
+            return 1;
+        }
+        if (printer_technology != ptFFF || slice_cache_dir().empty()) {
+            boost::nowide::cerr << "error: --slice_shard requires an FFF configuration and --slice_cache" << std::endl;
+            return 1;
+        }
+    }
     
     // Loop through transform options.
     bool user_center_specified = false;
@@ -554,6 +616,11 @@ int CLI::run(int argc, char **argv)
                 if (make_copy)
                     model_copy = model_in;
                 Model &model = make_copy ? model_copy : model_in;
+                if (num_shards > 0)
+                    // Keep just the objects of this shard. The cached slices don't depend on the placement of the objects.
+                    for (int idx = int(model.objects.size()) - 1; idx >= 0; -- idx)
+                        if (idx % num_shards != shard_idx)
+                            model.delete_object(size_t(idx));
                 // If all objects have defined instances, their relative positions will be
                 // honored when printing (they will be only centered, unless --dont-arrange
                 // is supplied); if any object has no instances, it will get a default one
@@ -579,14 +646,28 @@ int CLI::run(int argc, char **argv)
                 if (printer_technology == ptFFF) {
                     for (auto* mo : model.objects)
                         fff_print.auto_assign_extruders(mo);
+                    // The Print is exported just once, unless the layers are reused by the G-code variants.
+                    fff_print.set_release_layers_on_export(m_config.opt_bool("low_memory") && gcode_variants.empty());
                 }
+                print->set_max_threads(m_config.opt_int("max_threads"));
                 print->apply(model, m_print_config);
                 std::string err = print->validate();
                 if (! err.empty()) {
                     boost::nowide::cerr << err << std::endl;
                     return 1;
                 }
-                if (print->empty())
+                if (num_shards > 0) {
+                    // Only slice the objects into the slice cache, the G-code is exported by the process slicing the whole plate
+                    // with the same configuration and slice cache, which loads the slices of all the shards from the cache.
+                    try {
+                        fff_print.process_slices();
+                    } catch (const std::exception &ex) {
+                        boost::nowide::cerr << ex.what() << std::endl;
+                        return 1;
+                    }
+                    boost::nowide::cout << "Slices of " << model.objects.size() << " objects of shard " << shard_idx << "/" << num_shards <<
+                        " stored into " << slice_cache_dir() << std::endl;
+                } else if (print->empty())
                     boost::nowide::cout << "Nothing to print for " << outfile << " . Either the print is empty or no object is fully inside the print volume." << std::endl;
                 else
                     try {
@@ -612,6 +693,38 @@ int CLI::run(int argc, char **argv)
                         // Run the post-processing scripts if defined.
                         run_post_process_scripts(outfile, fff_print.full_print_config());
                         boost::nowide::cout << "Slicing result exported to " << outfile << std::endl;
+
+                        // Apply the configs of the G-code variants one after the other to the same Print. Print::apply() invalidates
+                        // just the steps depending on the options the configs differ in, thus a variant differing in the printer,
+                        // filament, speed or temperature options only regenerates the G-code, reusing the sliced layers.
+                        std::vector<std::string> exported_paths { fff_print.output_filepath(m_config.opt_string("output")) };
+                        for (const auto &[variant_file, variant_config] : gcode_variants) {
+                            fff_print.apply(model, variant_config);
+                            if (std::string err = fff_print.validate(); ! err.empty()) {
+                                boost::nowide::cerr << variant_file << ": " << err << std::endl;
+                                return 1;
+                            }
+                            fff_print.process();
+                            std::string variant_outfile = fff_print.output_filepath(m_config.opt_string("output"));
+                            if (std::find(exported_paths.begin(), exported_paths.end(), variant_outfile) != exported_paths.end()) {
+                                // Don't overwrite the G-code of the base config or of another variant, add the name of the variant config.
+                                boost::filesystem::path path(variant_outfile);
+                                variant_outfile = (path.parent_path() / (path.stem().string() + "_" +
+                                    boost::filesystem::path(variant_file).stem().string() + path.extension().string())).string();
+                            }
+                            exported_paths.emplace_back(variant_outfile);
+                            variant_outfile = fff_print.export_gcode(variant_outfile, nullptr, nullptr);
+                            std::string variant_outfile_final = fff_print.print_statistics().finalize_output_path(variant_outfile);
+                            if (variant_outfile != variant_outfile_final) {
+                                if (Slic3r::rename_file(variant_outfile, variant_outfile_final)) {
+                                    boost::nowide::cerr << "Renaming file " << variant_outfile << " to " << variant_outfile_final << " failed" << std::endl;
+                                    return 1;
+                                }
+                                variant_outfile = variant_outfile_final;
+                            }
+                            run_post_process_scripts(variant_outfile, fff_print.full_print_config());
+                            boost::nowide::cout << "G-code variant " << variant_file << " exported to " << variant_outfile << std::endl;
+                        }
                     } catch (const std::exception &ex) {
                         boost::nowide::cerr << ex.what() << std::endl;
                         return 1;
@@ -699,66 +812,69 @@ int CLI::run(int argc, char **argv)
 
 bool CLI::setup(int argc, char **argv)
 {
-    {
-	    Slic3r::set_logging_level(1);
-        const char *loglevel = boost::nowide::getenv("SLIC3R_LOGLEVEL");
-        if (loglevel != nullptr) {
-            if (loglevel[0] >= '0' && loglevel[0] <= '9' && loglevel[1] == 0)
-                set_logging_level(loglevel[0] - '0');
-            else
-                boost::nowide::cerr << "Invalid SLIC3R_LOGLEVEL environment variable: " << loglevel << std::endl;
+    // Jobs of a batch share the process wide settings (logging, platform, resource directories) of the CLI running the batch.
+    if (! m_batch_job) {
+        {
+    	    Slic3r::set_logging_level(1);
+            const char *loglevel = boost::nowide::getenv("SLIC3R_LOGLEVEL");
+            if (loglevel != nullptr) {
+                if (loglevel[0] >= '0' && loglevel[0] <= '9' && loglevel[1] == 0)
+                    set_logging_level(loglevel[0] - '0');
+                else
+                    boost::nowide::cerr << "Invalid SLIC3R_LOGLEVEL environment variable: " << loglevel << std::endl;
+            }
         }
-    }
 
-    // Detect the operating system flavor after SLIC3R_LOGLEVEL is set.
-    detect_platform();
+        // Detect the operating system flavor after SLIC3R_LOGLEVEL is set.
+        detect_platform();
 
 #ifdef WIN32
-    // Notify user that a blacklisted DLL was injected into PrusaSlicer process (for example Nahimic, see GH #5573).
-    // We hope that if a DLL is being injected into a PrusaSlicer process, it happens at the very start of the application,
-    // thus we shall detect them now.
-    if (BlacklistedLibraryCheck::get_instance().perform_check()) {
-        std::wstring text = L"Following DLLs have been injected into the PrusaSlicer process:\n\n";
-        text += BlacklistedLibraryCheck::get_instance().get_blacklisted_string();
-        text += L"\n\n"
-                L"PrusaSlicer is known to not run correctly with these DLLs injected. "
-                L"We suggest stopping or uninstalling these services if you experience "
-                L"crashes or unexpected behaviour while using PrusaSlicer.\n"
-                L"For example, ASUS Sonic Studio injects a Nahimic driver, which makes PrusaSlicer "
-                L"to crash on a secondary monitor, see PrusaSlicer github issue #5573";
-        MessageBoxW(NULL, text.c_str(), L"Warning"/*L"Incopatible library found"*/, MB_OK);
-    }
+        // Notify user that a blacklisted DLL was injected into PrusaSlicer process (for example Nahimic, see GH #5573).
+        // We hope that if a DLL is being injected into a PrusaSlicer process, it happens at the very start of the application,
+        // thus we shall detect them now.
+        if (BlacklistedLibraryCheck::get_instance().perform_check()) {
+            std::wstring text = L"Following DLLs have been injected into the PrusaSlicer process:\n\n";
+            text += BlacklistedLibraryCheck::get_instance().get_blacklisted_string();
+            text += L"\n\n"
+                    L"PrusaSlicer is known to not run correctly with these DLLs injected. "
+                    L"We suggest stopping or uninstalling these services if you experience "
+                    L"crashes or unexpected behaviour while using PrusaSlicer.\n"
+                    L"For example, ASUS Sonic Studio injects a Nahimic driver, which makes PrusaSlicer "
+                    L"to crash on a secondary monitor, see PrusaSlicer github issue #5573";
+            MessageBoxW(NULL, text.c_str(), L"Warning"/*L"Incopatible library found"*/, MB_OK);
+        }
 #endif
 
-    // See Invoking prusa-slicer from $PATH environment variable crashes #5542
-    // boost::filesystem::path path_to_binary = boost::filesystem::system_complete(argv[0]);
-    boost::filesystem::path path_to_binary = boost::dll::program_location();
+        // See Invoking prusa-slicer from $PATH environment variable crashes #5542
+        // boost::filesystem::path path_to_binary = boost::filesystem::system_complete(argv[0]);
+        boost::filesystem::path path_to_binary = boost::dll::program_location();
 
-    // Path from the Slic3r binary to its resources.
+        // Path from the Slic3r binary to its resources.
 #ifdef __APPLE__
-    // The application is packed in the .dmg archive as 'Slic3r.app/Contents/MacOS/Slic3r'
-    // The resources are packed to 'Slic3r.app/Contents/Resources'
-    boost::filesystem::path path_resources = boost::filesystem::canonical(path_to_binary).parent_path() / "../Resources";
+        // The application is packed in the .dmg archive as 'Slic3r.app/Contents/MacOS/Slic3r'
+        // The resources are packed to 'Slic3r.app/Contents/Resources'
+        boost::filesystem::path path_resources = boost::filesystem::canonical(path_to_binary).parent_path() / "../Resources";
 #elif defined _WIN32
-    // The application is packed in the .zip archive in the root,
-    // The resources are packed to 'resources'
-    // Path from Slic3r binary to resources:
-    boost::filesystem::path path_resources = path_to_binary.parent_path() / "resources";
+        // The application is packed in the .zip archive in the root,
+        // The resources are packed to 'resources'
+        // Path from Slic3r binary to resources:
+        boost::filesystem::path path_resources = path_to_binary.parent_path() / "resources";
 #elif defined SLIC3R_FHS
-    // The application is packaged according to the Linux Filesystem Hierarchy Standard
-    // Resources are set to the 'Architecture-independent (shared) data', typically /usr/share or /usr/local/share
-    boost::filesystem::path path_resources = SLIC3R_FHS_RESOURCES;
+        // The application is packaged according to the Linux Filesystem Hierarchy Standard
+        // Resources are set to the 'Architecture-independent (shared) data', typically /usr/share or /usr/local/share
+        boost::filesystem::path path_resources = SLIC3R_FHS_RESOURCES;
 #else
-    // The application is packed in the .tar.bz archive (or in AppImage) as 'bin/slic3r',
-    // The resources are packed to 'resources'
-    // Path from Slic3r binary to resources:
-    boost::filesystem::path path_resources = boost::filesystem::canonical(path_to_binary).parent_path() / "../resources";
+        // The application is packed in the .tar.bz archive (or in AppImage) as 'bin/slic3r',
+        // The resources are packed to 'resources'
+        // Path from Slic3r binary to resources:
+        boost::filesystem::path path_resources = boost::filesystem::canonical(path_to_binary).parent_path() / "../resources";
 #endif
 
-    set_resources_dir(path_resources.string());
-    set_var_dir((path_resources / "icons").string());
-    set_local_dir((path_resources / "localization").string());
-    set_sys_shapes_dir((path_resources / "shapes").string());
+        set_resources_dir(path_resources.string());
+        set_var_dir((path_resources / "icons").string());
+        set_local_dir((path_resources / "localization").string());
+        set_sys_shapes_dir((path_resources / "shapes").string());
+    }
 
     // Parse all command line options into a DynamicConfig.
     // If any option is unsupported, print usage and abort immediately.
@@ -779,7 +895,7 @@ bool CLI::setup(int argc, char **argv)
 
     {
         const ConfigOptionInt *opt_loglevel = m_config.opt<ConfigOptionInt>("loglevel");
-        if (opt_loglevel != 0)
+        if (opt_loglevel != 0 && ! m_batch_job)
             set_logging_level(opt_loglevel->value);
     }
     
@@ -791,7 +907,15 @@ bool CLI::setup(int argc, char **argv)
         for (const t_optiondef_map::value_type &optdef : *options)
             m_config.option(optdef.first, true);
 
-    set_data_dir(m_config.opt_string("datadir"));
+    if (! m_batch_job) {
+        set_data_dir(m_config.opt_string("datadir"));
+        set_slice_cache_dir(m_config.opt_string("slice_cache"));
+        std::string trace = m_config.opt_string("trace");
+        if (const char *trace_env = boost::nowide::getenv("SLIC3R_TRACE"); trace.empty() && trace_env != nullptr)
+            trace = trace_env;
+        if (! trace.empty())
+            trace_start(trace);
+    }
     
     //FIXME Validating at this stage most likely does not make sense, as the config is not fully initialized yet.
     if (!validity.empty()) {
@@ -802,6 +926,81 @@ bool CLI::setup(int argc, char **argv)
     return true;
 }
 
+int CLI::run_batch(const std::string &path, const char *argv0)
+{
+    // Each job is a line of command line arguments, separated by spaces, possibly quoted.
+    std::vector<std::vector<std::string>> jobs;
+    {
+        boost::nowide::ifstream ifs(path);
+        if (! ifs) {
+            boost::nowide::cerr << "Failed to open batch job list " << path << std::endl;
+            return 1;
+        }
+        std::string line;
+        try {
+            while (std::getline(ifs, line)) {
+                boost::trim(line);
+                if (line.empty() || line.front() == '#')
+                    continue;
+                boost::tokenizer<boost::escaped_list_separator<char>> tokens(line, boost::escaped_list_separator<char>('\\', ' ', '"'));
+                std::vector<std::string> args { argv0 };
+                for (const std::string &token : tokens)
+                    if (! token.empty())
+                        args.emplace_back(token);
+                jobs.emplace_back(std::move(args));
+            }
+        } catch (const boost::escaped_list_error &ex) {
+            boost::nowide::cerr << "Error while parsing batch job list " << path << ": " << ex.what() << std::endl;
+            return 1;
+        }
+    }
+
+    const size_t num_workers = std::clamp<size_t>(size_t(m_config.opt_int("batch_jobs")), 1, std::max<size_t>(jobs.size(), 1));
+    const int    max_threads = tbb::this_task_arena::max_concurrency();
+    const int    job_threads = m_config.opt_int("batch_threads") > 0 ?
+        std::min(m_config.opt_int("batch_threads"), max_threads) : std::max(1, max_threads / int(num_workers));
+    BOOST_LOG_TRIVIAL(info) << "Batch processing " << jobs.size() << " jobs, " << num_workers << " concurrently with " << job_threads << " threads each";
+
+    std::atomic<size_t> next_job { 0 };
+    std::atomic<size_t> num_failed { 0 };
+    auto worker = [&jobs, &next_job, &num_failed, job_threads]() {
+        // All the jobs share the process wide TBB thread pool, the arena just limits the number of threads a single job occupies.
+        tbb::task_arena arena(job_threads);
+        for (size_t job_idx = next_job ++; job_idx < jobs.size(); job_idx = next_job ++) {
+            std::vector<std::string> &args = jobs[job_idx];
+            std::vector<char*>        argv(args.size() + 1, nullptr);
+            for (size_t i = 0; i < args.size(); ++ i)
+                argv[i] = args[i].data();
+            int result = 1;
+            arena.execute([&result, &args, &argv]() {
+                try {
+                    CLI cli;
+                    cli.m_batch_job = true;
+                    result = cli.run(int(args.size()), argv.data());
+                } catch (const std::exception &ex) {
+                    boost::nowide::cerr << ex.what() << std::endl;
+                }
+            });
+            if (result != 0) {
+                ++ num_failed;
+                boost::nowide::cerr << "Batch job " << job_idx + 1 << " failed" << std::endl;
+            }
+        }
+    };
+    std::vector<boost::thread> threads;
+    for (size_t i = 1; i < num_workers; ++ i)
+        threads.emplace_back(create_thread(worker));
+    worker();
+    for (boost::thread &thread : threads)
+        thread.join();
+
+    if (num_failed > 0) {
+        boost::nowide::cerr << num_failed << " of " << jobs.size() << " batch jobs failed" << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
 void CLI::print_help(bool include_print_options, PrinterTechnology printer_technology) const
 {
     boost::nowide::cout
@@ -29,8 +29,13 @@ private:
     std::vector<std::string>    m_actions;
     std::vector<std::string>    m_transforms;
     std::vector<Model>          m_models;
+    // Set for the jobs started by run_batch().
+    bool                        m_batch_job { false };
 
     bool setup(int argc, char **argv);
+
+    /// Processes the jobs of a batch job list file in this process, see the --batch option.
+    int run_batch(const std::string &path, const char *argv0);
     
     /// Prints usage of the CLI.
     void print_help(bool include_print_options = false, PrinterTechnology printer_technology = ptAny) const;
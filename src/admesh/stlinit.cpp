@@ -153,13 +153,23 @@ static bool stl_read(stl_file *stl, FILE *fp, int first_facet, bool first)
     	rewind(fp);
 
   	char normal_buf[3][32];
+  	// Binary facets are read in blocks, a single fread() per facet is slow for large files.
+  	static constexpr uint32_t facets_per_block = 16384;
+  	std::vector<char> block;
+  	uint32_t block_facets = 0, block_next = 0;
   	for (uint32_t i = first_facet; i < stl->stats.number_of_facets; ++ i) {
   	  	stl_facet facet;
 
     	if (stl->stats.type == binary) {
+      		if (block_next == block_facets) {
+      			block_facets = std::min(facets_per_block, stl->stats.number_of_facets - i);
+      			block.resize(size_t(block_facets) * SIZEOF_STL_FACET);
+      			if (fread(block.data(), SIZEOF_STL_FACET, block_facets, fp) != block_facets)
+      				return false;
+      			block_next = 0;
+      		}
       		// Read a single facet from a binary .STL file. We assume little-endian architecture!
-      		if (fread(&facet, 1, SIZEOF_STL_FACET, fp) != SIZEOF_STL_FACET)
-      			return false;
+      		memcpy(&facet, block.data() + size_t(block_next ++) * SIZEOF_STL_FACET, SIZEOF_STL_FACET);
 #if BOOST_ENDIAN_BIG_BYTE
       		// Convert the loaded little endian data to big endian.
       		stl_internal_reverse_quads((char*)&facet, 48);
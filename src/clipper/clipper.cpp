@@ -73,25 +73,6 @@ static int const Skip = -2;        //edge that would otherwise close a path
 #define TOLERANCE (1.0e-20)
 #define NEAR_ZERO(val) (((val) > -TOLERANCE) && ((val) < TOLERANCE))
 
-// Output polygon.
-struct OutRec {
-  int       Idx;
-  bool      IsHole;
-  bool      IsOpen;
-  //The 'FirstLeft' field points to another OutRec that contains or is the
-  //'parent' of OutRec. It is 'first left' because the ActiveEdgeList (AEL) is
-  //parsed left from the current edge (owning OutRec) until the owner OutRec
-  //is found. This field simplifies sorting the polygons into a tree structure
-  //which reflects the parent/child relationships of all polygons.
-  //This field should be renamed Parent, and will be later.
-  OutRec   *FirstLeft;
-  // Used only by void Clipper::BuildResult2(PolyTree& polytree)
-  PolyNode *PolyNd;
-  // Linked list of output points, dynamically allocated.
-  OutPt    *Pts;
-  OutPt    *BottomPt;
-};
-
 //------------------------------------------------------------------------------
 
 inline IntPoint IntPoint2d(cInt x, cInt y)
@@ -1061,8 +1042,6 @@ IntRect ClipperBase::GetBounds()
 Clipper::Clipper(int initOptions) : 
   ClipperBase(),
   m_OutPtsFree(nullptr),
-  m_OutPtsChunkSize(32),
-  m_OutPtsChunkLast(32),
   m_ActiveEdges(nullptr),
   m_SortedEdges(nullptr)
 {
@@ -1192,27 +1171,16 @@ OutPt* Clipper::AllocateOutPt()
     // Recycle some of the already released points.
     pt = m_OutPtsFree;
     m_OutPtsFree = pt->Next;
-  } else if (m_OutPtsChunkLast < m_OutPtsChunkSize) {
-    // Get a point from the last chunk.
-    pt = m_OutPts.back() + (m_OutPtsChunkLast ++);
-  } else {
-    // The last chunk is full. Allocate a new one.
-    m_OutPts.push_back(new OutPt[m_OutPtsChunkSize]);
-    m_OutPtsChunkLast = 1;
-    pt = m_OutPts.back();
-  }
+  } else
+    pt = m_OutPts.allocate();
   return pt;
 }
 
 void Clipper::DisposeAllOutRecs()
 {
-  for (OutPt *pts : m_OutPts)
-    delete[] pts;
-  for (OutRec *rec : m_PolyOuts)
-    delete rec;
   m_OutPts.clear();
   m_OutPtsFree = nullptr;
-  m_OutPtsChunkLast = m_OutPtsChunkSize;
+  m_OutRecs.clear();
   m_PolyOuts.clear();
 }
 //------------------------------------------------------------------------------
@@ -1991,7 +1959,7 @@ void Clipper::AppendPolygon(TEdge *e1, TEdge *e2) const
 
 OutRec* Clipper::CreateOutRec()
 {
-  OutRec* result = new OutRec;
+  OutRec* result = m_OutRecs.allocate();
   result->IsHole = false;
   result->IsOpen = false;
   result->FirstLeft = 0;
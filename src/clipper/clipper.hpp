@@ -50,6 +50,7 @@
 //use_deprecated: Enables temporary support for the obsolete functions
 //#define use_deprecated  
 
+#include <algorithm>
 #include <vector>
 #include <deque>
 #include <stdexcept>
@@ -277,7 +278,25 @@ enum EdgeSide { esLeft = 1, esRight = 2};
     OutPt    *Prev;
   };
 
-  struct OutRec;
+  // Output polygon.
+  struct OutRec {
+    int       Idx;
+    bool      IsHole;
+    bool      IsOpen;
+    //The 'FirstLeft' field points to another OutRec that contains or is the
+    //'parent' of OutRec. It is 'first left' because the ActiveEdgeList (AEL) is
+    //parsed left from the current edge (owning OutRec) until the owner OutRec
+    //is found. This field simplifies sorting the polygons into a tree structure
+    //which reflects the parent/child relationships of all polygons.
+    //This field should be renamed Parent, and will be later.
+    OutRec   *FirstLeft;
+    // Used only by void Clipper::BuildResult2(PolyTree& polytree)
+    PolyNode *PolyNd;
+    // Linked list of output points, dynamically allocated.
+    OutPt    *Pts;
+    OutPt    *BottomPt;
+  };
+
   struct Join {
     Join(OutPt *OutPt1, OutPt *OutPt2, IntPoint OffPt) :
       OutPt1(OutPt1), OutPt2(OutPt2), OffPt(OffPt) {}
@@ -285,6 +304,42 @@ enum EdgeSide { esLeft = 1, esRight = 2};
     OutPt    *OutPt2;
     IntPoint  OffPt;
   };
+
+  // Allocator of objects by chunks of geometrically growing size, all the objects are released at once by clear().
+  // Replaces allocating the output polygons and points one by one on the heap, which dominated the cost
+  // of clipping operations producing many small polygons. Destructors of T are not called.
+  template<typename T>
+  class ChunkedAllocator {
+  public:
+    ChunkedAllocator() = default;
+    ChunkedAllocator(const ChunkedAllocator&) = delete;
+    ChunkedAllocator& operator=(const ChunkedAllocator&) = delete;
+    ~ChunkedAllocator() { clear(); }
+
+    T* allocate() {
+      if (m_last == m_chunk_size) {
+        // The last chunk is full. Allocate a new one, twice the size of the previous one.
+        m_chunk_size = m_chunks.empty() ? initial_chunk_size : std::min(2 * m_chunk_size, max_chunk_size);
+        m_chunks.push_back(new T[m_chunk_size]);
+        m_last = 0;
+      }
+      return m_chunks.back() + (m_last ++);
+    }
+    void clear() {
+      for (T *chunk : m_chunks)
+        delete[] chunk;
+      m_chunks.clear();
+      m_chunk_size = 0;
+      m_last       = 0;
+    }
+
+  private:
+    static constexpr size_t initial_chunk_size = 32;
+    static constexpr size_t max_chunk_size     = 4096;
+    std::vector<T*> m_chunks;
+    size_t          m_chunk_size { 0 };
+    size_t          m_last { 0 };
+  };
 // }; // namespace Internal
 
 //------------------------------------------------------------------------------
@@ -425,12 +480,12 @@ private:
   
   // Output polygons.
   std::vector<OutRec*>  m_PolyOuts;
-  // Output points, allocated by a continuous sets of m_OutPtsChunkSize.
-  std::vector<OutPt*>   m_OutPts;
+  // Storage of m_PolyOuts.
+  ChunkedAllocator<OutRec> m_OutRecs;
+  // Output points, allocated by chunks.
+  ChunkedAllocator<OutPt> m_OutPts;
   // List of free output points, to be used before taking a point from m_OutPts or allocating a new chunk.
   OutPt                *m_OutPtsFree;
-  size_t                m_OutPtsChunkSize;
-  size_t                m_OutPtsChunkLast;
 
   std::vector<Join>     m_Joins;
   std::vector<Join>     m_GhostJoins;
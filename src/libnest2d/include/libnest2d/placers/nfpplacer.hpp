@@ -765,110 +765,89 @@ public:
                 using OptResults = std::vector<OptResult>;
 
                 // Local optimization with the four polygon corners as
-                // starting points
+                // starting points. The starting points of all the nfp
+                // contours and their holes are optimized in one parallel
+                // run and the results are evaluated in the contour order.
+                std::vector<Optimum> starts;
+                std::vector<size_t> group_begins;
+                group_begins.reserve(ecache.size() + 1);
+
                 for(unsigned ch = 0; ch < ecache.size(); ch++) {
                     auto& cache = ecache[ch];
 
-                    OptResults results(cache.corners().size());
+                    group_begins.emplace_back(starts.size());
+                    for(double pos : cache.corners())
+                        starts.emplace_back(pos, ch, -1);
 
-                    auto& rofn = rawobjfunc;
-                    auto& nfpoint = getNfpPoint;
-                    float accuracy = config_.accuracy;
+                    for(unsigned hidx = 0; hidx < cache.holeCount(); ++hidx) {
+                        group_begins.emplace_back(starts.size());
+                        for(double pos : cache.corners(hidx))
+                            starts.emplace_back(pos, ch, int(hidx));
+                    }
+                }
+                group_begins.emplace_back(starts.size());
 
-                    __parallel::enumerate(
-                                cache.corners().begin(),
-                                cache.corners().end(),
-                                [&results, &item, &rofn, &nfpoint, ch, accuracy]
-                                (double pos, size_t n)
-                    {
-                        Optimizer solver(accuracy);
-
-                        Item itemcpy = item;
-                        auto contour_ofn = [&rofn, &nfpoint, ch, &itemcpy]
-                                (double relpos)
-                        {
-                            Optimum op(relpos, ch);
-                            return rofn(nfpoint(op), itemcpy);
-                        };
-
-                        try {
-                            results[n] = solver.optimize_min(contour_ofn,
-                                            opt::initvals<double>(pos),
-                                            opt::bound<double>(0, 1.0)
-                                            );
-                        } catch(std::exception& e) {
-                            derr() << "ERROR: " << e.what() << "\n";
-                        }
-                    }, policy);
+                OptResults results(starts.size());
+
+                auto& rofn = rawobjfunc;
+                auto& nfpoint = getNfpPoint;
+                float accuracy = config_.accuracy;
 
-                    auto resultcomp =
-                            []( const OptResult& r1, const OptResult& r2 ) {
-                        return r1.score < r2.score;
+                __parallel::enumerate(
+                            starts.begin(),
+                            starts.end(),
+                            [&results, &item, &rofn, &nfpoint, accuracy]
+                            (const Optimum& start, size_t n)
+                {
+                    Optimizer solver(accuracy);
+
+                    Item itemcpy = item;
+                    unsigned ch = start.nfpidx;
+                    int hidx = start.hidx;
+                    auto contour_ofn = [&rofn, &nfpoint, ch, hidx, &itemcpy]
+                            (double relpos)
+                    {
+                        Optimum op(relpos, ch, hidx);
+                        return rofn(nfpoint(op), itemcpy);
                     };
 
-                    auto mr = *std::min_element(results.begin(), results.end(),
-                                                resultcomp);
+                    try {
+                        results[n] = solver.optimize_min(contour_ofn,
+                                        opt::initvals<double>(start.relpos),
+                                        opt::bound<double>(0, 1.0)
+                                        );
+                    } catch(std::exception& e) {
+                        derr() << "ERROR: " << e.what() << "\n";
+                    }
+                }, policy);
+
+                auto resultcomp =
+                        []( const OptResult& r1, const OptResult& r2 ) {
+                    return r1.score < r2.score;
+                };
+
+                for(size_t g = 0; g + 1 < group_begins.size(); ++g) {
+                    size_t from = group_begins[g], to = group_begins[g + 1];
+
+                    // A contour or a hole without corners has nothing to offer
+                    if(from == to) continue;
 
-                    if(mr.score < best_score) {
-                        Optimum o(std::get<0>(mr.optimum), ch, -1);
+                    auto mr = std::min_element(results.begin() + from,
+                                               results.begin() + to,
+                                               resultcomp);
+
+                    if(mr->score < best_score) {
+                        const Optimum &start = starts[from];
+                        Optimum o(std::get<0>(mr->optimum), start.nfpidx,
+                                  start.hidx);
                         double miss = boundaryCheck(o);
-                        if(miss <= 0) {
-                            best_score = mr.score;
+                        if(miss <= 0.0) {
+                            best_score = mr->score;
                             optimum = o;
                         } else {
                             best_overfit = std::min(miss, best_overfit);
                         }
                     }
-
-                    for(unsigned hidx = 0; hidx < cache.holeCount(); ++hidx) {
-                        results.clear();
-                        results.resize(cache.corners(hidx).size());
-
-                        // TODO : use parallel for
-                        __parallel::enumerate(cache.corners(hidx).begin(),
-                                      cache.corners(hidx).end(),
-                                      [&results, &item, &nfpoint,
-                                       &rofn, ch, hidx, accuracy]
-                                      (double pos, size_t n)
-                        {
-                            Optimizer solver(accuracy);
-
-                            Item itmcpy = item;
-                            auto hole_ofn =
-                                    [&rofn, &nfpoint, ch, hidx, &itmcpy]
-                                    (double pos)
-                            {
-                                Optimum opt(pos, ch, hidx);
-                                return rofn(nfpoint(opt), itmcpy);
-                            };
-
-                            try {
-                                results[n] = solver.optimize_min(hole_ofn,
-                                                opt::initvals<double>(pos),
-                                                opt::bound<double>(0, 1.0)
-                                                );
-
-                            } catch(std::exception& e) {
-                                derr() << "ERROR: " << e.what() << "\n";
-                            }
-                        }, policy);
-
-                        auto hmr = *std::min_element(results.begin(),
-                                                    results.end(),
-                                                    resultcomp);
-
-                        if(hmr.score < best_score) {
-                            Optimum o(std::get<0>(hmr.optimum),
-                                      ch, hidx);
-                            double miss = boundaryCheck(o);
-                            if(miss <= 0.0) {
-                                best_score = hmr.score;
-                                optimum = o;
-                            } else {
-                                best_overfit = std::min(miss, best_overfit);
-                            }
-                        }
-                    }
                 }
 
                 if( best_score < global_score ) {
@@ -7,6 +7,7 @@
 #define slic3r_AABBTreeIndirect_hpp_
 
 #include <algorithm>
+#include <cstdint>
 #include <limits>
 #include <type_traits>
 #include <vector>
@@ -260,18 +261,47 @@ namespace detail {
 		std::vector<igl::Hit>				 hits;
 	};
 
+	// Up to max_size rays traversing the AABB tree together, see intersect_rays_first_hit().
+	template<typename AVertexType, typename AIndexedFaceType, typename ATreeType, typename AVectorType>
+	struct RayPacketIntersector {
+		using VertexType 		= AVertexType;
+		using IndexedFaceType 	= AIndexedFaceType;
+		using TreeType			= ATreeType;
+		using VectorType 		= AVectorType;
+		using Scalar 			= typename VectorType::Scalar;
+		// One bit of an uint32_t mask per ray.
+		static constexpr size_t max_size = 32;
+
+		const std::vector<VertexType> 		&vertices;
+		const std::vector<IndexedFaceType> 	&faces;
+		const TreeType 						&tree;
+
+		size_t 								 size;
+		const VectorType					*origins;
+		const VectorType 					*dirs;
+		VectorType 							 invdirs[max_size];
+		// Parameter of the closest hit found so far for each ray.
+		Scalar 								 min_t[max_size];
+		igl::Hit 							*hits;
+
+		// epsilon for ray-triangle intersection, see intersect_triangle1()
+		const double  						 eps;
+	};
+
 	//FIXME implement SSE for float AABB trees with float ray queries.
 	// SSE/SSE2 is supported by any Intel/AMD x64 processor.
 	// SSE support requires 16 byte alignment of the AABB nodes, representing the bounding boxes with 4+4 floats,
 	// storing the node index as the 4th element of the bounding box min value etc.
 	// https://www.flipcode.com/archives/SSE_RayBox_Intersection_Test.shtml
+	// Returns the ray parameter, at which the ray enters the box, in t_entry.
 	template <typename Derivedsource, typename Deriveddir, typename Scalar>
 	inline bool ray_box_intersect_invdir(
   		const Eigen::MatrixBase<Derivedsource> 	&origin,
   		const Eigen::MatrixBase<Deriveddir> 	&inv_dir,
   		Eigen::AlignedBox<Scalar,3> 			 box,
   		const Scalar 							&t0,
-  		const Scalar 							&t1) {
+  		const Scalar 							&t1,
+  		Scalar 									&t_entry) {
 		// http://people.csail.mit.edu/amy/papers/box-jgt.pdf
 		// "An Efficient and Robust Ray–Box Intersection Algorithm"
 		if (inv_dir.x() < 0)
@@ -302,9 +332,21 @@ namespace detail {
 			tmin = tzmin;
 		if (tzmax < tmax)
 			tmax = tzmax;
+		t_entry = tmin;
         return tmin < t1 && tmax > t0;
 	}
 
+	template <typename Derivedsource, typename Deriveddir, typename Scalar>
+	inline bool ray_box_intersect_invdir(
+  		const Eigen::MatrixBase<Derivedsource> 	&origin,
+  		const Eigen::MatrixBase<Deriveddir> 	&inv_dir,
+  		const Eigen::AlignedBox<Scalar,3> 		&box,
+  		const Scalar 							&t0,
+  		const Scalar 							&t1) {
+		Scalar t_entry;
+		return ray_box_intersect_invdir(origin, inv_dir, box, t0, t1, t_entry);
+	}
+
 	// The following intersect_triangle() is derived from raytri.c routine intersect_triangle1()
 	// Ray-Triangle Intersection Test Routines
 	// Different optimizations of my and Ben Trumbore's
@@ -392,18 +434,20 @@ namespace detail {
 		return eps;
 	}
 
+	// Front to back traversal: the child box entered first by the ray is visited first, the other child is skipped
+	// if the ray enters it behind the closest hit found so far.
+	// Of the triangles hit at the same distance (for example at a shared edge), the one with the lowest index is reported,
+	// so that the result does not depend on the traversal order and matches intersect_ray_packet_recursive_first_hit().
+	// The caller has already verified that the ray hits the bounding box of node_idx before min_t.
     template<typename RayIntersectorType, typename Scalar>
 	static inline bool intersect_ray_recursive_first_hit(
         RayIntersectorType 	   &ray_intersector,
         size_t 				    node_idx,
-        Scalar                  min_t,
+        Scalar                 &min_t,
         igl::Hit 			   &hit)
 	{
         const auto &node = ray_intersector.tree.node(node_idx);
         assert(node.is_valid());
-		
-        if (! ray_box_intersect_invdir(ray_intersector.origin, ray_intersector.invdir, node.bbox.template cast<Scalar>(), Scalar(0), min_t))
-			return false;
 
 	  	if (node.is_leaf()) {
 		    // shoot ray, record hit
@@ -413,29 +457,76 @@ namespace detail {
 		    		ray_intersector.origin, ray_intersector.dir, 
 		    		ray_intersector.vertices[face(0)], ray_intersector.vertices[face(1)], ray_intersector.vertices[face(2)], 
                     t, u, v, ray_intersector.eps)
-		    	&& t > 0.) {
-                hit = igl::Hit { int(node.idx), -1, float(u), float(v), float(t) };
+		    	&& t > 0. && (Scalar(t) < min_t || (Scalar(t) == min_t && int(node.idx) < hit.id))) {
+                min_t = Scalar(t);
+                hit   = igl::Hit { int(node.idx), -1, float(u), float(v), float(t) };
 				return true;
 		    } else
 		    	return false;
+	  	} else {
+			// Left / right child node index.
+			size_t child[2] = { node_idx * 2 + 1, node_idx * 2 + 2 };
+			Scalar t_entry[2];
+			bool   hit_box[2];
+			for (int i = 0; i < 2; ++ i)
+				hit_box[i] = ray_box_intersect_invdir(ray_intersector.origin, ray_intersector.invdir, 
+					ray_intersector.tree.node(child[i]).bbox.template cast<Scalar>(), Scalar(0), std::numeric_limits<Scalar>::infinity(), t_entry[i]) &&
+					t_entry[i] <= min_t;
+			if (hit_box[0] && hit_box[1] && t_entry[1] < t_entry[0]) {
+				std::swap(child[0], child[1]);
+				std::swap(t_entry[0], t_entry[1]);
+			}
+			bool ret = false;
+			for (int i = 0; i < 2; ++ i)
+				// min_t may have been reduced by the hit in the first child.
+				if (hit_box[i] && t_entry[i] <= min_t)
+					ret |= intersect_ray_recursive_first_hit(ray_intersector, child[i], min_t, hit);
+			return ret;
+		}
+	}
+
+    template<typename RayPacketIntersectorType>
+	static inline void intersect_ray_packet_recursive_first_hit(RayPacketIntersectorType &packet, size_t node_idx, uint32_t mask)
+	{
+        using Scalar = typename RayPacketIntersectorType::Scalar;
+
+        const auto &node = packet.tree.node(node_idx);
+        assert(node.is_valid());
+
+		// Only the rays hitting the bounding box not behind their closest hit found so far descend into the node.
+		// Ties are resolved to the lowest triangle index the same way as in intersect_ray_recursive_first_hit().
+		const Eigen::AlignedBox<Scalar, 3> bbox = node.bbox.template cast<Scalar>();
+		uint32_t active = 0;
+		for (size_t i = 0; i < packet.size; ++ i) {
+			Scalar t_entry;
+			if (((mask >> i) & 1) && 
+				ray_box_intersect_invdir(packet.origins[i], packet.invdirs[i], bbox, Scalar(0), std::numeric_limits<Scalar>::infinity(), t_entry) &&
+				t_entry <= packet.min_t[i])
+				active |= uint32_t(1) << i;
+		}
+		if (active == 0)
+			return;
+
+	  	if (node.is_leaf()) {
+            auto face = packet.faces[node.idx];
+			for (size_t i = 0; i < packet.size; ++ i)
+				if ((active >> i) & 1) {
+				    double t, u, v;
+				    if (intersect_triangle(
+				    		packet.origins[i], packet.dirs[i], 
+				    		packet.vertices[face(0)], packet.vertices[face(1)], packet.vertices[face(2)], 
+		                    t, u, v, packet.eps)
+				    	&& t > 0. && (Scalar(t) < packet.min_t[i] || (Scalar(t) == packet.min_t[i] && int(node.idx) < packet.hits[i].id))) {
+				    	packet.min_t[i] = Scalar(t);
+		                packet.hits[i]  = igl::Hit { int(node.idx), -1, float(u), float(v), float(t) };
+				    }
+				}
 	  	} else {
 			// Left / right child node index.
 			size_t left  = node_idx * 2 + 1;
 			size_t right = left + 1;
-			igl::Hit left_hit;
-			igl::Hit right_hit;
-	        bool left_ret = intersect_ray_recursive_first_hit(ray_intersector, left,  min_t, left_hit);
-			if (left_ret && left_hit.t < min_t) {
-	    		min_t = left_hit.t;
-	    		hit   = left_hit;
-	  		} else
-			    left_ret = false;
-	        bool right_ret = intersect_ray_recursive_first_hit(ray_intersector, right, min_t, right_hit);
-			if (right_ret && right_hit.t < min_t)
-				hit = right_hit;
-			else
-				right_ret = false;
-			return left_ret || right_ret;
+			intersect_ray_packet_recursive_first_hit(packet, left,  active);
+			intersect_ray_packet_recursive_first_hit(packet, right, active);
 		}
 	}
 
@@ -742,8 +833,54 @@ inline bool intersect_ray_first_hit(
         origin, dir, VectorType(dir.cwiseInverse()),
         eps
 	};
-	return ! tree.empty() && detail::intersect_ray_recursive_first_hit(
-        ray_intersector, size_t(0), std::numeric_limits<Scalar>::infinity(), hit);
+	Scalar min_t = std::numeric_limits<Scalar>::infinity();
+	return ! tree.empty() && 
+		detail::ray_box_intersect_invdir(ray_intersector.origin, ray_intersector.invdir, tree.node(0).bbox.template cast<Scalar>(), Scalar(0), min_t) &&
+		detail::intersect_ray_recursive_first_hit(ray_intersector, size_t(0), min_t, hit);
+}
+
+// Find a first intersection of each ray of a batch with indexed triangle set, see intersect_ray_first_hit().
+// The rays are traversed through the AABB tree in packets, so that each node is fetched once for a packet of rays
+// and the rays missing its bounding box are masked out, which pays off for coherent rays,
+// for example rays shot from a single point into a hemisphere.
+// hits[i].id is set to -1 for rays not hitting anything. Returns the number of rays hitting.
+template<typename VertexType, typename IndexedFaceType, typename TreeType, typename VectorType>
+inline size_t intersect_rays_first_hit(
+	// Indexed triangle set - 3D vertices.
+	const std::vector<VertexType> 		&vertices,
+	// Indexed triangle set - triangular faces, references to vertices.
+	const std::vector<IndexedFaceType> 	&faces,
+	// AABBTreeIndirect::Tree over vertices & faces, bounding boxes built with the accuracy of vertices.
+	const TreeType 						&tree,
+	// Origins of the rays.
+	const std::vector<VectorType>		&origins,
+	// Directions of the rays.
+	const std::vector<VectorType> 		&dirs,
+	// First intersection of each ray with the indexed triangle set.
+	std::vector<igl::Hit> 				&hits,
+	// Epsilon for the ray-triangle intersection, it should be proportional to an average triangle edge length.
+	const double 						 eps = 0.000001)
+{
+    using Scalar = typename VectorType::Scalar;
+    using Packet = detail::RayPacketIntersector<VertexType, IndexedFaceType, TreeType, VectorType>;
+	assert(origins.size() == dirs.size());
+	hits.assign(origins.size(), igl::Hit { -1, -1, 0.f, 0.f, 0.f });
+	if (tree.empty())
+		return 0;
+
+	size_t num_hits = 0;
+	for (size_t begin = 0; begin < origins.size(); begin += Packet::max_size) {
+		Packet packet { vertices, faces, tree, std::min(Packet::max_size, origins.size() - begin), origins.data() + begin, dirs.data() + begin, {}, {}, hits.data() + begin, eps };
+		for (size_t i = 0; i < packet.size; ++ i) {
+			packet.invdirs[i] = VectorType(packet.dirs[i].cwiseInverse());
+			packet.min_t[i]   = std::numeric_limits<Scalar>::infinity();
+		}
+		detail::intersect_ray_packet_recursive_first_hit(packet, 0, packet.size == Packet::max_size ? uint32_t(-1) : (uint32_t(1) << packet.size) - 1);
+		for (size_t i = 0; i < packet.size; ++ i)
+			if (packet.hits[i].id >= 0)
+				++ num_hits;
+	}
+	return num_hits;
 }
 
 // Find all intersections of a ray with indexed triangle set.
@@ -308,7 +308,7 @@ public:
         tree = AABBTreeLines::build_aabb_tree_over_indexed_lines(this->lines);
     }
 
-    explicit LinesDistancer(std::vector<LineType> &&lines) : lines(lines)
+    explicit LinesDistancer(std::vector<LineType> &&lines) : lines(std::move(lines))
     {
         tree = AABBTreeLines::build_aabb_tree_over_indexed_lines(this->lines);
     }
@@ -339,6 +339,30 @@ public:
         return {distance, nearest_line_index_out, nearest_point_out};
     }
 
+    // Variant of distance_from_lines_extra() for spatially coherent queries, such as the consecutive points of a polyline.
+    // The distance to the line hint_line_idx (typically the closest line of the previous query) bounds the search,
+    // thus most of the tree is culled. Returns the same distance as distance_from_lines_extra(point).
+    template<bool SIGNED_DISTANCE>
+    std::tuple<Floating, size_t, Vec<2, Floating>> distance_from_lines_extra(const Vec<2, Scalar> &point, size_t hint_line_idx) const
+    {
+        if (hint_line_idx >= lines.size())
+            return distance_from_lines_extra<SIGNED_DISTANCE>(point);
+
+        Vec<2, Scalar>   hint_point;
+        Floating         hint_distance          = line_alg::distance_to_squared(lines[hint_line_idx], point, &hint_point);
+        size_t           nearest_line_index_out = hint_line_idx;
+        Vec<2, Floating> nearest_point_out      = hint_point.template cast<Floating>();
+        Vec<2, Floating> p                      = point.template cast<Floating>();
+        // Returns hint_distance if no line is closer than the hint line, leaving the outputs at the hint line.
+        Floating         distance = std::sqrt(AABBTreeLines::squared_distance_to_indexed_lines(lines, tree, p, nearest_line_index_out,
+                                                                                                nearest_point_out, hint_distance));
+        if (SIGNED_DISTANCE) {
+            distance *= outside(point);
+        }
+
+        return {distance, nearest_line_index_out, nearest_point_out};
+    }
+
     template<bool SIGNED_DISTANCE> Floating distance_from_lines(const Vec<2, typename LineType::Scalar> &point) const
     {
         auto [dist, idx, np] = distance_from_lines_extra<SIGNED_DISTANCE>(point);
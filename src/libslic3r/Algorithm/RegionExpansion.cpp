@@ -7,6 +7,9 @@
 
 #include <numeric>
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
 namespace Slic3r {
 namespace Algorithm {
 
@@ -386,24 +389,45 @@ static Polygons propagate_wave_from_boundary(
 // Resulting regions are sorted by boundary id and source id.
 std::vector<RegionExpansion> propagate_waves(const WaveSeeds &seeds, const ExPolygons &boundary, const RegionExpansionParameters &params)
 {
-    std::vector<RegionExpansion> out;
-    ClipperLib::Paths            paths;
-    ClipperLib::ClipperOffset co;
-    co.ArcTolerance       = params.arc_tolerance;
-    co.ShortestEdgeLength = params.shortest_edge_length;
-    for (auto it_seed = seeds.begin(); it_seed != seeds.end();) {
-        auto it = it_seed;
-        paths.clear();
-        for (; it != seeds.end() && it->boundary == it_seed->boundary && it->src == it_seed->src; ++ it)
-            paths.emplace_back(it->path);
-        // Propagate the wavefront while clipping it with the trimmed boundary.
-        // Collect the expanded polygons, merge them with the source polygons.
-        RegionExpansion re;
-        for (Polygon &polygon : propagate_wave_from_boundary(co, paths, boundary[it_seed->boundary], params.initial_step, params.other_step, params.num_other_steps, params.max_inflation))
-            out.push_back({ std::move(polygon), it_seed->src, it_seed->boundary });
-        it_seed = it;
+    // Seeds of a single source expanding into a single boundary, <begin, end) indices into seeds.
+    std::vector<std::pair<size_t, size_t>> seed_groups;
+    for (size_t begin = 0; begin < seeds.size();) {
+        size_t end = begin + 1;
+        for (; end < seeds.size() && seeds[end].boundary == seeds[begin].boundary && seeds[end].src == seeds[begin].src; ++ end) ;
+        seed_groups.emplace_back(begin, end);
+        begin = end;
     }
 
+    // Each source x boundary pair is wave expanded independently, thus the seed groups are processed in parallel.
+    std::vector<Polygons> expanded(seed_groups.size());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, seed_groups.size()),
+        [&seeds, &boundary, &params, &seed_groups, &expanded](const tbb::blocked_range<size_t> &range) {
+            ClipperLib::Paths         paths;
+            ClipperLib::ClipperOffset co;
+            co.ArcTolerance       = params.arc_tolerance;
+            co.ShortestEdgeLength = params.shortest_edge_length;
+            for (size_t igroup = range.begin(); igroup < range.end(); ++ igroup) {
+                const auto [begin, end] = seed_groups[igroup];
+                paths.clear();
+                for (size_t i = begin; i < end; ++ i)
+                    paths.emplace_back(seeds[i].path);
+                // Propagate the wavefront while clipping it with the trimmed boundary.
+                expanded[igroup] = propagate_wave_from_boundary(co, paths, boundary[seeds[begin].boundary],
+                    params.initial_step, params.other_step, params.num_other_steps, params.max_inflation);
+            }
+        });
+
+    // Collect the expanded polygons in the order of the seeds.
+    std::vector<RegionExpansion> out;
+    size_t                       num_polygons = 0;
+    for (const Polygons &polygons : expanded)
+        num_polygons += polygons.size();
+    out.reserve(num_polygons);
+    for (size_t igroup = 0; igroup < seed_groups.size(); ++ igroup) {
+        const WaveSeed &seed = seeds[seed_groups[igroup].first];
+        for (Polygon &polygon : expanded[igroup])
+            out.push_back({ std::move(polygon), seed.src, seed.boundary });
+    }
     return out;
 }
 
@@ -1,6 +1,7 @@
 #include "libslic3r/libslic3r.h"
 #include "libslic3r/Utils.hpp"
 #include "AppConfig.hpp"
+#include "DeferredWriter.hpp"
 #include "Exception.hpp"
 #include "LocalesUtils.hpp"
 #include "Thread.hpp"
@@ -92,6 +93,12 @@ void AppConfig::set_defaults()
         if (get("export_sources_full_pathnames").empty())
             set("export_sources_full_pathnames", "0");
 
+        if (get("export_gcode_result_cache").empty())
+            set("export_gcode_result_cache", "0");
+
+        if (get("autosave_project").empty())
+            set("autosave_project", "0");
+
 #ifdef _WIN32
         if (get("associate_3mf").empty())
             set("associate_3mf", "0");
@@ -201,6 +208,9 @@ void AppConfig::set_defaults()
     if (get("allow_ip_resolve").empty())
         set("allow_ip_resolve", "1");
 
+    if (get("print_host_upload_threads").empty())
+        set("print_host_upload_threads", "4");
+
 #ifdef _WIN32
     if (get("use_legacy_3DConnexion").empty())
         set("use_legacy_3DConnexion", "0");
@@ -420,19 +430,39 @@ void AppConfig::save()
     if (! is_main_thread_active())
         throw CriticalException("Calling AppConfig::save() from a worker thread!");
 
-    // The config is first written to a file with a PID suffix and then moved
-    // to avoid race conditions with multiple instances of Slic3r
-    const auto path = config_path();
-    std::string path_pid = (boost::format("%1%.%2%") % path % get_current_pid()).str();
+    if (m_deferred_writer != nullptr)
+        // Don't let a write scheduled by save_deferred() overwrite this one.
+        m_deferred_writer->flush(config_path());
+    write_file(config_path(), this->serialize());
+    m_dirty = false;
+}
+
+void AppConfig::save_deferred()
+{
+    if (! is_main_thread_active())
+        throw CriticalException("Calling AppConfig::save_deferred() from a worker thread!");
 
+    if (m_deferred_writer == nullptr) {
+        this->save();
+        return;
+    }
+    // Serialize here, the background thread must not access m_storage. Writing the file is the slow part.
+    std::string path = config_path();
+    m_deferred_writer->schedule(path, [path, content = this->serialize()]() { write_file(path, content); }, std::chrono::milliseconds(500));
+    m_dirty = false;
+}
+
+std::string AppConfig::serialize() const
+{
     std::stringstream config_ss;
     if (m_mode == EAppMode::Editor)
         config_ss << "# " << Slic3r::header_slic3r_generated() << std::endl;
     else
         config_ss << "# " << Slic3r::header_gcodeviewer_generated() << std::endl;
     // Make sure the "no" category is written first.
-    for (const auto& kvp : m_storage[""])
-        config_ss << kvp.first << " = " << kvp.second << std::endl;
+    if (auto it = m_storage.find(""); it != m_storage.end())
+        for (const auto& kvp : it->second)
+            config_ss << kvp.first << " = " << kvp.second << std::endl;
     // Write the other categories.
     for (const auto& category : m_storage) {
     	if (category.first.empty())
@@ -459,7 +489,15 @@ void AppConfig::save()
     // One empty line before the MD5 sum.
     config_ss << std::endl;
 
-    std::string config_str = config_ss.str();
+    return config_ss.str();
+}
+
+void AppConfig::write_file(const std::string &path, const std::string &config_str)
+{
+    // The config is first written to a file with a PID suffix and then moved
+    // to avoid race conditions with multiple instances of Slic3r
+    std::string path_pid = (boost::format("%1%.%2%") % path % get_current_pid()).str();
+
     boost::nowide::ofstream c;
     c.open(path_pid, std::ios::out | std::ios::trunc);
     c << config_str;
@@ -484,7 +522,6 @@ void AppConfig::save()
     // On Windows, the rename is likely NOT atomic, thus it may fail if PrusaSlicer crashes on another thread in the meanwhile.
     // To cope with that, we already made a backup of the config on Windows.
     rename_file(path_pid, path);
-    m_dirty = false;
 }
 
 bool AppConfig::erase(const std::string &section, const std::string &key)
@@ -12,6 +12,8 @@
 
 namespace Slic3r {
 
+class DeferredWriter;
+
 class AppConfig
 {
 public:
@@ -39,6 +41,11 @@ public:
 	std::string         load(const std::string &path);
 	// Store the slic3r.ini into a user profile directory (or a datadir, if configured).
 	void 			   	save();
+	// Store the slic3r.ini on the thread of the deferred writer, coalescing saves following shortly after each other.
+	// The slic3r.ini is stored immediately if no deferred writer was set.
+	void 				save_deferred();
+	// Writer of save_deferred(). save() waits for the writes scheduled before, so that it is not overwritten by an older state.
+	void 				set_deferred_writer(DeferredWriter *writer) { m_deferred_writer = writer; }
 
 	// Does this config need to be saved?
 	bool 				dirty() const { return m_dirty; }
@@ -173,6 +180,11 @@ public:
     static const std::string SECTION_EMBOSS_STYLE;
 
 private:
+	// Content of the slic3r.ini file.
+	std::string 		serialize() const;
+	// Write the content into the slic3r.ini file at path through a temporary file.
+	static void 		write_file(const std::string &path, const std::string &content);
+
 	template<typename T>
 	bool get_3dmouse_device_numeric_value(const std::string &device_name, const char *parameter_name, T &out) const 
 	{
@@ -195,6 +207,8 @@ private:
 	VendorMap                                                   m_vendors;
 	// Has any value been modified since the config.ini has been last saved or loaded?
 	bool														m_dirty;
+	// Writer of save_deferred(), not owned.
+	DeferredWriter                                             *m_deferred_writer { nullptr };
 	// Original version found in the ini file before it was overwritten
 	Semver                                                      m_orig_version;
 	// Whether the existing version is before system profiles & configuration updating
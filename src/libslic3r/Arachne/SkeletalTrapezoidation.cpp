@@ -530,6 +530,7 @@ inline static std::unordered_map<Point, Point, PointHash> try_to_fix_degenerated
     const double                                  fix_angle)
 {
     std::unordered_map<Point, Point, PointHash> vertex_mapping;
+    polys_rotated = polys;
     for (Polygon &poly : polys_rotated)
         poly.rotate(fix_angle);
 
@@ -673,8 +674,9 @@ void SkeletalTrapezoidation::constructFromPolygons(const Polygons& polys)
     const double         fix_angle = PI / 6;
 
     std::unordered_map<Point, Point, PointHash> vertex_mapping;
+    // Rotated copy of polys, only filled in when the Voronoi diagram is degenerated.
     // polys_copy is referenced through items stored in the std::vector segments.
-    Polygons                                    polys_copy = polys;
+    Polygons                                    polys_copy;
     if (status != VoronoiDiagramStatus::NO_ISSUE_DETECTED) {
         if (status == VoronoiDiagramStatus::MISSING_VORONOI_VERTEX)
             BOOST_LOG_TRIVIAL(warning) << "Detected missing Voronoi vertex, input polygons will be rotated back and forth.";
@@ -698,6 +700,9 @@ void SkeletalTrapezoidation::constructFromPolygons(const Polygons& polys)
 
 process_voronoi_diagram:
     assert(this->graph.edges.empty() && this->graph.nodes.empty() && this->vd_edge_to_he_edge.empty() && this->vd_node_to_he_node.empty());
+    // Each Voronoi edge and vertex is transferred at most once, avoid rehashing while filling in the maps.
+    this->vd_edge_to_he_edge.reserve(voronoi_diagram.num_edges());
+    this->vd_node_to_he_node.reserve(voronoi_diagram.num_vertices());
     for (vd_t::cell_type cell : voronoi_diagram.cells()) {
         if (!cell.incident_edge())
             continue; // There is no spoon
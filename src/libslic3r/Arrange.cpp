@@ -1,4 +1,5 @@
 #include "Arrange.hpp"
+#include "ArrangeRaster.hpp"
 
 #include "BoundingBox.hpp"
 
@@ -9,6 +10,7 @@
 #include <libnest2d/utils/rotcalipers.hpp>
 
 #include <numeric>
+#include <optional>
 #include <ClipperUtils.hpp>
 
 #include <boost/geometry/index/rtree.hpp>
@@ -536,6 +538,21 @@ inline Circle to_nestbin(const CircleBed &c) { return Circle({c.center()(0), c.c
 inline ExPolygon to_nestbin(const Polygon &p) { return ExPolygon{p}; }
 inline Box to_nestbin(const InfiniteBed &bed) { return Box::infinite({bed.center.x(), bed.center.y()}); }
 
+// Bed shapes for the Raster engine, which only arranges on beds of a finite size.
+static std::optional<ExPolygon> to_raster_bed(const BoundingBox &bb) { return ExPolygon{ Polygon{ bb.min, { bb.max.x(), bb.min.y() }, bb.max, { bb.min.x(), bb.max.y() } } }; }
+static std::optional<ExPolygon> to_raster_bed(const CircleBed &c)
+{
+    // Inscribed polygon, so that the arranged items are inside the circle.
+    Polygon out;
+    for (size_t i = 0; i < 128; ++ i) {
+        const double angle = 2. * PI * double(i) / 128.;
+        out.points.emplace_back(c.center() + Point(coord_t(c.radius() * std::cos(angle)), coord_t(c.radius() * std::sin(angle))));
+    }
+    return ExPolygon{ std::move(out) };
+}
+static std::optional<ExPolygon> to_raster_bed(const Polygon &p) { return ExPolygon{ p }; }
+static std::optional<ExPolygon> to_raster_bed(const InfiniteBed &) { return std::nullopt; }
+
 inline coord_t width(const BoundingBox& box) { return box.max.x() - box.min.x(); }
 inline coord_t height(const BoundingBox& box) { return box.max.y() - box.min.y(); }
 inline double area(const BoundingBox& box) { return double(width(box)) * height(box); }
@@ -629,6 +646,12 @@ void arrange(ArrangePolygons &      arrangables,
              const ArrangeParams &  params)
 {
     namespace clppr = Slic3r::ClipperLib;
+
+    if (params.engine == ArrangeParams::Engine::Raster)
+        if (std::optional<ExPolygon> raster_bed = to_raster_bed(bed); raster_bed) {
+            arrange_raster(arrangables, excludes, *raster_bed, params);
+            return;
+        }
     
     std::vector<Item> items, fixeditems;
     items.reserve(arrangables.size());
@@ -110,6 +110,18 @@ enum class Pivots {
 
 struct ArrangeParams {
 
+    enum class Engine {
+        /// Precise arrangement by the no fit polygon placer of libnest2d.
+        NFP,
+        /// Fast arrangement of the rasterized item silhouettes, the items are spaced
+        /// a bit more than necessary due to the rasterization. Suitable for many items.
+        Raster
+    };
+    Engine engine = Engine::NFP;
+
+    /// Pixel size of the Raster engine. Zero derives the pixel size from the bed size.
+    coord_t raster_resolution = 0;
+
     /// The minimum distance which is allowed for any 
     /// pair of items on the print bed in any direction.
     coord_t min_obj_distance = 0;
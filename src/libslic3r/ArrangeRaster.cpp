@@ -0,0 +1,276 @@
+#include "ArrangeRaster.hpp"
+
+#include "BoundingBox.hpp"
+#include "ClipperUtils.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+#include <tbb/parallel_for.h>
+
+namespace Slic3r {
+namespace arrangement {
+
+namespace {
+
+// Bit mask of the rasterized pixels, a row of 64bit words per raster line.
+struct RasterMask
+{
+    int                   width  { 0 };
+    int                   height { 0 };
+    // Number of words per raster line. The bed masks are padded by two words at the end of each line,
+    // so that a line may be read at any bit offset up to the width.
+    int                   words  { 0 };
+    std::vector<uint64_t> bits;
+
+    RasterMask() = default;
+    RasterMask(int width, int height, int padding) :
+        width(width), height(height), words((width + 63) / 64 + padding), bits(size_t(words) * size_t(height), 0) {}
+
+    uint64_t*       row(int y)       { return bits.data() + size_t(y) * size_t(words); }
+    const uint64_t* row(int y) const { return bits.data() + size_t(y) * size_t(words); }
+    bool            test(int x, int y) const { return (this->row(y)[x >> 6] >> (x & 63)) & 1; }
+    void            set(int x, int y) { this->row(y)[x >> 6] |= uint64_t(1) << (x & 63); }
+};
+
+// Set the pixels of the mask with their centers inside the polygons (even-odd rule).
+// Pixel (x, y) of the mask spans origin + [x, x + 1) * resolution, origin + [y, y + 1) * resolution.
+static void rasterize(const Polygons &polygons, const Point &origin, coord_t resolution, RasterMask &mask)
+{
+    std::vector<double> intersections;
+    for (int y = 0; y < mask.height; ++ y) {
+        const double yc = double(origin.y()) + (double(y) + 0.5) * double(resolution);
+        intersections.clear();
+        for (const Polygon &polygon : polygons)
+            for (size_t i = 0, j = polygon.size() - 1; i < polygon.size(); j = i ++) {
+                const Point &a = polygon.points[j];
+                const Point &b = polygon.points[i];
+                if ((double(a.y()) <= yc) != (double(b.y()) <= yc))
+                    intersections.emplace_back(double(a.x()) + (yc - double(a.y())) * double(b.x() - a.x()) / double(b.y() - a.y()));
+            }
+        std::sort(intersections.begin(), intersections.end());
+        for (size_t i = 0; i + 1 < intersections.size(); i += 2) {
+            // Pixels with their centers inside <intersections[i], intersections[i + 1]>.
+            const double x0 = std::ceil ((intersections[i]     - double(origin.x())) / double(resolution) - 0.5);
+            const double x1 = std::floor((intersections[i + 1] - double(origin.x())) / double(resolution) - 0.5);
+            for (int x = int(std::max(0., x0)); x <= int(std::min(double(mask.width - 1), x1)); ++ x)
+                mask.set(x, y);
+        }
+    }
+}
+
+// Does the item placed with its raster origin at pixel (x0, y0) of the bed overlap the occupied pixels of the bed?
+static bool collides(const RasterMask &bed, const RasterMask &item, int x0, int y0)
+{
+    const int word0 = x0 >> 6;
+    const int shift = x0 & 63;
+    for (int y = 0; y < item.height; ++ y) {
+        const uint64_t *bed_row  = bed.row(y0 + y) + word0;
+        const uint64_t *item_row = item.row(y);
+        for (int k = 0; k < item.words; ++ k) {
+            const uint64_t window = shift == 0 ? bed_row[k] : (bed_row[k] >> shift) | (bed_row[k + 1] << (64 - shift));
+            if (window & item_row[k])
+                return true;
+        }
+    }
+    return false;
+}
+
+static void place(RasterMask &bed, const RasterMask &item, int x0, int y0)
+{
+    const int word0 = x0 >> 6;
+    const int shift = x0 & 63;
+    for (int y = 0; y < item.height; ++ y) {
+        uint64_t       *bed_row  = bed.row(y0 + y) + word0;
+        const uint64_t *item_row = item.row(y);
+        for (int k = 0; k < item.words; ++ k) {
+            bed_row[k] |= item_row[k] << shift;
+            if (shift != 0)
+                bed_row[k + 1] |= item_row[k] >> (64 - shift);
+        }
+    }
+}
+
+// Item rasterized at a single rotation.
+struct RasterItem
+{
+    double     rotation { 0. };
+    RasterMask mask;
+    // Position of the raster origin in the coordinate system of the rotated item.
+    Point      origin;
+    // A pixel of the item tested first to quickly reject the occupied positions.
+    int        probe_x { 0 };
+    int        probe_y { 0 };
+};
+
+static RasterItem rasterize_item(const Polygon &contour, double rotation, double inflation, coord_t resolution)
+{
+    RasterItem out;
+    out.rotation = rotation;
+    Polygon rotated = contour;
+    rotated.rotate(rotation);
+    Polygons inflated = offset(rotated, float(inflation));
+    BoundingBox bbox = get_extents(inflated);
+    out.origin = bbox.min;
+    out.mask   = RasterMask(int(bbox.size().x() / resolution) + 1, int(bbox.size().y() / resolution) + 1, 0);
+    rasterize(inflated, out.origin, resolution, out.mask);
+    // Probe the middle line first, it is most likely to hit the neighbors.
+    out.probe_y = out.mask.height / 2;
+    out.probe_x = -1;
+    for (int x = 0; x < out.mask.width && out.probe_x == -1; ++ x)
+        if (out.mask.test(x, out.probe_y))
+            out.probe_x = x;
+    if (out.probe_x == -1) {
+        // A degenerate item not covering any pixel center, let it cover at least a single pixel.
+        out.probe_x = out.mask.width / 2;
+        out.mask.set(out.probe_x, out.probe_y);
+    }
+    return out;
+}
+
+} // namespace
+
+void arrange_raster(ArrangePolygons &items, const ArrangePolygons &excludes, const ExPolygon &bed, const ArrangeParams &params)
+{
+    for (ArrangePolygon &item : items)
+        item.bed_idx = UNARRANGED;
+
+    // The items are inflated by half of the distance between the objects, thus the bed is inflated by the same distance
+    // and shrunk by the distance from the bed edges.
+    const coord_t  infl     = coord_t(std::ceil(params.min_obj_distance / 2.0));
+    const Polygons bed_area = offset(bed.contour, float(params.min_obj_distance / 2 - params.min_bed_distance));
+    if (bed_area.empty())
+        return;
+    const BoundingBox bed_bbox   = get_extents(bed_area);
+    const coord_t     resolution = params.raster_resolution > 0 ? params.raster_resolution :
+        std::max<coord_t>(scaled(0.1), std::max(bed_bbox.size().x(), bed_bbox.size().y()) / 512);
+    // Conservative rasterization: A pixel is occupied by an item if its center is closer than half of the pixel diagonal
+    // to the item, a pixel is free for the items if its center is farther than half of the pixel diagonal from the bed edge.
+    const double half_diagonal = 0.5 * std::sqrt(2.) * double(resolution);
+    const Point  origin        = bed_bbox.min;
+    const int    width         = int(bed_bbox.size().x() / resolution) + 1;
+    const int    height        = int(bed_bbox.size().y() / resolution) + 1;
+
+    RasterMask empty_bed(width, height, 2);
+    {
+        RasterMask free_pixels(width, height, 2);
+        rasterize(offset(bed_area, - float(half_diagonal)), origin, resolution, free_pixels);
+        for (size_t i = 0; i < empty_bed.bits.size(); ++ i)
+            empty_bed.bits[i] = ~ free_pixels.bits[i];
+    }
+    auto make_bed = [&](int bed_idx) {
+        RasterMask out = empty_bed;
+        for (const ArrangePolygon &fixed : excludes)
+            if (fixed.bed_idx == bed_idx) {
+                Polygon contour = fixed.poly.contour;
+                contour.rotate(fixed.rotation);
+                contour.translate(fixed.translation);
+                rasterize(offset(contour, float(infl - scaled(2. * EPSILON) + half_diagonal)), origin, resolution, out);
+            }
+        return out;
+    };
+
+    // Positions of the item centers ordered by their distance from the alignment pivot, the items are placed at the first free one.
+    Vec2d pivot;
+    switch (params.alignment) {
+    case Pivots::BottomLeft:  pivot = { 0.,            0. };             break;
+    case Pivots::TopLeft:     pivot = { 0.,            double(height) }; break;
+    case Pivots::BottomRight: pivot = { double(width), 0. };             break;
+    case Pivots::TopRight:    pivot = { double(width), double(height) }; break;
+    case Pivots::Center:
+    default:                  pivot = { 0.5 * width,   0.5 * height };   break;
+    }
+    std::vector<uint32_t> order(size_t(width) * size_t(height));
+    {
+        std::vector<float> distances(order.size());
+        for (int y = 0; y < height; ++ y)
+            for (int x = 0; x < width; ++ x)
+                distances[size_t(y) * width + x] = float((Vec2d(x + 0.5, y + 0.5) - pivot).squaredNorm());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&distances](uint32_t l, uint32_t r) { return distances[l] < distances[r]; });
+    }
+
+    std::vector<double> rotations { 0. };
+    if (params.allow_rotations)
+        for (int i = 1; i < 8; ++ i)
+            rotations.emplace_back(i * PI / 4.);
+
+    auto for_each_rotation = [&params, &rotations](auto &&fn) {
+        if (params.parallel && rotations.size() > 1)
+            tbb::parallel_for(tbb::blocked_range<size_t>(0, rotations.size(), 1), [&fn](const tbb::blocked_range<size_t> &range) {
+                for (size_t i = range.begin(); i < range.end(); ++ i)
+                    fn(i);
+            });
+        else
+            for (size_t i = 0; i < rotations.size(); ++ i)
+                fn(i);
+    };
+
+    // Find the first free position in the order over all the rotations of an item.
+    // Returns the index into the order and the index of the rotation, the index into the order is order.size() if the item does not fit.
+    auto find_position = [&](const RasterMask &bed_mask, const std::vector<RasterItem> &rasters) {
+        std::vector<size_t> ranks(rasters.size(), order.size());
+        for_each_rotation([&](size_t rotation_idx) {
+            const RasterItem &raster = rasters[rotation_idx];
+            if (raster.mask.width > width || raster.mask.height > height)
+                return;
+            for (size_t rank = 0; rank < order.size(); ++ rank) {
+                const int x0 = int(order[rank] % uint32_t(width))  - raster.mask.width  / 2;
+                const int y0 = int(order[rank] / uint32_t(width)) - raster.mask.height / 2;
+                if (x0 >= 0 && y0 >= 0 && x0 + raster.mask.width <= width && y0 + raster.mask.height <= height &&
+                    ! bed_mask.test(x0 + raster.probe_x, y0 + raster.probe_y) && ! collides(bed_mask, raster.mask, x0, y0)) {
+                    ranks[rotation_idx] = rank;
+                    break;
+                }
+            }
+        });
+        const size_t rotation_idx = std::min_element(ranks.begin(), ranks.end()) - ranks.begin();
+        return std::make_pair(ranks[rotation_idx], rotation_idx);
+    };
+
+    // First fit decreasing: Place the items with higher priority first, then the larger items first.
+    std::vector<size_t> sorted(items.size());
+    std::iota(sorted.begin(), sorted.end(), 0);
+    std::vector<double> areas(items.size());
+    for (size_t i = 0; i < items.size(); ++ i)
+        areas[i] = std::abs(items[i].poly.contour.area());
+    std::stable_sort(sorted.begin(), sorted.end(), [&items, &areas](size_t l, size_t r) {
+        return items[l].priority > items[r].priority || (items[l].priority == items[r].priority && areas[l] > areas[r]);
+    });
+
+    std::vector<RasterMask> beds;
+    std::vector<RasterItem> rasters(rotations.size());
+    for (size_t i = 0; i < sorted.size(); ++ i) {
+        if (params.stopcondition && params.stopcondition())
+            break;
+        ArrangePolygon &item = items[sorted[i]];
+        for_each_rotation([&](size_t rotation_idx) {
+            rasters[rotation_idx] = rasterize_item(item.poly.contour, item.rotation + rotations[rotation_idx], double(infl) + half_diagonal, resolution);
+        });
+        // Items not fitting an empty bed are left unarranged.
+        if (find_position(empty_bed, rasters).first < order.size()) {
+            for (int bed_idx = 0;; ++ bed_idx) {
+                if (bed_idx == int(beds.size()))
+                    beds.emplace_back(make_bed(bed_idx));
+                const auto [rank, rotation_idx] = find_position(beds[bed_idx], rasters);
+                if (rank < order.size()) {
+                    const RasterItem &raster = rasters[rotation_idx];
+                    const int x0 = int(order[rank] % uint32_t(width))  - raster.mask.width  / 2;
+                    const int y0 = int(order[rank] / uint32_t(width)) - raster.mask.height / 2;
+                    place(beds[bed_idx], raster.mask, x0, y0);
+                    item.translation = origin + Point(coord_t(x0) * resolution, coord_t(y0) * resolution) - raster.origin;
+                    item.rotation    = raster.rotation;
+                    item.bed_idx     = bed_idx;
+                    break;
+                }
+            }
+        }
+        if (params.progressind)
+            params.progressind(unsigned(sorted.size() - i - 1));
+        if (params.on_packed && item.is_arranged())
+            params.on_packed(item);
+    }
+}
+
+}} // namespace Slic3r::arrangement
@@ -0,0 +1,17 @@
+#ifndef slic3r_ArrangeRaster_hpp_
+#define slic3r_ArrangeRaster_hpp_
+
+#include "Arrange.hpp"
+
+namespace Slic3r {
+namespace arrangement {
+
+/// Arranges the items on a bed of the given shape by the raster engine, see ArrangeParams::Engine::Raster.
+/// The bed and the items are rasterized conservatively, so that the arranged items never overlap, and the items
+/// are placed first fit decreasing on the rasterized beds, each item as close to the alignment pivot as possible.
+/// Items not fitting the bed are placed onto the following logical beds, items not fitting an empty bed are left UNARRANGED.
+void arrange_raster(ArrangePolygons &items, const ArrangePolygons &excludes, const ExPolygon &bed, const ArrangeParams &params);
+
+}} // namespace Slic3r::arrangement
+
+#endif // slic3r_ArrangeRaster_hpp_
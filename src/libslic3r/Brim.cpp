@@ -60,10 +60,11 @@ static ExPolygons get_print_object_bottom_layer_expolygons(const PrintObject &pr
 // Returns ExPolygons of bottom layer for every print object in Print after elephant foot compensation.
 static std::vector<ExPolygons> get_print_bottom_layers_expolygons(const Print &print)
 {
-    std::vector<ExPolygons> bottom_layers_expolygons;
-    bottom_layers_expolygons.reserve(print.objects().size());
-    for (const PrintObject *object : print.objects())
-        bottom_layers_expolygons.emplace_back(get_print_object_bottom_layer_expolygons(*object));
+    std::vector<ExPolygons> bottom_layers_expolygons(print.objects().size());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, print.objects().size()), [&print, &bottom_layers_expolygons](const tbb::blocked_range<size_t> &range) {
+        for (size_t print_object_idx = range.begin(); print_object_idx < range.end(); ++ print_object_idx)
+            bottom_layers_expolygons[print_object_idx] = get_print_object_bottom_layer_expolygons(*print.objects()[print_object_idx]);
+    });
 
     return bottom_layers_expolygons;
 }
@@ -164,41 +165,48 @@ static ExPolygons top_level_outer_brim_area(const Print                   &print
     for (const PrintObject *object : top_level_objects_with_brim)
         top_level_objects_idx.insert(object->id().id);
 
-    ExPolygons brim_area;
-    ExPolygons no_brim_area;
-    for(size_t print_object_idx = 0; print_object_idx < print.objects().size(); ++print_object_idx) {
-        const PrintObject *object            = print.objects()[print_object_idx];
-        const BrimType     brim_type         = object->config().brim_type.value;
-        const float        brim_separation   = scale_(object->config().brim_separation.value);
-        const float        brim_width        = scale_(object->config().brim_width.value);
-        const bool         is_top_outer_brim = top_level_objects_idx.find(object->id().id) != top_level_objects_idx.end();
+    // The areas of the objects are independent, calculate them in parallel.
+    std::vector<ExPolygons> brim_area_objects(print.objects().size());
+    std::vector<ExPolygons> no_brim_area_objects(print.objects().size());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, print.objects().size()),
+        [&print, &bottom_layers_expolygons, &top_level_objects_idx, no_brim_offset, &brim_area_objects, &no_brim_area_objects](const tbb::blocked_range<size_t> &range) {
+        for (size_t print_object_idx = range.begin(); print_object_idx < range.end(); ++ print_object_idx) {
+            const PrintObject *object            = print.objects()[print_object_idx];
+            const BrimType     brim_type         = object->config().brim_type.value;
+            const float        brim_separation   = scale_(object->config().brim_separation.value);
+            const float        brim_width        = scale_(object->config().brim_width.value);
+            const bool         is_top_outer_brim = top_level_objects_idx.find(object->id().id) != top_level_objects_idx.end();
+
+            ExPolygons &brim_area_object    = brim_area_objects[print_object_idx];
+            ExPolygons &no_brim_area_object = no_brim_area_objects[print_object_idx];
+            for (const ExPolygon &ex_poly : bottom_layers_expolygons[print_object_idx]) {
+                if ((brim_type == BrimType::btOuterOnly || brim_type == BrimType::btOuterAndInner) && is_top_outer_brim)
+                    append(brim_area_object, diff_ex(offset(ex_poly.contour, brim_width + brim_separation, ClipperLib::jtSquare), offset(ex_poly.contour, brim_separation, ClipperLib::jtSquare)));
 
-        ExPolygons brim_area_object;
-        ExPolygons no_brim_area_object;
-        for (const ExPolygon &ex_poly : bottom_layers_expolygons[print_object_idx]) {
-            if ((brim_type == BrimType::btOuterOnly || brim_type == BrimType::btOuterAndInner) && is_top_outer_brim)
-                append(brim_area_object, diff_ex(offset(ex_poly.contour, brim_width + brim_separation, ClipperLib::jtSquare), offset(ex_poly.contour, brim_separation, ClipperLib::jtSquare)));
+                // After 7ff76d07684858fd937ef2f5d863f105a10f798e offset and shrink don't work with CW polygons (holes), so let's make it CCW.
+                Polygons ex_poly_holes_reversed = ex_poly.holes;
+                polygons_reverse(ex_poly_holes_reversed);
+                if (brim_type == BrimType::btOuterOnly || brim_type == BrimType::btNoBrim)
+                    append(no_brim_area_object, shrink_ex(ex_poly_holes_reversed, no_brim_offset, ClipperLib::jtSquare));
 
-            // After 7ff76d07684858fd937ef2f5d863f105a10f798e offset and shrink don't work with CW polygons (holes), so let's make it CCW.
-            Polygons ex_poly_holes_reversed = ex_poly.holes;
-            polygons_reverse(ex_poly_holes_reversed);
-            if (brim_type == BrimType::btOuterOnly || brim_type == BrimType::btNoBrim)
-                append(no_brim_area_object, shrink_ex(ex_poly_holes_reversed, no_brim_offset, ClipperLib::jtSquare));
-
-            if (brim_type == BrimType::btInnerOnly || brim_type == BrimType::btNoBrim)
-                append(no_brim_area_object, diff_ex(offset(ex_poly.contour, no_brim_offset, ClipperLib::jtSquare), ex_poly_holes_reversed));
+                if (brim_type == BrimType::btInnerOnly || brim_type == BrimType::btNoBrim)
+                    append(no_brim_area_object, diff_ex(offset(ex_poly.contour, no_brim_offset, ClipperLib::jtSquare), ex_poly_holes_reversed));
 
-            if (brim_type != BrimType::btNoBrim)
-                append(no_brim_area_object, offset_ex(ExPolygon(ex_poly.contour), brim_separation, ClipperLib::jtSquare));
+                if (brim_type != BrimType::btNoBrim)
+                    append(no_brim_area_object, offset_ex(ExPolygon(ex_poly.contour), brim_separation, ClipperLib::jtSquare));
 
-            no_brim_area_object.emplace_back(ex_poly.contour);
+                no_brim_area_object.emplace_back(ex_poly.contour);
+            }
         }
+    });
 
-        for (const PrintInstance &instance : object->instances()) {
-            append_and_translate(brim_area, brim_area_object, instance);
-            append_and_translate(no_brim_area, no_brim_area_object, instance);
+    ExPolygons brim_area;
+    ExPolygons no_brim_area;
+    for (size_t print_object_idx = 0; print_object_idx < print.objects().size(); ++ print_object_idx)
+        for (const PrintInstance &instance : print.objects()[print_object_idx]->instances()) {
+            append_and_translate(brim_area, brim_area_objects[print_object_idx], instance);
+            append_and_translate(no_brim_area, no_brim_area_objects[print_object_idx], instance);
         }
-    }
 
     return diff_ex(brim_area, no_brim_area);
 }
@@ -494,6 +502,50 @@ static void make_inner_brim(const Print                   &print,
                                     float(flow.width()), float(print.skirt_first_layer_height()));
 }
 
+// Split the brim islands into clusters, which are further than the distance from each other,
+// thus the brim loops of the clusters do not touch and they may be generated independently.
+static std::vector<Polygons> cluster_brim_islands(Polygons &&islands, const coord_t distance)
+{
+    std::vector<BoundingBox> bboxes;
+    bboxes.reserve(islands.size());
+    for (const Polygon &island : islands)
+        bboxes.emplace_back(get_extents(island));
+
+    std::vector<size_t> parent(islands.size());
+    std::iota(parent.begin(), parent.end(), 0);
+    auto find_root = [&parent](size_t i) {
+        while (parent[i] != i)
+            i = parent[i] = parent[parent[i]];
+        return i;
+    };
+
+    // Sweep the bounding boxes sorted by their left side.
+    std::vector<size_t> order(islands.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&bboxes](size_t l, size_t r) { return bboxes[l].min.x() < bboxes[r].min.x(); });
+    std::vector<size_t> active;
+    for (size_t i : order) {
+        const BoundingBox &bbox = bboxes[i];
+        active.erase(std::remove_if(active.begin(), active.end(), [&bboxes, &bbox, distance](size_t j) { return bboxes[j].max.x() + distance < bbox.min.x(); }), active.end());
+        for (size_t j : active)
+            if (bboxes[j].min.y() <= bbox.max.y() + distance && bbox.min.y() <= bboxes[j].max.y() + distance)
+                parent[find_root(j)] = find_root(i);
+        active.emplace_back(i);
+    }
+
+    std::vector<Polygons> clusters;
+    std::vector<size_t>   root_to_cluster(islands.size(), size_t(-1));
+    for (size_t i = 0; i < islands.size(); ++ i) {
+        size_t &cluster = root_to_cluster[find_root(i)];
+        if (cluster == size_t(-1)) {
+            cluster = clusters.size();
+            clusters.emplace_back();
+        }
+        clusters[cluster].emplace_back(std::move(islands[i]));
+    }
+    return clusters;
+}
+
 // Produce brim lines around those objects, that have the brim enabled.
 // Collect islands_area to be merged into the final 1st layer convex hull.
 ExtrusionEntityCollection make_brim(const Print &print, PrintTryCancel try_cancel, Polygons &islands_area)
@@ -508,12 +560,33 @@ ExtrusionEntityCollection make_brim(const Print &print, PrintTryCancel try_cance
 
     Polygons        loops;
     size_t          num_loops = size_t(floor(max_brim_width(print.objects()) / flow.spacing()));
-    for (size_t i = 0; i < num_loops; ++i) {
-        try_cancel();
-        islands = expand(islands, float(flow.scaled_spacing()), ClipperLib::jtSquare);
-        for (Polygon &poly : islands) 
-            poly.douglas_peucker(scaled_resolution);
-        polygons_append(loops, shrink(islands, 0.5f * float(flow.scaled_spacing())));
+    {
+        // Each of the num_loops expansions grows the islands by one spacing along their edges and slightly further at the squared
+        // corners (by 8% at a right angle corner). The clusters are kept apart by twice num_loops + 1 spacings, leaving each cluster
+        // a margin of one spacing for its corners, so that the brims of two clusters do not touch. With many objects on the bed,
+        // the brims of distant objects are then generated in parallel over smaller polygon sets.
+        std::vector<Polygons> clusters = cluster_brim_islands(std::move(islands), 2 * coord_t(num_loops + 1) * flow.scaled_spacing());
+        std::vector<Polygons> loops_by_clusters(clusters.size());
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, clusters.size(), 1),
+            [&clusters, &loops_by_clusters, &flow, &try_cancel, num_loops, scaled_resolution](const tbb::blocked_range<size_t> &range) {
+            for (size_t cluster_idx = range.begin(); cluster_idx < range.end(); ++ cluster_idx) {
+                Polygons &islands = clusters[cluster_idx];
+                for (size_t i = 0; i < num_loops; ++i) {
+                    try_cancel();
+                    islands = expand(islands, float(flow.scaled_spacing()), ClipperLib::jtSquare);
+                    for (Polygon &poly : islands)
+                        poly.douglas_peucker(scaled_resolution);
+                    polygons_append(loops_by_clusters[cluster_idx], shrink(islands, 0.5f * float(flow.scaled_spacing())));
+                }
+            }
+        });
+#ifdef BRIM_DEBUG_TO_SVG
+        islands.clear();
+        for (Polygons &cluster : clusters)
+            polygons_append(islands, std::move(cluster));
+#endif // BRIM_DEBUG_TO_SVG
+        for (Polygons &cluster_loops : loops_by_clusters)
+            polygons_append(loops, std::move(cluster_loops));
     }
     loops = union_pt_chained_outside_in(loops);
 
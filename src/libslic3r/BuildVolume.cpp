@@ -213,6 +213,9 @@ BuildVolume::ObjectState object_state_templ(const indexed_triangle_set &its, con
                 ++ num_above;
                 if (is_inside(pt))
                     ++ num_inside;
+                if (num_inside > 0 && num_inside < num_above)
+                    // Some vertices inside, some outside: colliding. The edges need not to be tested, thus sides are not needed either.
+                    break;
             }
         }
 
@@ -255,15 +258,14 @@ BuildVolume::ObjectState object_state_templ(const indexed_triangle_set &its, con
     {
         // Much simpler and faster code, not clipping the object with the print bed.
         assert(! may_be_below_bed);
-        num_above = its.vertices.size();
         for (const stl_vertex &v : its.vertices) {
             const stl_vertex pt = trafo * v;
             assert(pt.z() >= world_min_z);
-            if (is_inside(pt))
-                ++ num_inside;
+            (is_inside(pt) ? inside : outside) = true;
+            if (inside && outside)
+                // Colliding, the remaining vertices need not to be tested.
+                break;
         }
-        inside  = num_inside > 0;
-        outside = num_inside < num_above;
     }
 
     return inside ? (outside ? BuildVolume::ObjectState::Colliding : BuildVolume::ObjectState::Inside) : BuildVolume::ObjectState::Outside;
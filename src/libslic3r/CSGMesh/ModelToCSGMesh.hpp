@@ -59,7 +59,9 @@ void model_to_csgmesh(const ModelObject &mo,
                 *out = std::move(part_end);
                 ++out;
             } else {
-                CSGPart part{&(vol->mesh().its),
+                // The part shares the ownership of the volume mesh. Meshes are immutable, thus the mesh pointer
+                // identifies the mesh revision for as long as the part exists.
+                CSGPart part{std::shared_ptr<const indexed_triangle_set>{vol->mesh_ptr(), &(vol->mesh().its)},
                              vol->is_model_part() ? CSGType::Union : CSGType::Difference,
                              (trafo * vol->get_matrix()).cast<float>()};
 
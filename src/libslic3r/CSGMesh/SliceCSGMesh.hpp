@@ -4,6 +4,7 @@
 #include "CSGMesh.hpp"
 
 #include <stack>
+#include <vector>
 
 #include "libslic3r/TriangleMeshSlicer.hpp"
 #include "libslic3r/ClipperUtils.hpp"
@@ -58,14 +59,31 @@ std::vector<ExPolygons> slice_csgmesh_ex(
 
     std::stack opstack{std::vector<Frame>{}};
 
-    MeshSlicingParamsEx params_cpy = params;
-    auto trafo = params.trafo;
     auto nonempty_indices = reserve_vector<size_t>(slicegrid.size());
 
+    std::vector<ItCSG> parts;
+    for (auto it = csgrange.begin(); it != csgrange.end(); ++it)
+        parts.emplace_back(it);
+
+    // Slice all the parts up front in parallel. The parts besides the model itself (negative volumes, drill holes)
+    // are usually small, slicing them one after the other would leave most of the threads idle.
+    std::vector<std::vector<ExPolygons>> part_slices(parts.size());
+    execution::for_each(
+        ex_tbb, size_t(0), parts.size(),
+        [&parts, &part_slices, &slicegrid, &params, &throw_on_cancel](size_t i) {
+            const auto &csgpart = *parts[i];
+            if (const indexed_triangle_set *its = csg::get_mesh(csgpart)) {
+                MeshSlicingParamsEx params_cpy = params;
+                params_cpy.trafo = params.trafo * csg::get_transform(csgpart).template cast<double>();
+                part_slices[i] = slice_mesh_ex(*its, slicegrid, params_cpy, throw_on_cancel);
+                assert(part_slices[i].size() == slicegrid.size());
+            }
+        }, execution::max_concurrency(ex_tbb));
+
     opstack.push({CSGType::Union, std::vector<ExPolygons>(slicegrid.size())});
 
-    for (const auto &csgpart : csgrange) {
-        const indexed_triangle_set *its = csg::get_mesh(csgpart);
+    for (size_t ipart = 0; ipart < parts.size(); ++ipart) {
+        const auto &csgpart = *parts[ipart];
 
         auto op = get_operation(csgpart);
 
@@ -76,13 +94,27 @@ std::vector<ExPolygons> slice_csgmesh_ex(
 
         Frame *top = &opstack.top();
 
-        if (its) {
-            params_cpy.trafo = trafo * csg::get_transform(csgpart).template cast<double>();
-            std::vector<ExPolygons> slices = slice_mesh_ex(*its,
-                                                           slicegrid, params_cpy,
-                                                           throw_on_cancel);
-
-            assert(slices.size() == slicegrid.size());
+        if (csg::get_mesh(csgpart)) {
+            std::vector<ExPolygons> slices = std::move(part_slices[ipart]);
+
+            // Subtract a run of negative parts of the same frame at once, a single 2D difference per layer
+            // instead of one difference per part.
+            if (op == CSGType::Difference && get_stack_operation(csgpart) != CSGStackOp::Pop)
+                while (ipart + 1 < parts.size()) {
+                    const auto &next = *parts[ipart + 1];
+                    if (get_stack_operation(next) == CSGStackOp::Push || get_operation(next) != CSGType::Difference ||
+                        ! csg::get_mesh(next))
+                        break;
+                    ++ipart;
+                    execution::for_each(
+                        ex_tbb, size_t(0), slicegrid.size(),
+                        [&slices, &part_slices, ipart](size_t i) {
+                            append(slices[i], std::move(part_slices[ipart][i]));
+                        }, execution::max_concurrency(ex_tbb));
+                    part_slices[ipart] = {};
+                    if (get_stack_operation(next) == CSGStackOp::Pop)
+                        break;
+                }
 
             collect_nonempty_indices(op, slicegrid, slices, nonempty_indices);
 
@@ -93,7 +125,7 @@ std::vector<ExPolygons> slice_csgmesh_ex(
                 }, execution::max_concurrency(ex_tbb));
         }
 
-        if (get_stack_operation(csgpart) == CSGStackOp::Pop) {
+        if (get_stack_operation(*parts[ipart]) == CSGStackOp::Pop) {
             std::vector<ExPolygons> popslices = std::move(top->slices);
             auto popop = opstack.top().op;
             opstack.pop();
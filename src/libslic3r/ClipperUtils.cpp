@@ -401,6 +401,36 @@ Slic3r::Polygons offset(const Slic3r::Polyline &polyline, const float delta, Cli
 Slic3r::Polygons offset(const Slic3r::Polylines &polylines, const float delta, ClipperLib::JoinType joinType, double miterLimit)
     { assert(delta > 0); return to_polygons(clipper_union<ClipperLib::Paths>(raw_offset_polyline(ClipperUtils::PolylinesProvider(polylines), delta, joinType, miterLimit))); }
 
+// Merges the offsetted outer contour with the offsetted holes of a single ExPolygon.
+// returns number of expolygons collected (0 or 1).
+static int offset_expolygon_merge_holes(ClipperLib::Paths &&contours, ClipperLib::Paths &&holes, const float delta, ClipperLib::Paths &out)
+{
+    if (holes.empty()) {
+        // No hole remaining after an offset. Just copy the outer contour.
+        append(out, std::move(contours));
+    } else if (delta < 0) {
+        // Negative offset. There is a chance, that the offsetted hole intersects the outer contour. 
+        // Subtract the offsetted holes from the offsetted contours.            
+        if (auto output = clipper_do<ClipperLib::Paths>(ClipperLib::ctDifference, contours, holes, ClipperLib::pftNonZero); ! output.empty()) {
+            append(out, std::move(output));
+        } else {
+            // The offsetted holes have eaten up the offsetted outer contour.
+            return 0;
+        }
+    } else {
+        // Positive offset. As long as the Clipper offset does what one expects it to do, the offsetted hole will have a smaller
+        // area than the original hole or even disappear, therefore there will be no new intersections.
+        // Just collect the reversed holes.
+        out.reserve(contours.size() + holes.size());
+        append(out, std::move(contours));
+        // Reverse the holes in place.
+        for (size_t i = 0; i < holes.size(); ++ i)
+            std::reverse(holes[i].begin(), holes[i].end());
+        append(out, std::move(holes));
+    }
+    return 1;
+}
+
 // returns number of expolygons collected (0 or 1).
 static int offset_expolygon_inner(const Slic3r::ExPolygon &expoly, const float delta, ClipperLib::JoinType joinType, double miterLimit, ClipperLib::Paths &out)
 {
@@ -423,54 +453,29 @@ static int offset_expolygon_inner(const Slic3r::ExPolygon &expoly, const float d
     if (expoly.holes.empty()) {
         // No need to subtract holes from the offsetted expolygon, we are done.
         append(out, std::move(contours));
-    } else {
-        // 2) Offset the holes one by one, collect the offsetted holes.
-        ClipperLib::Paths holes;
-        {
-            for (const Polygon &hole : expoly.holes) {
-                ClipperLib::ClipperOffset co;
-                if (joinType == jtRound)
-                    co.ArcTolerance = miterLimit;
-                else
-                    co.MiterLimit = miterLimit;
-                co.ShortestEdgeLength = std::abs(delta * ClipperOffsetShortestEdgeFactor);
-                co.AddPath(hole.points, joinType, ClipperLib::etClosedPolygon);
-                ClipperLib::Paths out2;
-                // Execute reorients the contours so that the outer most contour has a positive area. Thus the output
-                // contours will be CCW oriented even though the input paths are CW oriented.
-                // Offset is applied after contour reorientation, thus the signum of the offset value is reversed.
-                co.Execute(out2, - delta);
-                append(holes, std::move(out2));
-            }
-        }
+        return 1;
+    }
 
-        // 3) Subtract holes from the contours.
-        if (holes.empty()) {
-            // No hole remaining after an offset. Just copy the outer contour.
-            append(out, std::move(contours));
-        } else if (delta < 0) {
-            // Negative offset. There is a chance, that the offsetted hole intersects the outer contour. 
-            // Subtract the offsetted holes from the offsetted contours.            
-            if (auto output = clipper_do<ClipperLib::Paths>(ClipperLib::ctDifference, contours, holes, ClipperLib::pftNonZero); ! output.empty()) {
-                append(out, std::move(output));
-            } else {
-                // The offsetted holes have eaten up the offsetted outer contour.
-                return 0;
-            }
-        } else {
-            // Positive offset. As long as the Clipper offset does what one expects it to do, the offsetted hole will have a smaller
-            // area than the original hole or even disappear, therefore there will be no new intersections.
-            // Just collect the reversed holes.
-            out.reserve(contours.size() + holes.size());
-            append(out, std::move(contours));
-            // Reverse the holes in place.
-            for (size_t i = 0; i < holes.size(); ++ i)
-                std::reverse(holes[i].begin(), holes[i].end());
-            append(out, std::move(holes));
-        }
+    // 2) Offset the holes one by one, collect the offsetted holes.
+    ClipperLib::Paths holes;
+    for (const Polygon &hole : expoly.holes) {
+        ClipperLib::ClipperOffset co;
+        if (joinType == jtRound)
+            co.ArcTolerance = miterLimit;
+        else
+            co.MiterLimit = miterLimit;
+        co.ShortestEdgeLength = std::abs(delta * ClipperOffsetShortestEdgeFactor);
+        co.AddPath(hole.points, joinType, ClipperLib::etClosedPolygon);
+        ClipperLib::Paths out2;
+        // Execute reorients the contours so that the outer most contour has a positive area. Thus the output
+        // contours will be CCW oriented even though the input paths are CW oriented.
+        // Offset is applied after contour reorientation, thus the signum of the offset value is reversed.
+        co.Execute(out2, - delta);
+        append(holes, std::move(out2));
     }
 
-    return 1;
+    // 3) Subtract holes from the contours.
+    return offset_expolygon_merge_holes(std::move(contours), std::move(holes), delta, out);
 }
 
 static int offset_expolygon_inner(const Slic3r::Surface &surface, const float delta, ClipperLib::JoinType joinType, double miterLimit, ClipperLib::Paths &out)
@@ -542,6 +547,75 @@ Slic3r::ExPolygons offset_ex(const Slic3r::Surfaces &surfaces, const float delta
 Slic3r::ExPolygons offset_ex(const Slic3r::SurfacesPtr &surfaces, const float delta, ClipperLib::JoinType joinType, double miterLimit)
     { return PolyTreeToExPolygons(expolygons_offset_pt(surfaces, delta, joinType, miterLimit)); }
 
+std::vector<Slic3r::Polygons> offset_multiple(const Slic3r::ExPolygons &expolygons, const std::vector<float> &deltas, ClipperLib::JoinType joinType, double miterLimit)
+{
+    std::vector<ClipperLib::Paths> out(deltas.size());
+    if (deltas.empty())
+        return {};
+    // The short edges are filtered out by the ClipperOffset when adding a path, with respect to the magnitude of the delta as offset() does.
+    // Thus a single ClipperOffset is shared by the deltas of the same magnitude only.
+    std::vector<std::vector<size_t>> delta_groups;
+    for (size_t i = 0; i < deltas.size(); ++ i) {
+        auto it = std::find_if(delta_groups.begin(), delta_groups.end(), [&deltas, i](const std::vector<size_t> &group)
+            { return std::abs(deltas[group.front()]) == std::abs(deltas[i]); });
+        if (it == delta_groups.end())
+            delta_groups.push_back({ i });
+        else
+            it->emplace_back(i);
+    }
+    auto prepare = [joinType, miterLimit](ClipperLib::ClipperOffset &co, const Polygon &polygon, const float delta) {
+        if (joinType == jtRound)
+            co.ArcTolerance = miterLimit;
+        else
+            co.MiterLimit = miterLimit;
+        co.ShortestEdgeLength = std::abs(delta * ClipperOffsetShortestEdgeFactor);
+        co.AddPath(polygon.points, joinType, ClipperLib::etClosedPolygon);
+    };
+    // Number of non-empty offsetted expolygons collected per delta, to decide whether a final union is needed.
+    std::vector<size_t>            expolygons_collected(deltas.size(), 0);
+    std::vector<ClipperLib::Paths> contours(deltas.size());
+    std::vector<ClipperLib::Paths> holes(deltas.size());
+    for (const ExPolygon &expoly : expolygons) {
+        for (const std::vector<size_t> &group : delta_groups) {
+            // 1) Offset the outer contour by all the deltas of the group, the contour is cleaned up and reoriented just once.
+            {
+                ClipperLib::ClipperOffset co;
+                prepare(co, expoly.contour, deltas[group.front()]);
+                for (size_t i : group)
+                    co.Execute(contours[i], deltas[i]);
+            }
+            // 2) Offset the holes one by one, each by all the deltas of the group.
+            for (const Polygon &hole : expoly.holes) {
+                ClipperLib::ClipperOffset co;
+                prepare(co, hole, deltas[group.front()]);
+                ClipperLib::Paths out2;
+                for (size_t i : group)
+                    if (! contours[i].empty()) {
+                        // See offset_expolygon_inner() for the reversed signum of the offset.
+                        co.Execute(out2, - deltas[i]);
+                        append(holes[i], std::move(out2));
+                    }
+            }
+        }
+        // 3) Subtract holes from the contours.
+        for (size_t i = 0; i < deltas.size(); ++ i) {
+            if (! contours[i].empty())
+                expolygons_collected[i] += offset_expolygon_merge_holes(std::move(contours[i]), std::move(holes[i]), deltas[i], out[i]);
+            contours[i].clear();
+            holes[i].clear();
+        }
+    }
+
+    std::vector<Slic3r::Polygons> result;
+    result.reserve(deltas.size());
+    for (size_t i = 0; i < deltas.size(); ++ i)
+        result.emplace_back(to_polygons(expolygons_collected[i] > 1 && deltas[i] > 0 ?
+            // There is a chance that the outwards offsetted expolygons may intersect. Perform a union.
+            clipper_union<ClipperLib::Paths>(out[i]) :
+            std::move(out[i])));
+    return result;
+}
+
 Polygons offset2(const ExPolygons &expolygons, const float delta1, const float delta2, ClipperLib::JoinType joinType, double miterLimit)
 {
     return to_polygons(offset_paths<ClipperLib::Paths>(expolygons_offset(expolygons, delta1, joinType, miterLimit), delta2, joinType, miterLimit));
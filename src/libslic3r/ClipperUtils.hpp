@@ -375,6 +375,10 @@ inline Slic3r::ExPolygons shrink_ex(const Slic3r::Polygons &polygons, const floa
     { assert(delta > 0); return offset_ex(polygons, -delta, joinType, miterLimit); }
 inline Slic3r::ExPolygons shrink_ex(const Slic3r::ExPolygons &polygons, const float delta, ClipperLib::JoinType joinType = DefaultJoinType, double miterLimit = DefaultMiterLimit) 
     { assert(delta > 0); return offset_ex(polygons, -delta, joinType, miterLimit); }
+// Offset the ExPolygons by multiple deltas, one output per delta, each matching offset(expolygons, deltas[i]).
+// The input contours and holes are cleaned up and reoriented for offsetting just once for all the deltas of the same magnitude,
+// as the short edges are filtered out with respect to the magnitude of the delta.
+std::vector<Slic3r::Polygons> offset_multiple(const Slic3r::ExPolygons &expolygons, const std::vector<float> &deltas, ClipperLib::JoinType joinType = DefaultJoinType, double miterLimit = DefaultMiterLimit);
 
 // Wherever applicable, please use the opening() / closing() variants instead, they convey their purpose better.
 // Input polygons for negative offset shall be "normalized": There must be no overlap / intersections between the input polygons.
@@ -540,21 +540,25 @@ SurfaceCut Slic3r::cut_surface(const ExPolygons &shapes,
 
     // for filttrate opposite triangles and a little more
     const float max_angle = 89.9f;
-    priv::CutMeshes cgal_models; // source for patch
-    priv::CutMeshes cgal_neg_models; // model used for differenciate patches
-    cgal_models.reserve(models.size());
-    for (const indexed_triangle_set &its : models) {
-        std::vector<bool> skip_indicies(its.indices.size(), {false});
-        priv::set_skip_for_out_of_aoi(skip_indicies, its, projection, shapes_bb);
-
-        // create model for differenciate cutted patches
-        bool flip = true;
-        cgal_neg_models.push_back(priv::to_cgal(its, skip_indicies, flip));
-        
-        // cut out more than only opposit triangles 
-        priv::set_skip_by_angle(skip_indicies, its, projection, max_angle);
-        cgal_models.push_back(priv::to_cgal(its, skip_indicies));
-    }
+    priv::CutMeshes cgal_models(models.size()); // source for patch
+    priv::CutMeshes cgal_neg_models(models.size()); // model used for differenciate patches
+    // models are independent, prepare them in parallel
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, models.size()),
+    [&models, &cgal_models, &cgal_neg_models, &projection, &shapes_bb, max_angle](const tbb::blocked_range<size_t> &range) {
+        for (size_t i = range.begin(); i < range.end(); ++i) {
+            const indexed_triangle_set &its = models[i];
+            std::vector<bool> skip_indicies(its.indices.size(), {false});
+            priv::set_skip_for_out_of_aoi(skip_indicies, its, projection, shapes_bb);
+
+            // create model for differenciate cutted patches
+            bool flip = true;
+            cgal_neg_models[i] = priv::to_cgal(its, skip_indicies, flip);
+
+            // cut out more than only opposit triangles
+            priv::set_skip_by_angle(skip_indicies, its, projection, max_angle);
+            cgal_models[i] = priv::to_cgal(its, skip_indicies);
+        }
+    }); // END parallel for
 #ifdef DEBUG_OUTPUT_DIR
     priv::store(cgal_models, DEBUG_OUTPUT_DIR + "model/");// model[0-N].off
     priv::store(cgal_neg_models, DEBUG_OUTPUT_DIR + "model_neg/"); // model[0-N].off
@@ -565,19 +569,25 @@ SurfaceCut Slic3r::cut_surface(const ExPolygons &shapes,
     CGAL::IO::write_OFF(DEBUG_OUTPUT_DIR + "shape.off", cgal_shape); // only debug
 #endif // DEBUG_OUTPUT_DIR
 
+    // Corefinement reads the property maps of the shape and the cuts keep pointers into them,
+    // so each model beyond the first one gets its own copy of the shape living until the end of the cut.
+    priv::CutMeshes cgal_shape_copies(cgal_models.empty() ? 0 : cgal_models.size() - 1, cgal_shape);
+
     // create tool for convert index to shape Point adress and vice versa
     ExPolygonsIndices s2i(shapes);
-    priv::VCutAOIs model_cuts;
+    priv::VCutAOIs model_cuts(cgal_models.size());
     // cut shape from each cgal model
-    for (priv::CutMesh &cgal_model : cgal_models) { 
-        priv::CutAOIs cutAOIs = priv::cut_from_model(
-            cgal_model, shapes, cgal_shape, projection_ratio, s2i);
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, cgal_models.size()),
+    [&cgal_models, &cgal_shape, &cgal_shape_copies, &model_cuts, &shapes, &s2i, projection_ratio](const tbb::blocked_range<size_t> &range) {
+        for (size_t index = range.begin(); index < range.end(); ++index) {
+            priv::CutMesh &cgal_model = cgal_models[index];
+            priv::CutMesh &shape      = index == 0 ? cgal_shape : cgal_shape_copies[index - 1];
+            model_cuts[index] = priv::cut_from_model(cgal_model, shapes, shape, projection_ratio, s2i);
 #ifdef DEBUG_OUTPUT_DIR
-        size_t index = &cgal_model - &cgal_models.front();
-        priv::store(cutAOIs, cgal_model, DEBUG_OUTPUT_DIR + "model_AOIs/" + std::to_string(index) + "/"); // only debug
+            priv::store(model_cuts[index], cgal_model, DEBUG_OUTPUT_DIR + "model_AOIs/" + std::to_string(index) + "/"); // only debug
 #endif // DEBUG_OUTPUT_DIR
-        model_cuts.push_back(std::move(cutAOIs));
-    }
+        }
+    }); // END parallel for
 
     priv::SurfacePatches patches = priv::diff_models(model_cuts, cgal_models, cgal_neg_models, projection);
 #ifdef DEBUG_OUTPUT_DIR
@@ -805,13 +815,18 @@ void priv::set_skip_for_out_of_aoi(std::vector<bool>          &skip_indicies,
     }); // END parallel for
 
     // inspect all triangles, when it is out of bounding box
+    // std::vector<bool> packs the flags into words, it can't be written from multiple threads
+    std::vector<uint8_t> skip(its.indices.size());
     tbb::parallel_for(tbb::blocked_range<size_t>(0, its.indices.size()),
-    [&its, &is_on_sides, &skip_indicies](const tbb::blocked_range<size_t> &range) {
+    [&its, &is_on_sides, &skip](const tbb::blocked_range<size_t> &range) {
         for (size_t i = range.begin(); i < range.end(); ++i) {
             if (is_all_on_one_side(its.indices[i], is_on_sides)) 
-                skip_indicies[i] = true;
+                skip[i] = true;
         }
     }); // END parallel for
+    for (size_t i = 0; i < skip.size(); ++i)
+        if (skip[i])
+            skip_indicies[i] = true;
 }
 
 indexed_triangle_set Slic3r::its_mask(const indexed_triangle_set &its,
@@ -873,21 +888,29 @@ void priv::set_skip_by_angle(std::vector<bool>          &skip_indicies,
     assert(max_angle < 90. && max_angle > 89.);
     assert(skip_indicies.size() == its.indices.size());
     float threshold = static_cast<float>(cos(max_angle / 180. * M_PI));
-    for (const stl_triangle_vertex_indices& face : its.indices) {
-        size_t index = &face - &its.indices.front();
-        if (skip_indicies[index]) continue;
-        Vec3f n = its_face_normal(its, face);
-        const Vec3f& v = its.vertices[face[0]];
-        const Vec3d vd = v.cast<double>();
-        // Improve: For Orthogonal Projection it is same for each vertex
-        Vec3d projectedd  = projection.project(vd);
-        Vec3f projected   = projectedd.cast<float>();
-        Vec3f project_dir = projected - v;
-        project_dir.normalize();
-        float cos_alpha = project_dir.dot(n);
-        if (cos_alpha > threshold) continue;
-        skip_indicies[index] = true;
-    }
+    // std::vector<bool> packs the flags into words, it can't be written from multiple threads
+    std::vector<uint8_t> skip(its.indices.size());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, its.indices.size()),
+    [&its, &projection, &skip_indicies, &skip, threshold](const tbb::blocked_range<size_t> &range) {
+        for (size_t index = range.begin(); index < range.end(); ++index) {
+            if (skip_indicies[index]) continue;
+            const stl_triangle_vertex_indices &face = its.indices[index];
+            Vec3f n = its_face_normal(its, face);
+            const Vec3f& v = its.vertices[face[0]];
+            const Vec3d vd = v.cast<double>();
+            // Improve: For Orthogonal Projection it is same for each vertex
+            Vec3d projectedd  = projection.project(vd);
+            Vec3f projected   = projectedd.cast<float>();
+            Vec3f project_dir = projected - v;
+            project_dir.normalize();
+            float cos_alpha = project_dir.dot(n);
+            if (cos_alpha > threshold) continue;
+            skip[index] = true;
+        }
+    }); // END parallel for
+    for (size_t index = 0; index < skip.size(); ++index)
+        if (skip[index])
+            skip_indicies[index] = true;
 }
 
 priv::CutMesh priv::to_cgal(const indexed_triangle_set &its,
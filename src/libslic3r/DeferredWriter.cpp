@@ -0,0 +1,87 @@
+#include "DeferredWriter.hpp"
+#include "Thread.hpp"
+
+#include <algorithm>
+#include <exception>
+
+#include <boost/log/trivial.hpp>
+
+namespace Slic3r {
+
+DeferredWriter::DeferredWriter() : m_thread(create_thread([this]() { this->thread_proc(); }))
+{
+}
+
+DeferredWriter::~DeferredWriter()
+{
+    {
+        std::scoped_lock<std::mutex> lock(m_mutex);
+        m_exit = true;
+    }
+    m_condition.notify_all();
+    m_thread.join();
+}
+
+void DeferredWriter::schedule(const std::string &key, Job job, std::chrono::milliseconds delay)
+{
+    {
+        std::scoped_lock<std::mutex> lock(m_mutex);
+        m_pending[key] = { std::chrono::steady_clock::now() + delay, std::move(job) };
+    }
+    m_condition.notify_all();
+}
+
+void DeferredWriter::flush()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    for (auto &[key, pending] : m_pending)
+        pending.deadline = std::chrono::steady_clock::time_point::min();
+    m_condition.notify_all();
+    m_condition.wait(lock, [this]() { return m_pending.empty() && m_running == 0; });
+}
+
+void DeferredWriter::flush(const std::string &key)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (auto it = m_pending.find(key); it != m_pending.end())
+        it->second.deadline = std::chrono::steady_clock::time_point::min();
+    m_condition.notify_all();
+    m_condition.wait(lock, [this, &key]() { return m_pending.find(key) == m_pending.end() && (m_running == 0 || m_running_key != key); });
+}
+
+void DeferredWriter::thread_proc()
+{
+    set_current_thread_name("slic3r_deferredwriter");
+    std::unique_lock<std::mutex> lock(m_mutex);
+    for (;;) {
+        if (m_pending.empty()) {
+            if (m_exit)
+                break;
+            m_condition.wait(lock);
+            continue;
+        }
+        auto it = std::min_element(m_pending.begin(), m_pending.end(),
+            [](const auto &l, const auto &r) { return l.second.deadline < r.second.deadline; });
+        // Pending jobs are not delayed any more once the writer is being destroyed.
+        if (! m_exit && it->second.deadline > std::chrono::steady_clock::now()) {
+            // Woken up by a new job, by a flush, at the deadline or spuriously, the earliest job is looked up again.
+            m_condition.wait_until(lock, it->second.deadline);
+            continue;
+        }
+        Job job = std::move(it->second.job);
+        m_running_key = it->first;
+        m_pending.erase(it);
+        ++ m_running;
+        lock.unlock();
+        try {
+            job();
+        } catch (const std::exception &ex) {
+            BOOST_LOG_TRIVIAL(error) << "Deferred write failed: " << ex.what();
+        }
+        lock.lock();
+        -- m_running;
+        m_condition.notify_all();
+    }
+}
+
+} // namespace Slic3r
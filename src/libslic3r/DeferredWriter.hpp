@@ -0,0 +1,56 @@
+#ifndef slic3r_DeferredWriter_hpp_
+#define slic3r_DeferredWriter_hpp_
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+
+#include <boost/thread.hpp>
+
+namespace Slic3r {
+
+// Runs jobs writing files on a single background thread, so that a slow (network) file system does not stall the UI thread.
+// The jobs are keyed by the file they write: a job scheduled for a key replaces the job still pending for the same key,
+// thus repeated writes of the same file are coalesced. A job is started once it was not replaced for its delay (debouncing).
+// The job has to own all the data it writes, it must not refer to data modified by the caller.
+class DeferredWriter
+{
+public:
+    using Job = std::function<void()>;
+
+    DeferredWriter();
+    // Runs the pending jobs before the thread is stopped.
+    ~DeferredWriter();
+
+    // Schedule the job to be started after the delay, replacing the job pending for the same key.
+    void schedule(const std::string &key, Job job, std::chrono::milliseconds delay);
+    // Start all the pending jobs immediately and wait until they are finished.
+    void flush();
+    // Start the job pending for the key immediately and wait until it is finished, the other jobs are left pending.
+    void flush(const std::string &key);
+
+private:
+    void thread_proc();
+
+    struct Pending {
+        std::chrono::steady_clock::time_point deadline;
+        Job                                   job;
+    };
+
+    std::map<std::string, Pending>  m_pending;
+    // Number of jobs taken from m_pending, which did not finish yet.
+    size_t                          m_running { 0 };
+    // Key of the job being run, valid if m_running is not zero.
+    std::string                     m_running_key;
+    bool                            m_exit { false };
+    std::mutex                      m_mutex;
+    std::condition_variable         m_condition;
+    boost::thread                   m_thread;
+};
+
+} // namespace Slic3r
+
+#endif // slic3r_DeferredWriter_hpp_
@@ -703,6 +703,8 @@ void EdgeGrid::Grid::calculate_sdf()
 				const Slic3r::Point v_seg = p2 - p1;
 				// l2 of v_seg
 				const int64_t l2_seg = int64_t(v_seg(0)) * int64_t(v_seg(0)) + int64_t(v_seg(1)) * int64_t(v_seg(1));
+				// Inverse length of v_seg, calculated once for all the 16 corners visited below.
+				const double  l_seg_inv = 1. / sqrt(double(l2_seg));
 				// For each corner of this cell and its 1 ring neighbours:
 				for (int corner_y = -1; corner_y < 3; ++ corner_y) {
 					coord_t corner_r = r + corner_y;
@@ -718,9 +720,10 @@ void EdgeGrid::Grid::calculate_sdf()
 						// dot(p2-p1, pt-p1)
 						int64_t t_pt = int64_t(v_seg(0)) * int64_t(v_pt(0)) + int64_t(v_seg(1)) * int64_t(v_pt(1));
 						if (t_pt < 0) {
-							// Closest to p1.
-							double dabs = sqrt(int64_t(v_pt(0)) * int64_t(v_pt(0)) + int64_t(v_pt(1)) * int64_t(v_pt(1)));
-							if (dabs < d_min) {
+							// Closest to p1. Compare the squared distances to save the square root for the corners already closer to another segment.
+							double dabs2 = double(int64_t(v_pt(0)) * int64_t(v_pt(0)) + int64_t(v_pt(1)) * int64_t(v_pt(1)));
+							if (dabs2 < double(d_min) * double(d_min)) {
+								double dabs = sqrt(dabs2);
 								// Previous point.
 								const Slic3r::Point &p0 = contour.segment_prev(ipt);
 								Slic3r::Point v_seg_prev = p1 - p0;
@@ -750,7 +753,7 @@ void EdgeGrid::Grid::calculate_sdf()
 							// Closest to the segment.
 							assert(t_pt >= 0 && t_pt <= l2_seg);
 							int64_t d_seg = int64_t(v_seg(1)) * int64_t(v_pt(0)) - int64_t(v_seg(0)) * int64_t(v_pt(1));
-							double d = double(d_seg) / sqrt(double(l2_seg));
+							double d = double(d_seg) * l_seg_inv;
 							double dabs = std::abs(d);
 							if (dabs < d_min) {
 								d_min = dabs;
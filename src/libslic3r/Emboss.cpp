@@ -1,6 +1,7 @@
 #include "Emboss.hpp"
 #include <stdio.h>
 #include <cstdlib>
+#include <numeric>
 #include <boost/nowide/convert.hpp>
 #include <boost/log/trivial.hpp>
 #include <ClipperUtils.hpp> // union_ex + for boldness(polygon extend(offset))
@@ -40,6 +41,9 @@ std::optional<Glyph> get_glyph(const stbtt_fontinfo &font_info, int unicode_lett
 const Glyph* get_glyph(int unicode, const FontFile &font, const FontProp &font_prop, 
         Glyphs &cache, fontinfo_opt &font_info_opt);
 
+// Union and heal glyphs placed into the text, see text2shapes
+ExPolygons merge_glyphs(std::vector<ExPolygons> &&glyphs);
+
 EmbossStyle create_style(std::wstring name, std::wstring path);
 
 // scale and convert float to int coordinate
@@ -843,12 +847,66 @@ const Glyph* priv::get_glyph(
                 for (Polygon &hole : expolygon.holes) skew(hole);
             }
         }
+        // The cached glyph has to be healthy, text2shapes does not heal separated glyphs again
+        if (font_prop.boldness.has_value() || font_prop.skew.has_value())
+            Emboss::heal_shape(glyph_opt->shape);
     }
     auto it = cache.insert({unicode, std::move(*glyph_opt)});
     assert(it.second);
     return &it.first->second;
 }
 
+ExPolygons priv::merge_glyphs(std::vector<ExPolygons> &&glyphs)
+{
+    // Glyphs are healed when cached and most of them do not touch their neighbours. Only the groups of glyphs
+    // with touching bounding boxes are united and healed, thus the cost stays linear with the text length.
+    std::vector<BoundingBox> bbs;
+    bbs.reserve(glyphs.size());
+    for (const ExPolygons &glyph : glyphs)
+        bbs.emplace_back(get_extents(glyph));
+
+    std::vector<size_t> parent(glyphs.size());
+    std::iota(parent.begin(), parent.end(), 0);
+    auto find_root = [&parent](size_t i) {
+        while (parent[i] != i)
+            i = parent[i] = parent[parent[i]];
+        return i;
+    };
+
+    // Sweep over the glyphs sorted by the left side of their bounding boxes.
+    std::vector<size_t> order(glyphs.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&bbs](size_t l, size_t r) { return bbs[l].min.x() < bbs[r].min.x(); });
+    std::vector<size_t> active;
+    for (size_t i : order) {
+        active.erase(std::remove_if(active.begin(), active.end(), [&bbs, i](size_t j) { return bbs[j].max.x() < bbs[i].min.x(); }),
+                     active.end());
+        for (size_t j : active)
+            if (bbs[j].overlap(bbs[i]))
+                parent[find_root(j)] = find_root(i);
+        active.emplace_back(i);
+    }
+
+    std::vector<std::vector<size_t>> groups(glyphs.size());
+    for (size_t i = 0; i < glyphs.size(); ++i)
+        groups[find_root(i)].emplace_back(i);
+
+    ExPolygons result;
+    for (const std::vector<size_t> &group : groups) {
+        if (group.size() == 1) {
+            expolygons_append(result, std::move(glyphs[group.front()]));
+        } else if (group.size() > 1) {
+            ExPolygons shape;
+            for (size_t i : group)
+                expolygons_append(shape, std::move(glyphs[i]));
+            shape = Slic3r::union_ex(shape);
+            Emboss::heal_shape(shape);
+            expolygons_append(result, std::move(shape));
+        }
+    }
+    return result;
+}
+
 EmbossStyle priv::create_style(std::wstring name, std::wstring path) {
     return { boost::nowide::narrow(name.c_str()),
              boost::nowide::narrow(path.c_str()),
@@ -1214,7 +1272,7 @@ ExPolygons Emboss::text2shapes(FontFileWithCache    &font_with_cache,
     assert(font_with_cache.has_value());
     fontinfo_opt font_info_opt;    
     Point    cursor(0, 0);
-    ExPolygons result;
+    std::vector<ExPolygons> glyphs;
     const FontFile& font = *font_with_cache.font_file;
     unsigned int font_index = font_prop.collection_number.has_value()?
         *font_prop.collection_number : 0;
@@ -1257,11 +1315,10 @@ ExPolygons Emboss::text2shapes(FontFileWithCache    &font_with_cache,
             expolygon.translate(cursor);
 
         cursor.x() += glyph_ptr->advance_width;
-        expolygons_append(result, std::move(expolygons));
+        if (! expolygons.empty())
+            glyphs.emplace_back(std::move(expolygons));
     }
-    result = Slic3r::union_ex(result);
-    heal_shape(result);
-    return result;
+    return priv::merge_glyphs(std::move(glyphs));
 }
 
 void Emboss::apply_transformation(const FontProp &font_prop,
@@ -182,14 +182,14 @@ Polygons ExPolygon::simplify_p(double tolerance) const
     {
         Polygon p = this->contour;
         p.points.push_back(p.points.front());
-        p.points = MultiPoint::_douglas_peucker(p.points, tolerance);
+        MultiPoint::_douglas_peucker_inplace(p.points, tolerance);
         p.points.pop_back();
         pp.emplace_back(std::move(p));
     }
     // holes
     for (Polygon p : this->holes) {
         p.points.push_back(p.points.front());
-        p.points = MultiPoint::_douglas_peucker(p.points, tolerance);
+        MultiPoint::_douglas_peucker_inplace(p.points, tolerance);
         p.points.pop_back();
         pp.emplace_back(std::move(p));
     }
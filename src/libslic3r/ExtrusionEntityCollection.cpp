@@ -26,10 +26,12 @@ ExtrusionEntityCollection::ExtrusionEntityCollection(const ExtrusionPaths &paths
 
 ExtrusionEntityCollection& ExtrusionEntityCollection::operator=(const ExtrusionEntityCollection &other)
 {
-    this->entities      = other.entities;
-    for (size_t i = 0; i < this->entities.size(); ++i)
-        this->entities[i] = this->entities[i]->clone();
-    this->no_sort       = other.no_sort;
+    if (this != &other) {
+        // Release the entities owned so far before cloning the other collection.
+        this->clear();
+        this->append(other.entities);
+        this->no_sort = other.no_sort;
+    }
     return *this;
 }
 
@@ -83,6 +85,25 @@ void ExtrusionEntityCollection::remove(size_t i)
     this->entities.erase(this->entities.begin() + i);
 }
 
+void ExtrusionEntityCollection::shrink_to_fit()
+{
+    auto shrink_paths = [](ExtrusionPaths &paths) {
+        for (ExtrusionPath &path : paths)
+            path.polyline.points.shrink_to_fit();
+        paths.shrink_to_fit();
+    };
+    for (ExtrusionEntity *ee : this->entities)
+        if (auto *collection = dynamic_cast<ExtrusionEntityCollection*>(ee))
+            collection->shrink_to_fit();
+        else if (auto *path = dynamic_cast<ExtrusionPath*>(ee))
+            path->polyline.points.shrink_to_fit();
+        else if (auto *multipath = dynamic_cast<ExtrusionMultiPath*>(ee))
+            shrink_paths(multipath->paths);
+        else if (auto *loop = dynamic_cast<ExtrusionLoop*>(ee))
+            shrink_paths(loop->paths);
+    this->entities.shrink_to_fit();
+}
+
 ExtrusionEntityCollection ExtrusionEntityCollection::chained_path_from(const ExtrusionEntitiesPtr& extrusion_entities, const Point &start_near, ExtrusionRole role)
 {
 	// Return a filtered copy of the collection.
@@ -96,6 +96,9 @@ public:
     }
     void replace(size_t i, const ExtrusionEntity &entity);
     void remove(size_t i);
+    // Release the spare capacity of the point vectors of all the extrusions, recursively.
+    // To be called on extrusions, which are stored for the rest of the slicing pipeline.
+    void shrink_to_fit();
     static ExtrusionEntityCollection chained_path_from(const ExtrusionEntitiesPtr &extrusion_entities, const Point &start_near, ExtrusionRole role = ExtrusionRole::Mixed);
     ExtrusionEntityCollection chained_path_from(const Point &start_near, ExtrusionRole role = ExtrusionRole::Mixed) const
     	{ return this->no_sort ? *this : chained_path_from(this->entities, start_near, role); }
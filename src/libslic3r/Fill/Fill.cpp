@@ -2,6 +2,11 @@
 #include <stdio.h>
 #include <memory>
 
+#include <boost/functional/hash.hpp>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
 #include "../ClipperUtils.hpp"
 #include "../Geometry.hpp"
 #include "../Layer.hpp"
@@ -11,6 +16,7 @@
 // for Arachne based infills
 #include "../PerimeterGenerator.hpp"
 
+#include "Fill.hpp"
 #include "FillBase.hpp"
 #include "FillRectilinear.hpp"
 #include "FillLightning.hpp"
@@ -464,7 +470,105 @@ void Layer::clear_fills()
 			island.fills.clear();
 }
 
-void Layer::make_fills(FillAdaptive::Octree* adaptive_fill_octree, FillAdaptive::Octree* support_fill_octree, FillLightning::Generator* lightning_generator)
+bool FillCache::cacheable(InfillPattern pattern)
+{
+    // Rectilinear based patterns depend on neither the print_z nor the layer ID except for its parity.
+    switch (pattern) {
+    case ipRectilinear:
+    case ipAlignedRectilinear:
+    case ipMonotonic:
+    case ipMonotonicLines:
+    case ipGrid:
+    case ipTriangles:
+    case ipStars:
+    // Ensuring does not depend on the layer at all, only on the layer height.
+    case ipEnsuring:
+        return true;
+    default:
+        return false;
+    }
+}
+
+void FillCache::Key::update_hash()
+{
+    hash = 0;
+    boost::hash_combine(hash, int(pattern));
+    boost::hash_combine(hash, bridge_angle);
+    boost::hash_combine(hash, thickness_layers);
+    boost::hash_combine(hash, odd_layer);
+    boost::hash_combine(hash, angle);
+    boost::hash_combine(hash, spacing);
+    boost::hash_combine(hash, link_max_length);
+    boost::hash_combine(hash, loop_clipping);
+    boost::hash_combine(hash, params.density);
+    boost::hash_combine(hash, params.layer_height);
+    auto hash_polygon = [this](const Polygon &polygon) {
+        boost::hash_combine(hash, polygon.points.size());
+        for (const Point &pt : polygon.points) {
+            boost::hash_combine(hash, pt.x());
+            boost::hash_combine(hash, pt.y());
+        }
+    };
+    hash_polygon(expolygon.contour);
+    for (const Polygon &hole : expolygon.holes)
+        hash_polygon(hole);
+}
+
+bool FillCache::Key::operator==(const Key &rhs) const
+{
+    return hash == rhs.hash && pattern == rhs.pattern && bridge_angle == rhs.bridge_angle && thickness_layers == rhs.thickness_layers &&
+           odd_layer == rhs.odd_layer && angle == rhs.angle && spacing == rhs.spacing && link_max_length == rhs.link_max_length &&
+           loop_clipping == rhs.loop_clipping && params.density == rhs.params.density && params.anchor_length == rhs.params.anchor_length &&
+           params.anchor_length_max == rhs.params.anchor_length_max && params.resolution == rhs.params.resolution &&
+           params.dont_adjust == rhs.params.dont_adjust && params.monotonic == rhs.params.monotonic && params.complete == rhs.params.complete &&
+           params.use_arachne == rhs.params.use_arachne && params.layer_height == rhs.params.layer_height && expolygon == rhs.expolygon;
+}
+
+std::shared_ptr<const FillCache::Value> FillCache::find(const Key &key) const
+{
+    std::scoped_lock<std::mutex> lock(m_mutex);
+    // Search the most recent entries first, the infill usually repeats every other layer.
+    for (auto it = m_entries.rbegin(); it != m_entries.rend(); ++ it)
+        if (it->first == key)
+            return it->second;
+    return nullptr;
+}
+
+void FillCache::insert(Key &&key, std::shared_ptr<const Value> value)
+{
+    std::scoped_lock<std::mutex> lock(m_mutex);
+    if (m_entries.size() >= m_max_entries)
+        m_entries.pop_front();
+    m_entries.emplace_back(std::move(key), std::move(value));
+}
+
+// Key of the infill produced by filler f for a surface with the given fill parameters.
+static FillCache::Key fill_cache_key(const Fill &f, InfillPattern pattern, const Surface &surface, const FillParams &params)
+{
+    FillCache::Key key;
+    key.pattern          = pattern;
+    key.expolygon        = surface.expolygon;
+    key.bridge_angle     = surface.bridge_angle;
+    key.thickness_layers = surface.thickness_layers;
+    key.odd_layer        = ((f.layer_id / std::max<size_t>(1, surface.thickness_layers)) & 1) != 0;
+    key.angle            = f.angle;
+    key.spacing          = f.spacing;
+    key.link_max_length  = f.link_max_length;
+    key.loop_clipping    = 0;
+    key.params           = params;
+    if (params.use_arachne) {
+        // The Arachne based infill is neither rotated nor alternated with the layers, thus it is shared by all the layers
+        // of the same height. The layer height is only considered by the Arachne based infill.
+        key.odd_layer     = false;
+        key.angle         = 0.f;
+        key.loop_clipping = f.loop_clipping;
+    } else
+        key.params.layer_height = 0.;
+    key.update_hash();
+    return key;
+}
+
+void Layer::make_fills(FillAdaptive::Octree* adaptive_fill_octree, FillAdaptive::Octree* support_fill_octree, FillLightning::Generator* lightning_generator, FillCache *fill_cache)
 {
 	this->clear_fills();
 
@@ -485,6 +589,17 @@ void Layer::make_fills(FillAdaptive::Octree* adaptive_fill_octree, FillAdaptive:
 #endif /* SLIC3R_DEBUG_SLICE_PROCESSING */
 
 	size_t first_object_layer_id = this->object()->get_layer(0)->id();
+
+    // Fillers and their parameters, one per SurfaceFill.
+    struct SurfaceFillJob {
+        SurfaceFill          *surface_fill;
+        std::unique_ptr<Fill> filler;
+        FillParams            params;
+        bool                  using_internal_flow;
+        bool                  use_fill_cache;
+    };
+    std::vector<SurfaceFillJob> jobs;
+    jobs.reserve(surface_fills.size());
     for (SurfaceFill &surface_fill : surface_fills) {
 		//skip patterns for which additional input is nullptr
 		switch (surface_fill.params.pattern) {
@@ -549,63 +664,115 @@ void Layer::make_fills(FillAdaptive::Octree* adaptive_fill_octree, FillAdaptive:
         params.use_arachne       = (perimeter_generator == PerimeterGeneratorType::Arachne && surface_fill.params.pattern == ipConcentric) || surface_fill.params.pattern == ipEnsuring;
         params.layer_height      = layerm.layer()->height;
 
-        for (ExPolygon &expoly : surface_fill.expolygons) {
+        const bool use_fill_cache = fill_cache != nullptr && FillCache::cacheable(surface_fill.params.pattern);
+        jobs.push_back({ &surface_fill, std::move(f), params, using_internal_flow, use_fill_cache });
+    }
+
+    // Generate the infill of all the ExPolygons of all the SurfaceFills in parallel, so that layers with a few large
+    // surfaces (the first layers of a large plate, flat parts) are spread over all the cores. This nests into the
+    // parallel loop over layers of PrintObject::infill(), TBB balances the two levels.
+    struct FillTask {
+        size_t         job_idx;
+        size_t         expolygon_idx;
+        Polylines      polylines;
+        ThickPolylines thick_polylines;
+        // Spacing is modified by the filler to indicate adjustments.
+        double         spacing;
+    };
+    std::vector<FillTask> tasks;
+    for (size_t job_idx = 0; job_idx < jobs.size(); ++ job_idx)
+        for (size_t expolygon_idx = 0; expolygon_idx < jobs[job_idx].surface_fill->expolygons.size(); ++ expolygon_idx)
+            tasks.push_back({ job_idx, expolygon_idx, {}, {}, 0. });
+
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, tasks.size()),
+        [&jobs, &tasks, fill_cache](const tbb::blocked_range<size_t> &range) {
+        // Fillers keep state while filling (spacing, pattern caches), thus each range works with its own copies.
+        std::vector<std::unique_ptr<Fill>> fillers(jobs.size());
+        for (size_t task_idx = range.begin(); task_idx < range.end(); ++ task_idx) {
+            FillTask       &task = tasks[task_idx];
+            SurfaceFillJob &job  = jobs[task.job_idx];
+            if (! fillers[task.job_idx])
+                fillers[task.job_idx].reset(job.filler->clone());
+            Fill          *f            = fillers[task.job_idx].get();
+            SurfaceFill   &surface_fill = *job.surface_fill;
 			// Spacing is modified by the filler to indicate adjustments. Reset it for each expolygon.
 			f->spacing = surface_fill.params.spacing;
-			surface_fill.surface.expolygon = std::move(expoly);
-            Polylines      polylines;
-            ThickPolylines thick_polylines;
-			try {
-                if (params.use_arachne)
-                    thick_polylines = f->fill_surface_arachne(&surface_fill.surface, params);
-                else
-				    polylines = f->fill_surface(&surface_fill.surface, params);
-			} catch (InfillFailedException &) {
-			}
-            if (!polylines.empty() || !thick_polylines.empty()) {
-                // calculate actual flow from spacing (which might have been adjusted by the infill
-		        // pattern generator)
-		        double flow_mm3_per_mm = surface_fill.params.flow.mm3_per_mm();
-		        double flow_width      = surface_fill.params.flow.width();
-		        if (using_internal_flow) {
-		            // if we used the internal flow we're not doing a solid infill
-		            // so we can safely ignore the slight variation that might have
-		            // been applied to f->spacing
-		        } else {
-		            Flow new_flow   = surface_fill.params.flow.with_spacing(float(f->spacing));
-		        	flow_mm3_per_mm = new_flow.mm3_per_mm();
-		        	flow_width      = new_flow.width();
-		        }
-		        // Save into layer.
-				ExtrusionEntityCollection* eec = nullptr;
-				auto fill_begin = uint32_t(layerm.fills().size());
-		        layerm.m_fills.entities.push_back(eec = new ExtrusionEntityCollection());
-		        // Only concentric fills are not sorted.
-		        eec->no_sort = f->no_sort();
-                if (params.use_arachne) {
-                    for (const ThickPolyline &thick_polyline : thick_polylines) {
-                        Flow new_flow = surface_fill.params.flow.with_spacing(float(f->spacing));
-
-                        ExtrusionMultiPath multi_path = PerimeterGenerator::thick_polyline_to_multi_path(thick_polyline, surface_fill.params.extrusion_role, new_flow, scaled<float>(0.05), float(SCALED_EPSILON));
-                        // Append paths to collection.
-                        if (!multi_path.empty()) {
-                            if (multi_path.paths.front().first_point() == multi_path.paths.back().last_point())
-                                eec->entities.emplace_back(new ExtrusionLoop(std::move(multi_path.paths)));
-                            else
-                                eec->entities.emplace_back(new ExtrusionMultiPath(std::move(multi_path)));
-                        }
+            Surface surface(surface_fill.surface, std::move(surface_fill.expolygons[task.expolygon_idx]));
+            FillCache::Key                          cache_key;
+            std::shared_ptr<const FillCache::Value> cached;
+            if (job.use_fill_cache) {
+                cache_key = fill_cache_key(*f, surface_fill.params.pattern, surface, job.params);
+                cached    = fill_cache->find(cache_key);
+            }
+            if (cached) {
+                task.polylines       = cached->polylines;
+                task.thick_polylines = cached->thick_polylines;
+                f->spacing           = cached->spacing;
+            } else {
+                try {
+                    if (job.params.use_arachne)
+                        task.thick_polylines = f->fill_surface_arachne(&surface, job.params);
+                    else
+                        task.polylines = f->fill_surface(&surface, job.params);
+                    if (job.use_fill_cache)
+                        fill_cache->insert(std::move(cache_key), std::make_shared<const FillCache::Value>(FillCache::Value{ task.polylines, f->spacing, task.thick_polylines }));
+                } catch (InfillFailedException &) {
+                }
+            }
+            task.spacing = f->spacing;
+        }
+    });
+
+    // Save the infill into the layer in the order of the SurfaceFills and their ExPolygons, independent of the scheduling above.
+    for (FillTask &task : tasks) {
+        SurfaceFillJob &job          = jobs[task.job_idx];
+        SurfaceFill    &surface_fill = *job.surface_fill;
+        LayerRegion    &layerm       = *m_regions[surface_fill.region_id];
+        Polylines      &polylines       = task.polylines;
+        ThickPolylines &thick_polylines = task.thick_polylines;
+        if (!polylines.empty() || !thick_polylines.empty()) {
+            // calculate actual flow from spacing (which might have been adjusted by the infill
+	        // pattern generator)
+	        double flow_mm3_per_mm = surface_fill.params.flow.mm3_per_mm();
+	        double flow_width      = surface_fill.params.flow.width();
+	        if (job.using_internal_flow) {
+	            // if we used the internal flow we're not doing a solid infill
+	            // so we can safely ignore the slight variation that might have
+	            // been applied to f->spacing
+	        } else {
+	            Flow new_flow   = surface_fill.params.flow.with_spacing(float(task.spacing));
+	        	flow_mm3_per_mm = new_flow.mm3_per_mm();
+	        	flow_width      = new_flow.width();
+	        }
+	        // Save into layer.
+			ExtrusionEntityCollection* eec = nullptr;
+			auto fill_begin = uint32_t(layerm.fills().size());
+	        layerm.m_fills.entities.push_back(eec = new ExtrusionEntityCollection());
+	        // Only concentric fills are not sorted.
+	        eec->no_sort = job.filler->no_sort();
+            if (job.params.use_arachne) {
+                for (const ThickPolyline &thick_polyline : thick_polylines) {
+                    Flow new_flow = surface_fill.params.flow.with_spacing(float(task.spacing));
+
+                    ExtrusionMultiPath multi_path = PerimeterGenerator::thick_polyline_to_multi_path(thick_polyline, surface_fill.params.extrusion_role, new_flow, scaled<float>(0.05), float(SCALED_EPSILON));
+                    // Append paths to collection.
+                    if (!multi_path.empty()) {
+                        if (multi_path.paths.front().first_point() == multi_path.paths.back().last_point())
+                            eec->entities.emplace_back(new ExtrusionLoop(std::move(multi_path.paths)));
+                        else
+                            eec->entities.emplace_back(new ExtrusionMultiPath(std::move(multi_path)));
                     }
-
-                    thick_polylines.clear();
-                } else {
-                    extrusion_entities_append_paths(
-                        eec->entities, std::move(polylines),
-                        surface_fill.params.extrusion_role,
-                        flow_mm3_per_mm, float(flow_width), surface_fill.params.flow.height());
                 }
-                insert_fills_into_islands(*this, uint32_t(surface_fill.region_id), fill_begin, uint32_t(layerm.fills().size()));
-		    }
-		}
+
+                thick_polylines.clear();
+            } else {
+                extrusion_entities_append_paths(
+                    eec->entities, std::move(polylines),
+                    surface_fill.params.extrusion_role,
+                    flow_mm3_per_mm, float(flow_width), surface_fill.params.flow.height());
+            }
+            insert_fills_into_islands(*this, uint32_t(surface_fill.region_id), fill_begin, uint32_t(layerm.fills().size()));
+	    }
     }
 
 	for (LayerSlice &lslice : this->lslices_ex)
@@ -640,6 +807,10 @@ void Layer::make_fills(FillAdaptive::Octree* adaptive_fill_octree, FillAdaptive:
 			}
 		}
 
+	// The fills are kept until the G-code is exported, don't waste memory on the spare capacity of the chained extrusions.
+	for (LayerRegion *layerm : m_regions)
+		layerm->m_fills.shrink_to_fit();
+
 #ifndef NDEBUG
 	for (LayerRegion *layerm : m_regions)
 	    for (const ExtrusionEntity *e : layerm->fills())
@@ -736,7 +907,7 @@ Polylines Layer::generate_sparse_infill_polylines_for_anchoring() const
 }
 
 // Create ironing extrusions over top surfaces.
-void Layer::make_ironing()
+void Layer::make_ironing(FillCache *fill_cache)
 {
 	// LayerRegion::slices contains surfaces marked with SurfaceType.
 	// Here we want to collect top surfaces extruded with the same extruder.
@@ -926,11 +1097,26 @@ void Layer::make_ironing()
         for (ExPolygon &expoly : ironing_areas) {
 			surface_fill.expolygon = std::move(expoly);
 			Polylines polylines;
-			try {
-                assert(!fill_params.use_arachne);
-				polylines = fill.fill_surface(&surface_fill, fill_params);
-			} catch (InfillFailedException &) {
-			}
+            // Ironing of the top surfaces of prismatic objects (or of all solid surfaces with IroningType::AllSolid) repeats
+            // over the layers the same way as the rectilinear infill does.
+            FillCache::Key                          cache_key;
+            std::shared_ptr<const FillCache::Value> cached;
+            if (fill_cache) {
+                cache_key = fill_cache_key(fill, ipMonotonic, surface_fill, fill_params);
+                cached    = fill_cache->find(cache_key);
+            }
+            if (cached) {
+                polylines    = cached->polylines;
+                fill.spacing = cached->spacing;
+            } else {
+                try {
+                    assert(!fill_params.use_arachne);
+                    polylines = fill.fill_surface(&surface_fill, fill_params);
+                    if (fill_cache)
+                        fill_cache->insert(std::move(cache_key), std::make_shared<const FillCache::Value>(FillCache::Value{ polylines, fill.spacing }));
+                } catch (InfillFailedException &) {
+                }
+            }
 	        if (! polylines.empty()) {
 		        // Save into layer.
 				auto fill_begin = uint32_t(ironing_params.layerm->fills().size());
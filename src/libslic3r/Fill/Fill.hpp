@@ -5,6 +5,10 @@
 #include <float.h>
 #include <stdint.h>
 
+#include <deque>
+#include <memory>
+#include <mutex>
+
 #include "../libslic3r.h"
 #include "../PrintConfig.hpp"
 
@@ -28,6 +32,55 @@ public:
     FillParams   params;
 };
 
+// Infill polylines of the rectilinear family of patterns (see FillRectilinear.hpp) shared between the layers of a PrintObject.
+// The sparse infill of prismatic objects repeats every other layer, these patterns only depend on the layer parity.
+// The thick polylines of FillEnsuring do not depend on the layer at all, they repeat over the thin vertical walls.
+class FillCache
+{
+public:
+    // All the inputs of Fill::fill_surface() and FillEnsuring::fill_surface_arachne(), which are not constant over a PrintObject.
+    struct Key {
+        InfillPattern   pattern;
+        ExPolygon       expolygon;
+        double          bridge_angle;
+        unsigned short  thickness_layers;
+        // Parity of the alternating infill direction, see Fill::_infill_direction().
+        bool            odd_layer;
+        float           angle;
+        coordf_t        spacing;
+        coord_t         link_max_length;
+        // Only used by the Arachne based infill, zero otherwise.
+        coord_t         loop_clipping;
+        FillParams      params;
+        size_t          hash { 0 };
+
+        void            update_hash();
+        bool            operator==(const Key &rhs) const;
+    };
+    struct Value {
+        Polylines       polylines;
+        // Spacing as adjusted by the filler.
+        coordf_t        spacing;
+        // Output of the Arachne based infill.
+        ThickPolylines  thick_polylines;
+    };
+
+    explicit FillCache(size_t max_entries = 64) : m_max_entries(max_entries) {}
+
+    // Patterns, which are cached by Layer::make_fills().
+    static bool                  cacheable(InfillPattern pattern);
+
+    // Returns nullptr if the key is not cached.
+    std::shared_ptr<const Value> find(const Key &key) const;
+    void                         insert(Key &&key, std::shared_ptr<const Value> value);
+
+private:
+    size_t                                                   m_max_entries;
+    mutable std::mutex                                       m_mutex;
+    // Oldest entries first.
+    std::deque<std::pair<Key, std::shared_ptr<const Value>>> m_entries;
+};
+
 } // namespace Slic3r
 
 #endif // slic3r_Fill_hpp_
@@ -62,47 +62,44 @@ static inline Polyline make_wave(
     return polyline;
 }
 
+// Emit the points strictly between lp and rp, subdividing the segment at its midpoint until the wave deviates less than the tolerance.
+// A segment is split based on its own end points only, therefore a depth first subdivision produces the points ordered by x
+// without re-evaluating the segments that are already fine enough.
+static void refine_wave_segment(const Vec2d &lp, const Vec2d &rp, double z_cos, double z_sin, bool vertical, bool flip, double tolerance, std::vector<Vec2d> &out)
+{
+    double x = lp(0) + (rp(0) - lp(0)) / 2;
+    Vec2d  ip{ x, f(x, z_sin, z_cos, vertical, flip) };
+    if (std::abs(cross2(Vec2d(ip - lp), Vec2d(ip - rp))) > sqr(tolerance)) {
+        refine_wave_segment(lp, ip, z_cos, z_sin, vertical, flip, tolerance, out);
+        out.emplace_back(ip);
+        refine_wave_segment(ip, rp, z_cos, z_sin, vertical, flip, tolerance, out);
+    }
+}
+
 static std::vector<Vec2d> make_one_period(double width, double scaleFactor, double z_cos, double z_sin, bool vertical, bool flip, double tolerance)
 {
-    std::vector<Vec2d> points;
+    std::vector<Vec2d> coarse;
     double dx = M_PI_2; // exact coordinates on main inflexion lobes
     double limit = std::min(2*M_PI, width);
-    points.reserve(coord_t(ceil(limit / tolerance / 3)));
 
     for (double x = 0.; x < limit - EPSILON; x += dx) {
-        points.emplace_back(Vec2d(x, f(x, z_sin, z_cos, vertical, flip)));
+        coarse.emplace_back(Vec2d(x, f(x, z_sin, z_cos, vertical, flip)));
     }
-    points.emplace_back(Vec2d(limit, f(limit, z_sin, z_cos, vertical, flip)));
+    coarse.emplace_back(Vec2d(limit, f(limit, z_sin, z_cos, vertical, flip)));
 
     // piecewise increase in resolution up to requested tolerance
-    for(;;)
-    {
-        size_t size = points.size();
-        for (unsigned int i = 1;i < size; ++i) {
-            auto& lp = points[i-1]; // left point
-            auto& rp = points[i];   // right point
-            double x = lp(0) + (rp(0) - lp(0)) / 2;
-            double y = f(x, z_sin, z_cos, vertical, flip);
-            Vec2d ip = {x, y};
-            if (std::abs(cross2(Vec2d(ip - lp), Vec2d(ip - rp))) > sqr(tolerance)) {
-                points.emplace_back(std::move(ip));
-            }
-        }
-
-        if (size == points.size())
-            break;
-        else
-        {
-            // insert new points in order
-            std::sort(points.begin(), points.end(),
-                      [](const Vec2d &lhs, const Vec2d &rhs) { return lhs(0) < rhs(0); });
-        }
+    std::vector<Vec2d> points;
+    points.reserve(coord_t(ceil(limit / tolerance / 3)));
+    points.emplace_back(coarse.front());
+    for (size_t i = 1; i < coarse.size(); ++ i) {
+        refine_wave_segment(coarse[i - 1], coarse[i], z_cos, z_sin, vertical, flip, tolerance, points);
+        points.emplace_back(coarse[i]);
     }
 
     return points;
 }
 
-static Polylines make_gyroid_waves(double gridZ, double density_adjusted, double line_spacing, double width, double height)
+static Polylines make_gyroid_waves(double gridZ, double density_adjusted, double line_spacing, double width, double height, FillGyroid::WaveCache &cache)
 {
     const double scaleFactor = scale_(line_spacing) / density_adjusted;
 
@@ -127,9 +124,20 @@ static Polylines make_gyroid_waves(double gridZ, double density_adjusted, double
         std::swap(width,height);
     }
 
-    std::vector<Vec2d> one_period_odd = make_one_period(width, scaleFactor, z_cos, z_sin, vertical, flip, tolerance); // creates one period of the waves, so it doesn't have to be recalculated all the time
-    flip = !flip;                                                                   // even polylines are a bit shifted
-    std::vector<Vec2d> one_period_even = make_one_period(width, scaleFactor, z_cos, z_sin, vertical, flip, tolerance);
+    // One period of the waves only depends on z, scale and on the width if narrower than a single period,
+    // thus it is shared by all the islands filled at the same layer with the same spacing.
+    const double limit = std::min(2*M_PI, width);
+    if (cache.one_period_odd.empty() || cache.z != z || cache.scale_factor != scaleFactor || cache.tolerance != tolerance || cache.limit != limit) {
+        cache.z               = z;
+        cache.scale_factor    = scaleFactor;
+        cache.tolerance       = tolerance;
+        cache.limit           = limit;
+        cache.one_period_odd  = make_one_period(width, scaleFactor, z_cos, z_sin, vertical, flip, tolerance); // creates one period of the waves, so it doesn't have to be recalculated all the time
+        cache.one_period_even = make_one_period(width, scaleFactor, z_cos, z_sin, vertical, ! flip, tolerance); // even polylines are a bit shifted
+    }
+    const std::vector<Vec2d> &one_period_odd  = cache.one_period_odd;
+    const std::vector<Vec2d> &one_period_even = cache.one_period_even;
+    flip = !flip;
     Polylines result;
 
     for (double y0 = lower_bound; y0 < upper_bound + EPSILON; y0 += M_PI) {
@@ -174,7 +182,8 @@ void FillGyroid::_fill_surface_single(
         density_adjusted,
         this->spacing,
         ceil(bb.size()(0) / distance) + 1.,
-        ceil(bb.size()(1) / distance) + 1.);
+        ceil(bb.size()(1) / distance) + 1.,
+        m_wave_cache);
 
 	// shift the polyline to the grid origin
 	for (Polyline &pl : polylines)
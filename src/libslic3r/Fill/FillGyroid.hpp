@@ -26,6 +26,15 @@ public:
     // Gyroid upper resolution tolerance (mm^-2)
     static constexpr double PatternTolerance = 0.2;
 
+    // One period of the odd and even waves, reused by the islands of a layer.
+    struct WaveCache {
+        double             z            { 0. };
+        double             scale_factor { 0. };
+        double             tolerance    { 0. };
+        double             limit        { 0. };
+        std::vector<Vec2d> one_period_odd;
+        std::vector<Vec2d> one_period_even;
+    };
 
 protected:
     void _fill_surface_single(
@@ -34,6 +43,9 @@ protected:
         const std::pair<float, Point>   &direction, 
         ExPolygon                        expolygon,
         Polylines                       &polylines_out) override;
+
+private:
+    WaveCache m_wave_cache;
 };
 
 } // namespace Slic3r
@@ -13,6 +13,12 @@ public:
     void            add_point(const Vec2d &pt);
     Points&&        result() { return std::move(m_out); }
     bool            clips() const override { return true; }
+    // Is the axis aligned rectangle of unscaled points strictly outside of the clipping bounding box?
+    bool            outside(const Vec2d &min, const Vec2d &max) const {
+        const Point pmin{ this->scaled(min) };
+        const Point pmax{ this->scaled(max) };
+        return pmax.x() < m_bbox.min.x() || pmin.x() > m_bbox.max.x() || pmax.y() < m_bbox.min.y() || pmin.y() > m_bbox.max.y();
+    }
 
 private:
     enum class Side {
@@ -181,32 +187,48 @@ void FillArchimedeanChords::generate(coord_t min_x, coord_t min_y, coord_t max_x
 //            |  |
 //            2--1
 //
-static inline Point hilbert_n_to_xy(const size_t n)
-{
+namespace hilbert {
     static constexpr const int next_state[16] { 4,0,0,12, 0,4,4,8, 12,8,8,4, 8,12,12,0 };
     static constexpr const int digit_to_x[16] { 0,1,1,0, 0,0,1,1, 1,0,0,1, 1,1,0,0 };
     static constexpr const int digit_to_y[16] { 0,0,1,1, 0,1,1,0, 1,1,0,0, 1,0,0,1 };
 
-    // Number of 2 bit digits.
-    size_t ndigits = 0;
+    // Corner of the sub-square of size 2^level and the given state, where the curve enters (digit = 0) or leaves it (digit = 3).
+    static inline Point end_point(int state, coord_t x, coord_t y, int level, int digit)
     {
-        size_t nc = n;
-        while(nc > 0) {
-            nc >>= 2;
-            ++ ndigits;
+        for (int i = level - 1; i >= 0; -- i) {
+            state += digit;
+            x += coord_t(digit_to_x[state]) << i;
+            y += coord_t(digit_to_y[state]) << i;
+            state = next_state[state];
         }
+        return Point(x, y);
     }
-    int state = (ndigits & 1) ? 4 : 0;
-    coord_t x = 0;
-    coord_t y = 0;
-    for (int i = (int)ndigits - 1; i >= 0; -- i) {
-        int digit = (n >> (i * 2)) & 3;
-        state += digit;
-        x |= digit_to_x[state] << i;
-        y |= digit_to_y[state] << i;
-        state = next_state[state];
+}
+
+// Emit the points of the sub-square of size 2^level with the lower left corner at (x, y), traversed in the given state.
+// Sub-squares completely outside of the clipping region are replaced by their entry and exit points: The entry and exit points
+// of a Hilbert sub-square lie on a common side of the sub-square, thus the replacing segment does not enter the clipping region
+// and the clipped curve is not changed.
+template<typename Output>
+static void generate_hilbert_square(int state, coord_t x, coord_t y, int level, const Point &offset, Output &output)
+{
+    if (level == 0) {
+        output.add_point({ x + offset.x(), y + offset.y() });
+        return;
+    }
+    const coord_t size = coord_t(1) << level;
+    if (level > 1 && output.outside(Vec2d(x + offset.x(), y + offset.y()), Vec2d(x + offset.x() + size - 1, y + offset.y() + size - 1))) {
+        const Point first = hilbert::end_point(state, x, y, level, 0);
+        const Point last  = hilbert::end_point(state, x, y, level, 3);
+        output.add_point({ first.x() + offset.x(), first.y() + offset.y() });
+        output.add_point({ last.x()  + offset.x(), last.y()  + offset.y() });
+        return;
+    }
+    const int child = level - 1;
+    for (int digit = 0; digit < 4; ++ digit) {
+        const int s = state + digit;
+        generate_hilbert_square(hilbert::next_state[s], x + (coord_t(hilbert::digit_to_x[s]) << child), y + (coord_t(hilbert::digit_to_y[s]) << child), child, offset, output);
     }
-    return Point(x, y);
 }
 
 template<typename Output>
@@ -223,12 +245,10 @@ static void generate_hilbert_curve(coord_t min_x, coord_t min_y, coord_t max_x,
         }
     }
 
-    size_t sz2 = sz * sz;
-    output.reserve(sz2);
-    for (size_t i = 0; i < sz2; ++ i) {
-        Point p = hilbert_n_to_xy(i);
-        output.add_point({ p.x() + min_x, p.y() + min_y });
-    }
+    if (! output.clips())
+        output.reserve(sz * sz);
+    // With an odd number of base 4 digits, the curve starts transposed.
+    generate_hilbert_square((pw & 1) ? 4 : 0, 0, 0, int(pw), Point(min_x, min_y), output);
 }
 
 void FillHilbertCurve::generate(coord_t min_x, coord_t min_y, coord_t max_x, coord_t max_y, const double /* resolution */, InfillPolylineOutput &output)
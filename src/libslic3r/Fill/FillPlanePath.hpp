@@ -38,6 +38,8 @@ protected:
         void            add_point(const Vec2d& pt) { m_out.emplace_back(this->scaled(pt)); }
         Points&& result() { return std::move(m_out); }
         virtual bool    clips() const { return false; }
+        // Only the clipping output skips the parts of the pattern outside of its bounding box.
+        bool            outside(const Vec2d & /* min */, const Vec2d & /* max */) const { return false; }
 
     protected:
         const Point     scaled(const Vec2d &fpt) const { return { coord_t(floor(fpt.x() * m_scale_out + 0.5)), coord_t(floor(fpt.y() * m_scale_out + 0.5)) }; }
@@ -39,6 +39,8 @@ namespace pt = boost::property_tree;
 
 #include <fast_float/fast_float.h>
 
+#include "libslic3r/Execution/ExecutionTBB.hpp"
+
 // Slightly faster than sprintf("%.9g"), but there is an issue with the karma floating point formatter,
 // https://github.com/boostorg/spirit/pull/586
 // where the exported string is one digit shorter than it should be to guarantee lossless round trip.
@@ -344,9 +346,13 @@ namespace Slic3r {
         {
             std::vector<Vec3f> vertices;
             std::vector<Vec3i> triangles;
-            std::vector<std::string> custom_supports;
-            std::vector<std::string> custom_seam;
-            std::vector<std::string> mmu_segmentation;
+            // Serialized painting of the painted triangles only, pairs of a triangle index and the painting string,
+            // sorted by the triangle index. Most triangles are not painted at all, storing an empty string
+            // for each of them cost time and memory for large meshes.
+            using TrianglesPainting = std::vector<std::pair<int, std::string>>;
+            TrianglesPainting custom_supports;
+            TrianglesPainting custom_seam;
+            TrianglesPainting mmu_segmentation;
 
             bool empty() { return vertices.empty() || triangles.empty(); }
 
@@ -1462,7 +1468,13 @@ namespace Slic3r {
         bool res = true;
         unsigned int num_attributes = (unsigned int)XML_GetSpecifiedAttributeCount(m_xml_parser);
 
-        if (::strcmp(MODEL_TAG, name) == 0)
+        // The vertices and triangles make up most of the elements of a model
+        // file, test them first.
+        if (::strcmp(VERTEX_TAG, name) == 0)
+            res = _handle_start_vertex(attributes, num_attributes);
+        else if (::strcmp(TRIANGLE_TAG, name) == 0)
+            res = _handle_start_triangle(attributes, num_attributes);
+        else if (::strcmp(MODEL_TAG, name) == 0)
             res = _handle_start_model(attributes, num_attributes);
         else if (::strcmp(RESOURCES_TAG, name) == 0)
             res = _handle_start_resources(attributes, num_attributes);
@@ -1472,12 +1484,8 @@ namespace Slic3r {
             res = _handle_start_mesh(attributes, num_attributes);
         else if (::strcmp(VERTICES_TAG, name) == 0)
             res = _handle_start_vertices(attributes, num_attributes);
-        else if (::strcmp(VERTEX_TAG, name) == 0)
-            res = _handle_start_vertex(attributes, num_attributes);
         else if (::strcmp(TRIANGLES_TAG, name) == 0)
             res = _handle_start_triangles(attributes, num_attributes);
-        else if (::strcmp(TRIANGLE_TAG, name) == 0)
-            res = _handle_start_triangle(attributes, num_attributes);
         else if (::strcmp(COMPONENTS_TAG, name) == 0)
             res = _handle_start_components(attributes, num_attributes);
         else if (::strcmp(COMPONENT_TAG, name) == 0)
@@ -1727,10 +1735,18 @@ namespace Slic3r {
     {
         // appends the vertex coordinates
         // missing values are set equal to ZERO
-        m_curr_object.geometry.vertices.emplace_back(
-            m_unit_factor * get_attribute_value_float(attributes, num_attributes, X_ATTR),
-            m_unit_factor * get_attribute_value_float(attributes, num_attributes, Y_ATTR),
-            m_unit_factor * get_attribute_value_float(attributes, num_attributes, Z_ATTR));
+        // the attributes are visited just once, there are millions of vertices in large models
+        Vec3f v = Vec3f::Zero();
+        if (attributes != nullptr && num_attributes % 2 == 0) {
+            for (unsigned int a = 0; a < num_attributes; a += 2) {
+                const char *key  = attributes[a];
+                const char *text = attributes[a + 1];
+                int axis = ::strcmp(key, X_ATTR) == 0 ? 0 : ::strcmp(key, Y_ATTR) == 0 ? 1 : ::strcmp(key, Z_ATTR) == 0 ? 2 : -1;
+                if (axis >= 0)
+                    fast_float::from_chars(text, text + strlen(text), v(axis));
+            }
+        }
+        m_curr_object.geometry.vertices.emplace_back(m_unit_factor * v);
         return true;
     }
 
@@ -1744,6 +1760,9 @@ namespace Slic3r {
     {
         // reset current triangles
         m_curr_object.geometry.triangles.clear();
+        m_curr_object.geometry.custom_supports.clear();
+        m_curr_object.geometry.custom_seam.clear();
+        m_curr_object.geometry.mmu_segmentation.clear();
         return true;
     }
 
@@ -1764,14 +1783,35 @@ namespace Slic3r {
 
         // appends the triangle's vertices indices
         // missing values are set equal to ZERO
-        m_curr_object.geometry.triangles.emplace_back(
-            get_attribute_value_int(attributes, num_attributes, V1_ATTR),
-            get_attribute_value_int(attributes, num_attributes, V2_ATTR),
-            get_attribute_value_int(attributes, num_attributes, V3_ATTR));
-
-        m_curr_object.geometry.custom_supports.push_back(get_attribute_value_string(attributes, num_attributes, CUSTOM_SUPPORTS_ATTR));
-        m_curr_object.geometry.custom_seam.push_back(get_attribute_value_string(attributes, num_attributes, CUSTOM_SEAM_ATTR));
-        m_curr_object.geometry.mmu_segmentation.push_back(get_attribute_value_string(attributes, num_attributes, MMU_SEGMENTATION_ATTR));
+        // the attributes are visited just once, there are millions of triangles in large models
+        Vec3i tri = Vec3i::Zero();
+        const char *custom_supports  = nullptr;
+        const char *custom_seam      = nullptr;
+        const char *mmu_segmentation = nullptr;
+        if (attributes != nullptr && num_attributes % 2 == 0) {
+            for (unsigned int a = 0; a < num_attributes; a += 2) {
+                const char *key  = attributes[a];
+                const char *text = attributes[a + 1];
+                if (int idx = ::strcmp(key, V1_ATTR) == 0 ? 0 : ::strcmp(key, V2_ATTR) == 0 ? 1 : ::strcmp(key, V3_ATTR) == 0 ? 2 : -1; idx >= 0)
+                    boost::spirit::qi::parse(text, text + strlen(text), boost::spirit::qi::int_, tri(idx));
+                else if (custom_supports == nullptr && ::strcmp(key, CUSTOM_SUPPORTS_ATTR) == 0)
+                    custom_supports = text;
+                else if (custom_seam == nullptr && ::strcmp(key, CUSTOM_SEAM_ATTR) == 0)
+                    custom_seam = text;
+                else if (mmu_segmentation == nullptr && ::strcmp(key, MMU_SEGMENTATION_ATTR) == 0)
+                    mmu_segmentation = text;
+            }
+        }
+        Geometry &geometry = m_curr_object.geometry;
+        const int tri_idx  = int(geometry.triangles.size());
+        geometry.triangles.emplace_back(tri);
+
+        if (custom_supports != nullptr && *custom_supports != 0)
+            geometry.custom_supports.emplace_back(tri_idx, custom_supports);
+        if (custom_seam != nullptr && *custom_seam != 0)
+            geometry.custom_seam.emplace_back(tri_idx, custom_seam);
+        if (mmu_segmentation != nullptr && *mmu_segmentation != 0)
+            geometry.mmu_segmentation.emplace_back(tri_idx, mmu_segmentation);
         return true;
     }
 
@@ -2208,24 +2248,19 @@ namespace Slic3r {
                 volume->source.transform = Slic3r::Geometry::Transformation(volume_matrix_to_object);
 
             // recreate custom supports, seam and mmu segmentation from previously loaded attribute
-            volume->supported_facets.reserve(triangles_count);
-            volume->seam_facets.reserve(triangles_count);
-            volume->mmu_segmentation_facets.reserve(triangles_count);
-            for (size_t i=0; i<triangles_count; ++i) {
-                size_t index = volume_data.first_triangle_id + i;
-                assert(index < geometry.custom_supports.size());
-                assert(index < geometry.custom_seam.size());
-                assert(index < geometry.mmu_segmentation.size());
-                if (! geometry.custom_supports[index].empty())
-                    volume->supported_facets.set_triangle_from_string(i, geometry.custom_supports[index]);
-                if (! geometry.custom_seam[index].empty())
-                    volume->seam_facets.set_triangle_from_string(i, geometry.custom_seam[index]);
-                if (! geometry.mmu_segmentation[index].empty())
-                    volume->mmu_segmentation_facets.set_triangle_from_string(i, geometry.mmu_segmentation[index]);
-            }
-            volume->supported_facets.shrink_to_fit();
-            volume->seam_facets.shrink_to_fit();
-            volume->mmu_segmentation_facets.shrink_to_fit();
+            auto set_painting = [&volume_data](const Geometry::TrianglesPainting &painting, FacetsAnnotation &facets) {
+                auto from = std::lower_bound(painting.begin(), painting.end(), int(volume_data.first_triangle_id),
+                    [](const std::pair<int, std::string> &p, int idx) { return p.first < idx; });
+                auto to   = std::upper_bound(from, painting.end(), int(volume_data.last_triangle_id),
+                    [](int idx, const std::pair<int, std::string> &p) { return idx < p.first; });
+                facets.reserve(int(to - from));
+                for (auto it = from; it != to; ++ it)
+                    facets.set_triangle_from_string(it->first - int(volume_data.first_triangle_id), it->second);
+                facets.shrink_to_fit();
+            };
+            set_painting(geometry.custom_supports, volume->supported_facets);
+            set_painting(geometry.custom_seam, volume->seam_facets);
+            set_painting(geometry.mmu_segmentation, volume->mmu_segmentation_facets);
             auto &tc = volume_data.text_configuration;
             if (tc.has_value()) {
                 volume->text_configuration = std::move(tc);
@@ -2810,7 +2845,34 @@ namespace Slic3r {
 #endif
         };
 
-        char buf[256];
+        // Formats the elements [0, count) with format_element(i, out) in parallel and appends them
+        // to the output buffer in order. The elements are formatted in chunks, a window of chunks
+        // at a time, so that the formatted text of a huge mesh is never held in memory at once.
+        auto append_parallel = [&output_buffer, &flush](size_t count, auto &&format_element) {
+            static constexpr size_t ChunkSize = 4096;
+            std::vector<std::string> chunks(4 * execution::max_concurrency(ex_tbb));
+            for (size_t window_begin = 0; window_begin < count; window_begin += chunks.size() * ChunkSize) {
+                size_t num_chunks = std::min(chunks.size(), (count - window_begin + ChunkSize - 1) / ChunkSize);
+                execution::for_each(ex_tbb, size_t(0), num_chunks,
+                    [&chunks, &format_element, window_begin, count](size_t chunk_idx) {
+                        // The numeric locale is set per thread.
+                        CNumericLocalesSetter locales_setter;
+                        std::string &out = chunks[chunk_idx];
+                        out.clear();
+                        size_t begin = window_begin + chunk_idx * ChunkSize;
+                        size_t end   = std::min(count, begin + ChunkSize);
+                        for (size_t i = begin; i < end; ++ i)
+                            format_element(i, out);
+                    });
+                for (size_t chunk_idx = 0; chunk_idx < num_chunks; ++ chunk_idx) {
+                    output_buffer += chunks[chunk_idx];
+                    if (! flush())
+                        return false;
+                }
+            }
+            return true;
+        };
+
         unsigned int vertices_count = 0;
         for (ModelVolume* volume : object.volumes) {
             if (volume == nullptr)
@@ -2827,8 +2889,9 @@ namespace Slic3r {
             vertices_count += (int)its.vertices.size();
 
             const Transform3d& matrix = volume->get_matrix();
-            for (const auto& vertex: its.vertices) {
-                Vec3f v = (matrix * vertex.cast<double>()).cast<float>();
+            bool ok = append_parallel(its.vertices.size(), [&its, &matrix, &format_coordinate](size_t i, std::string &out) {
+                char buf[256];
+                Vec3f v = (matrix * its.vertices[i].cast<double>()).cast<float>();
                 char *ptr = buf;
                 boost::spirit::karma::generate(ptr, boost::spirit::lit("     <") << VERTEX_TAG << " x=\"");
                 ptr = format_coordinate(v.x(), ptr);
@@ -2837,11 +2900,10 @@ namespace Slic3r {
                 boost::spirit::karma::generate(ptr, "\" z=\"");
                 ptr = format_coordinate(v.z(), ptr);
                 boost::spirit::karma::generate(ptr, "\"/>\n");
-                *ptr = '\0';
-                output_buffer += buf;
-                if (! flush())
-                    return false;
-            }
+                out.append(buf, ptr);
+            });
+            if (! ok)
+                return false;
         }
 
         output_buffer += "    </";
@@ -2866,53 +2928,54 @@ namespace Slic3r {
             triangles_count += (int)its.indices.size();
             volume_it->second.last_triangle_id = triangles_count - 1;
 
-            for (int i = 0; i < int(its.indices.size()); ++ i) {
+            const int first_vertex_id = volume_it->second.first_vertex_id;
+            bool ok = append_parallel(its.indices.size(), [&its, volume, is_left_handed, first_vertex_id](size_t triangle_idx, std::string &out) {
+                int i = int(triangle_idx);
                 {
                     const Vec3i &idx = its.indices[i];
+                    char buf[256];
                     char *ptr = buf;
                     boost::spirit::karma::generate(ptr, boost::spirit::lit("     <") << TRIANGLE_TAG <<
                         " v1=\"" << boost::spirit::int_ <<
                         "\" v2=\"" << boost::spirit::int_ <<
                         "\" v3=\"" << boost::spirit::int_ << "\"",
-                        idx[is_left_handed ? 2 : 0] + volume_it->second.first_vertex_id,
-                        idx[1] + volume_it->second.first_vertex_id,
-                        idx[is_left_handed ? 0 : 2] + volume_it->second.first_vertex_id);
-                    *ptr = '\0';
-                    output_buffer += buf;
+                        idx[is_left_handed ? 2 : 0] + first_vertex_id,
+                        idx[1] + first_vertex_id,
+                        idx[is_left_handed ? 0 : 2] + first_vertex_id);
+                    out.append(buf, ptr);
                 }
 
                 std::string custom_supports_data_string = volume->supported_facets.get_triangle_as_string(i);
                 if (! custom_supports_data_string.empty()) {
-                    output_buffer += " ";
-                    output_buffer += CUSTOM_SUPPORTS_ATTR;
-                    output_buffer += "=\"";
-                    output_buffer += custom_supports_data_string;
-                    output_buffer += "\"";
+                    out += " ";
+                    out += CUSTOM_SUPPORTS_ATTR;
+                    out += "=\"";
+                    out += custom_supports_data_string;
+                    out += "\"";
                 }
 
                 std::string custom_seam_data_string = volume->seam_facets.get_triangle_as_string(i);
                 if (! custom_seam_data_string.empty()) {
-                    output_buffer += " ";
-                    output_buffer += CUSTOM_SEAM_ATTR;
-                    output_buffer += "=\"";
-                    output_buffer += custom_seam_data_string;
-                    output_buffer += "\"";
+                    out += " ";
+                    out += CUSTOM_SEAM_ATTR;
+                    out += "=\"";
+                    out += custom_seam_data_string;
+                    out += "\"";
                 }
 
                 std::string mmu_painting_data_string = volume->mmu_segmentation_facets.get_triangle_as_string(i);
                 if (! mmu_painting_data_string.empty()) {
-                    output_buffer += " ";
-                    output_buffer += MMU_SEGMENTATION_ATTR;
-                    output_buffer += "=\"";
-                    output_buffer += mmu_painting_data_string;
-                    output_buffer += "\"";
+                    out += " ";
+                    out += MMU_SEGMENTATION_ATTR;
+                    out += "=\"";
+                    out += mmu_painting_data_string;
+                    out += "\"";
                 }
 
-                output_buffer += "/>\n";
-
-                if (! flush())
-                    return false;
-            }
+                out += "/>\n";
+            });
+            if (! ok)
+                return false;
         }
 
         output_buffer += "    </";
@@ -161,7 +161,8 @@ std::unique_ptr<sla::RasterBase> SL1Archive::create_raster() const
 
 sla::RasterEncoder SL1Archive::get_encoder() const
 {
-    return sla::PNGRasterEncoder{};
+    // Thousands of layer masks are written, trade a slightly larger archive for the encoding speed.
+    return sla::PNGRasterEncoder{png::EncodeMode::Fast};
 }
 
 static void write_thumbnail(Zipper &zipper, const ThumbnailData &data)
@@ -211,7 +212,11 @@ void SL1Archive::export_print(Zipper               &zipper,
             std::string imgname = project + string_printf("%.5d", i++) + "." +
                                   rst.extension();
 
-            zipper.add_entry(imgname.c_str(), rst.data(), rst.size());
+            if (rst.deflated())
+                zipper.add_deflated_entry(imgname, rst.data(), rst.size(),
+                                          rst.inflated_size(), rst.crc32());
+            else
+                zipper.add_entry(imgname.c_str(), rst.data(), rst.size());
         }
 
         for (const ThumbnailData& data : thumbnails)
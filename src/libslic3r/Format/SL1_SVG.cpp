@@ -4,6 +4,8 @@
 #include "libslic3r/ClipperUtils.hpp"
 #include "libslic3r/BoundingBox.hpp"
 #include "libslic3r/Format/ZipperArchiveImport.hpp"
+#include "libslic3r/Exception.hpp"
+#include "libslic3r/miniz_extension.hpp"
 
 #define NANOSVG_IMPLEMENTATION
 #include "nanosvg/nanosvg.h"
@@ -176,18 +178,39 @@ public:
     Trafo trafo() const override { return m_trafo; }
 
     // The encoder is ignored here, the svg text does not need any further
-    // encoding.
+    // encoding. The text is deflated right away though, as the layers are
+    // encoded in parallel (see SLAArchiveWriter::draw_layers()): only the
+    // compressed layers are kept in memory and they are stored into the
+    // archive without being compressed again.
     sla::EncodedRaster encode(sla::RasterEncoder /*encoder*/) const override
     {
-        std::vector<uint8_t> data;
         constexpr auto finish = "</svg>\n"sv;
 
-        data.reserve(m_svg.size() + std::size(finish));
-
-        std::copy(m_svg.begin(), m_svg.end(), std::back_inserter(data));
-        std::copy(finish.begin(), finish.end() - 1, std::back_inserter(data));
-
-        return sla::EncodedRaster{std::move(data), "svg"};
+        std::vector<uint8_t> data;
+        auto put_buf = [](const void *buf, int len, void *user) -> mz_bool {
+            auto &out = *static_cast<std::vector<uint8_t> *>(user);
+            auto  ptr = static_cast<const uint8_t *>(buf);
+            out.insert(out.end(), ptr, ptr + len);
+            return MZ_TRUE;
+        };
+
+        std::unique_ptr<tdefl_compressor, decltype(&tdefl_compressor_free)>
+            compressor{tdefl_compressor_alloc(), &tdefl_compressor_free};
+        if (!compressor)
+            throw RuntimeError("Not enough memory to compress an SVG layer.");
+
+        // Raw deflate stream (negative window bits), as stored in a zip archive.
+        mz_uint flags = tdefl_create_comp_flags_from_zip_params(
+            MZ_BEST_COMPRESSION, -MZ_DEFAULT_WINDOW_BITS, MZ_DEFAULT_STRATEGY);
+        tdefl_init(compressor.get(), put_buf, &data, int(flags));
+        tdefl_compress_buffer(compressor.get(), m_svg.data(), m_svg.size(), TDEFL_NO_FLUSH);
+        if (tdefl_compress_buffer(compressor.get(), finish.data(), finish.size(), TDEFL_FINISH) != TDEFL_STATUS_DONE)
+            throw RuntimeError("Failed to compress an SVG layer.");
+
+        mz_ulong crc = mz_crc32(MZ_CRC32_INIT, reinterpret_cast<const uint8_t *>(m_svg.data()), m_svg.size());
+        crc = mz_crc32(crc, reinterpret_cast<const uint8_t *>(finish.data()), finish.size());
+
+        return sla::EncodedRaster{std::move(data), "svg", m_svg.size() + finish.size(), uint32_t(crc)};
     }
 };
 
@@ -237,7 +260,7 @@ void SL1_SVGArchive::export_print(const std::string     fname,
 {
     // Export code is completely identical to SL1, only the compression level
     // is elevated, as the SL1 has already compressed PNGs with deflate,
-    // but the svg is just text.
+    // but the config is just text. The svg layers are deflated already.
     Zipper zipper{fname, Zipper::TIGHT_COMPRESSION};
 
     SL1Archive::export_print(zipper, print, thumbnails, projectname);
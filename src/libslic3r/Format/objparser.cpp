@@ -1,16 +1,30 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <boost/filesystem.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
 #include <boost/log/trivial.hpp>
 #include <boost/nowide/cstdio.hpp>
 
 #include "objparser.hpp"
 
 #include "libslic3r/LocalesUtils.hpp"
+#include "libslic3r/Execution/ExecutionTBB.hpp"
 
 namespace ObjParser {
 
-static bool obj_parseline(const char *line, ObjData &data)
+// Face vertex, which references a coordinate, texture coordinate or normal relative to the end of the list
+// parsed so far. The relative references are resolved against the data of a single chunk of the file
+// and shifted when the chunks are merged.
+struct ObjRelativeVertex
+{
+	size_t	vertexIdx;
+	bool	coord;
+	bool	textureCoord;
+	bool	normal;
+};
+
+static bool obj_parseline(const char *line, ObjData &data, std::vector<ObjRelativeVertex> &relative_vertices)
 {
 #define EATWS() while (*line == ' ' || *line == '\t') ++ line
 
@@ -217,18 +231,21 @@ static bool obj_parseline(const char *line, ObjData &data)
 					line = endptr;
 				}
 			}
-			if (vertex.coordIdx < 0)
+			ObjRelativeVertex relative { data.vertices.size(), vertex.coordIdx < 0, vertex.textureCoordIdx < 0, vertex.normalIdx < 0 };
+			if (relative.coord)
                 vertex.coordIdx += (int)data.coordinates.size() / 4;
             else
 				-- vertex.coordIdx;
-			if (vertex.normalIdx < 0)
+			if (relative.normal)
                 vertex.normalIdx += (int)data.normals.size() / 3;
             else
 				-- vertex.normalIdx;
-			if (vertex.textureCoordIdx < 0)
+			if (relative.textureCoord)
                 vertex.textureCoordIdx += (int)data.textureCoordinates.size() / 3;
             else
 				-- vertex.textureCoordIdx;
+			if (relative.coord || relative.textureCoord || relative.normal)
+				relative_vertices.push_back(relative);
 			data.vertices.push_back(vertex);
 			EATWS();
 		}
@@ -324,81 +341,200 @@ static bool obj_parseline(const char *line, ObjData &data)
 	return true;
 }
 
+// Maximum length of a line, longer lines are considered an error.
+static constexpr size_t MaxLineLength = 65536;
+
+// Parse the lines of [begin, end) into a chunk local ObjData. The last line has to be terminated with a new line.
+static bool obj_parsechunk(const char *begin, const char *end, ObjData &data, std::vector<ObjRelativeVertex> &relative_vertices)
+{
+	// obj_parseline() expects a zero terminated line, while the input may be a read-only memory mapped file.
+	char line[MaxLineLength + 1];
+	for (const char *it = begin; it != end;) {
+		const char *line_end = it;
+		while (*line_end != '\r' && *line_end != '\n')
+			++ line_end;
+		while (it != line_end && (*it == ' ' || *it == '\t'))
+			++ it;
+		size_t len = line_end - it;
+		if (len > MaxLineLength) {
+	    	BOOST_LOG_TRIVIAL(error) << "ObjParser: Excessive line length";
+			return false;
+		}
+		memcpy(line, it, len);
+		line[len] = 0;
+		//FIXME check the return value and exit on error?
+		// Will it break parsing of some obj files?
+		obj_parseline(line, data, relative_vertices);
+		it = line_end + 1;
+	}
+	return true;
+}
+
+// Append a chunk parsed by obj_parsechunk() to data, shifting the vertex indices of the chunk
+// and resolving the relative references against the data parsed so far.
+static void obj_mergechunk(ObjData &&chunk, const std::vector<ObjRelativeVertex> &relative_vertices, ObjData &data)
+{
+	const int coordIdxFirst			= int(data.coordinates.size() / 4);
+	const int textureCoordIdxFirst	= int(data.textureCoordinates.size() / 3);
+	const int normalIdxFirst		= int(data.normals.size() / 3);
+	const int vertexIdxFirst		= int(data.vertices.size());
+	for (const ObjRelativeVertex &relative : relative_vertices) {
+		ObjVertex &vertex = chunk.vertices[relative.vertexIdx];
+		if (relative.coord)
+			vertex.coordIdx += coordIdxFirst;
+		if (relative.textureCoord)
+			vertex.textureCoordIdx += textureCoordIdxFirst;
+		if (relative.normal)
+			vertex.normalIdx += normalIdxFirst;
+	}
+	auto append = [](auto &dst, auto &src) {
+		if (dst.empty())
+			dst = std::move(src);
+		else
+			dst.insert(dst.end(), std::make_move_iterator(src.begin()), std::make_move_iterator(src.end()));
+	};
+	auto append_shifted = [vertexIdxFirst, &append](auto &dst, auto &src) {
+		for (auto &item : src)
+			item.vertexIdxFirst += vertexIdxFirst;
+		append(dst, src);
+	};
+	append(data.coordinates, chunk.coordinates);
+	append(data.textureCoordinates, chunk.textureCoordinates);
+	append(data.normals, chunk.normals);
+	append(data.parameters, chunk.parameters);
+	append(data.mtllibs, chunk.mtllibs);
+	append_shifted(data.usemtls, chunk.usemtls);
+	append_shifted(data.objects, chunk.objects);
+	append_shifted(data.groups, chunk.groups);
+	append_shifted(data.smoothingGroups, chunk.smoothingGroups);
+	append(data.vertices, chunk.vertices);
+}
+
+// Parse the new line terminated lines of [begin, end). The buffer is split at line boundaries into chunks,
+// which are parsed in parallel and then merged in order, a window of chunks at a time to limit the peak memory.
+static bool obj_parsebuffer(const char *begin, const char *end, ObjData &data)
+{
+	static constexpr size_t ChunkSize = 1024 * 1024;
+	struct Chunk {
+		const char						*begin;
+		const char						*end;
+		ObjData							 data;
+		std::vector<ObjRelativeVertex>	 relative_vertices;
+		bool							 ok;
+	};
+	std::vector<Chunk> chunks(4 * Slic3r::execution::max_concurrency(Slic3r::ex_tbb));
+	while (begin != end) {
+		size_t num_chunks = 0;
+		for (; begin != end && num_chunks < chunks.size(); ++ num_chunks) {
+			Chunk &chunk = chunks[num_chunks];
+			chunk.begin = begin;
+			chunk.end   = size_t(end - begin) <= ChunkSize ? end : begin + ChunkSize;
+			// Extend the chunk up to the end of its last line.
+			while (chunk.end[-1] != '\r' && chunk.end[-1] != '\n')
+				++ chunk.end;
+			begin = chunk.end;
+		}
+		Slic3r::execution::for_each(Slic3r::ex_tbb, size_t(0), num_chunks, [&chunks](size_t chunk_idx) {
+			// The numeric locale is set per thread.
+			Slic3r::CNumericLocalesSetter locales_setter;
+			Chunk &chunk = chunks[chunk_idx];
+			chunk.data = ObjData();
+			chunk.relative_vertices.clear();
+			try {
+				chunk.ok = obj_parsechunk(chunk.begin, chunk.end, chunk.data, chunk.relative_vertices);
+			} catch (std::bad_alloc&) {
+				chunk.ok = false;
+			}
+		}, Slic3r::execution::max_concurrency(Slic3r::ex_tbb));
+		for (size_t chunk_idx = 0; chunk_idx < num_chunks; ++ chunk_idx) {
+			Chunk &chunk = chunks[chunk_idx];
+			if (! chunk.ok)
+				return false;
+			obj_mergechunk(std::move(chunk.data), chunk.relative_vertices, data);
+		}
+	}
+	return true;
+}
+
+// Read the input a large block at a time and parse the complete lines of each block.
+template<typename ReadFn>
+static bool obj_parsestream(ReadFn read, ObjData &data)
+{
+	static constexpr size_t BlockSize = 16 * 1024 * 1024;
+	std::vector<char> buf(BlockSize + MaxLineLength);
+	size_t len = 0;
+	size_t lenPrev = 0;
+	while ((len = read(buf.data() + lenPrev, BlockSize)) != 0) {
+		len += lenPrev;
+		size_t lastLine = len;
+		while (lastLine > 0 && buf[lastLine - 1] != '\r' && buf[lastLine - 1] != '\n')
+			-- lastLine;
+		if (! obj_parsebuffer(buf.data(), buf.data() + lastLine, data))
+			return false;
+		lenPrev = len - lastLine;
+		if (lenPrev > MaxLineLength) {
+	    	BOOST_LOG_TRIVIAL(error) << "ObjParser: Excessive line length";
+			return false;
+		}
+		memmove(buf.data(), buf.data() + lastLine, lenPrev);
+	}
+	return true;
+}
+
 bool objparse(const char *path, ObjData &data)
 {
-    Slic3r::CNumericLocalesSetter locales_setter;
+	try {
+		// Memory map the file to parse the lines in place without copying them through a read buffer.
+		boost::iostreams::mapped_file_source mapped_file;
+		try {
+			boost::filesystem::path file_path(path);
+			// Empty file cannot be mapped.
+			if (boost::filesystem::file_size(file_path) > 0)
+				mapped_file.open(file_path);
+		} catch (const std::exception &ex) {
+			BOOST_LOG_TRIVIAL(debug) << "ObjParser: Failed to memory map file " << path << ", reading it through a buffer: " << ex.what();
+		}
+		if (mapped_file.is_open()) {
+			const char *begin = mapped_file.data();
+			const char *end   = begin + mapped_file.size();
+			// Only the new line terminated lines are parsed, the same as when reading through a buffer.
+			while (end != begin && end[-1] != '\r' && end[-1] != '\n')
+				-- end;
+			return obj_parsebuffer(begin, end, data);
+		}
+	}
+	catch (std::bad_alloc&) {
+		BOOST_LOG_TRIVIAL(error) << "ObjParser: Out of memory";
+		return true;
+	}
 
 	FILE *pFile = boost::nowide::fopen(path, "rt");
 	if (pFile == 0)
 		return false;
 
+	bool result = true;
 	try {
-		char buf[65536 * 2];
-		size_t len = 0;
-		size_t lenPrev = 0;
-		while ((len = ::fread(buf + lenPrev, 1, 65536, pFile)) != 0) {
-			len += lenPrev;
-			size_t lastLine = 0;
-			for (size_t i = 0; i < len; ++ i)
-				if (buf[i] == '\r' || buf[i] == '\n') {
-					buf[i] = 0;
-					char *c = buf + lastLine;
-					while (*c == ' ' || *c == '\t')
-						++ c;
-					//FIXME check the return value and exit on error?
-					// Will it break parsing of some obj files?
-					obj_parseline(c, data);
-					lastLine = i + 1;
-				}
-			lenPrev = len - lastLine;
-			if (lenPrev > 65536) {
-		    	BOOST_LOG_TRIVIAL(error) << "ObjParser: Excessive line length";
-				::fclose(pFile);
-				return false;
-			}
-			memmove(buf, buf + lastLine, lenPrev);
-		}
-    }
-    catch (std::bad_alloc&) {
-    	BOOST_LOG_TRIVIAL(error) << "ObjParser: Out of memory";
+		result = obj_parsestream([pFile](char *dst, size_t size) { return ::fread(dst, 1, size, pFile); }, data);
+	}
+	catch (std::bad_alloc&) {
+		BOOST_LOG_TRIVIAL(error) << "ObjParser: Out of memory";
 	}
 	::fclose(pFile);
 
 	// printf("vertices: %d\r\n", data.vertices.size() / 4);
 	// printf("coords: %d\r\n", data.coordinates.size());
-	return true;
+	return result;
 }
 
 bool objparse(std::istream &stream, ObjData &data)
 {
-    Slic3r::CNumericLocalesSetter locales_setter;
-    
     try {
-        char buf[65536 * 2];
-        size_t len = 0;
-        size_t lenPrev = 0;
-        while ((len = size_t(stream.read(buf + lenPrev, 65536).gcount())) != 0) {
-            len += lenPrev;
-            size_t lastLine = 0;
-            for (size_t i = 0; i < len; ++ i)
-                if (buf[i] == '\r' || buf[i] == '\n') {
-                    buf[i] = 0;
-                    char *c = buf + lastLine;
-                    while (*c == ' ' || *c == '\t')
-                        ++ c;
-                    obj_parseline(c, data);
-                    lastLine = i + 1;
-                }
-            lenPrev = len - lastLine;
-            memmove(buf, buf + lastLine, lenPrev);
-        }
+        return obj_parsestream([&stream](char *dst, size_t size) { return size_t(stream.read(dst, size).gcount()); }, data);
     }
     catch (std::bad_alloc&) {
     	BOOST_LOG_TRIVIAL(error) << "ObjParser: Out of memory";
     	return false;
     }
-    
-    return true;
 }
 
 template<typename T> 
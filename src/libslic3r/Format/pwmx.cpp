@@ -27,7 +27,6 @@
 #define PREV_H 168
 #define PREV_DPI 42
 
-#define LAYER_SIZE_ESTIMATE (32 * 1024)
 
 namespace Slic3r {
 
@@ -78,6 +77,10 @@ struct PWXRasterEncoder
             }
         }
 
+        // The buffer was reserved for the worst case of the whole raster,
+        // release the excess as the encoded layers are kept until export.
+        dst.shrink_to_fit();
+
         return sla::EncodedRaster(std::move(dst), "pwx");
     }
 };
@@ -494,7 +497,6 @@ void PwmxArchive::export_print(const std::string     fname,
     pwmx_format_preview       preview = {};
     pwmx_format_layers_header layers_header = {};
     pwmx_format_misc          misc = {};
-    std::vector<uint8_t>      layer_images;
     std::uint32_t             image_offset;
 
     intro.version             = 1;
@@ -523,7 +525,6 @@ void PwmxArchive::export_print(const std::string     fname,
         pwmx_write_layers_header(out, layers_header);
 
         //layers
-        layer_images.reserve(layer_count * LAYER_SIZE_ESTIMATE);
         image_offset = intro.image_data_offset;
         size_t i = 0;
         for (const sla::EncodedRaster &rst : m_layers) {
@@ -544,14 +545,12 @@ void PwmxArchive::export_print(const std::string     fname,
             }
             image_offset += l.image_size;
             pwmx_write_layer(out, l);
-            // add the rle encoded layer image into the buffer
-            const char* img_start = reinterpret_cast<const char*>(rst.data());
-            const char* img_end = img_start + rst.size();
-            std::copy(img_start, img_end, std::back_inserter(layer_images));
             i++;
         }
-        const char* img_buffer = reinterpret_cast<const char*>(layer_images.data());
-        out.write(img_buffer, layer_images.size());
+        // the rle encoded layer images follow the layer table in the same
+        // order, write them directly instead of gathering a copy of all
+        for (const sla::EncodedRaster &rst : m_layers)
+            out.write(reinterpret_cast<const char*>(rst.data()), rst.size());
         out.close();
     } catch(std::exception& e) {
         BOOST_LOG_TRIVIAL(error) << e.what();
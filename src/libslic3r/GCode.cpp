@@ -5,6 +5,7 @@
 #include "GCode.hpp"
 #include "Exception.hpp"
 #include "ExtrusionEntity.hpp"
+#include "Geometry/Circle.hpp"
 #include "Geometry/ConvexHull.hpp"
 #include "GCode/PrintExtents.hpp"
 #include "GCode/Thumbnails.hpp"
@@ -15,6 +16,7 @@
 #include "ShortestPath.hpp"
 #include "Print.hpp"
 #include "Thread.hpp"
+#include "Trace.hpp"
 #include "Utils.hpp"
 #include "ClipperUtils.hpp"
 #include "libslic3r.h"
@@ -24,6 +26,8 @@
 #include <algorithm>
 #include <cstdlib>
 #include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <math.h>
 #include <string>
 #include <string_view>
@@ -183,7 +187,7 @@ namespace Slic3r {
                     //FIXME one shall not generate the unnecessary G1 Fxxx commands, here wipe_speed is a constant inside this cycle.
                     // Is it here for the cooling markers? Or should it be outside of the cycle?
                     gcode += gcodegen.writer().set_speed(wipe_speed * 60, {}, gcodegen.enable_cooling_markers() ? ";_WIPE" : "");
-                    gcode += gcodegen.writer().extrude_to_xy(p, -dE, "wipe and retract");
+                    gcodegen.writer().extrude_to_xy(gcode, p, -dE, "wipe and retract");
                     prev = p;
                     retract_length -= dE;
                 }
@@ -1021,6 +1025,7 @@ void GCode::_do_export(Print& print, GCodeOutputStream &file, ThumbnailsGenerato
         print.config().max_volumetric_extrusion_rate_slope_negative.value > 0)
         m_pressure_equalizer = make_unique<PressureEqualizer>(print.config());
     m_enable_extrusion_role_markers = (bool)m_pressure_equalizer;
+    m_enable_arc_fitting = print.config().arc_fitting.value && ! m_spiral_vase && ! m_pressure_equalizer;
 
     if (print.config().avoid_crossing_curled_overhangs){
         this->m_avoid_crossing_curled_overhangs.init_bed_shape(get_bed_shape(print.config()));
@@ -1199,9 +1204,9 @@ void GCode::_do_export(Print& print, GCodeOutputStream &file, ThumbnailsGenerato
 
     std::string start_gcode = this->placeholder_parser_process("start_gcode", print.config().start_gcode.value, initial_extruder_id);
     // Set bed temperature if the start G-code does not contain any bed temp control G-codes.
-    this->_print_first_layer_bed_temperature(file, print, start_gcode, initial_extruder_id, true);
+    file.write(this->_print_first_layer_bed_temperature(print, start_gcode, initial_extruder_id, true));
     // Set extruder(s) temperature before and after start G-code.
-    this->_print_first_layer_extruder_temperatures(file, print, start_gcode, initial_extruder_id, false);
+    file.write(this->_print_first_layer_extruder_temperatures(print, start_gcode, initial_extruder_id, false));
 
     // adds tag for processor
     file.write_format(";%s%s\n", GCodeProcessor::reserved_tag(GCodeProcessor::ETags::Role).c_str(), gcode_extrusion_role_to_string(GCodeExtrusionRole::Custom).c_str());
@@ -1209,7 +1214,7 @@ void GCode::_do_export(Print& print, GCodeOutputStream &file, ThumbnailsGenerato
     // Write the custom start G-code
     file.writeln(start_gcode);
 
-    this->_print_first_layer_extruder_temperatures(file, print, start_gcode, initial_extruder_id, true);
+    file.write(this->_print_first_layer_extruder_temperatures(print, start_gcode, initial_extruder_id, true));
     print.throw_if_canceled();
 
     // Set other general things.
@@ -1229,55 +1234,34 @@ void GCode::_do_export(Print& print, GCodeOutputStream &file, ThumbnailsGenerato
 
     // Do all objects for each layer.
     if (print.config().complete_objects.value) {
-        size_t finished_objects = 0;
+        // The tool ordering of an object only depends on the extruder the previous object finished with,
+        // thus the tool orderings and the layers of all the object instances are collected ahead of the G-code generation.
+        std::vector<SequentialObjectToPrint> objects_to_print;
+        std::deque<ToolOrdering>             tool_orderings;
+        tool_orderings.emplace_back(std::move(tool_ordering));
         const PrintObject *prev_object = (*print_object_instance_sequential_active)->print_object;
         for (; print_object_instance_sequential_active != print_object_instances_ordering.end(); ++ print_object_instance_sequential_active) {
             const PrintObject &object = *(*print_object_instance_sequential_active)->print_object;
-            if (&object != prev_object || tool_ordering.first_extruder() != final_extruder_id) {
-                tool_ordering = ToolOrdering(object, final_extruder_id);
-                unsigned int new_extruder_id = tool_ordering.first_extruder();
+            if (&object != prev_object || tool_orderings.back().first_extruder() != final_extruder_id) {
+                ToolOrdering object_tool_ordering(object, final_extruder_id);
+                unsigned int new_extruder_id = object_tool_ordering.first_extruder();
                 if (new_extruder_id == (unsigned int)-1)
                     // Skip this object.
                     continue;
+                tool_orderings.emplace_back(std::move(object_tool_ordering));
                 initial_extruder_id = new_extruder_id;
-                final_extruder_id   = tool_ordering.last_extruder();
+                final_extruder_id   = tool_orderings.back().last_extruder();
                 assert(final_extruder_id != (unsigned int)-1);
             }
-            print.throw_if_canceled();
-            this->set_origin(unscale((*print_object_instance_sequential_active)->shift));
-            if (finished_objects > 0) {
-                // Move to the origin position for the copy we're going to print.
-                // This happens before Z goes down to layer 0 again, so that no collision happens hopefully.
-                m_enable_cooling_markers = false; // we're not filtering these moves through CoolingBuffer
-                m_avoid_crossing_perimeters.use_external_mp_once();
-                file.write(this->retract());
-                file.write(this->travel_to(Point(0, 0), ExtrusionRole::None, "move to origin position for next object"));
-                m_enable_cooling_markers = true;
-                // Disable motion planner when traveling to first object point.
-                m_avoid_crossing_perimeters.disable_once();
-                // Ff we are printing the bottom layer of an object, and we have already finished
-                // another one, set first layer temperatures. This happens before the Z move
-                // is triggered, so machine has more time to reach such temperatures.
-                m_placeholder_parser.set("current_object_idx", int(finished_objects));
-                std::string between_objects_gcode = this->placeholder_parser_process("between_objects_gcode", print.config().between_objects_gcode.value, initial_extruder_id);
-                // Set first layer bed and extruder temperatures, don't wait for it to reach the temperature.
-                this->_print_first_layer_bed_temperature(file, print, between_objects_gcode, initial_extruder_id, false);
-                this->_print_first_layer_extruder_temperatures(file, print, between_objects_gcode, initial_extruder_id, false);
-                file.writeln(between_objects_gcode);
-            }
-            // Reset the cooling buffer internal state (the current position, feed rate, accelerations).
-            m_cooling_buffer->reset(this->writer().get_position());
-            m_cooling_buffer->set_current_extruder(initial_extruder_id);
-            // Process all layers of a single object instance (sequential mode) with a parallel pipeline:
-            // Generate G-code, run the filters (vase mode, cooling buffer), run the G-code analyser
-            // and export G-code into file.
-            this->process_layers(print, tool_ordering, collect_layers_to_print(object), *print_object_instance_sequential_active - object.instances().data(), file);
-            ++ finished_objects;
-            // Flag indicating whether the nozzle temperature changes from 1st to 2nd layer were performed.
-            // Reset it when starting another object from 1st layer.
-            m_second_layer_things_done = false;
+            objects_to_print.push_back({ *print_object_instance_sequential_active, &tool_orderings.back(), initial_extruder_id, collect_layers_to_print(object) });
             prev_object = &object;
         }
+        print.throw_if_canceled();
+        // Process all layers of all object instances (sequential mode) with a single parallel pipeline, so that the layers
+        // of the next object are being prepared while the last layers of the previous object are being generated and filtered:
+        // Generate G-code, run the filters (vase mode, cooling buffer), run the G-code analyser
+        // and export G-code into file.
+        this->process_layers(print, std::move(objects_to_print), file);
     } else {
         // Sort layers by Z.
         // All extrusion moves with the same top layer height are extruded uninterrupted.
@@ -1402,6 +1386,23 @@ void GCode::_do_export(Print& print, GCodeOutputStream &file, ThumbnailsGenerato
     print.throw_if_canceled();
 }
 
+// Passed between the two cooling buffer stages of the G-code export pipeline:
+// Either a layer parsed by CoolingBuffer::parse_layer() or G-code passed through the cooling buffer unchanged.
+using CoolingParsedLayer = std::pair<std::string, std::shared_ptr<CoolingBuffer::ParsedLayer>>;
+
+// Calculate data of a single print_z, which do not depend on the state of the G-code generator.
+// Called by a parallel stage of the G-code export pipeline ahead of the serial GCode::process_layer().
+static LayerPrepared prepare_layer(const GCode::ObjectsLayerToPrint &layers, size_t layer_to_print_idx)
+{
+    LayerPrepared out;
+    out.layer_to_print_idx = layer_to_print_idx;
+    out.overhang_boundaries.reserve(layers.size());
+    for (const GCode::ObjectLayerToPrint &layer : layers)
+        out.overhang_boundaries.emplace_back(layer.object_layer ?
+            ExtrusionQualityEstimator::layer_boundaries(*layer.object_layer) : AABBTreeLines::LinesDistancer<Linef>{});
+    return out;
+}
+
 // Process all layers of all objects (non-sequential mode) with a parallel pipeline:
 // Generate G-code, run the filters (vase mode, cooling buffer), run the G-code analyser
 // and export G-code into file.
@@ -1414,27 +1415,49 @@ void GCode::process_layers(
 {
     // The pipeline is variable: The vase mode filter is optional.
     size_t layer_to_print_idx = 0;
-    const auto generator = tbb::make_filter<void, LayerResult>(slic3r_tbb_filtermode::serial_in_order,
-        [this, &print, &tool_ordering, &print_object_instances_ordering, &layers_to_print, &layer_to_print_idx](tbb::flow_control& fc) -> LayerResult {
-            if (layer_to_print_idx >= layers_to_print.size()) {
-                if ((!m_pressure_equalizer && layer_to_print_idx == layers_to_print.size()) || (m_pressure_equalizer && layer_to_print_idx == (layers_to_print.size() + 1))) {
-                    fc.stop();
-                    return {};
-                } else {
-                    // Pressure equalizer need insert empty input. Because it returns one layer back.
-                    // Insert NOP (no operation) layer;
-                    ++layer_to_print_idx;
-                    return LayerResult::make_nop_layer_result();
-                }
-            } else {
-                const std::pair<coordf_t, ObjectsLayerToPrint> &layer = layers_to_print[layer_to_print_idx++];
-                const LayerTools& layer_tools = tool_ordering.tools_for_layer(layer.first);
-                if (m_wipe_tower && layer_tools.has_wipe_tower)
-                    m_wipe_tower->next_layer();
-                print.throw_if_canceled();
-                return this->process_layer(print, layer.second, layer_tools, &layer == &layers_to_print.back(), &print_object_instances_ordering, size_t(-1));
+    // Pressure equalizer need insert empty input. Because it returns one layer back.
+    const size_t num_layers_to_print = m_pressure_equalizer ? layers_to_print.size() + 1 : layers_to_print.size();
+    const auto layer_source = tbb::make_filter<void, size_t>(slic3r_tbb_filtermode::serial_in_order,
+        [&layer_to_print_idx, num_layers_to_print](tbb::flow_control& fc) -> size_t {
+            if (layer_to_print_idx >= num_layers_to_print) {
+                fc.stop();
+                return 0;
             }
+            return layer_to_print_idx ++;
         });
+    // Data not depending on the state of the G-code generator are calculated in parallel over layers.
+    const auto layer_prepare = tbb::make_filter<size_t, LayerPrepared>(slic3r_tbb_filtermode::parallel,
+        [&print, &layers_to_print](size_t idx) -> LayerPrepared {
+            if (idx >= layers_to_print.size())
+                return { idx, {} };
+            print.throw_if_canceled();
+            TraceScope trace("prepare layer", idx);
+            return prepare_layer(layers_to_print[idx].second, idx);
+        });
+    const auto layer_generate = tbb::make_filter<LayerPrepared, LayerResult>(slic3r_tbb_filtermode::serial_in_order,
+        [this, &print, &tool_ordering, &print_object_instances_ordering, &layers_to_print](LayerPrepared in) -> LayerResult {
+            if (in.layer_to_print_idx >= layers_to_print.size())
+                // Insert NOP (no operation) layer for the pressure equalizer.
+                return LayerResult::make_nop_layer_result();
+            TraceScope trace("generate layer", in.layer_to_print_idx);
+            const std::pair<coordf_t, ObjectsLayerToPrint> &layer = layers_to_print[in.layer_to_print_idx];
+            const LayerTools& layer_tools = tool_ordering.tools_for_layer(layer.first);
+            if (m_wipe_tower && layer_tools.has_wipe_tower)
+                m_wipe_tower->next_layer();
+            print.throw_if_canceled();
+            LayerResult result = this->process_layer(print, layer.second, layer_tools, std::move(in), &layer == &layers_to_print.back(), &print_object_instances_ordering, size_t(-1));
+            if (print.release_layers_on_export())
+                // All instances of the layers were just processed and no other layer refers to their extrusions.
+                // The parallel stage ahead only works with the layer slices, which are being kept.
+                for (const ObjectLayerToPrint &layer_to_print : layer.second) {
+                    if (layer_to_print.object_layer)
+                        const_cast<Layer*>(layer_to_print.object_layer)->clear_extrusions();
+                    if (layer_to_print.support_layer)
+                        const_cast<SupportLayer*>(layer_to_print.support_layer)->clear_extrusions();
+                }
+            return result;
+        });
+    const auto generator = layer_source & layer_prepare & layer_generate;
     const auto spiral_vase = tbb::make_filter<LayerResult, LayerResult>(slic3r_tbb_filtermode::serial_in_order,
         [spiral_vase = this->m_spiral_vase.get()](LayerResult in) -> LayerResult {
             if (in.nop_layer_result)
@@ -1447,19 +1470,26 @@ void GCode::process_layers(
         [pressure_equalizer = this->m_pressure_equalizer.get()](LayerResult in) -> LayerResult {
             return pressure_equalizer->process_layer(std::move(in));
         });
-    const auto cooling = tbb::make_filter<LayerResult, std::string>(slic3r_tbb_filtermode::serial_in_order,
-        [cooling_buffer = this->m_cooling_buffer.get()](LayerResult in) -> std::string {
-             if (in.nop_layer_result)
-                return in.gcode;
-
-             return cooling_buffer->process_layer(std::move(in.gcode), in.layer_id, in.cooling_buffer_flush);
+    // The cooling buffer runs as two serial stages: Parsing a layer and calculating its slow down may run
+    // in parallel with emitting the adjusted G-code of the previous layer.
+    const auto cooling = tbb::make_filter<LayerResult, CoolingParsedLayer>(slic3r_tbb_filtermode::serial_in_order,
+        [cooling_buffer = this->m_cooling_buffer.get()](LayerResult in) -> CoolingParsedLayer {
+            if (in.nop_layer_result)
+                return { std::move(in.gcode), nullptr };
+            TraceScope trace("cooling parse layer", in.layer_id);
+            return { std::string(), cooling_buffer->parse_layer(std::move(in.gcode), in.layer_id, in.cooling_buffer_flush) };
+        }) & tbb::make_filter<CoolingParsedLayer, std::string>(slic3r_tbb_filtermode::serial_in_order,
+        [cooling_buffer = this->m_cooling_buffer.get()](CoolingParsedLayer in) -> std::string {
+            TraceScope trace("cooling apply layer");
+            return in.second ? cooling_buffer->apply_layer(std::move(in.second)) : std::move(in.first);
         });
-    const auto find_replace = tbb::make_filter<std::string, std::string>(slic3r_tbb_filtermode::serial_in_order,
+    // The substitutions are stateless, thus the layers are processed in parallel.
+    const auto find_replace = tbb::make_filter<std::string, std::string>(slic3r_tbb_filtermode::parallel,
         [find_replace = this->m_find_replace.get()](std::string s) -> std::string {
             return find_replace->process_layer(std::move(s));
         });
     const auto output = tbb::make_filter<std::string, void>(slic3r_tbb_filtermode::serial_in_order,
-        [&output_stream](std::string s) { output_stream.write(s); }
+        [&output_stream](std::string s) { TraceScope trace("write layer"); output_stream.write(s); }
     );
 
     // It registers a handler that sets locales to "C" before any TBB thread starts participating in tbb::parallel_pipeline.
@@ -1487,59 +1517,140 @@ void GCode::process_layers(
     output_stream.find_replace_enable();
 }
 
-// Process all layers of a single object instance (sequential mode) with a parallel pipeline:
-// Generate G-code, run the filters (vase mode, cooling buffer), run the G-code analyser
-// and export G-code into file.
+// Process all layers of all object instances one after the other (sequential mode) with a single parallel pipeline:
+// Generate G-code including the moves between the objects, run the filters (vase mode, cooling buffer), run the G-code analyser
+// and export G-code into file. Running a single pipeline instead of a pipeline per object instance keeps the parallel stages busy
+// over the object boundaries, which matters for plates of many small objects.
 void GCode::process_layers(
     const Print                             &print,
-    const ToolOrdering                      &tool_ordering,
-    ObjectsLayerToPrint                      layers_to_print,
-    const size_t                             single_object_idx,
+    std::vector<SequentialObjectToPrint>   &&objects,
     GCodeOutputStream                       &output_stream)
 {
+    // Pairs of an index into objects and of an index into its layers. Layer index size_t(-1) marks the NOP layer
+    // inserted for the pressure equalizer after the last layer of each object, which flushes the last layer of the object.
+    std::vector<std::pair<size_t, size_t>> layers_to_print;
+    for (size_t object_idx = 0; object_idx < objects.size(); ++ object_idx) {
+        for (size_t layer_idx = 0; layer_idx < objects[object_idx].layers.size(); ++ layer_idx)
+            layers_to_print.emplace_back(object_idx, layer_idx);
+        if (m_pressure_equalizer && ! objects[object_idx].layers.empty())
+            layers_to_print.emplace_back(object_idx, size_t(-1));
+    }
+
     // The pipeline is variable: The vase mode filter is optional.
     size_t layer_to_print_idx = 0;
-    const auto generator = tbb::make_filter<void, LayerResult>(slic3r_tbb_filtermode::serial_in_order,
-        [this, &print, &tool_ordering, &layers_to_print, &layer_to_print_idx, single_object_idx](tbb::flow_control& fc) -> LayerResult {
+    const auto layer_source = tbb::make_filter<void, size_t>(slic3r_tbb_filtermode::serial_in_order,
+        [&layer_to_print_idx, &layers_to_print](tbb::flow_control& fc) -> size_t {
             if (layer_to_print_idx >= layers_to_print.size()) {
-                if ((!m_pressure_equalizer && layer_to_print_idx == layers_to_print.size()) || (m_pressure_equalizer && layer_to_print_idx == (layers_to_print.size() + 1))) {
-                    fc.stop();
-                    return {};
-                } else {
-                    // Pressure equalizer need insert empty input. Because it returns one layer back.
-                    // Insert NOP (no operation) layer;
-                    ++layer_to_print_idx;
-                    return LayerResult::make_nop_layer_result();
+                fc.stop();
+                return 0;
+            }
+            return layer_to_print_idx ++;
+        });
+    // Data not depending on the state of the G-code generator are calculated in parallel over layers.
+    const auto layer_prepare = tbb::make_filter<size_t, LayerPrepared>(slic3r_tbb_filtermode::parallel,
+        [&print, &objects, &layers_to_print](size_t idx) -> LayerPrepared {
+            const auto [object_idx, layer_idx] = layers_to_print[idx];
+            if (layer_idx == size_t(-1))
+                return { idx, {} };
+            print.throw_if_canceled();
+            TraceScope trace("prepare layer", idx);
+            return prepare_layer({ objects[object_idx].layers[layer_idx] }, idx);
+        });
+    const auto layer_generate = tbb::make_filter<LayerPrepared, LayerResult>(slic3r_tbb_filtermode::serial_in_order,
+        [this, &print, &objects, &layers_to_print](LayerPrepared in) -> LayerResult {
+            const auto [object_idx, layer_idx] = layers_to_print[in.layer_to_print_idx];
+            if (layer_idx == size_t(-1))
+                // Insert NOP (no operation) layer for the pressure equalizer.
+                return LayerResult::make_nop_layer_result();
+            TraceScope trace("generate layer", in.layer_to_print_idx);
+            SequentialObjectToPrint &object = objects[object_idx];
+            print.throw_if_canceled();
+            std::shared_ptr<LayerObjectStart> object_start;
+            if (layer_idx == 0) {
+                this->set_origin(unscale(object.instance->shift));
+                std::string gcode;
+                if (object_idx > 0) {
+                    // Move to the origin position for the copy we're going to print.
+                    // This happens before Z goes down to layer 0 again, so that no collision happens hopefully.
+                    m_enable_cooling_markers = false; // we're not filtering these moves through CoolingBuffer
+                    m_avoid_crossing_perimeters.use_external_mp_once();
+                    gcode += this->retract();
+                    gcode += this->travel_to(Point(0, 0), ExtrusionRole::None, "move to origin position for next object");
+                    m_enable_cooling_markers = true;
+                    // Disable motion planner when traveling to first object point.
+                    m_avoid_crossing_perimeters.disable_once();
+                    // Ff we are printing the bottom layer of an object, and we have already finished
+                    // another one, set first layer temperatures. This happens before the Z move
+                    // is triggered, so machine has more time to reach such temperatures.
+                    m_placeholder_parser.set("current_object_idx", int(object_idx));
+                    std::string between_objects_gcode = this->placeholder_parser_process("between_objects_gcode", print.config().between_objects_gcode.value, object.initial_extruder_id);
+                    // Set first layer bed and extruder temperatures, don't wait for it to reach the temperature.
+                    gcode += this->_print_first_layer_bed_temperature(print, between_objects_gcode, object.initial_extruder_id, false);
+                    gcode += this->_print_first_layer_extruder_temperatures(print, between_objects_gcode, object.initial_extruder_id, false);
+                    if (! between_objects_gcode.empty()) {
+                        gcode += between_objects_gcode;
+                        if (gcode.back() != '\n')
+                            gcode += '\n';
+                    }
+                    // Flag indicating whether the nozzle temperature changes from 1st to 2nd layer were performed.
+                    // Reset it when starting another object from 1st layer.
+                    m_second_layer_things_done = false;
                 }
-            } else {
-                ObjectLayerToPrint &layer = layers_to_print[layer_to_print_idx ++];
-                print.throw_if_canceled();
-                return this->process_layer(print, { std::move(layer) }, tool_ordering.tools_for_layer(layer.print_z()), &layer == &layers_to_print.back(), nullptr, single_object_idx);
+                // The cooling buffer internal state (the current position, feed rate, accelerations) is reset by the cooling stages.
+                object_start = std::make_shared<LayerObjectStart>(LayerObjectStart{ std::move(gcode), this->writer().get_position(), object.initial_extruder_id });
             }
+            ObjectLayerToPrint &layer = object.layers[layer_idx];
+            LayerResult result = this->process_layer(print, { std::move(layer) }, object.tool_ordering->tools_for_layer(layer.print_z()), std::move(in),
+                &layer == &object.layers.back(), nullptr, object.instance - object.instance->print_object->instances().data());
+            result.object_start = std::move(object_start);
+            return result;
         });
+    const auto generator = layer_source & layer_prepare & layer_generate;
     const auto spiral_vase = tbb::make_filter<LayerResult, LayerResult>(slic3r_tbb_filtermode::serial_in_order,
         [spiral_vase = this->m_spiral_vase.get()](LayerResult in)->LayerResult {
             if (in.nop_layer_result)
                 return in;
             spiral_vase->enable(in.spiral_vase_enable);
-            return { spiral_vase->process_layer(std::move(in.gcode)), in.layer_id, in.spiral_vase_enable, in.cooling_buffer_flush };
+            in.gcode = spiral_vase->process_layer(std::move(in.gcode));
+            return in;
         });
     const auto pressure_equalizer = tbb::make_filter<LayerResult, LayerResult>(slic3r_tbb_filtermode::serial_in_order,
         [pressure_equalizer = this->m_pressure_equalizer.get()](LayerResult in) -> LayerResult {
              return pressure_equalizer->process_layer(std::move(in));
         });
-    const auto cooling = tbb::make_filter<LayerResult, std::string>(slic3r_tbb_filtermode::serial_in_order,
-        [cooling_buffer = this->m_cooling_buffer.get()](LayerResult in)->std::string {
+    // The cooling buffer runs as two serial stages: Parsing a layer and calculating its slow down may run
+    // in parallel with emitting the adjusted G-code of the previous layer. Each stage resets its part of the cooling buffer
+    // at the start of an object.
+    struct CoolingParsedObjectLayer {
+        CoolingParsedLayer                layer;
+        std::shared_ptr<LayerObjectStart> object_start;
+    };
+    const auto cooling = tbb::make_filter<LayerResult, CoolingParsedObjectLayer>(slic3r_tbb_filtermode::serial_in_order,
+        [cooling_buffer = this->m_cooling_buffer.get()](LayerResult in) -> CoolingParsedObjectLayer {
             if (in.nop_layer_result)
-                return in.gcode;
-            return cooling_buffer->process_layer(std::move(in.gcode), in.layer_id, in.cooling_buffer_flush);
+                return { { std::move(in.gcode), nullptr }, nullptr };
+            TraceScope trace("cooling parse layer", in.layer_id);
+            if (in.object_start)
+                cooling_buffer->reset_parser(in.object_start->position, in.object_start->extruder_id);
+            return { { std::string(), cooling_buffer->parse_layer(std::move(in.gcode), in.layer_id, in.cooling_buffer_flush) }, std::move(in.object_start) };
+        }) & tbb::make_filter<CoolingParsedObjectLayer, std::string>(slic3r_tbb_filtermode::serial_in_order,
+        [cooling_buffer = this->m_cooling_buffer.get()](CoolingParsedObjectLayer in) -> std::string {
+            TraceScope trace("cooling apply layer");
+            std::string out;
+            if (in.object_start) {
+                cooling_buffer->reset_emitter(in.object_start->extruder_id);
+                out = std::move(in.object_start->gcode);
+            }
+            out += in.layer.second ? cooling_buffer->apply_layer(std::move(in.layer.second)) : std::move(in.layer.first);
+            return out;
         });
-    const auto find_replace = tbb::make_filter<std::string, std::string>(slic3r_tbb_filtermode::serial_in_order,
+    // The substitutions are stateless, thus the layers are processed in parallel.
+    const auto find_replace = tbb::make_filter<std::string, std::string>(slic3r_tbb_filtermode::parallel,
         [find_replace = this->m_find_replace.get()](std::string s) -> std::string {
             return find_replace->process_layer(std::move(s));
         });
     const auto output = tbb::make_filter<std::string, void>(slic3r_tbb_filtermode::serial_in_order,
-        [&output_stream](std::string s) { output_stream.write(s); }
+        [&output_stream](std::string s) { TraceScope trace("write layer"); output_stream.write(s); }
     );
 
     // It registers a handler that sets locales to "C" before any TBB thread starts participating in tbb::parallel_pipeline.
@@ -1711,7 +1822,7 @@ void GCode::print_machine_envelope(GCodeOutputStream &file, Print &print)
 // Only do that if the start G-code does not already contain any M-code controlling an extruder temperature.
 // M140 - Set Extruder Temperature
 // M190 - Set Extruder Temperature and Wait
-void GCode::_print_first_layer_bed_temperature(GCodeOutputStream &file, Print &print, const std::string &gcode, unsigned int first_printing_extruder_id, bool wait)
+std::string GCode::_print_first_layer_bed_temperature(const Print &print, const std::string &gcode, unsigned int first_printing_extruder_id, bool wait)
 {
     // Initial bed temperature based on the first extruder.
     int  temp = print.config().first_layer_bed_temperature.get_at(first_printing_extruder_id);
@@ -1723,8 +1834,7 @@ void GCode::_print_first_layer_bed_temperature(GCodeOutputStream &file, Print &p
     // Always call m_writer.set_bed_temperature() so it will set the internal "current" state of the bed temp as if
     // the custom start G-code emited these.
     std::string set_temp_gcode = m_writer.set_bed_temperature(temp, wait);
-    if (! temp_set_by_gcode)
-        file.write(set_temp_gcode);
+    return temp_set_by_gcode ? std::string() : set_temp_gcode;
 }
 
 // Write 1st layer extruder temperatures into the G-code.
@@ -1732,8 +1842,9 @@ void GCode::_print_first_layer_bed_temperature(GCodeOutputStream &file, Print &p
 // M104 - Set Extruder Temperature
 // M109 - Set Extruder Temperature and Wait
 // RepRapFirmware: G10 Sxx
-void GCode::_print_first_layer_extruder_temperatures(GCodeOutputStream &file, Print &print, const std::string &gcode, unsigned int first_printing_extruder_id, bool wait)
+std::string GCode::_print_first_layer_extruder_temperatures(const Print &print, const std::string &gcode, unsigned int first_printing_extruder_id, bool wait)
 {
+    std::string out;
     // Is the bed temperature set by the provided custom G-code?
     int  temp_by_gcode = -1;
     bool include_g10   = print.config().gcode_flavor == gcfRepRapFirmware;
@@ -1749,7 +1860,7 @@ void GCode::_print_first_layer_extruder_temperatures(GCodeOutputStream &file, Pr
             // Set temperature of the first printing extruder only.
             int temp = print.config().first_layer_temperature.get_at(first_printing_extruder_id);
             if (temp > 0)
-                file.write(m_writer.set_temperature(temp, wait, first_printing_extruder_id));
+                out += m_writer.set_temperature(temp, wait, first_printing_extruder_id);
         } else {
             // Set temperatures of all the printing extruders.
             for (unsigned int tool_id : print.extruders()) {
@@ -1763,10 +1874,11 @@ void GCode::_print_first_layer_extruder_temperatures(GCodeOutputStream &file, Pr
                 }
 
                 if (temp > 0)
-                    file.write(m_writer.set_temperature(temp, wait, tool_id));
+                    out += m_writer.set_temperature(temp, wait, tool_id);
             }
         }
     }
+    return out;
 }
 
 std::vector<GCode::InstanceToPrint> GCode::sort_print_object_instances(
@@ -1968,6 +2080,8 @@ LayerResult GCode::process_layer(
     // Set of object & print layers of the same PrintObject and with the same print_z.
     const ObjectsLayerToPrint           	&layers,
     const LayerTools        		        &layer_tools,
+    // Data of this print_z precalculated in parallel by the export pipeline, see prepare_layer().
+    LayerPrepared                          &&prepared,
     const bool                               last_layer,
     // Pairs of PrintObject index and its instance index.
     const std::vector<const PrintInstance*> *ordering,
@@ -2111,9 +2225,9 @@ LayerResult GCode::process_layer(
         }
     }
 
-    for (const ObjectLayerToPrint &layer_to_print : layers) {
-        m_extrusion_quality_estimator.prepare_for_new_layer(layer_to_print.object_layer);
-    }
+    assert(prepared.overhang_boundaries.size() == layers.size());
+    for (size_t i = 0; i < layers.size(); ++ i)
+        m_extrusion_quality_estimator.prepare_for_new_layer(layers[i].object_layer, std::move(prepared.overhang_boundaries[i]));
 
     // Extrude the skirt, brim, support, perimeters, infill ordered by the extruders.
     for (unsigned int extruder_id : layer_tools.extruders)
@@ -2342,8 +2456,19 @@ void GCode::process_layer_single_object(
                     const auto extrusion_name = ironing ? "ironing"sv : "infill"sv;
                     for (const ExtrusionEntity *fill : temp_fill_extrusions)
                         if (auto *eec = dynamic_cast<const ExtrusionEntityCollection*>(fill); eec) {
-                            for (const ExtrusionEntity *ee : eec->chained_path_from(m_last_pos).entities)
-                                gcode += this->extrude_entity(*ee, extrusion_name);
+                            if (eec->no_sort) {
+                                for (const ExtrusionEntity *ee : eec->entities)
+                                    gcode += this->extrude_entity(*ee, extrusion_name);
+                            } else {
+                                // Order the entities without cloning the whole collection, only the reversed entities are copied.
+                                for (const auto [idx, reversed] : chain_extrusion_entities(eec->entities, &m_last_pos))
+                                    if (reversed) {
+                                        std::unique_ptr<ExtrusionEntity> ee(eec->entities[idx]->clone());
+                                        ee->reverse();
+                                        gcode += this->extrude_entity(*ee, extrusion_name);
+                                    } else
+                                        gcode += this->extrude_entity(*eec->entities[idx], extrusion_name);
+                            }
                         } else
                             gcode += this->extrude_entity(*fill, extrusion_name);
                 }
@@ -2699,6 +2824,80 @@ std::string GCode::extrude_support(const ExtrusionEntityCollection &support_fill
     return gcode;
 }
 
+// Writing G-code into a slow (network) file system should not stall the serial output stage of the G-code export pipeline.
+// The G-code is collected into large blocks, which are written into the file by a background thread,
+// while the next block is being filled (double buffering).
+class GCode::GCodeOutputStream::AsyncWriter
+{
+public:
+    static constexpr const size_t block_size = 4 * 1024 * 1024;
+
+    explicit AsyncWriter(FILE *f) : m_file(f), m_thread(create_thread([this]() { this->thread_proc(); })) {}
+    ~AsyncWriter() {
+        {
+            std::scoped_lock<std::mutex> lock(m_mutex);
+            m_exit = true;
+        }
+        m_condition.notify_all();
+        // The pending block is written before the thread exits.
+        m_thread.join();
+    }
+
+    // Pass the block to the background thread, returning an empty block to be filled, which keeps the capacity of a block
+    // written before. Waits until the previously passed block is written.
+    void write(std::string &block) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_condition.wait(lock, [this]() { return m_pending.empty(); });
+        m_pending.swap(block);
+        lock.unlock();
+        m_condition.notify_all();
+        block.reserve(block_size);
+    }
+
+    // Wait until all the blocks passed to write() are written.
+    void wait() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_condition.wait(lock, [this]() { return m_pending.empty(); });
+    }
+
+private:
+    void thread_proc() {
+        set_current_thread_name("slic3r_gcodeout");
+        std::unique_lock<std::mutex> lock(m_mutex);
+        for (;;) {
+            m_condition.wait(lock, [this]() { return m_exit || ! m_pending.empty(); });
+            if (m_pending.empty())
+                break;
+            // The producer does not touch a non-empty pending block.
+            lock.unlock();
+            ::fwrite(m_pending.data(), 1, m_pending.size(), m_file);
+            lock.lock();
+            m_pending.clear();
+            m_condition.notify_all();
+        }
+    }
+
+    FILE                    *m_file;
+    std::string              m_pending;
+    bool                     m_exit { false };
+    std::mutex               m_mutex;
+    std::condition_variable  m_condition;
+    boost::thread            m_thread;
+};
+
+GCode::GCodeOutputStream::GCodeOutputStream(FILE *f, GCodeProcessor &processor) : f(f), m_processor(processor)
+{
+    if (f != nullptr) {
+        m_block.reserve(AsyncWriter::block_size);
+        m_writer = std::make_unique<AsyncWriter>(f);
+    }
+}
+
+GCode::GCodeOutputStream::~GCodeOutputStream()
+{
+    this->close();
+}
+
 bool GCode::GCodeOutputStream::is_error() const 
 {
     return ::ferror(this->f);
@@ -2706,12 +2905,17 @@ bool GCode::GCodeOutputStream::is_error() const
 
 void GCode::GCodeOutputStream::flush()
 { 
+    if (! m_block.empty())
+        m_writer->write(m_block);
+    m_writer->wait();
     ::fflush(this->f);
 }
 
 void GCode::GCodeOutputStream::close()
 { 
     if (this->f) {
+        this->flush();
+        m_writer.reset();
         ::fclose(this->f);
         this->f = nullptr;
     }
@@ -2722,8 +2926,9 @@ void GCode::GCodeOutputStream::write(const char *what)
     if (what != nullptr) {
         //FIXME don't allocate a string, maybe process a batch of lines?
         std::string gcode(m_find_replace ? m_find_replace->process_layer(what) : what);
-        // writes string to file
-        fwrite(gcode.c_str(), 1, gcode.size(), this->f);
+        m_block += gcode;
+        if (m_block.size() >= AsyncWriter::block_size)
+            m_writer->write(m_block);
         m_processor.process_buffer(gcode);
     }
 }
@@ -2961,15 +3166,37 @@ std::string GCode::_extrude(const ExtrusionPath &path, const std::string_view de
             comment = description;
             comment += description_bridge;
         }
-        Vec2d prev = this->point_to_gcode_quantized(path.polyline.points.front());
-        auto  it   = path.polyline.points.begin();
-        auto  end  = path.polyline.points.end();
-        for (++ it; it != end; ++ it) {
-            Vec2d p = this->point_to_gcode_quantized(*it);
-            const double line_length = (p - prev).norm();
-            path_length += line_length;
-            gcode += m_writer.extrude_to_xy(p, e_per_mm * line_length, comment);
-            prev = p;
+        if (m_enable_arc_fitting && path.polyline.points.size() > 3) {
+            Vec2ds pts;
+            pts.reserve(path.polyline.points.size());
+            for (const Point &pt : path.polyline.points)
+                pts.emplace_back(this->point_to_gcode_quantized(pt));
+            size_t begin = 0;
+            for (const Geometry::FittedArc &arc : Geometry::fit_arcs(pts, m_config.gcode_resolution.value)) {
+                const Vec2d &prev = pts[begin];
+                const Vec2d &p    = pts[arc.end];
+                if (arc.is_arc()) {
+                    const double arc_length = (prev - arc.center).norm() * std::abs(arc.angle);
+                    path_length += arc_length;
+                    m_writer.extrude_arc_to_xy(gcode, p, arc.center - prev, arc.angle > 0., e_per_mm * arc_length, comment);
+                } else {
+                    const double line_length = (p - prev).norm();
+                    path_length += line_length;
+                    m_writer.extrude_to_xy(gcode, p, e_per_mm * line_length, comment);
+                }
+                begin = arc.end;
+            }
+        } else {
+            Vec2d prev = this->point_to_gcode_quantized(path.polyline.points.front());
+            auto  it   = path.polyline.points.begin();
+            auto  end  = path.polyline.points.end();
+            for (++ it; it != end; ++ it) {
+                Vec2d p = this->point_to_gcode_quantized(*it);
+                const double line_length = (p - prev).norm();
+                path_length += line_length;
+                m_writer.extrude_to_xy(gcode, p, e_per_mm * line_length, comment);
+                prev = p;
+            }
         }
     } else {
         std::string marked_comment;
@@ -2986,7 +3213,7 @@ std::string GCode::_extrude(const ExtrusionPath &path, const std::string_view de
             const ProcessedPoint &processed_point = new_points[i];
             Vec2d                 p               = this->point_to_gcode_quantized(processed_point.p);
             const double          line_length     = (p - prev).norm();
-            gcode += m_writer.extrude_to_xy(p, e_per_mm * line_length, marked_comment);
+            m_writer.extrude_to_xy(gcode, p, e_per_mm * line_length, marked_comment);
             prev             = p;
             double new_speed = processed_point.speed * 60.0;
             if (last_set_speed != new_speed) {
@@ -3075,7 +3302,7 @@ std::string GCode::travel_to(const Point &point, ExtrusionRole role, std::string
     // use G1 because we rely on paths being straight (G0 may make round paths)
     if (travel.size() >= 2) {
         for (size_t i = 1; i < travel.size(); ++ i)
-            gcode += m_writer.travel_to_xy(this->point_to_gcode(travel.points[i]), comment);
+            m_writer.travel_to_xy(gcode, this->point_to_gcode(travel.points[i]), comment);
         this->set_last_pos(travel.points.back());
     }
     return gcode;
@@ -115,6 +115,16 @@ public:
     static const std::vector<std::string>& get() { return Colors; }
 };
 
+// Start of an object instance printed sequentially (complete_objects), see GCode::process_layers().
+struct LayerObjectStart {
+    // G-code moving from the previous object to this one, emitted ahead of the first layer of this object
+    // and not filtered by the cooling buffer.
+    std::string  gcode;
+    // Position of the G-code writer and the active extruder, which the cooling buffer is reset to.
+    Vec3d        position;
+    unsigned int extruder_id;
+};
+
 struct LayerResult {
     std::string gcode;
     size_t      layer_id;
@@ -125,10 +135,23 @@ struct LayerResult {
     // Is indicating if this LayerResult should be processed, or it is just inserted artificial LayerResult.
     // It is used for the pressure equalizer because it needs to buffer one layer back.
     bool        nop_layer_result { false };
+    // Only set for the first layer of an object instance printed sequentially.
+    std::shared_ptr<LayerObjectStart> object_start;
 
     static LayerResult make_nop_layer_result() { return {"", std::numeric_limits<coord_t>::max(), false, false, true}; }
 };
 
+// Data of a single print_z, which do not depend on the state of the G-code generator (last position, active extruder,
+// retraction, wipe ...), thus they are calculated by a parallel stage of the G-code export pipeline
+// ahead of the serial GCode::process_layer().
+struct LayerPrepared {
+    // Index into the list of layers to print. Index equal to the number of layers to print marks
+    // the NOP layer inserted for the pressure equalizer.
+    size_t                                            layer_to_print_idx { 0 };
+    // Boundaries of ObjectLayerToPrint::object_layer for ExtrusionQualityEstimator, one per ObjectLayerToPrint.
+    std::vector<AABBTreeLines::LinesDistancer<Linef>> overhang_boundaries;
+};
+
 class GCode {
 public:        
     GCode() : 
@@ -136,6 +159,7 @@ public:
         m_enable_loop_clipping(true), 
         m_enable_cooling_markers(false), 
         m_enable_extrusion_role_markers(false),
+        m_enable_arc_fitting(false),
         m_last_processor_extrusion_role(GCodeExtrusionRole::None),
         m_layer_count(0),
         m_layer_index(-1), 
@@ -204,8 +228,8 @@ public:
 private:
     class GCodeOutputStream {
     public:
-        GCodeOutputStream(FILE *f, GCodeProcessor &processor) : f(f), m_processor(processor) {}
-        ~GCodeOutputStream() { this->close(); }
+        GCodeOutputStream(FILE *f, GCodeProcessor &processor);
+        ~GCodeOutputStream();
 
         // Set a find-replace post-processor to modify the G-code before GCodePostProcessor.
         // It is being set to null inside process_layers(), because the find-replace process
@@ -215,8 +239,10 @@ private:
         void find_replace_supress() { m_find_replace = nullptr; }
 
         bool is_open() const { return f; }
+        // Only valid after flush(), as the G-code is being written into the file by a background thread.
         bool is_error() const;
         
+        // Wait until the background thread writes all the G-code into the file.
         void flush();
         void close();
 
@@ -233,7 +259,13 @@ private:
         void write_format(const char* format, ...);
 
     private:
+        // Writes the filled blocks into the file on a background thread, see GCode.cpp.
+        class AsyncWriter;
+
         FILE             *f { nullptr };
+        // Block of G-code being filled, to be passed to m_writer once it reaches block_size.
+        std::string       m_block;
+        std::unique_ptr<AsyncWriter> m_writer;
         // Find-replace post-processor to be called before GCodePostProcessor.
         GCodeFindReplace *m_find_replace { nullptr };
         // If suppressed, the backoup holds m_find_replace.
@@ -250,6 +282,8 @@ private:
         // Set of object & print layers of the same PrintObject and with the same print_z.
         const ObjectsLayerToPrint       &layers,
         const LayerTools  				&layer_tools,
+        // Data of this print_z precalculated in parallel by the export pipeline, see prepare_layer().
+        LayerPrepared                  &&prepared,
         const bool                       last_layer,
 		// Pairs of PrintObject index and its instance index.
 		const std::vector<const PrintInstance*> *ordering,
@@ -265,14 +299,19 @@ private:
         const std::vector<const PrintInstance*>                       &print_object_instances_ordering,
         const std::vector<std::pair<coordf_t, ObjectsLayerToPrint>>   &layers_to_print,
         GCodeOutputStream                                             &output_stream);
-    // Process all layers of a single object instance (sequential mode) with a parallel pipeline:
-    // Generate G-code, run the filters (vase mode, cooling buffer), run the G-code analyser
-    // and export G-code into file.
+    // Object instance printed sequentially (complete_objects) with its tool ordering and layers.
+    struct SequentialObjectToPrint {
+        const PrintInstance *instance;
+        const ToolOrdering  *tool_ordering;
+        unsigned int         initial_extruder_id;
+        ObjectsLayerToPrint  layers;
+    };
+    // Process all layers of all object instances one after the other (sequential mode) with a single parallel pipeline:
+    // Generate G-code including the moves between the objects, run the filters (vase mode, cooling buffer),
+    // run the G-code analyser and export G-code into file.
     void process_layers(
         const Print                             &print,
-        const ToolOrdering                      &tool_ordering,
-        ObjectsLayerToPrint                      layers_to_print,
-        const size_t                             single_object_idx,
+        std::vector<SequentialObjectToPrint>   &&objects,
         GCodeOutputStream                       &output_stream);
 
     void            set_last_pos(const Point &pos) { m_last_pos = pos; m_last_pos_defined = true; }
@@ -361,6 +400,9 @@ private:
     // Markers for the Pressure Equalizer to recognize the extrusion type.
     // The Pressure Equalizer removes the markers from the final G-code.
     bool                                m_enable_extrusion_role_markers;
+    // Export runs of extrusion moves along curved paths as G2 / G3 arcs.
+    // Disabled for the spiral vase and the Pressure Equalizer, which only understand G1 moves.
+    bool                                m_enable_arc_fitting;
     // Keeps track of the last extrusion role passed to the processor
     GCodeExtrusionRole                  m_last_processor_extrusion_role;
     // How many times will change_layer() be called?
@@ -410,8 +452,8 @@ private:
 
     std::string _extrude(const ExtrusionPath &path, const std::string_view description, double speed = -1);
     void print_machine_envelope(GCodeOutputStream &file, Print &print);
-    void _print_first_layer_bed_temperature(GCodeOutputStream &file, Print &print, const std::string &gcode, unsigned int first_printing_extruder_id, bool wait);
-    void _print_first_layer_extruder_temperatures(GCodeOutputStream &file, Print &print, const std::string &gcode, unsigned int first_printing_extruder_id, bool wait);
+    std::string _print_first_layer_bed_temperature(const Print &print, const std::string &gcode, unsigned int first_printing_extruder_id, bool wait);
+    std::string _print_first_layer_extruder_temperatures(const Print &print, const std::string &gcode, unsigned int first_printing_extruder_id, bool wait);
     // On the first printing layer. This flag triggers first layer speeds.
     bool                                on_first_layer() const { return m_layer != nullptr && m_layer->id() == 0; }
     // To control print speed of 1st object layer over raft interface.
@@ -1166,6 +1166,20 @@ static void init_boundary(AvoidCrossingPerimeters::Boundary *boundary, Polygons
     init_boundary_distances(boundary);
 }
 
+// Memoized avoid_perimeters(), the boundary shall not change between the calls.
+static size_t avoid_perimeters_cached(AvoidCrossingPerimeters::Boundary &boundary,
+                                      const Point                       &start,
+                                      const Point                       &end,
+                                      const Layer                       &layer,
+                                      Polyline                          &result_out)
+{
+    auto [it, inserted] = boundary.travels.try_emplace(std::make_pair(start, end));
+    if (inserted)
+        it->second.second = avoid_perimeters(boundary, start, end, layer, it->second.first);
+    result_out = it->second.first;
+    return it->second.second;
+}
+
 // Plan travel, which avoids perimeter crossings by following the boundaries of the layer.
 Polyline AvoidCrossingPerimeters::travel_to(const GCode &gcodegen, const Point &point, bool *could_be_wipe_disabled)
 {
@@ -1190,7 +1204,7 @@ Polyline AvoidCrossingPerimeters::travel_to(const GCode &gcodegen, const Point &
 
         // Trim the travel line by the bounding box.
         if (!m_internal.boundaries.empty() && Geometry::liang_barsky_line_clipping(startf, endf, m_internal.bbox)) {
-            travel_intersection_count = avoid_perimeters(m_internal, startf.cast<coord_t>(), endf.cast<coord_t>(), *gcodegen.layer(), result_pl);
+            travel_intersection_count = avoid_perimeters_cached(m_internal, startf.cast<coord_t>(), endf.cast<coord_t>(), *gcodegen.layer(), result_pl);
             result_pl.points.front()  = start;
             result_pl.points.back()   = end;
         }
@@ -1201,7 +1215,7 @@ Polyline AvoidCrossingPerimeters::travel_to(const GCode &gcodegen, const Point &
 
         // Trim the travel line by the bounding box.
         if (!m_external.boundaries.empty() && Geometry::liang_barsky_line_clipping(startf, endf, m_external.bbox)) {
-            travel_intersection_count = avoid_perimeters(m_external, startf.cast<coord_t>(), endf.cast<coord_t>(), *gcodegen.layer(), result_pl);
+            travel_intersection_count = avoid_perimeters_cached(m_external, startf.cast<coord_t>(), endf.cast<coord_t>(), *gcodegen.layer(), result_pl);
             result_pl.points.front()  = start;
             result_pl.points.back()   = end;
         }
@@ -1242,6 +1256,11 @@ Polyline AvoidCrossingPerimeters::travel_to(const GCode &gcodegen, const Point &
 
 void AvoidCrossingPerimeters::init_layer(const Layer &layer)
 {
+    if (m_layer == &layer)
+        // Printing another instance of the same object, reuse the boundaries and the travels already planned.
+        return;
+    m_layer = &layer;
+
     m_internal.clear();
     m_external.clear();
     m_lslices_offset.clear();
@@ -5,6 +5,8 @@
 #include "../ExPolygon.hpp"
 #include "../EdgeGrid.hpp"
 
+#include <unordered_map>
+
 namespace Slic3r {
 
 // Forward declarations.
@@ -43,10 +45,19 @@ public:
         // Used for detection of intersection between line and any polygon from boundaries
         EdgeGrid::Grid                  grid;
 
+        struct TravelHash {
+            size_t operator()(const std::pair<Point, Point> &travel) const noexcept
+                { return PointHash{}(travel.first) * 31 + PointHash{}(travel.second); }
+        };
+        // Already planned travels (start, end) => (planned travel, number of crossed boundaries).
+        // All instances of an object share the same layer and they repeat the same travels in the object coordinate system.
+        std::unordered_map<std::pair<Point, Point>, std::pair<Polyline, size_t>, TravelHash> travels;
+
         void clear()
         {
             boundaries.clear();
             boundaries_params.clear();
+            travels.clear();
         }
     };
 
@@ -58,6 +69,9 @@ private:
     // we enable it by default for the first travel move in print
     bool           m_disabled_once { true };
 
+    // Layer, for which the data below were initialized. The data are kept when printing the next instance of the same object.
+    const Layer             *m_layer { nullptr };
+
     // Lslices offseted by half an external perimeter width. Used for detection if line or polyline is inside of any polygon.
     ExPolygons               m_lslices_offset;
     std::vector<BoundingBox> m_lslices_offset_bboxes;
@@ -19,7 +19,7 @@
 
 namespace Slic3r {
 
-CoolingBuffer::CoolingBuffer(GCode &gcodegen) : m_config(gcodegen.config()), m_toolchange_prefix(gcodegen.writer().toolchange_prefix()), m_current_extruder(0)
+CoolingBuffer::CoolingBuffer(GCode &gcodegen) : m_config(gcodegen.config()), m_toolchange_prefix(gcodegen.writer().toolchange_prefix()), m_current_extruder(0), m_parser_extruder(0)
 {
     this->reset(gcodegen.writer().get_position());
 
@@ -31,14 +31,13 @@ CoolingBuffer::CoolingBuffer(GCode &gcodegen) : m_config(gcodegen.config()), m_t
     }
 }
 
-void CoolingBuffer::reset(const Vec3d &position)
+void CoolingBuffer::reset_parser(const Vec3d &position)
 {
     m_current_pos.assign(5, 0.f);
     m_current_pos[0] = float(position.x());
     m_current_pos[1] = float(position.y());
     m_current_pos[2] = float(position.z());
     m_current_pos[4] = float(m_config.travel_speed.value);
-    m_fan_speed = -1;
 }
 
 struct CoolingLine
@@ -63,6 +62,9 @@ struct CoolingLine
         // Custom fan speed (introduced for overhang fan speed)
         TYPE_SET_FAN_SPEED      = 1 << 13,
         TYPE_RESET_FAN_SPEED    = 1 << 14,
+        // G2 / G3 arc move, also marked as TYPE_G1 as it is handled the same way as the G1 extrusion moves.
+        TYPE_G2                 = 1 << 15,
+        TYPE_G3                 = 1 << 16,
     };
 
     CoolingLine(unsigned int type, size_t  line_start, size_t  line_end) :
@@ -302,7 +304,20 @@ finished:
 	return new_feedrate;
 }
 
+struct CoolingBuffer::ParsedLayer
+{
+    std::string                         gcode;
+    size_t                              layer_id;
+    float                               layer_time_stretched;
+    std::vector<PerExtruderAdjustments> per_extruder_adjustments;
+};
+
 std::string CoolingBuffer::process_layer(std::string &&gcode, size_t layer_id, bool flush)
+{
+    return this->apply_layer(this->parse_layer(std::move(gcode), layer_id, flush));
+}
+
+std::shared_ptr<CoolingBuffer::ParsedLayer> CoolingBuffer::parse_layer(std::string &&gcode, size_t layer_id, bool flush)
 {
     // Cache the input G-code.
     if (m_gcode.empty())
@@ -310,21 +325,34 @@ std::string CoolingBuffer::process_layer(std::string &&gcode, size_t layer_id, b
     else
         m_gcode += gcode;
 
-    std::string out;
+    std::shared_ptr<ParsedLayer> out;
     if (flush) {
         // This is either an object layer or the very last print layer. Calculate cool down over the collected support layers
         // and one object layer.
-        std::vector<PerExtruderAdjustments> per_extruder_adjustments = this->parse_layer_gcode(m_gcode, m_current_pos);
-        float layer_time_stretched = this->calculate_layer_slowdown(per_extruder_adjustments);
-        out = this->apply_layer_cooldown(m_gcode, layer_id, layer_time_stretched, per_extruder_adjustments);
+        out = std::make_shared<ParsedLayer>();
+        out->per_extruder_adjustments = this->parse_layer_gcode(m_gcode, m_current_pos, m_parser_extruder);
+        out->layer_time_stretched     = this->calculate_layer_slowdown(out->per_extruder_adjustments);
+        out->layer_id                 = layer_id;
+        // Hand over the collected G-code and start collecting the next layer into an empty buffer.
+        out->gcode                    = std::move(m_gcode);
         m_gcode.clear();
     }
     return out;
 }
 
+std::string CoolingBuffer::apply_layer(std::shared_ptr<ParsedLayer> &&layer)
+{
+    std::string out;
+    if (layer) {
+        out = this->apply_layer_cooldown(layer->gcode, layer->layer_id, layer->layer_time_stretched, layer->per_extruder_adjustments);
+        layer.reset();
+    }
+    return out;
+}
+
 // Parse the layer G-code for the moves, which could be adjusted.
 // Return the list of parsed lines, bucketed by an extruder.
-std::vector<PerExtruderAdjustments> CoolingBuffer::parse_layer_gcode(const std::string &gcode, std::vector<float> &current_pos) const
+std::vector<PerExtruderAdjustments> CoolingBuffer::parse_layer_gcode(const std::string &gcode, std::vector<float> &current_pos, unsigned int &current_extruder) const
 {
     std::vector<PerExtruderAdjustments> per_extruder_adjustments(m_extruder_ids.size());
     std::vector<size_t>                 map_extruder_to_per_extruder_adjustment(m_num_extruders, 0);
@@ -338,7 +366,6 @@ std::vector<PerExtruderAdjustments> CoolingBuffer::parse_layer_gcode(const std::
         map_extruder_to_per_extruder_adjustment[extruder_id] = i;
     }
 
-    unsigned int      current_extruder  = m_current_extruder;
     PerExtruderAdjustments *adjustment  = &per_extruder_adjustments[map_extruder_to_per_extruder_adjustment[current_extruder]];
     const char       *line_start = gcode.c_str();
     const char       *line_end   = line_start;
@@ -362,12 +389,18 @@ std::vector<PerExtruderAdjustments> CoolingBuffer::parse_layer_gcode(const std::
             line.type = CoolingLine::TYPE_G0;
         else if (boost::starts_with(sline, "G1 "))
             line.type = CoolingLine::TYPE_G1;
+        else if (boost::starts_with(sline, "G2 "))
+            line.type = CoolingLine::TYPE_G1 | CoolingLine::TYPE_G2;
+        else if (boost::starts_with(sline, "G3 "))
+            line.type = CoolingLine::TYPE_G1 | CoolingLine::TYPE_G3;
         else if (boost::starts_with(sline, "G92 "))
             line.type = CoolingLine::TYPE_G92;
         if (line.type) {
-            // G0, G1 or G92
+            // G0, G1, G2, G3 or G92
             // Parse the G-code line.
             new_pos = current_pos;
+            // Offset of the arc center from the start point of G2 / G3.
+            Vec2f arc_ij = Vec2f::Zero();
             for (auto c = sline.begin() + 3;;) {
                 // Skip whitespaces.
                 for (; c != sline.end() && (*c == ' ' || *c == '\t'); ++ c);
@@ -377,7 +410,10 @@ std::vector<PerExtruderAdjustments> CoolingBuffer::parse_layer_gcode(const std::
                 // Parse the axis.
                 size_t axis = (*c >= 'X' && *c <= 'Z') ? (*c - 'X') :
                               (*c == extrusion_axis) ? 3 : (*c == 'F') ? 4 : size_t(-1);
-                if (axis != size_t(-1)) {
+                if ((*c == 'I' || *c == 'J') && (line.type & (CoolingLine::TYPE_G2 | CoolingLine::TYPE_G3))) {
+                    float &v = arc_ij[*c == 'I' ? 0 : 1];
+                    fast_float::from_chars(&*(++ c), sline.data() + sline.size(), v);
+                } else if (axis != size_t(-1)) {
                     //auto [pend, ec] = 
                         fast_float::from_chars(&*(++ c), sline.data() + sline.size(), new_pos[axis]);
                     if (axis == 4) {
@@ -402,7 +438,7 @@ std::vector<PerExtruderAdjustments> CoolingBuffer::parse_layer_gcode(const std::
                 active_speed_modifier = adjustment->lines.size();
             }
             if ((line.type & CoolingLine::TYPE_G92) == 0) {
-                // G0 or G1. Calculate the duration.
+                // G0, G1, G2 or G3. Calculate the duration.
                 if (m_config.use_relative_e_distances.value)
                     // Reset extruder accumulator.
                     current_pos[3] = 0.f;
@@ -410,6 +446,19 @@ std::vector<PerExtruderAdjustments> CoolingBuffer::parse_layer_gcode(const std::
                 for (size_t i = 0; i < 4; ++ i)
                     dif[i] = new_pos[i] - current_pos[i];
                 float dxy2 = dif[0] * dif[0] + dif[1] * dif[1];
+                if ((line.type & (CoolingLine::TYPE_G2 | CoolingLine::TYPE_G3)) && arc_ij != Vec2f::Zero()) {
+                    // Length of the arc in XY.
+                    const Vec2f v1    = - arc_ij;
+                    const Vec2f v2    = Vec2f(dif[0], dif[1]) - arc_ij;
+                    float       angle = std::atan2(cross2(v1, v2), v1.dot(v2));
+                    if (line.type & CoolingLine::TYPE_G3) {
+                        if (angle <= 0.f)
+                            angle += float(2. * PI);
+                    } else if (angle >= 0.f)
+                        angle -= float(2. * PI);
+                    const float arc_length = arc_ij.norm() * std::abs(angle);
+                    dxy2 = arc_length * arc_length;
+                }
                 float dxyz2 = dxy2 + dif[2] * dif[2];
                 if (dxyz2 > 0.f) {
                     // Movement in xyz, calculate time from the xyz Euclidian distance.
@@ -3,6 +3,7 @@
 
 #include "../libslic3r.h"
 #include <map>
+#include <memory>
 #include <string>
 
 namespace Slic3r {
@@ -23,15 +24,32 @@ struct PerExtruderAdjustments;
 class CoolingBuffer {
 public:
     CoolingBuffer(GCode &gcodegen);
-    void        reset(const Vec3d &position);
-    void        set_current_extruder(unsigned int extruder_id) { m_current_extruder = extruder_id; }
+    void        reset(const Vec3d &position) { this->reset_parser(position); this->reset_emitter(); }
+    void        set_current_extruder(unsigned int extruder_id) { m_current_extruder = extruder_id; m_parser_extruder = extruder_id; }
+    // reset() and set_current_extruder() split into the parser and the emitter state, so that the cooling buffer may be reset
+    // between two layers while they are being processed by the two pipeline stages, see parse_layer() and apply_layer().
+    void        reset_parser(const Vec3d &position);
+    void        reset_parser(const Vec3d &position, unsigned int extruder_id) { this->reset_parser(position); m_parser_extruder = extruder_id; }
+    void        reset_emitter() { m_fan_speed = -1; }
+    void        reset_emitter(unsigned int extruder_id) { this->reset_emitter(); m_current_extruder = extruder_id; }
     std::string process_layer(std::string &&gcode, size_t layer_id, bool flush);
     std::string process_layer(const std::string &gcode, size_t layer_id, bool flush)
         { return this->process_layer(std::string(gcode), layer_id, flush); }
 
+    // The layer processing split into two steps, which are run by two consecutive serial stages of the G-code export pipeline,
+    // so that a layer may be parsed and its slow down calculated while the previous layer is being emitted.
+    // parse_layer() only touches the parser state (m_gcode, m_current_pos, m_parser_extruder),
+    // apply_layer() only touches the emitter state (m_fan_speed, m_current_extruder).
+    struct ParsedLayer;
+    // Cache the input G-code. If flush is set, parse the collected G-code and calculate its slow down,
+    // otherwise return nullptr.
+    std::shared_ptr<ParsedLayer> parse_layer(std::string &&gcode, size_t layer_id, bool flush);
+    // Apply slow down and fan control to a layer returned by parse_layer(). Returns an empty string for nullptr.
+    std::string apply_layer(std::shared_ptr<ParsedLayer> &&layer);
+
 private:
 	CoolingBuffer& operator=(const CoolingBuffer&) = delete;
-    std::vector<PerExtruderAdjustments> parse_layer_gcode(const std::string &gcode, std::vector<float> &current_pos) const;
+    std::vector<PerExtruderAdjustments> parse_layer_gcode(const std::string &gcode, std::vector<float> &current_pos, unsigned int &current_extruder) const;
     float       calculate_layer_slowdown(std::vector<PerExtruderAdjustments> &per_extruder_adjustments);
     // Apply slow down over G-code lines stored in per_extruder_adjustments, enable fan if needed.
     // Returns the adjusted G-code.
@@ -55,6 +73,8 @@ private:
     // the PrintConfig slice of FullPrintConfig is constant, thus no thread synchronization is required.
     const PrintConfig          &m_config;
     unsigned int                m_current_extruder;
+    // Extruder active at the end of the G-code parsed by parse_layer(), which may be ahead of apply_layer().
+    unsigned int                m_parser_extruder;
 
     // Old logic: proportional.
     bool                        m_cooling_logic_proportional = false;
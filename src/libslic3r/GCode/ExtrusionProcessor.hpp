@@ -135,7 +135,9 @@ std::vector<ExtendedPoint> estimate_points_properties(const std::vector<P>
     }
     for (size_t i = 1; i < input_points.size(); i++) {
         ExtendedPoint next_point{maybe_unscale(input_points[i])};
-        auto [distance, nearest_line, x]   = unscaled_prev_layer.template distance_from_lines_extra<SIGNED_DISTANCE>(next_point.position.cast<AABBScalar>());
+        // The closest line of the previous point bounds the search.
+        auto [distance, nearest_line, x]   = unscaled_prev_layer.template distance_from_lines_extra<SIGNED_DISTANCE>(next_point.position.cast<AABBScalar>(),
+                                                                                                                      points.back().nearest_prev_layer_line);
         next_point.distance                = distance + boundary_offset;
         next_point.nearest_prev_layer_line = nearest_line;
 
@@ -181,7 +183,7 @@ std::vector<ExtendedPoint> estimate_points_properties(const std::vector<P>
             }
             new_points.push_back(next);
         }
-        points = new_points;
+        points = std::move(new_points);
     }
 
     if (max_line_length > 0) {
@@ -198,13 +200,14 @@ std::vector<ExtendedPoint> estimate_points_properties(const std::vector<P>
                 for (size_t j = 1; j < new_point_count + 1; j++) {
                     Vec2d pos  = curr.position * (1.0 - j * t) + next.position * (j * t);
                     auto [p_dist, p_near_l,
-                          p_x] = unscaled_prev_layer.template distance_from_lines_extra<SIGNED_DISTANCE>(pos.cast<AABBScalar>());
+                          p_x] = unscaled_prev_layer.template distance_from_lines_extra<SIGNED_DISTANCE>(pos.cast<AABBScalar>(),
+                                                                                                         new_points.back().nearest_prev_layer_line);
                     new_points.push_back(ExtendedPoint{pos, float(p_dist + boundary_offset), p_near_l});
                 }
             }
             new_points.push_back(points.back());
         }
-        points = new_points;
+        points = std::move(new_points);
     }
 
     for (int point_idx = 0; point_idx < int(points.size()); ++point_idx) {
@@ -251,17 +254,32 @@ class ExtrusionQualityEstimator
 public:
     void set_current_object(const PrintObject *object) { current_object = object; }
 
+    // Boundaries of a layer to be used for estimation of the overhangs of the layer above.
+    // Does not depend on the state of ExtrusionQualityEstimator, thus it may be called in parallel for multiple layers
+    // ahead of prepare_for_new_layer().
+    static AABBTreeLines::LinesDistancer<Linef> layer_boundaries(const Layer &layer)
+    {
+        return AABBTreeLines::LinesDistancer<Linef>{to_unscaled_linesf(layer.lslices)};
+    }
+
     void prepare_for_new_layer(const Layer *layer)
+    {
+        if (layer == nullptr) return;
+        this->prepare_for_new_layer(layer, layer_boundaries(*layer));
+    }
+
+    // Variant of prepare_for_new_layer() with boundaries of the layer precalculated by layer_boundaries().
+    void prepare_for_new_layer(const Layer *layer, AABBTreeLines::LinesDistancer<Linef> &&boundaries)
     {
         if (layer == nullptr) return;
         const PrintObject *object     = layer->object();
-        prev_layer_boundaries[object] = next_layer_boundaries[object];
-        next_layer_boundaries[object] = AABBTreeLines::LinesDistancer<Linef>{to_unscaled_linesf(layer->lslices)};
+        prev_layer_boundaries[object] = std::move(next_layer_boundaries[object]);
+        next_layer_boundaries[object] = std::move(boundaries);
     }
 
     std::vector<ProcessedPoint> estimate_extrusion_quality(const ExtrusionPath                                          &path,
-                                                           const std::vector<std::pair<int, ConfigOptionFloatOrPercent>> overhangs_w_speeds,
-                                                           const std::vector<std::pair<int, ConfigOptionInts>> overhangs_w_fan_speeds,
+                                                           const std::vector<std::pair<int, ConfigOptionFloatOrPercent>> &overhangs_w_speeds,
+                                                           const std::vector<std::pair<int, ConfigOptionInts>> &overhangs_w_fan_speeds,
                                                            size_t                                              extruder_id,
                                                            float                                               ext_perimeter_speed,
                                                            float                                               original_speed)
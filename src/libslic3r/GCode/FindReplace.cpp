@@ -105,24 +105,21 @@ static void find_and_replace_whole_word(std::string &inout, const std::string &m
     }
 }
 
-std::string GCodeFindReplace::process_layer(const std::string &ain)
+std::string GCodeFindReplace::process_layer(std::string &&gcode) const
 {
-    std::string out;
-    const std::string *in = &ain;
+    // Substitute in place of the input G-code, the regular expressions swap out with a temporary buffer.
+    std::string out = std::move(gcode);
     std::string temp;
-    temp.reserve(in->size());
 
     for (const Substitution &substitution : m_substitutions) {
         if (substitution.regexp) {
             temp.clear();
-            temp.reserve(in->size());
-            boost::regex_replace(ToStringIterator(temp), in->begin(), in->end(),
+            temp.reserve(out.size());
+            boost::regex_replace(ToStringIterator(temp), out.cbegin(), out.cend(),
                 substitution.regexp_pattern, substitution.format, 
                 (substitution.single_line ? boost::match_single_line | boost::match_default : boost::match_not_dot_newline | boost::match_default) | boost::format_all);
-            std::swap(out, temp);
+            out.swap(temp);
         } else {
-            if (in == &ain)
-                out = ain;
             // Plain substitution
             if (substitution.case_insensitive) {
                 if (substitution.whole_word)
@@ -147,7 +144,6 @@ std::string GCodeFindReplace::process_layer(const std::string &ain)
                     boost::replace_all(out, substitution.plain_pattern, substitution.format);
             }
         }
-        in = &out;
     }
 
     return out;
@@ -13,7 +13,10 @@ public:
     GCodeFindReplace(const std::vector<std::string> &gcode_substitutions);
 
 
-    std::string process_layer(const std::string &gcode);
+    // Apply all the substitutions in their order. Thread safe, the substitutions hold no state,
+    // thus the layers may be processed in parallel.
+    std::string process_layer(std::string &&gcode) const;
+    std::string process_layer(const std::string &gcode) const { return this->process_layer(std::string(gcode)); }
     
 private:
     struct Substitution {
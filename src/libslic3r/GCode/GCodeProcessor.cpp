@@ -12,6 +12,7 @@
 #include <boost/nowide/fstream.hpp>
 #include <boost/nowide/cstdio.hpp>
 #include <boost/filesystem/path.hpp>
+#include <boost/filesystem/operations.hpp>
 
 #include <float.h>
 #include <assert.h>
@@ -266,10 +267,10 @@ static void recalculate_trapezoids(std::vector<GCodeProcessor::TimeBlock>& block
             // Recalculate if current block entry or exit junction speed has changed.
             if (curr->flags.recalculate || next->flags.recalculate) {
                 // NOTE: Entry and exit factors always > 0 by all previous logic operations.
-                GCodeProcessor::TimeBlock block = *curr;
-                block.feedrate_profile.exit = next->feedrate_profile.entry;
-                block.calculate_trapezoid();
-                curr->trapezoid = block.trapezoid;
+                // The exit feedrate is only consumed by calculate_trapezoid() and it is always set before being consumed,
+                // thus the block may be updated in place instead of calculating the trapezoid on a copy of the block.
+                curr->feedrate_profile.exit = next->feedrate_profile.entry;
+                curr->calculate_trapezoid();
                 curr->flags.recalculate = false; // Reset current only to ensure next trapezoid is computed
             }
         }
@@ -277,10 +278,8 @@ static void recalculate_trapezoids(std::vector<GCodeProcessor::TimeBlock>& block
 
     // Last/newest block in buffer. Always recalculated.
     if (next != nullptr) {
-        GCodeProcessor::TimeBlock block = *next;
-        block.feedrate_profile.exit = next->safe_feedrate;
-        block.calculate_trapezoid();
-        next->trapezoid = block.trapezoid;
+        next->feedrate_profile.exit = next->safe_feedrate;
+        next->calculate_trapezoid();
         next->flags.recalculate = false;
     }
 }
@@ -317,13 +316,9 @@ void GCodeProcessor::TimeMachine::calculate_time(size_t keep_last_n_blocks, floa
             roles_time[static_cast<size_t>(block.role)] += block_time;
         gcode_time.cache += block_time;
         moves_time[static_cast<size_t>(block.move_type)] += block_time;
-        if (block.layer_id >= layers_time.size()) {
-            const size_t curr_size = layers_time.size();
-            layers_time.resize(block.layer_id);
-            for (size_t i = curr_size; i < layers_time.size(); ++i) {
-                layers_time[i] = 0.0f;
-            }
-        }
+        if (block.layer_id > layers_time.size())
+            // Newly added layers are zero initialized.
+            layers_time.resize(block.layer_id, 0.0f);
         layers_time[block.layer_id - 1] += block_time;
         g1_times_cache.push_back({ block.g1_line_id, time });
         // update times for remaining time to printer stop placeholders
@@ -481,6 +476,237 @@ const std::vector<std::pair<GCodeProcessor::EProducer, std::string>> GCodeProces
 
 unsigned int GCodeProcessor::s_result_id = 0;
 
+namespace {
+
+static constexpr const char     ResultCacheMagic[8] = "PSGCRES";
+static constexpr const uint32_t ResultCacheVersion  = 1;
+
+// Plain binary image of the result. Vectors of simple structures (MoveVertex, pairs of numbers) are stored as they are laid out in memory,
+// thus the sidecar is only valid for the build that wrote it. The layout is guarded by the version and by the size of MoveVertex.
+class ResultCacheWriter
+{
+public:
+    template<typename T> void write(const T& v) { m_data.append(reinterpret_cast<const char*>(&v), sizeof(T)); }
+    template<typename T> void write_vector(const std::vector<T>& v) {
+        write(uint64_t(v.size()));
+        m_data.append(reinterpret_cast<const char*>(v.data()), v.size() * sizeof(T));
+    }
+    template<typename K, typename V> void write_map(const std::map<K, V>& m) {
+        write(uint64_t(m.size()));
+        for (const auto& [key, value] : m) {
+            write(key);
+            write(value);
+        }
+    }
+    void write_string(const std::string& s) { write(uint64_t(s.size())); m_data.append(s); }
+    void write_strings(const std::vector<std::string>& v) {
+        write(uint64_t(v.size()));
+        for (const std::string& s : v)
+            write_string(s);
+    }
+
+    const std::string& data() const { return m_data; }
+
+private:
+    std::string m_data;
+};
+
+class ResultCacheReader
+{
+public:
+    explicit ResultCacheReader(std::string&& data) : m_data(std::move(data)) {}
+
+    template<typename T> void read(T& v) { read_raw(&v, sizeof(T)); }
+    template<typename T> void read_vector(std::vector<T>& v) {
+        const size_t n = read_size(sizeof(T));
+        v.resize(n);
+        read_raw(v.data(), n * sizeof(T));
+    }
+    template<typename K, typename V> void read_map(std::map<K, V>& m) {
+        m.clear();
+        for (size_t n = read_size(sizeof(K) + sizeof(V)); n > 0; -- n) {
+            K key;
+            read(key);
+            read(m[key]);
+        }
+    }
+    void read_string(std::string& s) {
+        s.resize(read_size(1));
+        read_raw(s.data(), s.size());
+    }
+    void read_strings(std::vector<std::string>& v) {
+        v.resize(read_size(sizeof(uint64_t)));
+        for (std::string& s : v)
+            read_string(s);
+    }
+
+    bool at_end() const { return m_pos == m_data.size(); }
+
+    // Read number of elements, validate it against the size of the rest of the data.
+    size_t read_size(size_t element_size) {
+        uint64_t n;
+        read(n);
+        if (n > (m_data.size() - m_pos) / element_size)
+            throw Slic3r::RuntimeError("Truncated G-code result cache");
+        return size_t(n);
+    }
+
+private:
+    void read_raw(void* dst, size_t size) {
+        if (m_data.size() - m_pos < size)
+            throw Slic3r::RuntimeError("Truncated G-code result cache");
+        memcpy(dst, m_data.data() + m_pos, size);
+        m_pos += size;
+    }
+
+    std::string m_data;
+    size_t      m_pos{ 0 };
+};
+
+} // namespace
+
+bool GCodeProcessor::save_result_cache(const GCodeProcessorResult& result, const std::string& gcode_filename)
+{
+    const std::string path = result_cache_path(gcode_filename);
+    try {
+        ResultCacheWriter out;
+        out.write(ResultCacheMagic);
+        out.write(ResultCacheVersion);
+        out.write(uint32_t(sizeof(GCodeProcessorResult::MoveVertex)));
+        out.write(uint64_t(boost::filesystem::file_size(gcode_filename)));
+        out.write(int64_t(boost::filesystem::last_write_time(gcode_filename)));
+
+        out.write_vector(result.moves);
+        out.write_vector(result.lines_ends);
+        out.write_vector(result.bed_shape);
+        out.write(result.max_print_height);
+        out.write_string(result.settings_ids.print);
+        out.write_strings(result.settings_ids.filament);
+        out.write_string(result.settings_ids.printer);
+        out.write(uint64_t(result.extruders_count));
+        out.write_strings(result.extruder_colors);
+        out.write_vector(result.filament_diameters);
+        out.write_vector(result.filament_densities);
+        out.write_vector(result.filament_cost);
+
+        const PrintEstimatedStatistics& stats = result.print_statistics;
+        for (const PrintEstimatedStatistics::Mode& mode : stats.modes) {
+            out.write(mode.time);
+            out.write(mode.travel_time);
+            out.write_vector(mode.custom_gcode_times);
+            out.write_vector(mode.moves_times);
+            out.write_vector(mode.roles_times);
+            out.write_vector(mode.layers_times);
+        }
+        out.write_vector(stats.volumes_per_color_change);
+        out.write_map(stats.volumes_per_extruder);
+        out.write_map(stats.used_filaments_per_role);
+        out.write_map(stats.cost_per_extruder);
+
+        out.write(uint64_t(result.custom_gcode_per_print_z.size()));
+        for (const CustomGCode::Item& item : result.custom_gcode_per_print_z) {
+            out.write(item.print_z);
+            out.write(item.type);
+            out.write(item.extruder);
+            out.write_string(item.color);
+            out.write_string(item.extra);
+        }
+        out.write_vector(result.spiral_vase_layers);
+
+        boost::nowide::ofstream file(path, std::ios::binary);
+        file.write(out.data().data(), out.data().size());
+        file.close();
+        if (file.fail())
+            throw Slic3r::RuntimeError("Failed to write " + path);
+        return true;
+    } catch (const std::exception& ex) {
+        BOOST_LOG_TRIVIAL(error) << "Failed to save the G-code result cache " << path << ": " << ex.what();
+        boost::system::error_code ec;
+        boost::filesystem::remove(path, ec);
+        return false;
+    }
+}
+
+bool GCodeProcessor::load_result_cache(const std::string& gcode_filename, GCodeProcessorResult& result)
+{
+    const std::string path = result_cache_path(gcode_filename);
+    boost::system::error_code ec;
+    if (! boost::filesystem::exists(path, ec))
+        return false;
+    try {
+        std::string data;
+        {
+            boost::nowide::ifstream file(path, std::ios::binary);
+            data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+            if (file.bad())
+                return false;
+        }
+        ResultCacheReader in(std::move(data));
+        char     magic[sizeof(ResultCacheMagic)];
+        uint32_t version;
+        uint32_t move_vertex_size;
+        uint64_t gcode_size;
+        int64_t  gcode_time;
+        in.read(magic);
+        in.read(version);
+        in.read(move_vertex_size);
+        in.read(gcode_size);
+        in.read(gcode_time);
+        if (memcmp(magic, ResultCacheMagic, sizeof(magic)) != 0 || version != ResultCacheVersion ||
+            move_vertex_size != sizeof(GCodeProcessorResult::MoveVertex) ||
+            gcode_size != uint64_t(boost::filesystem::file_size(gcode_filename)) ||
+            gcode_time != int64_t(boost::filesystem::last_write_time(gcode_filename)))
+            // Stale sidecar or a sidecar written by a different build.
+            return false;
+
+        result.reset();
+        result.filename = gcode_filename;
+        result.id = ++s_result_id;
+        in.read_vector(result.moves);
+        in.read_vector(result.lines_ends);
+        in.read_vector(result.bed_shape);
+        in.read(result.max_print_height);
+        in.read_string(result.settings_ids.print);
+        in.read_strings(result.settings_ids.filament);
+        in.read_string(result.settings_ids.printer);
+        uint64_t extruders_count;
+        in.read(extruders_count);
+        result.extruders_count = size_t(extruders_count);
+        in.read_strings(result.extruder_colors);
+        in.read_vector(result.filament_diameters);
+        in.read_vector(result.filament_densities);
+        in.read_vector(result.filament_cost);
+
+        PrintEstimatedStatistics& stats = result.print_statistics;
+        for (PrintEstimatedStatistics::Mode& mode : stats.modes) {
+            in.read(mode.time);
+            in.read(mode.travel_time);
+            in.read_vector(mode.custom_gcode_times);
+            in.read_vector(mode.moves_times);
+            in.read_vector(mode.roles_times);
+            in.read_vector(mode.layers_times);
+        }
+        in.read_vector(stats.volumes_per_color_change);
+        in.read_map(stats.volumes_per_extruder);
+        in.read_map(stats.used_filaments_per_role);
+        in.read_map(stats.cost_per_extruder);
+
+        result.custom_gcode_per_print_z.assign(in.read_size(sizeof(double)), CustomGCode::Item());
+        for (CustomGCode::Item& item : result.custom_gcode_per_print_z) {
+            in.read(item.print_z);
+            in.read(item.type);
+            in.read(item.extruder);
+            in.read_string(item.color);
+            in.read_string(item.extra);
+        }
+        in.read_vector(result.spiral_vase_layers);
+        return in.at_end();
+    } catch (const std::exception& ex) {
+        BOOST_LOG_TRIVIAL(error) << "Failed to load the G-code result cache " << path << ": " << ex.what();
+        return false;
+    }
+}
+
 bool GCodeProcessor::contains_reserved_tag(const std::string& gcode, std::string& found_tag)
 {
     bool ret = false;
@@ -1114,6 +1340,11 @@ void GCodeProcessor::finalize(bool perform_post_process)
 
     update_estimated_times_stats();
 
+    // No more moves will be added, release the capacity reserved by the geometric growth of the vectors.
+    // For multi-million move G-codes this is a significant amount of memory kept for the lifetime of the result.
+    m_result.moves.shrink_to_fit();
+    m_result.spiral_vase_layers.shrink_to_fit();
+
 #if ENABLE_GCODE_VIEWER_DATA_CHECKING
     std::cout << "\n";
     m_mm3_per_mm_compare.output();
@@ -1123,6 +1354,7 @@ void GCodeProcessor::finalize(bool perform_post_process)
 
     if (perform_post_process)
         post_process();
+    m_result.lines_ends.shrink_to_fit();
 #if ENABLE_GCODE_VIEWER_STATISTICS
     m_result.time = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - m_start_time).count();
 #endif // ENABLE_GCODE_VIEWER_STATISTICS
@@ -3653,16 +3885,14 @@ void GCodeProcessor::post_process()
     // helper function to write to disk
     size_t out_file_pos = 0;
     m_result.lines_ends.clear();
-    auto write_string = [this, &export_line, &out, &out_path, &out_file_pos](const std::string& str) {
+    // m_result.lines_ends are collected when the lines are appended to export_line, see below.
+    auto write_string = [&export_line, &out, &out_path, &out_file_pos](const std::string& str) {
         fwrite((const void*)export_line.c_str(), 1, export_line.length(), out.f);
         if (ferror(out.f)) {
             out.close();
             boost::nowide::remove(out_path.c_str());
             throw Slic3r::RuntimeError(std::string("GCode processor post process export failed.\nIs the disk full?\n"));
         }
-        for (size_t i = 0; i < export_line.size(); ++i)
-            if (export_line[i] == '\n')
-                m_result.lines_ends.emplace_back(out_file_pos + i + 1);
         out_file_pos += export_line.size();
         export_line.clear();
     };
@@ -3694,20 +3924,35 @@ void GCodeProcessor::post_process()
                     ++line_id;
 
                     gcode_line += "\n";
-                    // replace placeholder lines
-                    auto [processed, lines_added_count] = process_placeholders(gcode_line);
-                    if (processed && lines_added_count > 0)
-                        offsets.push_back({ line_id, lines_added_count });
-                    if (!processed)
-                        processed = process_used_filament(gcode_line);
-                    if (!processed && !is_temporary_decoration(gcode_line) && GCodeReader::GCodeLine::cmd_is(gcode_line, "G1")) {
+                    const size_t export_line_size_old = export_line.size();
+                    // Was this line replaced or were any lines inserted in front of it?
+                    bool         multiple_lines       = false;
+                    // The placeholders and filament statistics are all comments, thus they are not searched for in the other lines.
+                    if (gcode_line.front() == ';') {
+                        // replace placeholder lines
+                        auto [processed, lines_added_count] = process_placeholders(gcode_line);
+                        if (processed && lines_added_count > 0)
+                            offsets.push_back({ line_id, lines_added_count });
+                        if (!processed)
+                            processed = process_used_filament(gcode_line);
+                        multiple_lines = processed;
+                    } else if (!is_temporary_decoration(gcode_line) && GCodeReader::GCodeLine::cmd_is(gcode_line, "G1")) {
                         // remove temporary lines, add lines M73 where needed
                         unsigned int extra_lines_count = process_line_G1(g1_lines_counter++);
-                        if (extra_lines_count > 0)
+                        if (extra_lines_count > 0) {
                             offsets.push_back({ line_id, extra_lines_count });
+                            multiple_lines = true;
+                        }
                     }
 
                     export_line += gcode_line;
+                    if (multiple_lines) {
+                        for (size_t i = export_line_size_old; i < export_line.size(); ++i)
+                            if (export_line[i] == '\n')
+                                m_result.lines_ends.emplace_back(out_file_pos + i + 1);
+                    } else
+                        // Single line terminated with '\n', no need to search for the line end.
+                        m_result.lines_ends.emplace_back(out_file_pos + export_line.size());
                     if (export_line.length() > 65535)
                         write_string(export_line);
                     gcode_line.clear();
@@ -609,6 +609,14 @@ namespace Slic3r {
         // throws CanceledException through print->throw_if_canceled() (sent by the caller as callback).
         void process_file(const std::string& filename, std::function<void()> cancel_callback = nullptr);
 
+        // Binary sidecar of a result stored next to the exported G-code, so that the G-code may be loaded into the viewer
+        // without processing it again. The sidecar is valid only as long as the size and the time stamp of the G-code match.
+        static std::string result_cache_path(const std::string& gcode_filename) { return gcode_filename + ".cache"; }
+        // Returns false if the sidecar could not be written.
+        static bool save_result_cache(const GCodeProcessorResult& result, const std::string& gcode_filename);
+        // Returns false if there is no valid sidecar for the G-code, result is left in an undefined state then.
+        static bool load_result_cache(const std::string& gcode_filename, GCodeProcessorResult& result);
+
         // Streaming interface, for processing G-codes just generated by PrusaSlicer in a pipelined fashion.
         void initialize(const std::string& filename);
         void process_buffer(const std::string& buffer);
@@ -155,6 +155,8 @@ std::vector<float> raycast_visibility(const AABBTreeIndirect::Tree<3, float> &ra
                     &raycasting_tree, &result, &samples](tbb::blocked_range<size_t> r) {
                 // Maintaining hits memory outside of the loop, so it does not have to be reallocated for each query.
                 std::vector<igl::Hit> hits;
+                std::vector<Vec3d>    ray_origins;
+                std::vector<Vec3d>    ray_dirs;
                 for (size_t s_idx = r.begin(); s_idx < r.end(); ++s_idx) {
                     result[s_idx] = 1.0f;
                     constexpr float decrease_step = 1.0f
@@ -166,49 +168,52 @@ std::vector<float> raycast_visibility(const AABBTreeIndirect::Tree<3, float> &ra
                     Frame f;
                     f.set_from_z(normal);
 
+                    if (!model_contains_negative_parts) {
+                        // All rays of a sample start at the same point, trace them through the AABB tree as a single packet.
+                        // FIXME: This AABBTTreeIndirect query will not compile for float ray origin and
+                        // direction.
+                        ray_origins.assign(precomputed_sample_directions.size(), (center + normal * 0.01f).cast<double>()); // start above surface.
+                        ray_dirs.clear();
+                        for (const auto &dir : precomputed_sample_directions)
+                            ray_dirs.emplace_back(f.to_world(dir).cast<double>());
+                        if (AABBTreeIndirect::intersect_rays_first_hit(triangles.vertices, triangles.indices, raycasting_tree, ray_origins, ray_dirs, hits) > 0)
+                            for (size_t ray_idx = 0; ray_idx < hits.size(); ++ ray_idx)
+                                if (hits[ray_idx].id >= 0 && its_face_normal(triangles, hits[ray_idx].id).dot(ray_dirs[ray_idx].cast<float>()) <= 0)
+                                    result[s_idx] -= decrease_step;
+                        continue;
+                    }
+
+                    //TODO improve logic for order based boolean operations - consider order of volumes
                     for (const auto &dir : precomputed_sample_directions) {
                         Vec3f final_ray_dir = (f.to_world(dir));
-                        if (!model_contains_negative_parts) {
-                            igl::Hit hitpoint;
-                            // FIXME: This AABBTTreeIndirect query will not compile for float ray origin and
-                            // direction.
-                            Vec3d final_ray_dir_d = final_ray_dir.cast<double>();
-                            Vec3d ray_origin_d = (center + normal * 0.01f).cast<double>(); // start above surface.
-                            bool hit = AABBTreeIndirect::intersect_ray_first_hit(triangles.vertices,
-                                    triangles.indices, raycasting_tree, ray_origin_d, final_ray_dir_d, hitpoint);
-                            if (hit && its_face_normal(triangles, hitpoint.id).dot(final_ray_dir) <= 0) {
-                                result[s_idx] -= decrease_step;
-                            }
-                        } else { //TODO improve logic for order based boolean operations - consider order of volumes
-                            bool casting_from_negative_volume = samples.triangle_indices[s_idx]
-                                    >= negative_volumes_start_index;
-
-                            Vec3d ray_origin_d = (center + normal * 0.01f).cast<double>(); // start above surface.
-                            if (casting_from_negative_volume) { // if casting from negative volume face, invert direction, change start pos
-                                final_ray_dir = -1.0 * final_ray_dir;
-                                ray_origin_d = (center - normal * 0.01f).cast<double>();
-                            }
-                            Vec3d final_ray_dir_d = final_ray_dir.cast<double>();
-                            bool some_hit = AABBTreeIndirect::intersect_ray_all_hits(triangles.vertices,
-                                    triangles.indices, raycasting_tree,
-                                    ray_origin_d, final_ray_dir_d, hits);
-                            if (some_hit) {
-                                int counter = 0;
-                                // NOTE: iterating in reverse, from the last hit for one simple reason: We know the state of the ray at that point;
-                                //  It cannot be inside model, and it cannot be inside negative volume
-                                for (int hit_index = int(hits.size()) - 1; hit_index >= 0; --hit_index) {
-                                    Vec3f face_normal = its_face_normal(triangles, hits[hit_index].id);
-                                    if (hits[hit_index].id >= int(negative_volumes_start_index)) { //negative volume hit
-                                        counter -= sgn(face_normal.dot(final_ray_dir)); // if volume face aligns with ray dir, we are leaving negative space
-                                        // which in reverse hit analysis means, that we are entering negative space :) and vice versa
-                                    } else {
-                                        counter += sgn(face_normal.dot(final_ray_dir));
-                                    }
-                                }
-                                if (counter == 0) {
-                                    result[s_idx] -= decrease_step;
+                        bool casting_from_negative_volume = samples.triangle_indices[s_idx]
+                                >= negative_volumes_start_index;
+
+                        Vec3d ray_origin_d = (center + normal * 0.01f).cast<double>(); // start above surface.
+                        if (casting_from_negative_volume) { // if casting from negative volume face, invert direction, change start pos
+                            final_ray_dir = -1.0 * final_ray_dir;
+                            ray_origin_d = (center - normal * 0.01f).cast<double>();
+                        }
+                        Vec3d final_ray_dir_d = final_ray_dir.cast<double>();
+                        bool some_hit = AABBTreeIndirect::intersect_ray_all_hits(triangles.vertices,
+                                triangles.indices, raycasting_tree,
+                                ray_origin_d, final_ray_dir_d, hits);
+                        if (some_hit) {
+                            int counter = 0;
+                            // NOTE: iterating in reverse, from the last hit for one simple reason: We know the state of the ray at that point;
+                            //  It cannot be inside model, and it cannot be inside negative volume
+                            for (int hit_index = int(hits.size()) - 1; hit_index >= 0; --hit_index) {
+                                Vec3f face_normal = its_face_normal(triangles, hits[hit_index].id);
+                                if (hits[hit_index].id >= int(negative_volumes_start_index)) { //negative volume hit
+                                    counter -= sgn(face_normal.dot(final_ray_dir)); // if volume face aligns with ray dir, we are leaving negative space
+                                    // which in reverse hit analysis means, that we are entering negative space :) and vice versa
+                                } else {
+                                    counter += sgn(face_normal.dot(final_ray_dir));
                                 }
                             }
+                            if (counter == 0) {
+                                result[s_idx] -= decrease_step;
+                            }
                         }
                     }
                 }
@@ -1003,7 +1008,7 @@ void pick_random_seam_point(const std::vector<SeamCandidate> &perimeter_points,
 // Store results in the SeamPlacer variables m_seam_per_object
 void SeamPlacer::gather_seam_candidates(const PrintObject *po, const SeamPlacerImpl::GlobalModelInfo &global_model_info) {
     using namespace SeamPlacerImpl;
-    PrintObjectSeamData &seam_data = m_seam_per_object.emplace(po, PrintObjectSeamData { }).first->second;
+    PrintObjectSeamData &seam_data = *m_seam_per_object.emplace(po, std::make_shared<PrintObjectSeamData>()).first->second;
     seam_data.layers.resize(po->layer_count());
 
     tbb::parallel_for(tbb::blocked_range<size_t>(0, po->layers().size()),
@@ -1033,7 +1038,7 @@ void SeamPlacer::calculate_candidates_visibility(const PrintObject *po,
         const SeamPlacerImpl::GlobalModelInfo &global_model_info) {
     using namespace SeamPlacerImpl;
 
-    std::vector<PrintObjectSeamData::LayerSeams> &layers = m_seam_per_object[po].layers;
+    std::vector<PrintObjectSeamData::LayerSeams> &layers = m_seam_per_object[po]->layers;
     tbb::parallel_for(tbb::blocked_range<size_t>(0, layers.size()),
             [&layers, &global_model_info](tbb::blocked_range<size_t> r) {
                 for (size_t layer_idx = r.begin(); layer_idx < r.end(); ++layer_idx) {
@@ -1049,7 +1054,7 @@ void SeamPlacer::calculate_overhangs_and_layer_embedding(const PrintObject *po)
     using namespace SeamPlacerImpl;
     using PerimeterDistancer = AABBTreeLines::LinesDistancer<Linef>;
 
-    std::vector<PrintObjectSeamData::LayerSeams> &layers = m_seam_per_object[po].layers;
+    std::vector<PrintObjectSeamData::LayerSeams> &layers = m_seam_per_object[po]->layers;
     tbb::parallel_for(tbb::blocked_range<size_t>(0, layers.size()),
             [po, &layers](tbb::blocked_range<size_t> r) {
                 std::unique_ptr<PerimeterDistancer> prev_layer_distancer;
@@ -1164,7 +1169,7 @@ std::optional<std::pair<size_t, size_t>> SeamPlacer::find_next_seam_in_layer(
 
 std::vector<std::pair<size_t, size_t>> SeamPlacer::find_seam_string(const PrintObject *po,
         std::pair<size_t, size_t> start_seam, const SeamPlacerImpl::SeamComparator &comparator) const {
-    const std::vector<PrintObjectSeamData::LayerSeams> &layers = m_seam_per_object.find(po)->second.layers;
+    const std::vector<PrintObjectSeamData::LayerSeams> &layers = m_seam_per_object.find(po)->second->layers;
     int layer_idx = start_seam.first;
 
     //initialize searching for seam string - cluster of nearby seams on previous and next layers
@@ -1244,7 +1249,7 @@ void SeamPlacer::align_seam_points(const PrintObject *po, const SeamPlacerImpl::
 #endif
 
     //gather vector of all seams on the print_object - pair of layer_index and seam__index within that layer
-    const std::vector<PrintObjectSeamData::LayerSeams> &layers = m_seam_per_object[po].layers;
+    const std::vector<PrintObjectSeamData::LayerSeams> &layers = m_seam_per_object[po]->layers;
     std::vector<std::pair<size_t, size_t>> seams;
     for (size_t layer_idx = 0; layer_idx < layers.size(); ++layer_idx) {
         const std::vector<SeamCandidate> &layer_perimeter_points = layers[layer_idx].points;
@@ -1265,12 +1270,12 @@ void SeamPlacer::align_seam_points(const PrintObject *po, const SeamPlacerImpl::
     );
 
     //align the seam points - start with the best, and check if they are aligned, if yes, skip, else start alignment
+    // The strings are discovered sequentially, as the discovery of each string depends on the perimeters finalized
+    // by the strings found before it. The curve fitting of the strings is independent and is done in parallel afterwards.
+    std::vector<std::vector<std::pair<size_t, size_t>>> seam_strings;
     // Keeping the vectors outside, so with a bit of luck they will not get reallocated after couple of for loop iterations.
     std::vector<std::pair<size_t, size_t>> seam_string;
     std::vector<std::pair<size_t, size_t>> alternative_seam_string;
-    std::vector<Vec2f> observations;
-    std::vector<float> observation_points;
-    std::vector<float> weights;
 
     int global_index = 0;
     while (global_index < int(seams.size())) {
@@ -1309,114 +1314,134 @@ void SeamPlacer::align_seam_points(const PrintObject *po, const SeamPlacerImpl::
             //repeat the alignment for the current seam, since it could be skipped due to alternative path being aligned.
             global_index--;
 
-            // gather all positions of seams and their weights
-            observations.resize(seam_string.size());
-            observation_points.resize(seam_string.size());
-            weights.resize(seam_string.size());
+            // Claim the perimeters of the string, the final seam positions are filled in by the curve fitting below.
+            for (const std::pair<size_t, size_t> &pair : seam_string) {
+                Perimeter &perimeter = layers[pair.first].points[pair.second].perimeter;
+                perimeter.seam_index = pair.second;
+                perimeter.finalized = true;
+            }
+            seam_strings.emplace_back(std::move(seam_string));
+        }
+    }
 
-            auto angle_3d = [](const Vec3f& a, const Vec3f& b){
-                return std::abs(acosf(a.normalized().dot(b.normalized())));
-            };
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, seam_strings.size()),
+            [&layers, &comparator, &seam_strings](tbb::blocked_range<size_t> r) {
+                std::vector<Vec2f> observations;
+                std::vector<float> observation_points;
+                std::vector<float> weights;
+                for (size_t string_idx = r.begin(); string_idx < r.end(); ++string_idx) {
+                    const std::vector<std::pair<size_t, size_t>> &seam_string = seam_strings[string_idx];
+
+                    // gather all positions of seams and their weights
+                    observations.resize(seam_string.size());
+                    observation_points.resize(seam_string.size());
+                    weights.resize(seam_string.size());
+
+                    auto angle_3d = [](const Vec3f& a, const Vec3f& b){
+                        return std::abs(acosf(a.normalized().dot(b.normalized())));
+                    };
 
-            auto angle_weight = [](float angle){
-                return 1.0f / (0.1f + compute_angle_penalty(angle));
-            };
+                    auto angle_weight = [](float angle){
+                        return 1.0f / (0.1f + compute_angle_penalty(angle));
+                    };
 
-            //gather points positions and weights
-            float total_length = 0.0f;
-            Vec3f last_point_pos = layers[seam_string[0].first].points[seam_string[0].second].position;
-            for (size_t index = 0; index < seam_string.size(); ++index) {
-                const SeamCandidate &current = layers[seam_string[index].first].points[seam_string[index].second];
-                float layer_angle = 0.0f;
-                if (index > 0 && index < seam_string.size() - 1) {
-                    layer_angle = angle_3d(
-                                    current.position
-                                            - layers[seam_string[index - 1].first].points[seam_string[index - 1].second].position,
-                                    layers[seam_string[index + 1].first].points[seam_string[index + 1].second].position
-                                            - current.position
-                                            );
-                }
-                observations[index] = current.position.head<2>();
-                observation_points[index] = current.position.z();
-                weights[index] = angle_weight(current.local_ccw_angle);
-                float curling_influence = layer_angle > 2.0 * std::abs(current.local_ccw_angle) ? -0.8f : 1.0f;
-                if (current.type == EnforcedBlockedSeamPoint::Enforced) {
-                    curling_influence = 1.0f;
-                    weights[index] += 3.0f;
-                }
-                total_length += curling_influence * (last_point_pos - current.position).norm();
-                last_point_pos = current.position;
-            }
+                    //gather points positions and weights
+                    float total_length = 0.0f;
+                    Vec3f last_point_pos = layers[seam_string[0].first].points[seam_string[0].second].position;
+                    for (size_t index = 0; index < seam_string.size(); ++index) {
+                        const SeamCandidate &current = layers[seam_string[index].first].points[seam_string[index].second];
+                        float layer_angle = 0.0f;
+                        if (index > 0 && index < seam_string.size() - 1) {
+                            layer_angle = angle_3d(
+                                            current.position
+                                                    - layers[seam_string[index - 1].first].points[seam_string[index - 1].second].position,
+                                            layers[seam_string[index + 1].first].points[seam_string[index + 1].second].position
+                                                    - current.position
+                                                    );
+                        }
+                        observations[index] = current.position.head<2>();
+                        observation_points[index] = current.position.z();
+                        weights[index] = angle_weight(current.local_ccw_angle);
+                        float curling_influence = layer_angle > 2.0 * std::abs(current.local_ccw_angle) ? -0.8f : 1.0f;
+                        if (current.type == EnforcedBlockedSeamPoint::Enforced) {
+                            curling_influence = 1.0f;
+                            weights[index] += 3.0f;
+                        }
+                        total_length += curling_influence * (last_point_pos - current.position).norm();
+                        last_point_pos = current.position;
+                    }
 
-            if (comparator.setup == spRear) {
-                total_length *= 0.3f;
-            }
+                    if (comparator.setup == spRear) {
+                        total_length *= 0.3f;
+                    }
 
-            // Curve Fitting
-            size_t number_of_segments = std::max(size_t(1),
-                    size_t(std::max(0.0f,total_length) / SeamPlacer::seam_align_mm_per_segment));
-            auto curve = Geometry::fit_cubic_bspline(observations, observation_points, weights, number_of_segments);
-
-            // Do alignment - compute fitted point for each point in the string from its Z coord, and store the position into
-            // Perimeter structure of the point; also set flag aligned to true
-            for (size_t index = 0; index < seam_string.size(); ++index) {
-                const auto &pair = seam_string[index];
-                float t = std::min(1.0f, std::pow(std::abs(layers[pair.first].points[pair.second].local_ccw_angle)
-                        / SeamPlacer::sharp_angle_snapping_threshold, 3.0f));
-                if (layers[pair.first].points[pair.second].type == EnforcedBlockedSeamPoint::Enforced){
-                    t = std::max(0.4f, t);
-                }
+                    // Curve Fitting
+                    size_t number_of_segments = std::max(size_t(1),
+                            size_t(std::max(0.0f,total_length) / SeamPlacer::seam_align_mm_per_segment));
+                    auto curve = Geometry::fit_cubic_bspline(observations, observation_points, weights, number_of_segments);
+
+                    // Do alignment - compute fitted point for each point in the string from its Z coord, and store the position into
+                    // Perimeter structure of the point
+                    for (size_t index = 0; index < seam_string.size(); ++index) {
+                        const auto &pair = seam_string[index];
+                        float t = std::min(1.0f, std::pow(std::abs(layers[pair.first].points[pair.second].local_ccw_angle)
+                                / SeamPlacer::sharp_angle_snapping_threshold, 3.0f));
+                        if (layers[pair.first].points[pair.second].type == EnforcedBlockedSeamPoint::Enforced){
+                            t = std::max(0.4f, t);
+                        }
 
-                Vec3f current_pos = layers[pair.first].points[pair.second].position;
-                Vec2f fitted_pos = curve.get_fitted_value(current_pos.z());
+                        Vec3f current_pos = layers[pair.first].points[pair.second].position;
+                        Vec2f fitted_pos = curve.get_fitted_value(current_pos.z());
 
-                //interpolate between current and fitted position, prefer current pos for large weights.
-                Vec3f final_position = t * current_pos + (1.0f - t) * to_3d(fitted_pos, current_pos.z());
+                        //interpolate between current and fitted position, prefer current pos for large weights.
+                        Vec3f final_position = t * current_pos + (1.0f - t) * to_3d(fitted_pos, current_pos.z());
 
-                Perimeter &perimeter = layers[pair.first].points[pair.second].perimeter;
-                perimeter.seam_index = pair.second;
-                perimeter.final_seam_position = final_position;
-                perimeter.finalized = true;
-            }
+                        layers[pair.first].points[pair.second].perimeter.final_seam_position = final_position;
+                    }
+                }
+            });
 
 #ifdef DEBUG_FILES
-            auto randf = []() {
-                return float(rand()) / float(RAND_MAX);
-            };
-            Vec3f color { randf(), randf(), randf() };
-            for (size_t i = 0; i < seam_string.size(); ++i) {
-                auto orig_seam = layers[seam_string[i].first].points[seam_string[i].second];
-                fprintf(clusters, "v %f %f %f %f %f %f \n", orig_seam.position[0],
-                        orig_seam.position[1],
-                        orig_seam.position[2], color[0], color[1],
-                        color[2]);
-            }
+    auto randf = []() {
+        return float(rand()) / float(RAND_MAX);
+    };
+    for (const std::vector<std::pair<size_t, size_t>> &seam_string : seam_strings) {
+        Vec3f color { randf(), randf(), randf() };
+        for (size_t i = 0; i < seam_string.size(); ++i) {
+            auto orig_seam = layers[seam_string[i].first].points[seam_string[i].second];
+            fprintf(clusters, "v %f %f %f %f %f %f \n", orig_seam.position[0],
+                    orig_seam.position[1],
+                    orig_seam.position[2], color[0], color[1],
+                    color[2]);
+        }
 
-            color = Vec3f { randf(), randf(), randf() };
-            for (size_t i = 0; i < seam_string.size(); ++i) {
-                const Perimeter &perimeter = layers[seam_string[i].first].points[seam_string[i].second].perimeter;
-                fprintf(aligns, "v %f %f %f %f %f %f \n", perimeter.final_seam_position[0],
-                        perimeter.final_seam_position[1],
-                        perimeter.final_seam_position[2], color[0], color[1],
-                        color[2]);
-            }
-#endif
+        color = Vec3f { randf(), randf(), randf() };
+        for (size_t i = 0; i < seam_string.size(); ++i) {
+            const Perimeter &perimeter = layers[seam_string[i].first].points[seam_string[i].second].perimeter;
+            fprintf(aligns, "v %f %f %f %f %f %f \n", perimeter.final_seam_position[0],
+                    perimeter.final_seam_position[1],
+                    perimeter.final_seam_position[2], color[0], color[1],
+                    color[2]);
         }
     }
 
-#ifdef DEBUG_FILES
     fclose(clusters);
     fclose(aligns);
 #endif
 
 }
 
-void SeamPlacer::init(const Print &print, std::function<void(void)> throw_if_canceled_func) {
+void SeamPlacer::init(Print &print, std::function<void(void)> throw_if_canceled_func) {
     using namespace SeamPlacerImpl;
     m_seam_per_object.clear();
 
-    for (const PrintObject *po : print.objects()) {
+    for (PrintObject *po : print.objects_mutable()) {
         throw_if_canceled_func();
+        if (std::shared_ptr<PrintObjectSeamData> seam_data = po->seam_data(); seam_data) {
+            // Neither the perimeters nor the seam settings changed since the last G-code export.
+            m_seam_per_object.emplace(po, std::move(seam_data));
+            continue;
+        }
         SeamPosition configured_seam_preference = po->config().seam_position.value;
         SeamComparator comparator { configured_seam_preference };
 
@@ -1453,7 +1478,7 @@ void SeamPlacer::init(const Print &print, std::function<void(void)> throw_if_can
             BOOST_LOG_TRIVIAL(debug)
             << "SeamPlacer: pick_seam_point : start";
             //pick seam point
-            std::vector<PrintObjectSeamData::LayerSeams> &layers = m_seam_per_object[po].layers;
+            std::vector<PrintObjectSeamData::LayerSeams> &layers = m_seam_per_object[po]->layers;
             tbb::parallel_for(tbb::blocked_range<size_t>(0, layers.size()),
                     [&layers, configured_seam_preference, comparator](tbb::blocked_range<size_t> r) {
                         for (size_t layer_idx = r.begin(); layer_idx < r.end(); ++layer_idx) {
@@ -1479,8 +1504,10 @@ void SeamPlacer::init(const Print &print, std::function<void(void)> throw_if_can
         }
 
 #ifdef DEBUG_FILES
-        debug_export_points(m_seam_per_object[po].layers, po->bounding_box(), comparator);
+        debug_export_points(m_seam_per_object[po]->layers, po->bounding_box(), comparator);
 #endif
+        // Keep the seams for the next G-code export, for example after editing just the custom G-codes.
+        po->set_seam_data(m_seam_per_object[po]);
     }
 }
 
@@ -1506,7 +1533,7 @@ void SeamPlacer::place_seam(const Layer *layer, ExtrusionLoop &loop, bool extern
     };
 
     const PrintObjectSeamData::LayerSeams &layer_perimeters =
-            m_seam_per_object.find(layer->object())->second.layers[layer_index];
+            m_seam_per_object.find(layer->object())->second->layers[layer_index];
 
     // Find the closest perimeter in the SeamPlacer to this loop.
     // Repeat search until two consecutive points of the loop are found, that result in the same closest_perimeter
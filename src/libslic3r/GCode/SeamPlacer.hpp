@@ -137,9 +137,10 @@ public:
     static constexpr size_t seam_align_mm_per_segment = 4.0f;
 
     //The following data structures hold all perimeter points for all PrintObject.
-    std::unordered_map<const PrintObject*, PrintObjectSeamData> m_seam_per_object;
+    // The data are shared with PrintObject::seam_data(), which keeps them for the next G-code export.
+    std::unordered_map<const PrintObject*, std::shared_ptr<PrintObjectSeamData>> m_seam_per_object;
 
-    void init(const Print &print, std::function<void(void)> throw_if_canceled_func);
+    void init(Print &print, std::function<void(void)> throw_if_canceled_func);
 
     void place_seam(const Layer *layer, ExtrusionLoop &loop, bool external_first, const Point &last_pos) const;
 
@@ -1,10 +1,55 @@
 #include "SpiralVase.hpp"
 #include "GCode.hpp"
-#include <sstream>
+#include "../GCodeWriter.hpp"
 
 namespace Slic3r {
 
-std::string SpiralVase::process_layer(const std::string &gcode)
+static void append_axis(std::string &gcode, const char axis, const float value, const size_t digits)
+{
+    GCodeFormatter formatter;
+    formatter.emit_axis(axis, value, digits);
+    // Drop the end of line terminating the formatted string.
+    std::string_view axis_value = formatter.string_view();
+    gcode.append(axis_value.data(), axis_value.size() - 1);
+}
+
+// Append raw G1 line to gcode with its Z value replaced by z or with Z inserted after the command if the line does not contain it,
+// optionally with its extrusion value replaced by e. Terminate the line.
+static void append_g1_with_z(std::string &gcode, const std::string_view raw, const float z, const char extrusion_axis, const float *e)
+{
+    auto is_whitespace = [](const char c) { return c == ' ' || c == '\t'; };
+    auto skip_whitespaces = [&raw, &is_whitespace](size_t i) { for (; i < raw.size() && is_whitespace(raw[i]); ++ i) ; return i; };
+    auto skip_word = [&raw, &is_whitespace](size_t i) { for (; i < raw.size() && ! is_whitespace(raw[i]) && raw[i] != ';'; ++ i) ; return i; };
+
+    size_t i = skip_word(skip_whitespaces(0));
+    gcode.append(raw.data(), i);
+    bool has_z = false;
+    for (size_t j = i; ! has_z && j < raw.size() && raw[j] != ';'; ++ j)
+        has_z = raw[j] == 'Z' && is_whitespace(raw[j - 1]);
+    if (! has_z)
+        append_axis(gcode, 'Z', z, GCodeFormatter::XYZF_EXPORT_DIGITS);
+    while (i < raw.size()) {
+        size_t word_begin = skip_whitespaces(i);
+        if (word_begin == raw.size() || raw[word_begin] == ';') {
+            // Keep the comment including the white spaces preceding it.
+            gcode.append(raw.data() + i, raw.size() - i);
+            break;
+        }
+        size_t word_end = skip_word(word_begin);
+        if (raw[word_begin] == 'Z')
+            append_axis(gcode, 'Z', z, GCodeFormatter::XYZF_EXPORT_DIGITS);
+        else if (e != nullptr && raw[word_begin] == extrusion_axis)
+            append_axis(gcode, extrusion_axis, *e, GCodeFormatter::E_EXPORT_DIGITS);
+        else {
+            gcode += ' ';
+            gcode.append(raw.data() + word_begin, word_end - word_begin);
+        }
+        i = word_end;
+    }
+    gcode += '\n';
+}
+
+std::string SpiralVase::process_layer(std::string &&gcode)
 {
     /*  This post-processor relies on several assumptions:
         - all layers are processed through it, including those that are not supposed
@@ -18,23 +63,29 @@ std::string SpiralVase::process_layer(const std::string &gcode)
     // in order to update positions.
     if (! m_enabled) {
         m_reader.parse_buffer(gcode);
-        return gcode;
+        return std::move(gcode);
     }
     
-    // Get total XY length for this layer by summing all extrusion moves.
+    // Parse the layer just once: get total XY length for this layer by summing all extrusion moves
+    // and remember the lines to be modified, so that the G-code does not need to be parsed again
+    // when the new Z values are known.
     float total_layer_length = 0;
     float layer_height = 0;
     float z = 0.f;
-    
+
+    m_lines.clear();
     {
-        //FIXME Performance warning: This copies the GCodeConfig of the reader.
-        GCodeReader r = m_reader;  // clone
-        bool set_z = false;
-        r.parse_buffer(gcode, [&total_layer_length, &layer_height, &z, &set_z]
+        bool  set_z = false;
+        float len   = 0.f;
+        auto  callback = [this, &total_layer_length, &layer_height, &z, &set_z, &len]
             (GCodeReader &reader, const GCodeReader::GCodeLine &line) {
+            Line &l = m_lines.back();
+            l.size = line.raw().size();
             if (line.cmd_is("G1")) {
-                if (line.extruding(reader)) {
-                    total_layer_length += line.dist_XY(reader);
+                bool extruding = line.extruding(reader);
+                float dist_XY = line.dist_XY(reader);
+                if (extruding) {
+                    total_layer_length += dist_XY;
                 } else if (line.has(Z)) {
                     layer_height += line.dist_Z(reader);
                     if (!set_z) {
@@ -42,54 +93,69 @@ std::string SpiralVase::process_layer(const std::string &gcode)
                         set_z = true;
                     }
                 }
+                if (line.has_z()) {
+                    l.type = Line::Type::ZMove;
+                } else if (dist_XY > 0) {
+                    // horizontal move
+                    if (extruding) {
+                        len  += dist_XY;
+                        l.type = Line::Type::Extrusion;
+                        l.len  = len;
+                        l.has_e = line.has(E);
+                        l.e    = line.value(E);
+                    } else
+                        l.type = Line::Type::Travel;
+                }
             }
-        });
+        };
+        const char *begin = gcode.c_str();
+        const char *end   = begin + gcode.size();
+        GCodeReader::GCodeLine gline;
+        for (const char *ptr = begin; *ptr != 0;) {
+            m_lines.push_back({ size_t(ptr - begin) });
+            gline.reset();
+            ptr = m_reader.parse_line(ptr, end, gline, callback);
+        }
     }
     
-    // Remove layer height from initial Z.
+    // Remove layer height from initial Z.
     z -= layer_height;
     
     std::string new_gcode;
+    new_gcode.reserve(gcode.size() + gcode.size() / 4);
     //FIXME Tapering of the transition layer only works reliably with relative extruder distances.
     // For absolute extruder distances it will be switched off.
     // Tapering the absolute extruder distances requires to process every extrusion value after the first transition
     // layer.
     bool  transition = m_transition_layer && m_config.use_relative_e_distances.value;
     float layer_height_factor = layer_height / total_layer_length;
-    float len = 0.f;
-    m_reader.parse_buffer(gcode, [&new_gcode, &z, total_layer_length, layer_height_factor, transition, &len]
-        (GCodeReader &reader, GCodeReader::GCodeLine line) {
-        if (line.cmd_is("G1")) {
-            if (line.has_z()) {
-                // If this is the initial Z move of the layer, replace it with a
-                // (redundant) move to the last Z of previous layer.
-                line.set(reader, Z, z);
-                new_gcode += line.raw() + '\n';
-                return;
-            } else {
-                float dist_XY = line.dist_XY(reader);
-                if (dist_XY > 0) {
-                    // horizontal move
-                    if (line.extruding(reader)) {
-                        len += dist_XY;
-                        line.set(reader, Z, z + len * layer_height_factor);
-                        if (transition && line.has(E))
-                            // Transition layer, modulate the amount of extrusion from zero to the final value.
-                            line.set(reader, E, line.value(E) * len / total_layer_length);
-                        new_gcode += line.raw() + '\n';
-                    }
-                    return;
-                
-                    /*  Skip travel moves: the move to first perimeter point will
-                        cause a visible seam when loops are not aligned in XY; by skipping
-                        it we blend the first loop move in the XY plane (although the smoothness
-                        of such blend depend on how long the first segment is; maybe we should
-                        enforce some minimum length?).  */
-                }
-            }
+    for (const Line &l : m_lines) {
+        const std::string_view raw(gcode.data() + l.begin, l.size);
+        switch (l.type) {
+        case Line::Type::ZMove:
+            // If this is the initial Z move of the layer, replace it with a
+            // (redundant) move to the last Z of previous layer.
+            append_g1_with_z(new_gcode, raw, z, m_reader.extrusion_axis(), nullptr);
+            break;
+        case Line::Type::Extrusion:
+        {
+            // Transition layer, modulate the amount of extrusion from zero to the final value.
+            float e = l.e * l.len / total_layer_length;
+            append_g1_with_z(new_gcode, raw, z + l.len * layer_height_factor, m_reader.extrusion_axis(), transition && l.has_e ? &e : nullptr);
+            break;
         }
-        new_gcode += line.raw() + '\n';
-    });
+        case Line::Type::Travel:
+            /*  Skip travel moves: the move to first perimeter point will
+                cause a visible seam when loops are not aligned in XY; by skipping
+                it we blend the first loop move in the XY plane (although the smoothness
+                of such blend depend on how long the first segment is; maybe we should
+                enforce some minimum length?).  */
+            break;
+        default:
+            new_gcode += raw;
+            new_gcode += '\n';
+        }
+    }
     
     return new_gcode;
 }
@@ -19,12 +19,36 @@ public:
     	m_enabled 		   = en;
     }
 
-    std::string process_layer(const std::string &gcode);
+    // Returns the input G-code without copying it if the vase mode is not enabled for this layer.
+    std::string process_layer(std::string &&gcode);
+    std::string process_layer(const std::string &gcode) { return this->process_layer(std::string(gcode)); }
     
 private:
     const PrintConfig  &m_config;
     GCodeReader 		m_reader;
 
+    // Lines of the layer being processed, reused between layers to spare allocations.
+    struct Line {
+        // Span of the raw line in the layer G-code, without the end of line.
+        size_t      begin;
+        size_t      size  { 0 };
+        enum class Type : unsigned char {
+            Other,
+            // G1 with Z, the move to the next layer.
+            ZMove,
+            // Horizontal extrusion.
+            Extrusion,
+            // Horizontal travel, to be dropped.
+            Travel,
+        };
+        Type        type  { Type::Other };
+        bool        has_e { false };
+        // Extruded length of the layer up to the end of this extrusion.
+        float       len   { 0.f };
+        float       e     { 0.f };
+    };
+    std::vector<Line>   m_lines;
+
     bool 				m_enabled = false;
     // First spiral vase layer. Layer height has to be ramped up from zero to the target layer height.
     bool 				m_transition_layer = false;
@@ -1,5 +1,6 @@
 #include "Thumbnails.hpp"
 #include "../miniz_extension.hpp"
+#include "../PNGReadWrite.hpp"
 
 #include <qoi/qoi.h>
 #include <jpeglib.h>
@@ -11,7 +12,7 @@ using namespace std::literals;
 
 struct CompressedPNG : CompressedImageBuffer 
 {
-    ~CompressedPNG() override { if (data) mz_free(data); }
+    std::vector<uint8_t> buffer;
     std::string_view tag() const override { return "thumbnail"sv; }
 };
 
@@ -27,10 +28,14 @@ struct CompressedQOI : CompressedImageBuffer
     std::string_view tag() const override { return "thumbnail_QOI"sv; }
 };
 
-std::unique_ptr<CompressedImageBuffer> compress_thumbnail_png(const ThumbnailData &data)
+std::unique_ptr<CompressedImageBuffer> compress_thumbnail_png(const ThumbnailData &data, png::EncodeMode mode)
 {
     auto out = std::make_unique<CompressedPNG>();
-    out->data = tdefl_write_image_to_png_file_in_memory_ex((const void*)data.pixels.data(), data.width, data.height, 4, &out->size, MZ_DEFAULT_LEVEL, 1);
+    out->buffer = png::encode_png(data.pixels.data(), data.width, data.height, 4, mode, true);
+    if (! out->buffer.empty()) {
+        out->data = out->buffer.data();
+        out->size = out->buffer.size();
+    }
     return out;
 }
 
@@ -103,12 +108,12 @@ std::unique_ptr<CompressedImageBuffer> compress_thumbnail_qoi(const ThumbnailDat
     return out;
 }
 
-std::unique_ptr<CompressedImageBuffer> compress_thumbnail(const ThumbnailData &data, GCodeThumbnailsFormat format)
+std::unique_ptr<CompressedImageBuffer> compress_thumbnail(const ThumbnailData &data, GCodeThumbnailsFormat format, png::EncodeMode png_mode)
 {
     switch (format) {
         case GCodeThumbnailsFormat::PNG:
         default:
-            return compress_thumbnail_png(data);
+            return compress_thumbnail_png(data, png_mode);
         case GCodeThumbnailsFormat::JPG:
             return compress_thumbnail_jpg(data);
         case GCodeThumbnailsFormat::QOI:
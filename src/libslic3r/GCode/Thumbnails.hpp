@@ -4,6 +4,7 @@
 #include "../Point.hpp"
 #include "../PrintConfig.hpp"
 #include "ThumbnailData.hpp"
+#include "../PNGReadWrite.hpp"
 
 #include <vector>
 #include <memory>
@@ -11,6 +12,9 @@
 
 #include <boost/beast/core/detail/base64.hpp>
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
 namespace Slic3r::GCodeThumbnails {
 
 struct CompressedImageBuffer
@@ -21,7 +25,9 @@ struct CompressedImageBuffer
     virtual std::string_view tag() const = 0;
 };
 
-std::unique_ptr<CompressedImageBuffer> compress_thumbnail(const ThumbnailData &data, GCodeThumbnailsFormat format);
+// png_mode selects the png encoder, see png::EncodeMode.
+std::unique_ptr<CompressedImageBuffer> compress_thumbnail(const ThumbnailData &data, GCodeThumbnailsFormat format,
+                                                          png::EncodeMode png_mode = png::EncodeMode::Default);
 
 template<typename WriteToOutput, typename ThrowIfCanceledCallback>
 inline void export_thumbnails_to_file(ThumbnailsGeneratorCallback &thumbnail_cb, const std::vector<Vec2d> &sizes, GCodeThumbnailsFormat format, WriteToOutput output, ThrowIfCanceledCallback throw_if_canceled)
@@ -30,9 +36,16 @@ inline void export_thumbnails_to_file(ThumbnailsGeneratorCallback &thumbnail_cb,
     if (thumbnail_cb != nullptr) {
         static constexpr const size_t max_row_length = 78;
         ThumbnailsList thumbnails = thumbnail_cb(ThumbnailsParams{ sizes, true, true, true, true });
-        for (const ThumbnailData& data : thumbnails)
-            if (data.is_valid()) {
-                auto compressed = compress_thumbnail(data, format);
+        // Compress the thumbnails of all the requested sizes in parallel, then write them in their original order.
+        std::vector<std::unique_ptr<CompressedImageBuffer>> compressed_thumbnails(thumbnails.size());
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, thumbnails.size(), 1), [&thumbnails, &compressed_thumbnails, format](const tbb::blocked_range<size_t> &range) {
+            for (size_t i = range.begin(); i < range.end(); ++ i)
+                if (thumbnails[i].is_valid())
+                    compressed_thumbnails[i] = compress_thumbnail(thumbnails[i], format);
+        });
+        for (size_t i = 0; i < thumbnails.size(); ++ i)
+            if (const ThumbnailData &data = thumbnails[i]; data.is_valid()) {
+                const std::unique_ptr<CompressedImageBuffer> &compressed = compressed_thumbnails[i];
                 if (compressed->data && compressed->size) {
                     std::string encoded;
                     encoded.resize(boost::beast::detail::base64::encoded_size(compressed->size));
@@ -40,14 +53,14 @@ inline void export_thumbnails_to_file(ThumbnailsGeneratorCallback &thumbnail_cb,
 
                     output((boost::format("\n;\n; %s begin %dx%d %d\n") % compressed->tag() % data.width % data.height % encoded.size()).str().c_str());
 
-                    while (encoded.size() > max_row_length) {
-                        output((boost::format("; %s\n") % encoded.substr(0, max_row_length)).str().c_str());
-                        encoded = encoded.substr(max_row_length);
+                    std::string row;
+                    for (size_t row_start = 0; row_start < encoded.size(); row_start += max_row_length) {
+                        row.assign("; ");
+                        row.append(encoded, row_start, max_row_length);
+                        row += '\n';
+                        output(row.c_str());
                     }
 
-                    if (encoded.size() > 0)
-                        output((boost::format("; %s\n") % encoded).str().c_str());
-
                     output((boost::format("; %s end\n;\n") % compressed->tag()).str().c_str());
                 }
                 throw_if_canceled();
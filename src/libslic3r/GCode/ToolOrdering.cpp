@@ -14,6 +14,9 @@
 #include <cassert>
 #include <limits>
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
 #include <boost/log/trivial.hpp>
 
 #include <libslic3r.h>
@@ -223,76 +226,87 @@ void ToolOrdering::collect_extruders(const PrintObject &object, const std::vecto
     }
 
     // Extruder overrides are ordered by print_z.
-    std::vector<std::pair<double, unsigned int>>::const_iterator it_per_layer_extruder_override;
-	it_per_layer_extruder_override = per_layer_extruder_switches.begin();
-    unsigned int extruder_override = 0;
+    // Resolve the LayerTools and the extruder override of each object layer first, so that the object layers
+    // may be processed in parallel below. Layers of a single object map to distinct LayerTools.
+    std::vector<std::pair<LayerTools*, unsigned int>> layer_tools_and_overrides;
+    layer_tools_and_overrides.reserve(object.layers().size());
+    {
+        auto         it_per_layer_extruder_override = per_layer_extruder_switches.begin();
+        unsigned int extruder_override = 0;
+        for (const Layer *layer : object.layers()) {
+            // Override extruder with the next 
+            for (; it_per_layer_extruder_override != per_layer_extruder_switches.end() && it_per_layer_extruder_override->first < layer->print_z + EPSILON; ++ it_per_layer_extruder_override)
+                extruder_override = (int)it_per_layer_extruder_override->second;
+            layer_tools_and_overrides.emplace_back(&this->tools_for_layer(layer->print_z), extruder_override);
+        }
+    }
 
     // Collect the object extruders.
-    for (auto layer : object.layers()) {
-        LayerTools &layer_tools = this->tools_for_layer(layer->print_z);
-
-        // Override extruder with the next 
-    	for (; it_per_layer_extruder_override != per_layer_extruder_switches.end() && it_per_layer_extruder_override->first < layer->print_z + EPSILON; ++ it_per_layer_extruder_override)
-    		extruder_override = (int)it_per_layer_extruder_override->second;
-
-        // Store the current extruder override (set to zero if no overriden), so that layer_tools.wiping_extrusions().is_overridable_and_mark() will use it.
-        layer_tools.extruder_override = extruder_override;
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, object.layers().size()), [this, &object, &layer_tools_and_overrides](const tbb::blocked_range<size_t> &range) {
+        for (size_t layer_idx = range.begin(); layer_idx < range.end(); ++ layer_idx) {
+            const Layer  *layer             = object.layers()[layer_idx];
+            LayerTools   &layer_tools       = *layer_tools_and_overrides[layer_idx].first;
+            unsigned int  extruder_override = layer_tools_and_overrides[layer_idx].second;
+
+            // Store the current extruder override (set to zero if no overriden), so that layer_tools.wiping_extrusions().is_overridable_and_mark() will use it.
+            layer_tools.extruder_override = extruder_override;
+
+            // What extruders are required to print this object layer?
+            for (const LayerRegion *layerm : layer->regions()) {
+                const PrintRegion &region = layerm->region();
+
+                if (! layerm->perimeters().empty()) {
+                    bool something_nonoverriddable = true;
+
+                    if (m_print_config_ptr) { // in this case complete_objects is false (see ToolOrdering constructors)
+                        something_nonoverriddable = false;
+                        for (const ExtrusionEntity *eec : layerm->perimeters()) // let's check if there are nonoverriddable entities
+                            if (is_overriddable(dynamic_cast<const ExtrusionEntityCollection&>(*eec), layer_tools, *m_print_config_ptr, object, region))
+                                layer_tools.wiping_extrusions_nonconst().set_something_overridable();
+                            else
+                                something_nonoverriddable = true;
+                    }
 
-        // What extruders are required to print this object layer?
-        for (const LayerRegion *layerm : layer->regions()) {
-            const PrintRegion &region = layerm->region();
+                    if (something_nonoverriddable)
+                   		layer_tools.extruders.emplace_back(extruder_override == 0 ? region.config().perimeter_extruder.value : extruder_override);
 
-            if (! layerm->perimeters().empty()) {
-                bool something_nonoverriddable = true;
+                    layer_tools.has_object = true;
+                }
 
-                if (m_print_config_ptr) { // in this case complete_objects is false (see ToolOrdering constructors)
-                    something_nonoverriddable = false;
-                    for (const ExtrusionEntity *eec : layerm->perimeters()) // let's check if there are nonoverriddable entities
-                        if (is_overriddable(dynamic_cast<const ExtrusionEntityCollection&>(*eec), layer_tools, *m_print_config_ptr, object, region))
+                bool has_infill       = false;
+                bool has_solid_infill = false;
+                bool something_nonoverriddable = false;
+                for (const ExtrusionEntity *ee : layerm->fills()) {
+                    // fill represents infill extrusions of a single island.
+                    const auto *fill = dynamic_cast<const ExtrusionEntityCollection*>(ee);
+                    ExtrusionRole role = fill->entities.empty() ? ExtrusionRole::None : fill->entities.front()->role();
+                    if (role.is_solid_infill())
+                        has_solid_infill = true;
+                    else if (role != ExtrusionRole::None)
+                        has_infill = true;
+
+                    if (m_print_config_ptr) {
+                        if (is_overriddable(*fill, layer_tools, *m_print_config_ptr, object, region))
                             layer_tools.wiping_extrusions_nonconst().set_something_overridable();
                         else
                             something_nonoverriddable = true;
+                    }
                 }
 
-                if (something_nonoverriddable)
-               		layer_tools.extruders.emplace_back(extruder_override == 0 ? region.config().perimeter_extruder.value : extruder_override);
-
-                layer_tools.has_object = true;
-            }
-
-            bool has_infill       = false;
-            bool has_solid_infill = false;
-            bool something_nonoverriddable = false;
-            for (const ExtrusionEntity *ee : layerm->fills()) {
-                // fill represents infill extrusions of a single island.
-                const auto *fill = dynamic_cast<const ExtrusionEntityCollection*>(ee);
-                ExtrusionRole role = fill->entities.empty() ? ExtrusionRole::None : fill->entities.front()->role();
-                if (role.is_solid_infill())
-                    has_solid_infill = true;
-                else if (role != ExtrusionRole::None)
-                    has_infill = true;
-
-                if (m_print_config_ptr) {
-                    if (is_overriddable(*fill, layer_tools, *m_print_config_ptr, object, region))
-                        layer_tools.wiping_extrusions_nonconst().set_something_overridable();
-                    else
-                        something_nonoverriddable = true;
+                if (something_nonoverriddable || !m_print_config_ptr) {
+                	if (extruder_override == 0) {
+    	                if (has_solid_infill)
+    	                    layer_tools.extruders.emplace_back(region.config().solid_infill_extruder);
+    	                if (has_infill)
+    	                    layer_tools.extruders.emplace_back(region.config().infill_extruder);
+                	} else if (has_solid_infill || has_infill)
+                		layer_tools.extruders.emplace_back(extruder_override);
                 }
+                if (has_solid_infill || has_infill)
+                    layer_tools.has_object = true;
             }
-
-            if (something_nonoverriddable || !m_print_config_ptr) {
-            	if (extruder_override == 0) {
-	                if (has_solid_infill)
-	                    layer_tools.extruders.emplace_back(region.config().solid_infill_extruder);
-	                if (has_infill)
-	                    layer_tools.extruders.emplace_back(region.config().infill_extruder);
-            	} else if (has_solid_infill || has_infill)
-            		layer_tools.extruders.emplace_back(extruder_override);
-            }
-            if (has_solid_infill || has_infill)
-                layer_tools.has_object = true;
         }
-    }
+    });
 
     for (auto& layer : m_layer_tools) {
         // Sort and remove duplicates
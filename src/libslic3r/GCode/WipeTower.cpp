@@ -1308,12 +1308,14 @@ int WipeTower::first_toolchange_to_nonsoluble(
     return -1;
 }
 
-static WipeTower::ToolChangeResult merge_tcr(WipeTower::ToolChangeResult& first,
-                                             WipeTower::ToolChangeResult& second)
+// The first ToolChangeResult is taken by value, so that the callers may move the (possibly long)
+// G-code and extrusions in instead of copying them.
+static WipeTower::ToolChangeResult merge_tcr(WipeTower::ToolChangeResult first,
+                                             const WipeTower::ToolChangeResult& second)
 {
     assert(first.new_tool == second.initial_tool);
-    WipeTower::ToolChangeResult out = first;
-    if (first.end_pos != second.start_pos)
+    WipeTower::ToolChangeResult out = std::move(first);
+    if (out.end_pos != second.start_pos)
         out.gcode += "G1 X" + Slic3r::float_to_string_decimal_point(second.start_pos.x(), 3)
                      + " Y" + Slic3r::float_to_string_decimal_point(second.start_pos.y(), 3)
                      + " F7200\n";
@@ -1321,7 +1323,6 @@ static WipeTower::ToolChangeResult merge_tcr(WipeTower::ToolChangeResult& first,
     out.extrusions.insert(out.extrusions.end(), second.extrusions.begin(), second.extrusions.end());
     out.end_pos = second.end_pos;
     out.wipe_path = second.wipe_path;
-    out.initial_tool = first.initial_tool;
     out.new_tool = second.new_tool;
     return out;
 }
@@ -1358,7 +1359,7 @@ void WipeTower::generate(std::vector<std::vector<WipeTower::ToolChangeResult>> &
     m_old_temperature = -1; // reset last temperature written in the gcode
 
     std::vector<WipeTower::ToolChangeResult> layer_result;
-	for (auto layer : m_plan)
+	for (const auto &layer : m_plan)
 	{
         set_layer(layer.z, layer.height, 0, false/*layer.z == m_plan.front().z*/, layer.z == m_plan.back().z);
         m_internal_rotation += 180.f;
@@ -1388,11 +1389,11 @@ void WipeTower::generate(std::vector<std::vector<WipeTower::ToolChangeResult>> &
         }
         else {
             if (idx == -1) {
-                layer_result[0] = merge_tcr(finish_layer_tcr, layer_result[0]);
+                layer_result[0] = merge_tcr(std::move(finish_layer_tcr), layer_result[0]);
                 layer_result[0].force_travel = true;
             }
             else
-                layer_result[idx] = merge_tcr(layer_result[idx], finish_layer_tcr);
+                layer_result[idx] = merge_tcr(std::move(layer_result[idx]), finish_layer_tcr);
         }
 
 		result.emplace_back(std::move(layer_result));
@@ -1,8 +1,12 @@
 #include "GCodeReader.hpp"
 #include <boost/algorithm/string/classification.hpp>
 #include <boost/algorithm/string/split.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
+#include <boost/log/trivial.hpp>
 #include <boost/nowide/fstream.hpp>
 #include <boost/nowide/cstdio.hpp>
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <iomanip>
@@ -122,10 +126,61 @@ void GCodeReader::update_coordinates(GCodeLine &gline, std::pair<const char*, co
     }
 }
 
+template<typename ParseLineCallback, typename LineEndCallback>
+bool GCodeReader::parse_mapped_raw_internal(const char *data, size_t size, ParseLineCallback parse_line_callback, LineEndCallback line_end_callback)
+{
+    const char *begin = data;
+    const char *end   = data + size;
+    // Last line of the file not terminated by a new line is copied, so that it is zero terminated for the parser.
+    std::string last_line;
+    m_parsing = true;
+    for (const char *it = begin; it != end;) {
+        // A line is terminated by '\n' or by a single '\r', search for both in a single pass.
+        // Searching for '\n' first would rescan the rest of the file for each line of a file with '\r' line ends.
+        const char *it_eol = std::find_if(it, end, [](const char c) { return c == '\n' || c == '\r'; });
+        if (it_eol == end) {
+            last_line.assign(it, end);
+            parse_line_callback(last_line.c_str(), last_line.c_str() + last_line.size());
+            break;
+        }
+        // The line is terminated by '\r' or '\n', which stops the line parser.
+        parse_line_callback(it, it_eol);
+        if (! m_parsing)
+            // The callback wishes to exit.
+            return true;
+        // Skip EOL.
+        it = it_eol;
+        if (*it == '\r')
+            ++ it;
+        if (it != end && *it == '\n') {
+            line_end_callback(size_t(it - begin) + 1);
+            ++ it;
+        }
+    }
+    return true;
+}
+
 template<typename ParseLineCallback, typename LineEndCallback>
 bool GCodeReader::parse_file_raw_internal(const std::string &filename, ParseLineCallback parse_line_callback, LineEndCallback line_end_callback)
 {
+    {
+        // Memory map the file to parse the lines in place without copying them through a read buffer.
+        boost::iostreams::mapped_file_source mapped_file;
+        try {
+            boost::filesystem::path path(filename);
+            // Empty file cannot be mapped.
+            if (boost::filesystem::file_size(path) > 0)
+                mapped_file.open(path);
+        } catch (const std::exception &ex) {
+            BOOST_LOG_TRIVIAL(debug) << "GCodeReader: Failed to memory map file " << filename << ", reading it through a buffer: " << ex.what();
+        }
+        if (mapped_file.is_open())
+            return this->parse_mapped_raw_internal(mapped_file.data(), mapped_file.size(), parse_line_callback, line_end_callback);
+    }
+
     FilePtr in{ boost::nowide::fopen(filename.c_str(), "rb") };
+    if (in.f == nullptr)
+        return false;
 
     // Read the input stream 64kB at a time, extract lines and process them.
     std::vector<char> buffer(65536 * 10, 0);
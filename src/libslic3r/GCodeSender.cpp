@@ -1,7 +1,11 @@
 #include "GCodeSender.hpp"
+#include <algorithm>
+#include <charconv>
+#include <cstring>
 #include <iostream>
 #include <istream>
 #include <string>
+#include <string_view>
 #include <thread>
 #include <boost/algorithm/string/predicate.hpp>
 #include <boost/algorithm/string/trim.hpp>
@@ -52,8 +56,8 @@ std::fstream fs;
 namespace Slic3r {
 
 GCodeSender::GCodeSender()
-    : io(), serial(io), can_send(false), sent(0), open(false), error(false),
-      connected(false), queue_paused(false)
+    : io(), serial(io), can_send(false), sent(0), open(false), writing(false), error(false),
+      connected(false), queue_paused(false), stream_pos(0), stream_rx_buffer_size(0), stream_rx_buffer_used(0)
 {
 #ifdef DEBUG_SERIAL
     std::srand(std::time(nullptr));
@@ -167,6 +171,15 @@ GCodeSender::disconnect()
     this->io.post(boost::bind(&GCodeSender::do_close, this));
     this->background_thread.join();
     this->io.reset();
+    {
+        // the lines in flight will never be acknowledged
+        boost::lock_guard<boost::mutex> l(this->queue_mutex);
+        this->writing = false;
+        this->stream_map.close();
+        this->stream_in_flight.clear();
+        this->stream_rx_buffer_used = 0;
+        this->stream_sent.clear();
+    }
     /*
     if (this->error_status()) {
         throw(boost::system::system_error(boost::system::error_code(),
@@ -235,6 +248,9 @@ GCodeSender::purge_queue(bool priority)
         std::queue<std::string> empty;
         std::swap(this->queue, empty);
         this->queue_paused = false;
+        // stop streaming, the stream is closed once the lines in flight are acknowledged
+        if (this->stream_map.is_open())
+            this->stream_pos = this->stream_map.size();
     }
 }
 
@@ -357,6 +373,11 @@ GCodeSender::on_read(const boost::system::error_code& error,
             {
                 boost::lock_guard<boost::mutex> l(this->queue_mutex);
                 this->can_send = true;
+                // the oldest streamed line left the receive buffer of the firmware
+                if (!this->stream_in_flight.empty()) {
+                    this->stream_rx_buffer_used -= this->stream_in_flight.front();
+                    this->stream_in_flight.pop_front();
+                }
             }
             this->send();
         } else if (boost::istarts_with(line, "resend")  // Marlin uses "Resend: "
@@ -369,7 +390,12 @@ GCodeSender::on_read(const boost::system::error_code& error,
             fs << "!! line num out of sync: toresend = " << toresend << ", sent = " << sent << ", last_sent.size = " << last_sent.size() << std::endl;
 #endif
 
-            if (toresend > this->sent - this->last_sent.size() && toresend <= this->sent) {
+            if (this->is_streaming()) {
+                if (this->stream_resend(toresend))
+                    this->send();
+                else
+                    printf("Cannot resend %zu of the streamed lines\n", toresend);
+            } else if (toresend > this->sent - this->last_sent.size() && toresend <= this->sent) {
                 {
                     boost::lock_guard<boost::mutex> l(this->queue_mutex);
                     
@@ -454,6 +480,37 @@ GCodeSender::send(const std::string &line, bool priority)
     this->send();
 }
 
+bool
+GCodeSender::stream_file(const std::string &path, size_t rx_buffer_size)
+{
+    {
+        boost::lock_guard<boost::mutex> l(this->queue_mutex);
+        if (this->stream_map.is_open() || !this->queue.empty())
+            return false;
+        try {
+            this->stream_map.open(path);
+        } catch (const std::exception &) {
+            return false;
+        }
+        if (!this->stream_map.is_open())
+            return false;
+        this->stream_pos = 0;
+        this->stream_rx_buffer_size = rx_buffer_size;
+        this->stream_rx_buffer_used = 0;
+        this->stream_in_flight.clear();
+        this->stream_sent.clear();
+    }
+    this->send();
+    return true;
+}
+
+bool
+GCodeSender::is_streaming() const
+{
+    boost::lock_guard<boost::mutex> l(this->queue_mutex);
+    return this->stream_map.is_open();
+}
+
 void
 GCodeSender::send()
 {
@@ -465,8 +522,14 @@ GCodeSender::do_send()
 {
     boost::lock_guard<boost::mutex> l(this->queue_mutex);
     
-    // printer is not connected or we're still waiting for the previous ack
-    if (!this->can_send) return;
+    if (this->stream_map.is_open()) {
+        this->do_stream();
+        // the normal queue is processed once the stream is finished
+        if (this->stream_map.is_open()) return;
+    }
+    
+    // printer is not connected or we're still waiting for the previous ack or for the previous write
+    if (!this->can_send || this->writing) return;
     
     std::string line;
     while (!this->priqueue.empty() || (!this->queue.empty() && !this->queue_paused)) {
@@ -516,6 +579,7 @@ GCodeSender::do_send()
     
     this->last_sent.push_back(line);
     this->can_send = false;
+    this->writing = true;
     
     while (this->last_sent.size() > KEEP_SENT) {
         this->last_sent.pop_front();
@@ -542,9 +606,141 @@ GCodeSender::on_write(const boost::system::error_code& error,
         return;
     }
     
+    {
+        boost::lock_guard<boost::mutex> l(this->queue_mutex);
+        this->writing = false;
+    }
     this->do_send();
 }
 
+static std::string_view strip_gcode_line(std::string_view line)
+{
+    // strip comments
+    line = line.substr(0, line.find(';'));
+    // trim, the line might end with \r
+    auto is_space = [](char c) { return c == ' ' || c == '\t' || c == '\r' || c == '\n'; };
+    while (!line.empty() && is_space(line.front()))
+        line.remove_prefix(1);
+    while (!line.empty() && is_space(line.back()))
+        line.remove_suffix(1);
+    return line;
+}
+
+// Send as many lines as fit into the receive buffer of the firmware, in a single write.
+// Called with queue_mutex locked.
+void
+GCodeSender::do_stream()
+{
+    // wait for the previous write and for the ack of the line sent before the streaming started
+    if (this->writing || (this->stream_in_flight.empty() && !this->can_send)) return;
+    
+    const char  *data = this->stream_map.data();
+    const size_t size = this->stream_map.size();
+    size_t       num_written = 0;
+    for (;;) {
+        // priority lines first, then the lines of the file unless paused
+        std::string_view line;
+        size_t           offset   = std::string::npos;
+        size_t           next_pos = this->stream_pos;
+        if (!this->priqueue.empty()) {
+            line = this->priqueue.front();
+        } else if (!this->queue_paused && this->stream_pos < size) {
+            const char *begin = data + this->stream_pos;
+            const char *end   = static_cast<const char*>(::memchr(begin, '\n', size - this->stream_pos));
+            next_pos = (end == nullptr) ? size : size_t(end - data) + 1;
+            offset   = this->stream_pos;
+            line     = std::string_view(begin, (end == nullptr ? data + size : end) - begin);
+        } else
+            break;
+        
+        line = strip_gcode_line(line);
+        if (line.empty()) {
+            // process next line
+            if (offset == std::string::npos)
+                this->priqueue.pop_front();
+            else
+                this->stream_pos = next_pos;
+            continue;
+        }
+        
+        // compute full line with line number and checksum
+        char num[24];
+        this->stream_line = "N";
+        this->stream_line.append(num, std::to_chars(num, num + sizeof(num), this->sent + 1).ptr);
+        this->stream_line += ' ';
+        this->stream_line += line;
+        int cs = 0;
+        for (char c : this->stream_line)
+            cs = cs ^ c;
+        this->stream_line += '*';
+        this->stream_line.append(num, std::to_chars(num, num + sizeof(num), cs).ptr);
+        this->stream_line += '\n';
+        
+        // the receive buffer is full, wait for an ack; a line longer than the buffer is sent alone
+        if (!this->stream_in_flight.empty() && this->stream_rx_buffer_used + this->stream_line.size() > this->stream_rx_buffer_size)
+            break;
+        
+#ifdef DEBUG_SERIAL
+        fs << ">> " << this->stream_line << std::flush;
+#endif
+        ++ this->sent;
+        if (offset == std::string::npos) {
+            this->stream_sent.push_back({ this->sent, offset, std::string(line) });
+            this->priqueue.pop_front();
+        } else {
+            this->stream_sent.push_back({ this->sent, offset, std::string() });
+            this->stream_pos = next_pos;
+        }
+        this->stream_in_flight.push_back(this->stream_line.size());
+        this->stream_rx_buffer_used += this->stream_line.size();
+        this->write_buffer.commit(boost::asio::buffer_copy(this->write_buffer.prepare(this->stream_line.size()), boost::asio::buffer(this->stream_line)));
+        ++ num_written;
+    }
+    
+    // keep the lines in flight and some more for a resend
+    while (this->stream_sent.size() > KEEP_SENT + this->stream_in_flight.size())
+        this->stream_sent.pop_front();
+    
+    if (num_written > 0) {
+        this->writing = true;
+        boost::asio::async_write(this->serial, this->write_buffer, boost::bind(&GCodeSender::on_write, this, boost::asio::placeholders::error,
+                    boost::asio::placeholders::bytes_transferred));
+    } else if (this->stream_pos >= size && this->stream_in_flight.empty()) {
+        // all the lines of the file were sent and acknowledged
+        this->stream_map.close();
+        this->stream_sent.clear();
+    }
+}
+
+// Rewind the stream to the line requested by the firmware. The firmware rejects the lines sent after the requested one,
+// still acknowledging each of them with an "ok", thus the lines in flight are kept for counting the receive buffer.
+bool
+GCodeSender::stream_resend(size_t toresend)
+{
+    boost::lock_guard<boost::mutex> l(this->queue_mutex);
+    auto it = std::find_if(this->stream_sent.begin(), this->stream_sent.end(),
+        [toresend](const StreamSent &s) { return s.line_num == toresend; });
+    if (it == this->stream_sent.end())
+        return false;
+    
+#ifdef DEBUG_SERIAL
+    fs << "!! resending streamed lines from " << toresend << std::endl;
+#endif
+    // the priority lines are resent first, then the file from its oldest line to be resent
+    auto it_priqueue = this->priqueue.begin();
+    bool file_rewound = false;
+    for (auto it_sent = it; it_sent != this->stream_sent.end(); ++ it_sent)
+        if (it_sent->offset == std::string::npos)
+            this->priqueue.insert(it_priqueue, it_sent->line);
+        else if (!file_rewound) {
+            this->stream_pos = it_sent->offset;
+            file_rewound = true;
+        }
+    this->stream_sent.erase(it, this->stream_sent.end());
+    this->sent = toresend - 1;
+    return true;
+}
+
 void
 GCodeSender::set_DTR(bool on)
 {
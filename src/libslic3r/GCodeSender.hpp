@@ -2,11 +2,14 @@
 #define slic3r_GCodeSender_hpp_
 
 #include "libslic3r.h"
+#include <deque>
+#include <list>
 #include <queue>
 #include <string>
 #include <vector>
 #include <boost/asio.hpp>
 #include <boost/bind/bind.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
 #include <boost/thread.hpp>
 
 namespace Slic3r {
@@ -20,6 +23,13 @@ class GCodeSender : private boost::noncopyable {
     bool connect(std::string devname, unsigned int baud_rate);
     void send(const std::vector<std::string> &lines, bool priority = false);
     void send(const std::string &s, bool priority = false);
+    // Stream a G-code file in the character-counting mode: as many lines are sent as fit into the serial receive buffer
+    // of the firmware of rx_buffer_size bytes, each "ok" frees the space of the oldest line not acknowledged yet.
+    // Only for firmwares acknowledging each line with a single "ok" and buffering the received lines.
+    // The file is memory mapped and its lines are sent without copying them into the queue.
+    // The normal queue shall be empty, priority lines are sent in between the lines of the file.
+    bool stream_file(const std::string &path, size_t rx_buffer_size = 127);
+    bool is_streaming() const;
     void disconnect();
     bool error_status() const;
     bool is_connected() const;
@@ -40,11 +50,12 @@ class GCodeSender : private boost::noncopyable {
     boost::thread background_thread;
     boost::asio::streambuf read_buffer, write_buffer;
     bool open;      // whether the serial socket is connected
+    bool writing;   // whether write_buffer is being written by async_write()
     bool connected; // whether the printer is online
     bool error;
     mutable boost::mutex error_mutex;
     
-    // this mutex guards queue, priqueue, can_send, queue_paused, sent, last_sent
+    // this mutex guards queue, priqueue, can_send, queue_paused, sent, last_sent and the stream_ members
     mutable boost::mutex queue_mutex;
     std::queue<std::string> queue;
     std::list<std::string> priqueue;
@@ -53,6 +64,24 @@ class GCodeSender : private boost::noncopyable {
     size_t sent;
     std::deque<std::string> last_sent;
     
+    // Line of the streamed file or a priority line, sent and kept for a resend.
+    struct StreamSent {
+        size_t      line_num;
+        // Offset of the line in the streamed file, or std::string::npos for the priority line.
+        size_t      offset;
+        std::string line;
+    };
+    boost::iostreams::mapped_file_source stream_map;
+    // Offset of the next line of stream_map to be sent.
+    size_t stream_pos;
+    size_t stream_rx_buffer_size;
+    // Lengths of the sent lines not acknowledged yet and their sum.
+    std::deque<size_t> stream_in_flight;
+    size_t stream_rx_buffer_used;
+    std::deque<StreamSent> stream_sent;
+    // Reused to format the lines, so that the streamed lines are not allocated.
+    std::string stream_line;
+    
     // this mutex guards log, T, B
     mutable boost::mutex log_mutex;
     std::queue<std::string> log;
@@ -61,6 +90,8 @@ class GCodeSender : private boost::noncopyable {
     void set_baud_rate(unsigned int baud_rate);
     void set_error_status(bool e);
     void do_send();
+    void do_stream();
+    bool stream_resend(size_t toresend);
     void on_write(const boost::system::error_code& error, size_t bytes_transferred);
     void do_close();
     void do_read();
@@ -254,6 +254,13 @@ std::string GCodeWriter::set_speed(double F, const std::string &comment, const s
 }
 
 std::string GCodeWriter::travel_to_xy(const Vec2d &point, const std::string &comment)
+{
+    std::string out;
+    this->travel_to_xy(out, point, comment);
+    return out;
+}
+
+void GCodeWriter::travel_to_xy(std::string &out, const Vec2d &point, const std::string &comment)
 {
     m_pos.x() = point.x();
     m_pos.y() = point.y();
@@ -262,7 +269,7 @@ std::string GCodeWriter::travel_to_xy(const Vec2d &point, const std::string &com
     w.emit_xy(point);
     w.emit_f(this->config.travel_speed.value * 60.0);
     w.emit_comment(this->config.gcode_comments, comment);
-    return w.string();
+    w.append_to(out);
 }
 
 std::string GCodeWriter::travel_to_xyz(const Vec3d &point, const std::string &comment)
@@ -345,6 +352,13 @@ bool GCodeWriter::will_move_z(double z) const
 }
 
 std::string GCodeWriter::extrude_to_xy(const Vec2d &point, double dE, const std::string &comment)
+{
+    std::string out;
+    this->extrude_to_xy(out, point, dE, comment);
+    return out;
+}
+
+void GCodeWriter::extrude_to_xy(std::string &out, const Vec2d &point, double dE, const std::string &comment)
 {
     m_pos.x() = point.x();
     m_pos.y() = point.y();
@@ -353,7 +367,20 @@ std::string GCodeWriter::extrude_to_xy(const Vec2d &point, double dE, const std:
     w.emit_xy(point);
     w.emit_e(m_extrusion_axis, m_extruder->extrude(dE).second);
     w.emit_comment(this->config.gcode_comments, comment);
-    return w.string();
+    w.append_to(out);
+}
+
+void GCodeWriter::extrude_arc_to_xy(std::string &out, const Vec2d &point, const Vec2d &ij, bool ccw, double dE, const std::string &comment)
+{
+    m_pos.x() = point.x();
+    m_pos.y() = point.y();
+
+    GCodeG2G3Formatter w(ccw);
+    w.emit_xy(point);
+    w.emit_ij(ij);
+    w.emit_e(m_extrusion_axis, m_extruder->extrude(dE).second);
+    w.emit_comment(this->config.gcode_comments, comment);
+    w.append_to(out);
 }
 
 #if 0
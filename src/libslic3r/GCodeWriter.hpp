@@ -3,6 +3,8 @@
 
 #include "libslic3r.h"
 #include <string>
+#include <string_view>
+#include <cstring>
 #include <charconv>
 #include "Extruder.hpp"
 #include "Point.hpp"
@@ -57,10 +59,16 @@ public:
     std::string toolchange(unsigned int extruder_id);
     std::string set_speed(double F, const std::string &comment = std::string(), const std::string &cooling_marker = std::string()) const;
     std::string travel_to_xy(const Vec2d &point, const std::string &comment = std::string());
+    // Append the travel move to out instead of returning a temporary string.
+    void        travel_to_xy(std::string &out, const Vec2d &point, const std::string &comment = std::string());
     std::string travel_to_xyz(const Vec3d &point, const std::string &comment = std::string());
     std::string travel_to_z(double z, const std::string &comment = std::string());
     bool        will_move_z(double z) const;
     std::string extrude_to_xy(const Vec2d &point, double dE, const std::string &comment = std::string());
+    // Append the extrusion move to out instead of returning a temporary string.
+    void        extrude_to_xy(std::string &out, const Vec2d &point, double dE, const std::string &comment = std::string());
+    // Append a G2 / G3 extrusion move along an arc to out. ij is the offset of the arc center from the current position.
+    void        extrude_arc_to_xy(std::string &out, const Vec2d &point, const Vec2d &ij, bool ccw, double dE, const std::string &comment = std::string());
 //    std::string extrude_to_xyz(const Vec3d &point, double dE, const std::string &comment = std::string());
     std::string retract(bool before_wipe = false);
     std::string retract_for_toolchange(bool before_wipe = false);
@@ -136,6 +144,11 @@ public:
         this->emit_axis('Y', point.y(), XYZF_EXPORT_DIGITS);
     }
 
+    void emit_ij(const Vec2d &ij) {
+        this->emit_axis('I', ij.x(), XYZF_EXPORT_DIGITS);
+        this->emit_axis('J', ij.y(), XYZF_EXPORT_DIGITS);
+    }
+
     void emit_xyz(const Vec3d &point) {
         this->emit_axis('X', point.x(), XYZF_EXPORT_DIGITS);
         this->emit_axis('Y', point.y(), XYZF_EXPORT_DIGITS);
@@ -157,8 +170,8 @@ public:
         this->emit_axis('F', speed, XYZF_EXPORT_DIGITS);
     }
 
-    void emit_string(const std::string &s) {
-        strncpy(ptr_err.ptr, s.c_str(), s.size());
+    void emit_string(const std::string_view s) {
+        memcpy(ptr_err.ptr, s.data(), s.size());
         ptr_err.ptr += s.size();
     }
 
@@ -169,9 +182,20 @@ public:
         }
     }
 
-    std::string string() {
+    // Terminate the line and return a view into the internal buffer, valid for the life time of the formatter.
+    // Only one of string_view(), string() and append_to() shall be called, and only once.
+    std::string_view string_view() {
         *ptr_err.ptr ++ = '\n';
-        return std::string(this->buf, ptr_err.ptr - buf);
+        return { this->buf, size_t(ptr_err.ptr - buf) };
+    }
+
+    std::string string() {
+        return std::string(this->string_view());
+    }
+
+    // Append the terminated line to out, sparing the allocation of a temporary string.
+    void append_to(std::string &out) {
+        out += this->string_view();
     }
 
 protected:
@@ -194,6 +218,20 @@ public:
     GCodeG1Formatter& operator=(const GCodeG1Formatter&) = delete;
 };
 
+// G2 (clockwise) or G3 (counter-clockwise) arc move.
+class GCodeG2G3Formatter : public GCodeFormatter {
+public:
+    explicit GCodeG2G3Formatter(bool ccw) {
+        this->buf[0] = 'G';
+        this->buf[1] = ccw ? '3' : '2';
+        this->buf_end = buf + buflen;
+        this->ptr_err.ptr = this->buf + 2;
+    }
+
+    GCodeG2G3Formatter(const GCodeG2G3Formatter&) = delete;
+    GCodeG2G3Formatter& operator=(const GCodeG2G3Formatter&) = delete;
+};
+
 } /* namespace Slic3r */
 
 #endif /* slic3r_GCodeWriter_hpp_ */
@@ -56,7 +56,7 @@ void simplify_polygons(const Polygons &polygons, double tolerance, Polygons* ret
     for (Polygons::const_iterator it = polygons.begin(); it != polygons.end(); ++it) {
         Polygon p = *it;
         p.points.push_back(p.points.front());
-        p.points = MultiPoint::_douglas_peucker(p.points, tolerance);
+        MultiPoint::_douglas_peucker_inplace(p.points, tolerance);
         p.points.pop_back();
         pp.push_back(p);
     }
@@ -137,4 +137,56 @@ Circled circle_ransac(const Vec2ds& input, size_t iterations, double* min_error)
     return circle_best;
 }
 
+// Signed angle of an arc through the first, middle and last point of polyline[begin, end],
+// if the arc approximates the polyline within tolerance. Zero otherwise.
+static double fitted_arc_angle(const Vec2ds &polyline, size_t begin, size_t end, const double tolerance, Vec2d &center)
+{
+    // Arcs of a larger radius are nearly straight, they are better exported as lines.
+    static constexpr const double max_radius = 1000.;
+    const Vec2d &a     = polyline[begin];
+    const Vec2d &b     = polyline[(begin + end) / 2];
+    const Vec2d &c     = polyline[end];
+    const double cross = cross2(Vec2d(b - a), Vec2d(c - b));
+    if (std::abs(cross) < EPSILON)
+        return 0.;
+    center = circle_center(a, b, c, EPSILON);
+    const double radius = (a - center).norm();
+    if (radius > max_radius)
+        return 0.;
+    const bool ccw   = cross > 0.;
+    double     angle = 0.;
+    for (size_t i = begin; i < end; ++ i) {
+        const Vec2d v1 = polyline[i] - center;
+        const Vec2d v2 = polyline[i + 1] - center;
+        if (std::abs(v2.norm() - radius) > tolerance || std::abs((0.5 * (v1 + v2)).norm() - radius) > tolerance)
+            return 0.;
+        // All the segments have to turn in the direction of the arc.
+        const double da = atan2(cross2(v1, v2), v1.dot(v2));
+        if (ccw ? da <= 0. : da >= 0.)
+            return 0.;
+        angle += da;
+    }
+    // Full circles are ambiguous in G-code, as their start and end point are the same.
+    return std::abs(angle) < 1.9 * PI ? angle : 0.;
+}
+
+std::vector<FittedArc> fit_arcs(const Vec2ds &polyline, const double tolerance)
+{
+    // Shorter runs of segments are not worth replacing.
+    static constexpr const size_t min_segments = 3;
+    std::vector<FittedArc> out;
+    for (size_t begin = 0; begin + 1 < polyline.size();) {
+        FittedArc arc { begin + 1, Vec2d::Zero(), 0. };
+        Vec2d     center;
+        for (size_t end = begin + min_segments; end < polyline.size(); ++ end)
+            if (double angle = fitted_arc_angle(polyline, begin, end, tolerance, center); angle != 0.)
+                arc = { end, center, angle };
+            else
+                break;
+        out.emplace_back(arc);
+        begin = arc.end;
+    }
+    return out;
+}
+
 } } // namespace Slic3r::Geometry
@@ -150,6 +150,23 @@ inline Circled smallest_enclosing_circle_welzl(const Points &points)
     return smallest_enclosing_circle_welzl<Vec2d, Points>(points, SCALED_EPSILON);
 }
 
+// Piece of a polyline approximated either by a straight line segment or by a circular arc, see fit_arcs().
+struct FittedArc {
+    // Index of the end point of this piece in the input polyline. The piece starts at the end point of the previous piece.
+    size_t end;
+    // Center of the arc, valid for arcs only.
+    Vec2d  center;
+    // Signed angle of the arc, positive for a counter-clockwise arc, zero for a straight line segment.
+    double angle { 0. };
+
+    bool is_arc() const { return angle != 0.; }
+};
+
+// Greedily replace runs of at least three polyline segments by circular arcs, which deviate from the polyline vertices
+// and from the centers of the polyline segments by no more than tolerance. Full circles and nearly straight runs
+// are not replaced.
+std::vector<FittedArc> fit_arcs(const Vec2ds &polyline, const double tolerance);
+
 // Ugly named variant, that accepts the squared line 
 // Don't call me with a nearly zero length vector!
 // sympy: 
@@ -8,6 +8,7 @@
 #include <vector>
 
 #include "Utils.hpp" // for next_highest_power_of_2()
+#include "Execution/Execution.hpp"
 
 namespace Slic3r {
 
@@ -33,9 +34,12 @@ public:
     KDTreeIndirect(CoordinateFn coordinate) : coordinate(coordinate) {}
     KDTreeIndirect(CoordinateFn coordinate, std::vector<size_t> indices) : coordinate(coordinate) { this->build(indices); }
     KDTreeIndirect(CoordinateFn coordinate, size_t num_indices) : coordinate(coordinate) { this->build(num_indices); }
+    template<class EP, class = ExecutionPolicyOnly<EP>>
+    KDTreeIndirect(const EP &ep, CoordinateFn coordinate, size_t num_indices) : coordinate(coordinate) { this->build(ep, num_indices); }
     KDTreeIndirect(KDTreeIndirect &&rhs) : m_nodes(std::move(rhs.m_nodes)), coordinate(std::move(rhs.coordinate)) {}
     KDTreeIndirect& operator=(KDTreeIndirect &&rhs) { m_nodes = std::move(rhs.m_nodes); coordinate = std::move(rhs.coordinate); return *this; }
     void clear() { m_nodes.clear(); }
+    bool empty() const { return m_nodes.empty(); }
 
     void build(size_t num_indices)
     {
@@ -58,6 +62,39 @@ public:
         indices.clear();
     }
 
+    template<class EP, class = ExecutionPolicyOnly<EP>>
+    void build(const EP &ep, size_t num_indices)
+    {
+        std::vector<size_t> indices(num_indices);
+        for (size_t i = 0; i < num_indices; ++ i)
+            indices[i] = i;
+        this->build(ep, indices);
+    }
+
+    // Build the same tree as build(indices), the subtrees are built in parallel by the execution policy.
+    // The upper levels of the tree are built sequentially until there are enough subtrees to keep all threads busy,
+    // thus the coordinate functor has to be safe to be called concurrently.
+    template<class EP, class = ExecutionPolicyOnly<EP>>
+    void build(const EP &ep, std::vector<size_t> &indices)
+    {
+        if (indices.empty())
+            clear();
+        else {
+            m_nodes.assign(next_highest_power_of_2(indices.size() + 1), npos);
+            std::vector<Subtree> subtrees;
+            size_t num_subtrees = 4 * execution::max_concurrency(ep);
+            size_t depth        = 0;
+            while ((size_t(1) << depth) < num_subtrees)
+                ++ depth;
+            split_recursive(indices, 0, 0, 0, indices.size() - 1, depth, subtrees);
+            execution::for_each(ep, size_t(0), subtrees.size(), [this, &indices, &subtrees](size_t i) {
+                const Subtree &subtree = subtrees[i];
+                build_recursive(indices, subtree.node, subtree.dimension, subtree.left, subtree.right);
+            });
+        }
+        indices.clear();
+    }
+
     template<typename CoordType>
     unsigned int descent_mask(const CoordType &point_coord, const CoordType &search_radius, size_t idx, size_t dimension) const
     {
@@ -107,6 +144,30 @@ private:
         build_recursive(input, node * 2 + 2, next_dimension, center + 1, right);
     }
 
+    struct Subtree { size_t node; size_t dimension; size_t left; size_t right; };
+
+    // Build the upper "depth" levels of the tree the same way as build_recursive() does, collect the subtrees below.
+    void split_recursive(std::vector<size_t> &input, size_t node, const size_t dimension, const size_t left, const size_t right,
+                         size_t depth, std::vector<Subtree> &subtrees)
+    {
+        if (left > right)
+            return;
+        // Small subtrees are not worth splitting any further.
+        if (depth == 0 || right - left < 1024) {
+            subtrees.push_back({ node, dimension, left, right });
+            return;
+        }
+        size_t center = (left + right) / 2;
+        partition_input(input, dimension, left, right, center);
+        m_nodes[node] = input[center];
+        size_t next_dimension = dimension;
+        if (++ next_dimension == NumDimensions)
+            next_dimension = 0;
+        if (center > left)
+            split_recursive(input, node * 2 + 1, next_dimension, left, center - 1, depth - 1, subtrees);
+        split_recursive(input, node * 2 + 2, next_dimension, center + 1, right, depth - 1, subtrees);
+    }
+
        // Partition the input m_nodes <left, right> at "k" and "dimension" using the QuickSelect method:
        // https://en.wikipedia.org/wiki/Quickselect
        // Items left of the k'th item are lower than the k'th item in the "dimension",
@@ -276,6 +337,18 @@ size_t find_closest_point(const KDTreeIndirectType& kdtree, const PointType& poi
     return find_closest_point(kdtree, point, [](size_t) { return true; });
 }
 
+// Find the closest point to each of the query points, the queries are answered in parallel by the execution policy.
+template<class EP, typename KDTreeIndirectType, typename PointType, class = ExecutionPolicyOnly<EP>>
+std::vector<size_t> find_closest_point(const EP &ep, const KDTreeIndirectType &kdtree, const std::vector<PointType> &points)
+{
+    std::vector<size_t> out(points.size(), KDTreeIndirectType::npos);
+    if (! kdtree.empty())
+        execution::for_each(ep, size_t(0), points.size(), [&kdtree, &points, &out](size_t i) {
+            out[i] = find_closest_point(kdtree, points[i]);
+        }, 64);
+    return out;
+}
+
 // Find nearby points (spherical neighbourhood) using Euclidian metrics.
 template<typename KDTreeIndirectType, typename PointType, typename FilterFn>
 std::vector<size_t> find_nearby_points(const KDTreeIndirectType &kdtree, const PointType &center,
@@ -322,6 +395,19 @@ std::vector<size_t> find_nearby_points(const KDTreeIndirectType &kdtree, const P
     });
 }
 
+// Find nearby points of each of the query points, the queries are answered in parallel by the execution policy.
+template<class EP, typename KDTreeIndirectType, typename PointType, class = ExecutionPolicyOnly<EP>>
+std::vector<std::vector<size_t>> find_nearby_points(const EP &ep, const KDTreeIndirectType &kdtree, const std::vector<PointType> &centers,
+                                                    const typename KDTreeIndirectType::CoordType& max_distance)
+{
+    std::vector<std::vector<size_t>> out(centers.size());
+    if (! kdtree.empty())
+        execution::for_each(ep, size_t(0), centers.size(), [&kdtree, &centers, &out, max_distance](size_t i) {
+            out[i] = find_nearby_points(kdtree, centers[i], max_distance);
+        }, 64);
+    return out;
+}
+
 // Find nearby points (spherical neighbourhood) using Euclidian metrics.
 template<typename KDTreeIndirectType, typename PointType, typename FilterFn>
 std::vector<size_t> find_nearby_points(const KDTreeIndirectType &kdtree,
@@ -318,6 +318,39 @@ void Layer::build_up_down_graph(Layer& below, Layer& above)
         );
 }
 
+void Layer::clear_extrusions()
+{
+    for (LayerRegion *layerm : m_regions) {
+        layerm->m_perimeters.clear();
+        layerm->m_thin_fills.clear();
+        layerm->m_fills.clear();
+    }
+    for (LayerSlice &lslice : lslices_ex)
+        lslice.islands.clear();
+}
+
+void Layer::release_intermediate_data()
+{
+    for (LayerRegion *layerm : m_regions) {
+        ExPolygons().swap(layerm->m_raw_slices);
+        ExPolygons().swap(layerm->m_fill_expolygons);
+        BoundingBoxes().swap(layerm->m_fill_expolygons_bboxes);
+        ExPolygons().swap(layerm->m_fill_expolygons_composite);
+        BoundingBoxes().swap(layerm->m_fill_expolygons_composite_bboxes);
+        // Thin fills were copied into the fills by make_fills().
+        layerm->m_thin_fills.clear();
+        Polylines().swap(layerm->m_unsupported_bridge_edges);
+        // The G-code generator only looks at the top surfaces, see AvoidCrossingPerimeters.
+        layerm->m_fill_surfaces.keep_type(stTop);
+        layerm->m_fill_surfaces.surfaces.shrink_to_fit();
+    }
+    for (LayerSlice &lslice : lslices_ex)
+        for (LayerIsland &island : lslice.islands) {
+            island.thin_fills      = {};
+            island.fill_expolygons = {};
+        }
+}
+
 static inline bool layer_needs_raw_backup(const Layer *layer)
 {
     return ! (layer->regions().size() == 1 && (layer->id() > 0 || layer->object()->config().elefant_foot_compensation.value == 0));
@@ -364,6 +397,24 @@ void Layer::restore_untyped_slices_no_extra_perimeters()
     }
 }
 
+void Layer::build_internal_islands()
+{
+    this->internal_islands.islands.clear();
+    this->internal_islands.aabbtree.clear();
+    // Collect expolygons of internal slices.
+    for (const LayerRegion *layerm : m_regions)
+        for (const Surface &surface : layerm->slices().surfaces)
+            if (surface.is_internal())
+                this->internal_islands.islands.emplace_back(&surface.expolygon);
+    // Calculate bounding boxes of internal slices.
+    std::vector<AABBTreeIndirect::BoundingBoxWrapper> bboxes;
+    bboxes.reserve(this->internal_islands.islands.size());
+    for (size_t i = 0; i < this->internal_islands.islands.size(); ++ i)
+        bboxes.emplace_back(i, get_extents(*this->internal_islands.islands[i]));
+    // Build AABB tree over bounding boxes of internal slices.
+    this->internal_islands.aabbtree.build_modify_input(bboxes);
+}
+
 ExPolygons Layer::merged(float offset_scaled) const
 {
 	assert(offset_scaled >= 0.f);
@@ -389,7 +440,7 @@ ExPolygons Layer::merged(float offset_scaled) const
 // Here the perimeters are created cummulatively for all layer regions sharing the same parameters influencing the perimeters.
 // The perimeter paths and the thin fills (ExtrusionEntityCollection) are assigned to the first compatible layer region.
 // The resulting fill surface is split back among the originating regions.
-void Layer::make_perimeters()
+void Layer::make_perimeters(PerimeterGenerator::ArachneCache *arachne_cache)
 {
     BOOST_LOG_TRIVIAL(trace) << "Generating perimeters for layer " << this->id();
     
@@ -458,7 +509,7 @@ void Layer::make_perimeters()
     		        }
 
     	        if (layer_region_ids.size() == 1) {  // optimization
-    	            (*layerm)->make_perimeters((*layerm)->slices(), perimeter_and_gapfill_ranges, fill_expolygons, fill_expolygons_ranges);
+    	            (*layerm)->make_perimeters((*layerm)->slices(), perimeter_and_gapfill_ranges, fill_expolygons, fill_expolygons_ranges, arachne_cache);
                     this->sort_perimeters_into_islands((*layerm)->slices(), region_id, perimeter_and_gapfill_ranges, std::move(fill_expolygons), fill_expolygons_ranges, layer_region_ids);
     	        } else {
     	            SurfaceCollection new_slices;
@@ -493,11 +544,16 @@ void Layer::make_perimeters()
                         }
     	            }
     	            // make perimeters
-    	            layerm_config->make_perimeters(new_slices, perimeter_and_gapfill_ranges, fill_expolygons, fill_expolygons_ranges);
+    	            layerm_config->make_perimeters(new_slices, perimeter_and_gapfill_ranges, fill_expolygons, fill_expolygons_ranges, arachne_cache);
                     this->sort_perimeters_into_islands(new_slices, region_id_config, perimeter_and_gapfill_ranges, std::move(fill_expolygons), fill_expolygons_ranges, layer_region_ids);
     	        }
     	    }
         }
+    // The perimeters are kept until the G-code is exported, don't waste memory on the spare capacity of the chained extrusions.
+    for (LayerRegion *layerm : m_regions) {
+        layerm->m_perimeters.shrink_to_fit();
+        layerm->m_thin_fills.shrink_to_fit();
+    }
     BOOST_LOG_TRIVIAL(trace) << "Generating perimeters for layer " << this->id() << " - Done";
 }
 
@@ -2,6 +2,7 @@
 #define slic3r_Layer_hpp_
 
 #include "libslic3r.h"
+#include "AABBTreeIndirect.hpp"
 #include "BoundingBox.hpp"
 #include "Flow.hpp"
 #include "SurfaceCollection.hpp"
@@ -19,6 +20,8 @@ class LayerRegion;
 using LayerRegionPtrs = std::vector<LayerRegion*>;
 class PrintRegion;
 class PrintObject;
+class FillCache;
+namespace PerimeterGenerator { class ArachneCache; }
 
 namespace FillAdaptive {
     struct Octree;
@@ -148,7 +151,9 @@ public:
         // All fill areas produced for all input slices above.
         ExPolygons                                             &fill_expolygons,
         // Ranges of fill areas above per input slice.
-        std::vector<ExPolygonRange>                            &fill_expolygons_ranges);
+        std::vector<ExPolygonRange>                            &fill_expolygons_ranges,
+        // Optional cache of Arachne perimeters shared by the layers of a PrintObject.
+        PerimeterGenerator::ArachneCache                       *arachne_cache = nullptr);
     void    process_external_surfaces(const Layer *lower_layer, const Polygons *lower_layer_covered);
     double  infill_area_threshold() const;
     // Trim surfaces by trimming polygons. Used by the elephant foot compensation at the 1st layer.
@@ -307,6 +312,15 @@ struct LayerSlice
 
 using LayerSlices = std::vector<LayerSlice>;
 
+// Internal islands of the layer region slices with an AABB tree over their bounding boxes,
+// for the G-code export to test quickly whether a travel stays inside an internal island, see RetractWhenCrossingPerimeters.
+struct LayerInternalIslands
+{
+    // Referencing data owned by layer->regions()->slices().
+    std::vector<const ExPolygon*>       islands;
+    AABBTreeIndirect::Tree<2, coord_t>  aabbtree;
+};
+
 class Layer 
 {
 public:
@@ -338,6 +352,8 @@ public:
     ExPolygons 				lslices;
     std::vector<size_t>     lslice_indices_sorted_by_print_order;
     LayerSlices             lslices_ex;
+    // Built by PrintObject::infill() in parallel for all object layers once their slices are final, empty for support layers.
+    LayerInternalIslands    internal_islands;
 
     size_t                  region_count() const { return m_regions.size(); }
     const LayerRegion*      get_region(int idx) const { return m_regions[idx]; }
@@ -365,12 +381,21 @@ public:
         for (const LayerRegion *layerm : m_regions) if (layerm->slices().any_bottom_contains(item)) return true;
         return false;
     }
-    void                    make_perimeters();
+    void                    make_perimeters(PerimeterGenerator::ArachneCache *arachne_cache = nullptr);
     // Phony version of make_fills() without parameters for Perl integration only.
     void                    make_fills() { this->make_fills(nullptr, nullptr, nullptr); }
-    void                    make_fills(FillAdaptive::Octree* adaptive_fill_octree, FillAdaptive::Octree* support_fill_octree, FillLightning::Generator* lightning_generator);
+    void                    make_fills(FillAdaptive::Octree* adaptive_fill_octree, FillAdaptive::Octree* support_fill_octree, FillLightning::Generator* lightning_generator, FillCache *fill_cache = nullptr);
     Polylines               generate_sparse_infill_polylines_for_anchoring() const;
-    void 					make_ironing();
+    // Collect the internal islands of the region slices and build the AABB tree over them.
+    void                    build_internal_islands();
+    // Ironing polylines are shared through fill_cache between the layers where the ironed areas repeat.
+    void 					make_ironing(FillCache *fill_cache = nullptr);
+    // Release all extrusions of this layer including their references from the layer islands.
+    // Only to be called once the G-code of this layer was generated, see Print::set_release_layers_on_export().
+    virtual void            clear_extrusions();
+    // Release the data only needed to regenerate perimeters and infill: raw slices, fill expolygons, thin fills already copied
+    // into the fills, non-top fill surfaces. Only to be called once all the object steps are done, see Print::set_release_layers_on_export().
+    void                    release_intermediate_data();
 
     void                    export_region_slices_to_svg(const char *path) const;
     void                    export_region_fill_surfaces_to_svg(const char *path) const;
@@ -433,6 +458,7 @@ public:
 
     // Is there any valid extrusion assigned to this LayerRegion?
     virtual bool                has_extrusions() const { return ! support_fills.empty(); }
+    void                        clear_extrusions() override { Layer::clear_extrusions(); support_fills.clear(); }
 
     // Zero based index of an interface layer, used for alternating direction of interface / contact layers.
     size_t                      interface_id() const { return m_interface_id; }
@@ -15,6 +15,8 @@
 
 #include <boost/log/trivial.hpp>
 
+#include <tbb/parallel_for.h>
+
 namespace Slic3r {
 
 Flow LayerRegion::flow(FlowRole role) const
@@ -71,7 +73,9 @@ void LayerRegion::make_perimeters(
     // All fill areas produced for all input slices above.
     ExPolygons                                             &fill_expolygons,
     // Ranges of fill areas above per input slice.
-    std::vector<ExPolygonRange>                            &fill_expolygons_ranges)
+    std::vector<ExPolygonRange>                            &fill_expolygons_ranges,
+    // Optional cache of Arachne perimeters shared by the layers of a PrintObject.
+    PerimeterGenerator::ArachneCache                       *arachne_cache)
 {
     m_perimeters.clear();
     m_thin_fills.clear();
@@ -101,17 +105,20 @@ void LayerRegion::make_perimeters(
         print_config,
         spiral_vase
     );
+    params.arachne_cache = arachne_cache;
+
+    if (slices.empty())
+        return;
 
     // Cummulative sum of polygons over all the regions.
     const ExPolygons *lower_slices = this->layer()->lower_layer ? &this->layer()->lower_layer->lslices : nullptr;
-    // Cache for offsetted lower_slices
-    Polygons          lower_layer_polygons_cache;
+    // Offsetted lower_slices, shared by all the surfaces.
+    Polygons          lower_layer_polygons_cache = PerimeterGenerator::lower_slices_for_overhangs(params, lower_slices);
+    const bool        arachne = this->layer()->object()->config().perimeter_generator.value == PerimeterGeneratorType::Arachne && !spiral_vase;
 
-    for (const Surface &surface : slices) {
-        auto perimeters_begin      = uint32_t(m_perimeters.size());
-        auto gap_fills_begin       = uint32_t(m_thin_fills.size());
-        auto fill_expolygons_begin = uint32_t(fill_expolygons.size());
-        if (this->layer()->object()->config().perimeter_generator.value == PerimeterGeneratorType::Arachne && !spiral_vase)
+    auto process = [&params, lower_slices, &lower_layer_polygons_cache, arachne](const Surface &surface,
+        ExtrusionEntityCollection &out_loops, ExtrusionEntityCollection &out_gap_fill, ExPolygons &out_fill_expolygons) {
+        if (arachne)
             PerimeterGenerator::process_arachne(
                 // input:
                 params,
@@ -119,9 +126,9 @@ void LayerRegion::make_perimeters(
                 lower_slices,
                 lower_layer_polygons_cache,
                 // output:
-                m_perimeters,
-                m_thin_fills,
-                fill_expolygons);
+                out_loops,
+                out_gap_fill,
+                out_fill_expolygons);
         else
             PerimeterGenerator::process_classic(
                 // input:
@@ -130,9 +137,47 @@ void LayerRegion::make_perimeters(
                 lower_slices,
                 lower_layer_polygons_cache,
                 // output:
-                m_perimeters,
-                m_thin_fills,
-                fill_expolygons);
+                out_loops,
+                out_gap_fill,
+                out_fill_expolygons);
+    };
+
+    if (arachne && slices.size() > 1) {
+        // The islands are independent. Arachne is expensive enough to generate the perimeters of each island in a nested
+        // parallel task, which keeps all the cores busy for objects with few layers, but many islands per layer.
+        struct IslandPerimeters {
+            ExtrusionEntityCollection perimeters;
+            ExtrusionEntityCollection thin_fills;
+            ExPolygons                fill_expolygons;
+        };
+        std::vector<IslandPerimeters> islands(slices.size());
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, slices.size()), [&slices, &process, &islands](const tbb::blocked_range<size_t> &range) {
+            for (size_t island_idx = range.begin(); island_idx < range.end(); ++ island_idx) {
+                IslandPerimeters &island = islands[island_idx];
+                process(slices.surfaces[island_idx], island.perimeters, island.thin_fills, island.fill_expolygons);
+            }
+        });
+        // Merge in the order of the input surfaces, producing the same output as the sequential code.
+        for (IslandPerimeters &island : islands) {
+            auto perimeters_begin      = uint32_t(m_perimeters.size());
+            auto gap_fills_begin       = uint32_t(m_thin_fills.size());
+            auto fill_expolygons_begin = uint32_t(fill_expolygons.size());
+            m_perimeters.append(std::move(island.perimeters.entities));
+            m_thin_fills.append(std::move(island.thin_fills.entities));
+            append(fill_expolygons, std::move(island.fill_expolygons));
+            perimeter_and_gapfill_ranges.emplace_back(
+                ExtrusionRange{ perimeters_begin, uint32_t(m_perimeters.size()) }, 
+                ExtrusionRange{ gap_fills_begin,  uint32_t(m_thin_fills.size()) });
+            fill_expolygons_ranges.emplace_back(ExtrusionRange{ fill_expolygons_begin, uint32_t(fill_expolygons.size()) });
+        }
+        return;
+    }
+
+    for (const Surface &surface : slices) {
+        auto perimeters_begin      = uint32_t(m_perimeters.size());
+        auto gap_fills_begin       = uint32_t(m_thin_fills.size());
+        auto fill_expolygons_begin = uint32_t(fill_expolygons.size());
+        process(surface, m_perimeters, m_thin_fills, fill_expolygons);
         perimeter_and_gapfill_ranges.emplace_back(
             ExtrusionRange{ perimeters_begin, uint32_t(m_perimeters.size()) }, 
             ExtrusionRange{ gap_fills_begin,  uint32_t(m_thin_fills.size()) });
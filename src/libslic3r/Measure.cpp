@@ -6,6 +6,8 @@
 #include "libslic3r/SurfaceMesh.hpp"
 #include <numeric>
 
+#include <tbb/parallel_for.h>
+
 #include <numeric>
 
 #define DEBUG_EXTRACT_ALL_FEATURES_AT_ONCE 0
@@ -160,8 +162,9 @@ void MeasuringImpl::update_planes()
     assert(std::none_of(m_face_to_plane.begin(), m_face_to_plane.end(), [](size_t val) { return val == size_t(-1); }));
 
     // Now we will walk around each of the planes and save vertices which form the border.
+    // The walk around a plane only reads the mesh and the facet to plane map, thus the planes are processed in parallel.
     SurfaceMesh sm(m_mesh.its);
-    for (int plane_id=0; plane_id < int(m_planes.size()); ++plane_id) {
+    auto walk_plane_borders = [this, &sm, &face_neighbors](int plane_id) {
         const auto& facets = m_planes[plane_id].facets;
         m_planes[plane_id].borders.clear();
         std::vector<std::array<bool, 3>> visited(facets.size(), {false, false, false});
@@ -248,11 +251,15 @@ void MeasuringImpl::update_planes()
                 }
             }
         }
-        continue; // There was no failure.
+        return; // There was no failure.
 
         PLANE_FAILURE:
             m_planes[plane_id].borders.clear();
-    }
+    };
+    tbb::parallel_for(tbb::blocked_range<int>(0, int(m_planes.size())), [&walk_plane_borders](const tbb::blocked_range<int> &range) {
+        for (int plane_id = range.begin(); plane_id < range.end(); ++ plane_id)
+            walk_plane_borders(plane_id);
+    });
 }
 
 
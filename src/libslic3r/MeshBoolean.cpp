@@ -10,6 +10,8 @@
 
 // CGAL headers
 #include <CGAL/Polygon_mesh_processing/corefinement.h>
+#include <CGAL/Polygon_mesh_processing/bbox.h>
+#include <CGAL/Polygon_mesh_processing/self_intersections.h>
 #include <CGAL/Exact_integer.h>
 #include <CGAL/Surface_mesh.h>
 #include <CGAL/Cartesian_converter.h>
@@ -194,32 +196,108 @@ indexed_triangle_set cgal_to_indexed_triangle_set(const CGALMesh &cgalmesh)
 // Boolean operations for CGAL meshes
 // /////////////////////////////////////////////////////////////////////////////
 
-static bool _cgal_diff(CGALMesh &A, CGALMesh &B, CGALMesh &R)
+enum class BooleanOp { Difference, Union, Intersection };
+
+template<class _Mesh>
+static bool _cgal_corefine(BooleanOp op, _Mesh &A, _Mesh &B, _Mesh &R)
 {
     const auto &p = CGALParams::throw_on_self_intersection(true);
-    return CGALProc::corefine_and_compute_difference(A.m, B.m, R.m, p, p);
+    switch (op) {
+    case BooleanOp::Difference:   return CGALProc::corefine_and_compute_difference(A, B, R, p, p);
+    case BooleanOp::Union:        return CGALProc::corefine_and_compute_union(A, B, R, p, p);
+    case BooleanOp::Intersection: return CGALProc::corefine_and_compute_intersection(A, B, R, p, p);
+    }
+    return false;
 }
 
-static bool _cgal_union(CGALMesh &A, CGALMesh &B, CGALMesh &R)
+// Copy the mesh into a mesh of another kernel, the removed elements of the source are skipped.
+template<class _SrcMesh, class _DstMesh, class _Converter>
+static void _cgal_convert(const _SrcMesh &src, _DstMesh &dst, const _Converter &cvt)
 {
-    const auto &p = CGALParams::throw_on_self_intersection(true);
-    return CGALProc::corefine_and_compute_union(A.m, B.m, R.m, p, p);
+    dst.reserve(src.num_vertices(), src.num_edges(), src.num_faces());
+
+    std::vector<typename _DstMesh::Vertex_index> vmap(src.num_vertices() + src.number_of_removed_vertices());
+    for (auto v : src.vertices())
+        vmap[size_t(v)] = dst.add_vertex(cvt(src.point(v)));
+
+    for (auto f : src.faces()) {
+        std::vector<typename _DstMesh::Vertex_index> face;
+        for (auto v : src.vertices_around_face(src.halfedge(f)))
+            face.emplace_back(vmap[size_t(v)]);
+        dst.add_face(face);
+    }
 }
 
-static bool _cgal_intersection(CGALMesh &A, CGALMesh &B, CGALMesh &R)
+// The operation on the exact constructions kernel, used if the (much faster) inexact constructions failed.
+// The new vertices are rounded back to doubles.
+static bool _cgal_corefine_exact(BooleanOp op, CGALMesh &A, CGALMesh &B, CGALMesh &R)
 {
-    const auto &p = CGALParams::throw_on_self_intersection(true);
-    return CGALProc::corefine_and_compute_intersection(A.m, B.m, R.m, p, p);
+    _EpecMesh eA, eB, eR;
+    _cgal_convert(A.m, eA, CGAL::Cartesian_converter<EpicKernel, EpecKernel>{});
+    _cgal_convert(B.m, eB, CGAL::Cartesian_converter<EpicKernel, EpecKernel>{});
+    if (! _cgal_corefine(op, eA, eB, eR))
+        return false;
+    _cgal_convert(eR, R.m, CGAL::Cartesian_converter<EpecKernel, EpicKernel>{});
+    return true;
+}
+
+// The meshes are strictly apart if their bounding boxes do not even touch, the result is then known without
+// the corefinement. An empty mesh has an empty bounding box and it is apart from any other mesh.
+static bool _bboxes_apart(const BoundingBoxf3 &a, const BoundingBoxf3 &b)
+{
+    return ! a.defined || ! b.defined || (a.min.array() > b.max.array()).any() || (b.min.array() > a.max.array()).any();
 }
 
-template<class Op> void _cgal_do(Op &&op, CGALMesh &A, CGALMesh &B)
+static bool _cgal_apart(const CGALMesh &A, const CGALMesh &B)
 {
+    return A.m.is_empty() || B.m.is_empty() || ! CGAL::do_overlap(CGALProc::bbox(A.m), CGALProc::bbox(B.m));
+}
+
+static void _merge(CGALMesh &A, const CGALMesh &B) { A.m += B.m; }
+static void _merge(TriangleMesh &A, const TriangleMesh &B) { A.merge(B); }
+static void _merge(indexed_triangle_set &A, const indexed_triangle_set &B) { its_merge(A, B); }
+
+// Result of the operation on meshes apart.
+template<class _Mesh> static void _apart_do(BooleanOp op, _Mesh &A, const _Mesh &B)
+{
+    switch (op) {
+    case BooleanOp::Difference:   break;
+    case BooleanOp::Union:        _merge(A, B); break;
+    case BooleanOp::Intersection: A = _Mesh{}; break;
+    }
+}
+
+static void _cgal_do(BooleanOp op, CGALMesh &A, CGALMesh &B)
+{
+    if (_cgal_apart(A, B)) {
+        _apart_do(op, A, B);
+        return;
+    }
+
     bool success = false;
     bool hw_fail = false;
+    bool self_intersection = false;
+    // The inexact constructions may round the intersection points so that the result of valid operands self intersects,
+    // such a result is recalculated with the exact constructions.
+    bool validate = CGAL::is_closed(A.m) && CGAL::is_closed(B.m);
     try {
         CGALMesh result;
-        try_catch_signal({SIGSEGV, SIGFPE}, [&success, &A, &B, &result, &op] {
-            success = op(A, B, result);
+        try_catch_signal({SIGSEGV, SIGFPE}, [&] {
+            try {
+                // Corefinement modifies the operands, keep the originals for the exact fallback.
+                CGALMesh fastA = A, fastB = B;
+                success = _cgal_corefine(op, fastA.m, fastB.m, result.m) &&
+                          (! validate || (CGAL::is_closed(result.m) && ! CGALProc::does_self_intersect(result.m)));
+            } catch (const CGALProc::Corefinement::Self_intersection_exception &) {
+                // The predicates are exact, the exact constructions would fail the same way.
+                self_intersection = true;
+            } catch (...) {
+                success = false;
+            }
+            if (! success && ! self_intersection) {
+                result = CGALMesh{};
+                success = _cgal_corefine_exact(op, A, B, result);
+            }
         }, [&] { hw_fail = true; });
         A = std::move(result);      // In-place operation does not work
     } catch (...) {
@@ -233,17 +311,23 @@ template<class Op> void _cgal_do(Op &&op, CGALMesh &A, CGALMesh &B)
         throw Slic3r::RuntimeError("CGAL mesh boolean operation failed.");
 }
 
-void minus(CGALMesh &A, CGALMesh &B) { _cgal_do(_cgal_diff, A, B); }
-void plus(CGALMesh &A, CGALMesh &B) { _cgal_do(_cgal_union, A, B); }
-void intersect(CGALMesh &A, CGALMesh &B) { _cgal_do(_cgal_intersection, A, B); }
+void minus(CGALMesh &A, CGALMesh &B) { _cgal_do(BooleanOp::Difference, A, B); }
+void plus(CGALMesh &A, CGALMesh &B) { _cgal_do(BooleanOp::Union, A, B); }
+void intersect(CGALMesh &A, CGALMesh &B) { _cgal_do(BooleanOp::Intersection, A, B); }
 bool does_self_intersect(const CGALMesh &mesh) { return CGALProc::does_self_intersect(mesh.m); }
 
 // /////////////////////////////////////////////////////////////////////////////
 // Now the public functions for TriangleMesh input:
 // /////////////////////////////////////////////////////////////////////////////
 
-template<class Op> void _mesh_boolean_do(Op &&op, indexed_triangle_set &A, const indexed_triangle_set &B)
+static void _mesh_boolean_do(BooleanOp op, indexed_triangle_set &A, const indexed_triangle_set &B)
 {
+    // Meshes apart are not converted to CGAL at all.
+    if (_bboxes_apart(bounding_box(A), bounding_box(B))) {
+        _apart_do(op, A, B);
+        return;
+    }
+
     CGALMesh meshA;
     CGALMesh meshB;
     triangle_mesh_to_cgal(A.vertices, A.indices, meshA.m);
@@ -254,8 +338,13 @@ template<class Op> void _mesh_boolean_do(Op &&op, indexed_triangle_set &A, const
     A = cgal_to_indexed_triangle_set(meshA.m);
 }
 
-template<class Op> void _mesh_boolean_do(Op &&op, TriangleMesh &A, const TriangleMesh &B)
+static void _mesh_boolean_do(BooleanOp op, TriangleMesh &A, const TriangleMesh &B)
 {
+    if (_bboxes_apart(A.bounding_box(), B.bounding_box())) {
+        _apart_do(op, A, B);
+        return;
+    }
+
     CGALMesh meshA;
     CGALMesh meshB;
     triangle_mesh_to_cgal(A.its.vertices, A.its.indices, meshA.m);
@@ -268,32 +357,32 @@ template<class Op> void _mesh_boolean_do(Op &&op, TriangleMesh &A, const Triangl
 
 void minus(TriangleMesh &A, const TriangleMesh &B)
 {
-    _mesh_boolean_do(_cgal_diff, A, B);
+    _mesh_boolean_do(BooleanOp::Difference, A, B);
 }
 
 void plus(TriangleMesh &A, const TriangleMesh &B)
 {
-    _mesh_boolean_do(_cgal_union, A, B);
+    _mesh_boolean_do(BooleanOp::Union, A, B);
 }
 
 void intersect(TriangleMesh &A, const TriangleMesh &B)
 {
-    _mesh_boolean_do(_cgal_intersection, A, B);
+    _mesh_boolean_do(BooleanOp::Intersection, A, B);
 }
 
 void minus(indexed_triangle_set &A, const indexed_triangle_set &B)
 {
-    _mesh_boolean_do(_cgal_diff, A, B);
+    _mesh_boolean_do(BooleanOp::Difference, A, B);
 }
 
 void plus(indexed_triangle_set &A, const indexed_triangle_set &B)
 {
-    _mesh_boolean_do(_cgal_union, A, B);
+    _mesh_boolean_do(BooleanOp::Union, A, B);
 }
 
 void intersect(indexed_triangle_set &A, const indexed_triangle_set &B)
 {
-    _mesh_boolean_do(_cgal_intersection, A, B);
+    _mesh_boolean_do(BooleanOp::Intersection, A, B);
 }
 
 bool does_self_intersect(const TriangleMesh &mesh)
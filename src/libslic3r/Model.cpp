@@ -17,9 +17,13 @@
 
 #include <float.h>
 
+#include <string_view>
+#include <unordered_map>
+
 #include <boost/algorithm/string/predicate.hpp>
 #include <boost/algorithm/string/replace.hpp>
 #include <boost/filesystem.hpp>
+#include <boost/functional/hash.hpp>
 #include <boost/log/trivial.hpp>
 #include <boost/nowide/iostream.hpp>
 
@@ -137,6 +141,8 @@ Model Model::read_from_file(const std::string& input_file, DynamicPrintConfig* c
     if (options & LoadAttribute::AddDefaultInstances)
         model.add_default_instances();
 
+    model.share_identical_meshes();
+
     CustomGCode::update_custom_gcode_per_print_z_from_config(model.custom_gcode_per_print_z, config);
     CustomGCode::check_mode_for_custom_gcode_per_print_z(model.custom_gcode_per_print_z);
 
@@ -144,6 +150,34 @@ Model Model::read_from_file(const std::string& input_file, DynamicPrintConfig* c
     return model;
 }
 
+bool Model::is_mesh_file(const std::string &input_file)
+{
+    return boost::algorithm::iends_with(input_file, ".stl") || boost::algorithm::iends_with(input_file, ".obj");
+}
+
+TriangleMesh Model::read_mesh_from_file(const std::string &input_file)
+{
+    assert(is_mesh_file(input_file));
+    TriangleMesh mesh;
+    bool result = boost::algorithm::iends_with(input_file, ".stl") ?
+        mesh.ReadSTLFile(input_file.c_str()) && ! mesh.empty() :
+        load_obj(input_file.c_str(), &mesh);
+    if (! result)
+        throw Slic3r::RuntimeError("Loading of a model file failed.");
+    return mesh;
+}
+
+// Same as read_from_file() applied to a STL or OBJ file, with the mesh already read by read_mesh_from_file().
+Model Model::read_from_mesh(const std::string &input_file, TriangleMesh &&mesh, LoadAttributes options)
+{
+    Model model;
+    const std::string object_name = boost::filesystem::path(input_file).filename().string();
+    model.add_object(object_name.c_str(), input_file.c_str(), std::move(mesh));
+    if (options & LoadAttribute::AddDefaultInstances)
+        model.add_default_instances();
+    return model;
+}
+
 // Loading model from a file (3MF or AMF), not from a simple geometry file (STL or OBJ).
 Model Model::read_from_archive(const std::string& input_file, DynamicPrintConfig* config, ConfigSubstitutionContext* config_substitutions, LoadAttributes options)
 {
@@ -176,6 +210,8 @@ Model Model::read_from_archive(const std::string& input_file, DynamicPrintConfig
     if (options & LoadAttribute::AddDefaultInstances)
         model.add_default_instances();
 
+    model.share_identical_meshes();
+
     CustomGCode::update_custom_gcode_per_print_z_from_config(model.custom_gcode_per_print_z, config);
     CustomGCode::check_mode_for_custom_gcode_per_print_z(model.custom_gcode_per_print_z);
 
@@ -559,6 +595,35 @@ int Model::removed_objects_with_zero_volume()
     return removed;
 }
 
+void Model::share_identical_meshes()
+{
+    auto bytes = [](const auto &vec) { return std::string_view(reinterpret_cast<const char*>(vec.data()), vec.size() * sizeof(vec.front())); };
+    // The meshes are only compared inside groups of the same hash.
+    std::unordered_map<size_t, std::vector<ModelVolume*>> volumes_by_hash;
+    size_t num_shared = 0;
+    for (ModelObject *object : this->objects)
+        for (ModelVolume *volume : object->volumes) {
+            const indexed_triangle_set &its  = volume->mesh().its;
+            size_t                      hash = std::hash<std::string_view>()(bytes(its.vertices));
+            boost::hash_combine(hash, std::hash<std::string_view>()(bytes(its.indices)));
+            std::vector<ModelVolume*> &group = volumes_by_hash[hash];
+            auto it = std::find_if(group.begin(), group.end(), [volume, &its](const ModelVolume *other) {
+                const indexed_triangle_set &oits = other->mesh().its;
+                return other->m_mesh == volume->m_mesh || (oits.vertices == its.vertices && oits.indices == its.indices);
+            });
+            if (it == group.end())
+                group.emplace_back(volume);
+            else if ((*it)->m_mesh != volume->m_mesh) {
+                volume->m_mesh = (*it)->m_mesh;
+                if ((*it)->m_convex_hull)
+                    volume->m_convex_hull = (*it)->m_convex_hull;
+                ++ num_shared;
+            }
+        }
+    if (num_shared > 0)
+        BOOST_LOG_TRIVIAL(debug) << "Model: " << num_shared << " volumes share the mesh of an identical volume";
+}
+
 void Model::adjust_min_z()
 {
     if (objects.empty())
@@ -1069,8 +1134,21 @@ Polygon ModelObject::convex_hull_2d(const Transform3d& trafo_instance) const
 {
     Points pts;
     for (const ModelVolume* v : volumes) {
-        if (v->is_model_part())
-            append(pts, its_convex_hull_2d_above(v->mesh().its, (trafo_instance * v->get_matrix()).cast<float>(), 0.0f).points);
+        if (v->is_model_part()) {
+            const Transform3f trafo = (trafo_instance * v->get_matrix()).cast<float>();
+            // If the volume is completely above the bed, then the 2D convex hull of its part above the bed is the projection
+            // of its cached 3D convex hull, which has usually much fewer vertices than the mesh itself.
+            // Otherwise the convex hull of the clipped 3D convex hull may be larger, thus the mesh is clipped.
+            const std::shared_ptr<const TriangleMesh> &hull = v->get_convex_hull_shared_ptr();
+            bool above_bed = hull != nullptr;
+            if (above_bed)
+                for (const stl_vertex &p : hull->its.vertices)
+                    if ((trafo * p).z() < 0.f) {
+                        above_bed = false;
+                        break;
+                    }
+            append(pts, its_convex_hull_2d_above(above_bed ? hull->its : v->mesh().its, trafo, 0.0f).points);
+        }
     }
     return Geometry::convex_hull(std::move(pts));
 }
@@ -1997,8 +2075,14 @@ unsigned int ModelObject::update_instances_print_volume_state(const BuildVolume
         unsigned int inside_outside = 0;
         for (const ModelVolume* vol : this->volumes)
             if (vol->is_model_part()) {
-                const Transform3d matrix = model_instance->get_matrix() * vol->get_matrix();
-                BuildVolume::ObjectState state = build_volume.object_state(vol->mesh().its, matrix.cast<float>(), true /* may be below print bed */);
+                const Transform3f matrix = (model_instance->get_matrix() * vol->get_matrix()).cast<float>();
+                // All the build volume shapes are convex, thus a volume whose convex hull is completely inside (or below)
+                // the build volume is completely inside (or below) as well. Only test the full mesh if the cheap test is inconclusive.
+                BuildVolume::ObjectState state = BuildVolume::ObjectState::Colliding;
+                if (const std::shared_ptr<const TriangleMesh> &hull = vol->get_convex_hull_shared_ptr(); hull != nullptr)
+                    state = build_volume.object_state(hull->its, matrix, true /* may be below print bed */);
+                if (state != BuildVolume::ObjectState::Inside && state != BuildVolume::ObjectState::Below)
+                    state = build_volume.object_state(vol->mesh().its, matrix, true /* may be below print bed */);
                 if (state == BuildVolume::ObjectState::Inside)
                     // Volume is completely inside.
                     inside_outside |= INSIDE;
@@ -2173,6 +2257,7 @@ void ModelVolume::center_geometry_after_creation(bool update_source_offset)
     Vec3d shift = this->mesh().bounding_box().center();
     if (!shift.isApprox(Vec3d::Zero()))
     {
+        this->unshare_mesh();
     	if (m_mesh)
         	const_cast<TriangleMesh*>(m_mesh.get())->translate(-(float)shift(0), -(float)shift(1), -(float)shift(2));
         if (m_convex_hull)
@@ -2184,6 +2269,15 @@ void ModelVolume::center_geometry_after_creation(bool update_source_offset)
         source.mesh_offset = shift;
 }
 
+void ModelVolume::unshare_mesh()
+{
+    // The mesh and the convex hull are modified in place below, make private copies if they were shared by Model::share_identical_meshes().
+    if (m_mesh && m_mesh.use_count() > 1)
+        m_mesh = std::make_shared<const TriangleMesh>(*m_mesh);
+    if (m_convex_hull && m_convex_hull.use_count() > 1)
+        m_convex_hull = std::make_shared<const TriangleMesh>(*m_convex_hull);
+}
+
 void ModelVolume::calculate_convex_hull()
 {
     m_convex_hull = std::make_shared<TriangleMesh>(this->mesh().convex_hull_3d());
@@ -2364,6 +2458,7 @@ void ModelVolume::mirror(Axis axis)
 // This method could only be called before the meshes of this ModelVolumes are not shared!
 void ModelVolume::scale_geometry_after_creation(const Vec3f& versor)
 {
+    this->unshare_mesh();
 	const_cast<TriangleMesh*>(m_mesh.get())->scale(versor);
 	const_cast<TriangleMesh*>(m_convex_hull.get())->scale(versor);
 }
@@ -2541,6 +2636,9 @@ void FacetsAnnotation::set_triangle_from_string(int triangle_id, const std::stri
     assert(m_data.first.empty() || m_data.first.back().first < triangle_id);
     m_data.first.emplace_back(triangle_id, int(m_data.second.size()));
 
+    // Grow the bit stream at once, then fill in the nibbles.
+    size_t bit = m_data.second.size();
+    m_data.second.resize(bit + 4 * str.size(), false);
     for (auto it = str.crbegin(); it != str.crend(); ++it) {
         const char ch = *it;
         int dec = 0;
@@ -2552,8 +2650,9 @@ void FacetsAnnotation::set_triangle_from_string(int triangle_id, const std::stri
             assert(false);
 
         // Convert to binary and append into code.
-        for (int i=0; i<4; ++i)
-            m_data.second.insert(m_data.second.end(), bool(dec & (1 << i)));
+        for (int i=0; i<4; ++i, ++bit)
+            if (dec & (1 << i))
+                m_data.second[bit] = true;
     }
 }
 
@@ -728,9 +728,24 @@ private:
     friend class cereal::access;
     friend class UndoRedo::StackImpl;
 
-    template<class Archive> void serialize(Archive &ar)
+    // Cereal stores std::vector<bool> as one byte per bit, thus the painting bit stream is packed
+    // to keep the Undo / Redo snapshots of painted meshes small.
+    template<class Archive> void save(Archive &ar) const
     {
-        ar(cereal::base_class<ObjectWithTimestamp>(this), m_data);
+        std::vector<uint8_t> bits((m_data.second.size() + 7) / 8, 0);
+        for (size_t i = 0; i < m_data.second.size(); ++ i)
+            if (m_data.second[i])
+                bits[i >> 3] |= uint8_t(1 << (i & 7));
+        ar(cereal::base_class<ObjectWithTimestamp>(this), m_data.first, uint64_t(m_data.second.size()), bits);
+    }
+    template<class Archive> void load(Archive &ar)
+    {
+        uint64_t             num_bits;
+        std::vector<uint8_t> bits;
+        ar(cereal::base_class<ObjectWithTimestamp>(this), m_data.first, num_bits, bits);
+        m_data.second.assign(size_t(num_bits), false);
+        for (size_t i = 0; i < m_data.second.size(); ++ i)
+            m_data.second[i] = (bits[i >> 3] >> (i & 7)) & 1;
     }
 
     std::pair<std::vector<std::pair<int, int>>, std::vector<bool>> m_data;
@@ -956,6 +971,8 @@ protected:
 	void 	 assign_new_unique_ids_recursive() override;
     void     transform_this_mesh(const Transform3d& t, bool fix_left_handed);
     void     transform_this_mesh(const Matrix3d& m, bool fix_left_handed);
+    // Make private copies of the mesh and of the convex hull before modifying them in place.
+    void     unshare_mesh();
 
 private:
     // Parent object owning this ModelVolume.
@@ -1321,6 +1338,13 @@ public:
         const std::string& input_file, 
         DynamicPrintConfig* config, ConfigSubstitutionContext* config_substitutions,
         LoadAttributes options = LoadAttribute::AddDefaultInstances);
+    // Plain mesh files (STL, OBJ) may be read in two steps: read_mesh_from_file() does the parsing and it does not create
+    // any ObjectBase, thus it may run on worker threads in parallel. read_from_mesh() makes the Model on the calling thread.
+    static bool         is_mesh_file(const std::string &input_file);
+    static TriangleMesh read_mesh_from_file(const std::string &input_file);
+    static Model        read_from_mesh(
+        const std::string &input_file, TriangleMesh &&mesh,
+        LoadAttributes options = LoadAttribute::AddDefaultInstances);
 
     // Add a new ModelObject to this Model, generate a new ID for this ModelObject.
     ModelObject* add_object();
@@ -1369,6 +1393,9 @@ public:
 
     // Ensures that the min z of the model is not negative
     void 		  adjust_min_z();
+    // Let the volumes with identical meshes share a single TriangleMesh and its convex hull,
+    // for example when a single file was loaded several times or a project contains copies of a part.
+    void          share_identical_meshes();
 
     void 		  print_info() const { for (const ModelObject *o : this->objects) o->print_info(); }
 
@@ -6,6 +6,18 @@
 
 namespace Slic3r {
 
+// The arrange polygon of an instance is the convex hull of its object
+// transformed by everything but the XY offset and the rotation around Z.
+// Instances which share these produce the same hull.
+static bool is_same_arrange_shape(const ModelInstance &a, const ModelInstance &b)
+{
+    return a.get_offset(Z) == b.get_offset(Z) &&
+           a.get_rotation(X) == b.get_rotation(X) &&
+           a.get_rotation(Y) == b.get_rotation(Y) &&
+           a.get_scaling_factor() == b.get_scaling_factor() &&
+           a.get_mirror() == b.get_mirror();
+}
+
 arrangement::ArrangePolygons get_arrange_polys(const Model &model, ModelInstancePtrs &instances)
 {
     size_t count = 0;
@@ -14,11 +26,30 @@ arrangement::ArrangePolygons get_arrange_polys(const Model &model, ModelInstance
     ArrangePolygons input;
     input.reserve(count);
     instances.clear(); instances.reserve(count);
-    for (ModelObject *mo : model.objects)
+    for (ModelObject *mo : model.objects) {
+        // Indices into input of the instances of this object with a
+        // distinct shape, copies of the same object reuse their hull.
+        std::vector<size_t> shapes;
         for (ModelInstance *minst : mo->instances) {
-            input.emplace_back(minst->get_arrange_polygon());
+            auto it = std::find_if(shapes.begin(), shapes.end(),
+                                   [&instances, minst](size_t idx) {
+                                       return is_same_arrange_shape(*instances[idx], *minst);
+                                   });
+
+            if (it == shapes.end()) {
+                shapes.emplace_back(input.size());
+                input.emplace_back(minst->get_arrange_polygon());
+            } else {
+                ArrangePolygon ap;
+                ap.poly.contour = input[*it].poly.contour;
+                ap.translation  = Vec2crd{scaled(minst->get_offset(X)), scaled(minst->get_offset(Y))};
+                ap.rotation     = minst->get_rotation(Z);
+                input.emplace_back(std::move(ap));
+            }
+
             instances.emplace_back(minst);
         }
+    }
     
     return input;
 }
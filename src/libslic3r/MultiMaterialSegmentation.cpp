@@ -79,6 +79,11 @@ struct PaintedLine
     size_t line_idx;
     Line   projected_line;
     int    color;
+
+    bool operator==(const PaintedLine &rhs) const
+    {
+        return contour_idx == rhs.contour_idx && line_idx == rhs.line_idx && projected_line == rhs.projected_line && color == rhs.color;
+    }
 };
 
 struct PaintedLineVisitor
@@ -1829,8 +1834,9 @@ std::vector<std::vector<ExPolygons>> multi_material_segmentation_by_painting(con
     BOOST_LOG_TRIVIAL(debug) << "MMU segmentation - painted layers count: "
                              << std::count_if(painted_lines.begin(), painted_lines.end(), [](const std::vector<PaintedLine> &pl) { return !pl.empty(); });
 
-    BOOST_LOG_TRIVIAL(debug) << "MMU segmentation - layers segmentation in parallel - begin";
-    tbb::parallel_for(tbb::blocked_range<size_t>(0, num_layers), [&edge_grids, &input_expolygons, &painted_lines, &segmented_regions, &num_extruders, &throw_on_cancel_callback](const tbb::blocked_range<size_t> &range) {
+    BOOST_LOG_TRIVIAL(debug) << "MMU segmentation - post-processing of painted lines in parallel - begin";
+    std::vector<std::vector<std::vector<PaintedLine>>> post_processed_painted_lines(num_layers);
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, num_layers), [&edge_grids, &input_expolygons, &painted_lines, &post_processed_painted_lines, &throw_on_cancel_callback](const tbb::blocked_range<size_t> &range) {
         for (size_t layer_idx = range.begin(); layer_idx < range.end(); ++layer_idx) {
             throw_on_cancel_callback();
             if (!painted_lines[layer_idx].empty()) {
@@ -1841,16 +1847,35 @@ std::vector<std::vector<ExPolygons>> multi_material_segmentation_by_painting(con
                 }
 #endif // MMU_SEGMENTATION_DEBUG_PAINTED_LINES
 
-                std::vector<std::vector<PaintedLine>> post_processed_painted_lines = post_process_painted_lines(edge_grids[layer_idx].contours(), std::move(painted_lines[layer_idx]));
+                post_processed_painted_lines[layer_idx] = post_process_painted_lines(edge_grids[layer_idx].contours(), std::move(painted_lines[layer_idx]));
 
 #ifdef MMU_SEGMENTATION_DEBUG_PAINTED_LINES
                 {
                     static int iRun = 0;
-                    export_painted_lines_to_svg(debug_out_path("mm-painted-lines-post-processed-%d-%d.svg", layer_idx, iRun++), post_processed_painted_lines, input_expolygons[layer_idx]);
+                    export_painted_lines_to_svg(debug_out_path("mm-painted-lines-post-processed-%d-%d.svg", layer_idx, iRun++), post_processed_painted_lines[layer_idx], input_expolygons[layer_idx]);
                 }
 #endif // MMU_SEGMENTATION_DEBUG_PAINTED_LINES
+            }
+        }
+    }); // end of parallel_for
+    BOOST_LOG_TRIVIAL(debug) << "MMU segmentation - post-processing of painted lines in parallel - end";
 
-                std::vector<std::vector<ColoredLine>> color_poly = colorize_contours(edge_grids[layer_idx].contours(), post_processed_painted_lines);
+    // Layers with the same outline and the same painted lines as the layer below are not segmented again, see below.
+    // That is typical for the painted vertical walls of prismatic objects.
+    std::vector<char> same_as_layer_below(num_layers, false);
+
+    BOOST_LOG_TRIVIAL(debug) << "MMU segmentation - layers segmentation in parallel - begin";
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, num_layers), [&edge_grids, &input_expolygons, &post_processed_painted_lines, &same_as_layer_below, &segmented_regions, &num_extruders, &throw_on_cancel_callback](const tbb::blocked_range<size_t> &range) {
+        for (size_t layer_idx = range.begin(); layer_idx < range.end(); ++layer_idx) {
+            throw_on_cancel_callback();
+            if (!post_processed_painted_lines[layer_idx].empty()) {
+                if (layer_idx > 0 && post_processed_painted_lines[layer_idx] == post_processed_painted_lines[layer_idx - 1] &&
+                    input_expolygons[layer_idx] == input_expolygons[layer_idx - 1]) {
+                    same_as_layer_below[layer_idx] = true;
+                    continue;
+                }
+
+                std::vector<std::vector<ColoredLine>> color_poly = colorize_contours(edge_grids[layer_idx].contours(), post_processed_painted_lines[layer_idx]);
 
 #ifdef MMU_SEGMENTATION_DEBUG_COLORIZED_POLYGONS
                 {
@@ -1891,6 +1916,13 @@ std::vector<std::vector<ExPolygons>> multi_material_segmentation_by_painting(con
     BOOST_LOG_TRIVIAL(debug) << "MMU segmentation - layers segmentation in parallel - end";
     throw_on_cancel_callback();
 
+    // Layers are processed bottom up, thus the layer below has already been resolved.
+    for (size_t layer_idx = 1; layer_idx < num_layers; ++layer_idx)
+        if (same_as_layer_below[layer_idx])
+            segmented_regions[layer_idx] = segmented_regions[layer_idx - 1];
+    BOOST_LOG_TRIVIAL(debug) << "MMU segmentation - layers reusing segmentation of the layer below: "
+                             << std::count(same_as_layer_below.begin(), same_as_layer_below.end(), true);
+
     if (auto w = print_object.config().mmu_segmented_region_max_width; w > 0.f) {
         cut_segmented_layers(input_expolygons, segmented_regions, float(-scale_(w)), throw_on_cancel_callback);
         throw_on_cancel_callback();
@@ -103,50 +103,75 @@ bool MultiPoint::remove_duplicate_points()
     return false;
 }
 
-std::vector<Point> MultiPoint::_douglas_peucker(const std::vector<Point>& pts, const double tolerance)
+// Douglas-Peucker simplification of pts[0, n), the simplified points are written to out[0, returned count).
+// out may alias pts: a point is only written at or below the index of the current anchor, while the points
+// still to be read (the anchor, the points between anchor and floater and the floaters on dpStack) lie at or above it.
+static size_t douglas_peucker_impl(const Point *pts, size_t n, const double tolerance, Point *out)
 {
-    std::vector<Point> result_pts;
-	double tolerance_sq = tolerance * tolerance;
-    if (! pts.empty()) {
-        const Point  *anchor      = &pts.front();
-        size_t        anchor_idx  = 0;
-        const Point  *floater     = &pts.back();
-        size_t        floater_idx = pts.size() - 1;
-        result_pts.reserve(pts.size());
-        result_pts.emplace_back(*anchor);
-        if (anchor_idx != floater_idx) {
-            assert(pts.size() > 1);
-            std::vector<size_t> dpStack;
-            dpStack.reserve(pts.size());
-            dpStack.emplace_back(floater_idx);
-            for (;;) {
-                double max_dist_sq  = 0.0;
-                size_t furthest_idx = anchor_idx;
-                // find point furthest from line seg created by (anchor, floater) and note it
+    assert(n > 0);
+    const double tolerance_sq = tolerance * tolerance;
+    size_t       anchor_idx   = 0;
+    size_t       floater_idx  = n - 1;
+    size_t       num_out      = 0;
+    out[num_out ++] = pts[anchor_idx];
+    if (anchor_idx != floater_idx) {
+        std::vector<size_t> dpStack;
+        dpStack.reserve(n);
+        dpStack.emplace_back(floater_idx);
+        for (;;) {
+            const Point  anchor       = pts[anchor_idx];
+            const Point  floater      = pts[floater_idx];
+            double       max_dist_sq  = 0.0;
+            size_t       furthest_idx = anchor_idx;
+            // find point furthest from line seg created by (anchor, floater) and note it.
+            // Same as Line::distance_to_squared(pts[i], anchor, floater), with the segment invariants hoisted out of the loop.
+            const Vec2d  v            = (floater - anchor).cast<double>();
+            const double l2           = v.squaredNorm();
+            if (l2 == 0.) {
                 for (size_t i = anchor_idx + 1; i < floater_idx; ++ i) {
-                    double dist_sq = Line::distance_to_squared(pts[i], *anchor, *floater);
+                    double dist_sq = (pts[i] - anchor).cast<double>().squaredNorm();
                     if (dist_sq > max_dist_sq) {
                         max_dist_sq  = dist_sq;
                         furthest_idx = i;
                     }
                 }
-                // remove point if less than tolerance
-                if (max_dist_sq <= tolerance_sq) {
-                    result_pts.emplace_back(*floater);
-                    anchor_idx = floater_idx;
-                    anchor     = floater;
-                    assert(dpStack.back() == floater_idx);
-                    dpStack.pop_back();
-                    if (dpStack.empty())
-                        break;
-                    floater_idx = dpStack.back();
-                } else {
-                    floater_idx = furthest_idx;
-                    dpStack.emplace_back(floater_idx);
+            } else {
+                for (size_t i = anchor_idx + 1; i < floater_idx; ++ i) {
+                    const Vec2d  va = (pts[i] - anchor).cast<double>();
+                    const double t  = va.dot(v) / l2;
+                    double dist_sq  = t <= 0. ? va.squaredNorm() :
+                                      t >= 1. ? (pts[i] - floater).cast<double>().squaredNorm() :
+                                                (t * v - va).squaredNorm();
+                    if (dist_sq > max_dist_sq) {
+                        max_dist_sq  = dist_sq;
+                        furthest_idx = i;
+                    }
                 }
-                floater = &pts[floater_idx];
+            }
+            // remove point if less than tolerance
+            if (max_dist_sq <= tolerance_sq) {
+                out[num_out ++] = floater;
+                anchor_idx = floater_idx;
+                assert(dpStack.back() == floater_idx);
+                dpStack.pop_back();
+                if (dpStack.empty())
+                    break;
+                floater_idx = dpStack.back();
+            } else {
+                floater_idx = furthest_idx;
+                dpStack.emplace_back(floater_idx);
             }
         }
+    }
+    return num_out;
+}
+
+std::vector<Point> MultiPoint::_douglas_peucker(const std::vector<Point>& pts, const double tolerance)
+{
+    std::vector<Point> result_pts;
+    if (! pts.empty()) {
+        result_pts.assign(pts.size(), Point());
+        result_pts.resize(douglas_peucker_impl(pts.data(), pts.size(), tolerance, result_pts.data()));
         assert(result_pts.front() == pts.front());
         assert(result_pts.back()  == pts.back());
 
@@ -171,6 +196,12 @@ std::vector<Point> MultiPoint::_douglas_peucker(const std::vector<Point>& pts, c
     return result_pts;
 }
 
+void MultiPoint::_douglas_peucker_inplace(std::vector<Point> &pts, const double tolerance)
+{
+    if (! pts.empty())
+        pts.erase(pts.begin() + douglas_peucker_impl(pts.data(), pts.size(), tolerance, pts.data()), pts.end());
+}
+
 // Visivalingam simplification algorithm https://github.com/slic3r/Slic3r/pull/3825
 // thanks to @fuchstraumer
 /*
@@ -82,6 +82,8 @@ public:
     }
 
     static Points _douglas_peucker(const Points &points, const double tolerance);
+    // Same as _douglas_peucker(), but simplifies points in place without allocating a new point vector.
+    static void   _douglas_peucker_inplace(Points &points, const double tolerance);
     static Points visivalingam(const Points& pts, const double& tolerance);
 
     inline auto begin()        { return points.begin(); }
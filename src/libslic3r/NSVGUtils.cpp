@@ -5,6 +5,9 @@ using namespace Slic3r;
 
 // inspired by nanosvgrast.h function nsvgRasterize -> nsvg__flattenShape -> nsvg__flattenCubicBez
 // https://github.com/memononen/nanosvg/blob/f0a3e1034dd22e2e87e5db22401e44998383124e/src/nanosvgrast.h#L335
+// Subdivides iteratively with an explicit stack instead of recursion. The subdivision is adaptive:
+// flat segments (all straight SVG segments are stored by nanosvg as degenerate cubics) are emitted at once,
+// only the curved parts are split. Points collapsing onto the previous integer point are dropped.
 void NSVGUtils::flatten_cubic_bez(Polygon &polygon,
                                   float    tessTol,
                                   Vec2f    p1,
@@ -13,29 +16,40 @@ void NSVGUtils::flatten_cubic_bez(Polygon &polygon,
                                   Vec2f    p4,
                                   int      level)
 {
-    Vec2f p12  = (p1 + p2) * 0.5f;
-    Vec2f p23  = (p2 + p3) * 0.5f;
-    Vec2f p34  = (p3 + p4) * 0.5f;
-    Vec2f p123 = (p12 + p23) * 0.5f;
+    struct Segment { Vec2f p1, p2, p3, p4; int level; };
+    // Depth first traversal, the stack never holds more than one pending segment per subdivision level.
+    std::vector<Segment> stack;
+    stack.push_back({ p1, p2, p3, p4, level });
+    while (! stack.empty()) {
+        Segment seg = stack.back();
+        stack.pop_back();
 
-    Vec2f pd  = p4 - p1;
-    Vec2f pd2 = p2 - p4;
-    float d2  = std::abs(pd2.x() * pd.y() - pd2.y() * pd.x());
-    Vec2f pd3 = p3 - p4;
-    float d3  = std::abs(pd3.x() * pd.y() - pd3.y() * pd.x());
-    float d23 = d2 + d3;
+        Vec2f pd  = seg.p4 - seg.p1;
+        Vec2f pd2 = seg.p2 - seg.p4;
+        float d2  = std::abs(pd2.x() * pd.y() - pd2.y() * pd.x());
+        Vec2f pd3 = seg.p3 - seg.p4;
+        float d3  = std::abs(pd3.x() * pd.y() - pd3.y() * pd.x());
+        float d23 = d2 + d3;
 
-    if ((d23 * d23) < tessTol * (pd.x() * pd.x() + pd.y() * pd.y())) {
-        polygon.points.emplace_back(p4.x(), p4.y());
-        return;
-    }
+        if ((d23 * d23) < tessTol * (pd.x() * pd.x() + pd.y() * pd.y())) {
+            Point pt(seg.p4.x(), seg.p4.y());
+            if (polygon.points.empty() || polygon.points.back() != pt)
+                polygon.points.push_back(pt);
+            continue;
+        }
 
-    --level;
-    if (level == 0) return;
-    Vec2f p234  = (p23 + p34) * 0.5f;
-    Vec2f p1234 = (p123 + p234) * 0.5f;
-    flatten_cubic_bez(polygon, tessTol, p1, p12, p123, p1234, level);
-    flatten_cubic_bez(polygon, tessTol, p1234, p234, p34, p4, level);
+        if (-- seg.level == 0)
+            continue;
+        Vec2f p12   = (seg.p1 + seg.p2) * 0.5f;
+        Vec2f p23   = (seg.p2 + seg.p3) * 0.5f;
+        Vec2f p34   = (seg.p3 + seg.p4) * 0.5f;
+        Vec2f p123  = (p12 + p23) * 0.5f;
+        Vec2f p234  = (p23 + p34) * 0.5f;
+        Vec2f p1234 = (p123 + p234) * 0.5f;
+        // Push the second half first, so that the first half is emitted first.
+        stack.push_back({ p1234, p234, p34, seg.p4, seg.level });
+        stack.push_back({ seg.p1, p12, p123, p1234, seg.level });
+    }
 }
 
 Polygons NSVGUtils::to_polygons(NSVGimage *image, float tessTol, int max_level)
@@ -49,9 +63,11 @@ Polygons NSVGUtils::to_polygons(NSVGimage *image, float tessTol, int max_level)
             for (NSVGpath *path = shape->paths; path != NULL;
                  path           = path->next) {
                 // Flatten path
-                polygon.points.emplace_back(path->pts[0], path->pts[1]);
                 size_t path_size = (path->npts > 1) ?
                     static_cast<size_t>(path->npts - 1) : 0;
+                // At least one point per cubic segment.
+                polygon.points.reserve(polygon.points.size() + 1 + path_size / 3);
+                polygon.points.emplace_back(path->pts[0], path->pts[1]);
                 for (size_t i = 0; i < path_size; i += 3) {
                     float *p = &path->pts[i * 2];
                     Vec2f  p1(p[0], p[1]), p2(p[2], p[3]), p3(p[4], p[5]),
@@ -60,13 +76,13 @@ Polygons NSVGUtils::to_polygons(NSVGimage *image, float tessTol, int max_level)
                                       max_level);
                 }
                 if (path->closed && !polygon.empty()) {
-                    polygons.push_back(polygon);
+                    polygons.push_back(std::move(polygon));
                     polygon = Slic3r::Polygon();
                 }
             }
         }
         if (!polygon.empty())
-            polygons.push_back(polygon);
+            polygons.push_back(std::move(polygon));
     }
     return polygons;
 }
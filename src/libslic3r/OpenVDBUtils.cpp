@@ -17,6 +17,8 @@
 #include <openvdb/tools/LevelSetRebuild.h>
 #include <openvdb/tools/FastSweeping.h>
 
+#include "libslic3r/Execution/ExecutionTBB.hpp"
+
 namespace Slic3r {
 
 struct VoxelGrid
@@ -104,15 +106,27 @@ VoxelGridPtr mesh_to_grid(const indexed_triangle_set &mesh,
 
     Interrupter interrupter{params.statusfn()};
 
-    openvdb::FloatGrid::Ptr grid;
-    for (auto &m : meshparts) {
-        auto subgrid = openvdb::tools::meshToVolume<openvdb::FloatGrid>(
-            interrupter,
-            TriangleMeshDataAdapter{m, trafo},
-            openvdb::math::Transform{},
-            params.exterior_bandwidth(),
-            params.interior_bandwidth());
+    // The parts are converted concurrently, which pays off for models split
+    // into many small parts. The union is done in the order of the parts.
+    std::vector<openvdb::FloatGrid::Ptr> subgrids(meshparts.size());
+    execution::for_each(
+        ex_tbb, size_t(0), meshparts.size(),
+        [&meshparts, &subgrids, &trafo, &params](size_t i) {
+            Interrupter part_interrupter{params.statusfn()};
+            if (part_interrupter.wasInterrupted())
+                return;
+
+            subgrids[i] = openvdb::tools::meshToVolume<openvdb::FloatGrid>(
+                part_interrupter,
+                TriangleMeshDataAdapter{meshparts[i], trafo},
+                openvdb::math::Transform{},
+                params.exterior_bandwidth(),
+                params.interior_bandwidth());
+        },
+        execution::max_concurrency(ex_tbb));
 
+    openvdb::FloatGrid::Ptr grid;
+    for (auto &subgrid : subgrids) {
         if (interrupter.wasInterrupted())
             break;
 
@@ -120,6 +134,8 @@ VoxelGridPtr mesh_to_grid(const indexed_triangle_set &mesh,
             openvdb::tools::csgUnion(*grid, *subgrid);
         else if (subgrid)
             grid = std::move(subgrid);
+
+        subgrid.reset();
     }
 
     if (interrupter.wasInterrupted())
@@ -1,5 +1,10 @@
 #include "PNGReadWrite.hpp"
 
+#include "miniz_extension.hpp"
+#include "Execution/ExecutionTBB.hpp"
+
+#include <algorithm>
+#include <atomic>
 #include <memory>
 
 #include <cstdio>
@@ -100,6 +105,114 @@ bool decode_png(IStream &in_buf, ImageGreyscale &out_img)
     return true;
 }
 
+static void append_be32(std::vector<uint8_t> &out, uint32_t v)
+{
+    for (int shift = 24; shift >= 0; shift -= 8)
+        out.emplace_back(uint8_t(v >> shift));
+}
+
+static void append_png_chunk(std::vector<uint8_t> &out, const char *type, const uint8_t *data, size_t len)
+{
+    append_be32(out, uint32_t(len));
+    size_t start = out.size();
+    out.insert(out.end(), type, type + 4);
+    if (len > 0)
+        out.insert(out.end(), data, data + len);
+    append_be32(out, uint32_t(mz_crc32(MZ_CRC32_INIT, out.data() + start, len + 4)));
+}
+
+// Compress the data into a raw deflate stream. A non final chunk is terminated by a sync flush,
+// which aligns the stream to a byte boundary, thus the compressed chunks may be concatenated.
+static bool deflate_chunk(const uint8_t *data, size_t len, bool final, int flags, std::vector<uint8_t> &out)
+{
+    // The compressor state is a few hundred kilobytes, don't zero it.
+    std::unique_ptr<tdefl_compressor> comp(new tdefl_compressor);
+    auto put = [](const void *buf, int len, void *user) -> mz_bool {
+        auto &out = *static_cast<std::vector<uint8_t>*>(user);
+        auto  ptr = static_cast<const uint8_t*>(buf);
+        out.insert(out.end(), ptr, ptr + len);
+        return MZ_TRUE;
+    };
+    if (tdefl_init(comp.get(), put, &out, flags) != TDEFL_STATUS_OKAY)
+        return false;
+    tdefl_status status = tdefl_compress_buffer(comp.get(), data, len, final ? TDEFL_FINISH : TDEFL_SYNC_FLUSH);
+    return status == (final ? TDEFL_STATUS_DONE : TDEFL_STATUS_OKAY);
+}
+
+static std::vector<uint8_t> encode_png_fast(const uint8_t *data, size_t width, size_t height, size_t num_components, bool flip)
+{
+    static constexpr uint8_t color_types[] = { 0, 4, 2, 6 };
+
+    // Filter the rows by the Up filter: identical rows of a mask turn into zeros.
+    const size_t stride = width * num_components;
+    std::vector<uint8_t> filtered((stride + 1) * height);
+    execution::for_each(ex_tbb, size_t(0), height, [&](size_t y) {
+        const uint8_t *row  = data + (flip ? height - 1 - y : y) * stride;
+        const uint8_t *prev = y == 0 ? nullptr : data + (flip ? height - y : y - 1) * stride;
+        uint8_t       *out  = filtered.data() + y * (stride + 1);
+        *out ++ = 2;
+        for (size_t x = 0; x < stride; ++ x)
+            out[x] = prev ? uint8_t(row[x] - prev[x]) : row[x];
+    }, std::max(size_t(1), height / (8 * execution::max_concurrency(ex_tbb))));
+
+    // Compress chunks of whole rows in parallel, at least 256kB each.
+    const size_t min_chunk = 256 * 1024;
+    const size_t nchunks   = std::clamp(filtered.size() / min_chunk, size_t(1), execution::max_concurrency(ex_tbb));
+    const size_t chunk_rows = (height + nchunks - 1) / nchunks;
+    const int    flags      = int(tdefl_create_comp_flags_from_zip_params(MZ_BEST_SPEED, -MZ_DEFAULT_WINDOW_BITS, MZ_DEFAULT_STRATEGY));
+    std::vector<std::vector<uint8_t>> chunks(nchunks);
+    std::atomic<bool> failed { false };
+    execution::for_each(ex_tbb, size_t(0), nchunks, [&](size_t i) {
+        size_t from = std::min(height, i * chunk_rows) * (stride + 1);
+        size_t to   = std::min(height, (i + 1) * chunk_rows) * (stride + 1);
+        if (! deflate_chunk(filtered.data() + from, to - from, i + 1 == nchunks, flags, chunks[i]))
+            failed = true;
+    });
+    if (failed)
+        return {};
+
+    std::vector<uint8_t> idat;
+    // zlib header: deflate with a 32kB window, fastest compression.
+    idat.emplace_back(0x78);
+    idat.emplace_back(0x01);
+    for (const std::vector<uint8_t> &chunk : chunks)
+        idat.insert(idat.end(), chunk.begin(), chunk.end());
+    append_be32(idat, uint32_t(mz_adler32(MZ_ADLER32_INIT, filtered.data(), filtered.size())));
+
+    std::vector<uint8_t> ihdr;
+    append_be32(ihdr, uint32_t(width));
+    append_be32(ihdr, uint32_t(height));
+    ihdr.insert(ihdr.end(), { 8, color_types[num_components - 1], 0, 0, 0 });
+
+    static constexpr uint8_t signature[] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+    std::vector<uint8_t> out;
+    out.reserve(idat.size() + 64);
+    out.insert(out.end(), std::begin(signature), std::end(signature));
+    append_png_chunk(out, "IHDR", ihdr.data(), ihdr.size());
+    append_png_chunk(out, "IDAT", idat.data(), idat.size());
+    append_png_chunk(out, "IEND", nullptr, 0);
+    return out;
+}
+
+std::vector<uint8_t> encode_png(const uint8_t *data, size_t width, size_t height, size_t num_components, EncodeMode mode, bool flip)
+{
+    if (width == 0 || height == 0 || num_components < 1 || num_components > 4)
+        return {};
+
+    if (mode == EncodeMode::Fast)
+        return encode_png_fast(data, width, height, num_components, flip);
+
+    size_t size = 0;
+    void  *png  = tdefl_write_image_to_png_file_in_memory_ex(data, int(width), int(height), int(num_components), &size, MZ_DEFAULT_LEVEL, flip);
+    if (png == nullptr)
+        return {};
+
+    auto ptr = static_cast<const uint8_t*>(png);
+    std::vector<uint8_t> out(ptr, ptr + size);
+    mz_free(png);
+    return out;
+}
+
 // Down to earth function to store a packed RGB image to file. Mostly useful for debugging purposes.
 // Based on https://www.lemoda.net/c/write-png/
 // png_color_type is PNG_COLOR_TYPE_RGB or PNG_COLOR_TYPE_GRAY
@@ -65,6 +65,20 @@ template<class Img> bool decode_png(const ReadBuf &in_buf, Img &out_img)
 
 // TODO: std::istream of FILE* could be similarly adapted in case its needed...
 
+enum class EncodeMode {
+    // Default deflate level without filtering, as tdefl_write_image_to_png_file_in_memory() of miniz.
+    Default,
+    // Fastest deflate level and the Up filter, which suits the masks of large uniform areas
+    // as the SLA layers. Chunks of rows are compressed in parallel, at the cost of a slightly larger file.
+    Fast
+};
+
+// Encode an 8 bit image of 1 (gray), 2 (gray + alpha), 3 (RGB) or 4 (RGBA) components per pixel
+// stored row after row into a png in memory, optionally flipping it vertically.
+// Returns an empty buffer on error.
+std::vector<uint8_t> encode_png(const uint8_t *data, size_t width, size_t height, size_t num_components,
+                                EncodeMode mode = EncodeMode::Default, bool flip = false);
+
 
 
 // Down to earth function to store a packed RGB image to file. Mostly useful for debugging purposes.
@@ -42,6 +42,8 @@
 #include <utility>
 #include <vector>
 
+#include <boost/functional/hash.hpp>
+
 // #define ARACHNE_DEBUG
 
 #ifdef ARACHNE_DEBUG
@@ -661,11 +663,9 @@ static void export_perimeters_to_svg(const std::string &path, const Polygons &co
 #endif
 
 // find out if paths touch - at least one point of one path is within limit distance of second path
-bool paths_touch(const ExtrusionPath &path_one, const ExtrusionPath &path_two, double limit_distance)
+static bool paths_touch(const ExtrusionPath &path_one, const AABBTreeLines::LinesDistancer<Line> &lines_one,
+                        const ExtrusionPath &path_two, const AABBTreeLines::LinesDistancer<Line> &lines_two, double limit_distance)
 {
-    AABBTreeLines::LinesDistancer<Line> lines_one{path_one.as_polyline().lines()};
-    AABBTreeLines::LinesDistancer<Line> lines_two{path_two.as_polyline().lines()};
-
     for (size_t pt_idx = 0; pt_idx < path_one.polyline.size(); pt_idx++) {
         if (lines_two.distance_from_lines<false>(path_one.polyline.points[pt_idx]) < limit_distance) { return true; }
     }
@@ -745,7 +745,22 @@ ExtrusionPaths sort_and_connect_extra_perimeters(const std::vector<ExtrusionPath
         size_t operator()(const Pidx &i) const { return std::hash<size_t>{}(i.shell) ^ std::hash<size_t>{}(i.path); }
     };
 
-    auto get_path = [&](Pidx i) { return connected_shells[i.shell][i.path]; };
+    auto get_path = [&](Pidx i) -> const ExtrusionPath& { return connected_shells[i.shell][i.path]; };
+
+    // The distancers of the paths are built once, not for each pair of paths tested. A pair of paths is only tested
+    // if their bounding boxes inflated by the touch distance overlap, which rejects most of the pairs of a large overhang.
+    const double touch_distance = extrusion_spacing * 1.5f;
+    struct PathLines
+    {
+        BoundingBox                         bbox;
+        AABBTreeLines::LinesDistancer<Line> lines;
+    };
+    std::vector<std::vector<PathLines>> shell_lines(connected_shells.size());
+    if (connected_shells.size() > 1)
+        for (size_t shell = 0; shell < connected_shells.size(); shell++)
+            for (const ExtrusionPath &path : connected_shells[shell])
+                shell_lines[shell].push_back({ get_extents(path.polyline).inflated(touch_distance),
+                                               AABBTreeLines::LinesDistancer<Line>{ path.as_polyline().lines() } });
 
     std::vector<std::unordered_map<Pidx, std::unordered_set<Pidx, PidxHash>, PidxHash>> dependencies;
     for (size_t shell = 0; shell < connected_shells.size(); shell++) {
@@ -755,9 +770,13 @@ ExtrusionPaths sort_and_connect_extra_perimeters(const std::vector<ExtrusionPath
             Pidx                               current_path{shell, path};
             std::unordered_set<Pidx, PidxHash> current_dependencies{};
             if (shell > 0) {
-                for (const auto &prev_path : dependencies[shell - 1]) {
-                    if (paths_touch(get_path(current_path), get_path(prev_path.first), extrusion_spacing * 1.5f)) {
-                        current_dependencies.insert(prev_path.first);
+                const PathLines &current_lines = shell_lines[shell][path];
+                for (size_t prev = 0; prev < connected_shells[shell - 1].size(); prev++) {
+                    Pidx             prev_path{shell - 1, prev};
+                    const PathLines &prev_lines = shell_lines[shell - 1][prev];
+                    if (current_lines.bbox.overlap(prev_lines.bbox) &&
+                        paths_touch(get_path(current_path), current_lines.lines, get_path(prev_path), prev_lines.lines, touch_distance)) {
+                        current_dependencies.insert(prev_path);
                     };
                 }
             }
@@ -908,9 +927,11 @@ std::tuple<std::vector<ExtrusionPaths>, Polygons> generate_extra_perimeters_over
                                                                                         deltas[i + 1], EXTRA_PERIMETER_OFFSET_PARAMETERS));
         }
 
-        for (size_t i = 0; i < anchor_areas_w_delta_anchor_size.size(); i++) {
-            inset_anchors = union_(inset_anchors,  anchor_areas_w_delta_anchor_size[i]);
-        }
+        // All the anchor areas are united at once instead of accumulating them by a union per area.
+        Polygons all_anchor_areas;
+        for (const Polygons &anchor_area : anchor_areas_w_delta_anchor_size)
+            append(all_anchor_areas, anchor_area);
+        inset_anchors = union_(all_anchor_areas);
 
         inset_anchors = expand(inset_anchors, 0.1*overhang_flow.scaled_width());
 
@@ -1084,6 +1105,59 @@ std::tuple<std::vector<ExtrusionPaths>, Polygons> generate_extra_perimeters_over
     return {result, diff(inset_overhang_area, inset_overhang_area_left_unfilled)};
 }
 
+Polygons PerimeterGenerator::lower_slices_for_overhangs(const Parameters &params, const ExPolygons *lower_slices)
+{
+    if (! params.config.overhangs || lower_slices == nullptr)
+        return {};
+    // We consider overhang any part where the entire nozzle diameter is not supported by the
+    // lower layer, so we take lower slices and offset them by half the nozzle diameter used
+    // in the current layer
+    double nozzle_diameter = params.print_config.nozzle_diameter.get_at(params.config.perimeter_extruder-1);
+    return offset(*lower_slices, float(scale_(+nozzle_diameter/2)));
+}
+
+void PerimeterGenerator::ArachneCache::Key::update_hash()
+{
+    hash = 0;
+    boost::hash_combine(hash, bead_width_0);
+    boost::hash_combine(hash, bead_width_x);
+    boost::hash_combine(hash, inset_count);
+    boost::hash_combine(hash, layer_height);
+    for (const Polygon &polygon : outline) {
+        boost::hash_combine(hash, polygon.points.size());
+        for (const Point &pt : polygon.points) {
+            boost::hash_combine(hash, pt.x());
+            boost::hash_combine(hash, pt.y());
+        }
+    }
+}
+
+bool PerimeterGenerator::ArachneCache::Key::operator==(const Key &rhs) const
+{
+    return hash == rhs.hash && bead_width_0 == rhs.bead_width_0 && bead_width_x == rhs.bead_width_x && inset_count == rhs.inset_count &&
+           layer_height == rhs.layer_height && outline == rhs.outline;
+}
+
+std::shared_ptr<const PerimeterGenerator::ArachneCache::Value> PerimeterGenerator::ArachneCache::find(const Key &key) const
+{
+    std::scoped_lock<std::mutex> lock(m_mutex);
+    // Search the most recent entries first, the identical layers are usually next to each other.
+    for (auto it = m_entries.rbegin(); it != m_entries.rend(); ++ it)
+        if (it->first == key) {
+            ++ m_hits;
+            return it->second;
+        }
+    return nullptr;
+}
+
+void PerimeterGenerator::ArachneCache::insert(Key &&key, std::shared_ptr<const Value> value)
+{
+    std::scoped_lock<std::mutex> lock(m_mutex);
+    if (m_entries.size() >= m_max_entries)
+        m_entries.pop_front();
+    m_entries.emplace_back(std::move(key), std::move(value));
+}
+
 // Thanks, Cura developers, for implementing an algorithm for generating perimeters with variable width (Arachne) that is based on the paper
 // "A framework for adaptive width control of dense contour-parallel toolpaths in fused deposition modeling"
 void PerimeterGenerator::process_arachne(
@@ -1091,8 +1165,8 @@ void PerimeterGenerator::process_arachne(
     const Parameters           &params,
     const Surface              &surface,
     const ExPolygons           *lower_slices,
-    // Cache:
-    Polygons                   &lower_slices_polygons_cache,
+    // Lower slices grown for overhang detection, see lower_slices_for_overhangs().
+    const Polygons             &lower_slices_polygons_cache,
     // Output:
     // Loops with the external thin walls
     ExtrusionEntityCollection  &out_loops,
@@ -1110,15 +1184,6 @@ void PerimeterGenerator::process_arachne(
     // solid infill
     coord_t solid_infill_spacing  = params.solid_infill_flow.scaled_spacing();
 
-    // prepare grown lower layer slices for overhang detection
-    if (params.config.overhangs && lower_slices != nullptr && lower_slices_polygons_cache.empty()) {
-        // We consider overhang any part where the entire nozzle diameter is not supported by the
-        // lower layer, so we take lower slices and offset them by half the nozzle diameter used
-        // in the current layer
-        double nozzle_diameter = params.print_config.nozzle_diameter.get_at(params.config.perimeter_extruder-1);
-        lower_slices_polygons_cache = offset(*lower_slices, float(scale_(+nozzle_diameter/2)));
-    }
-
     // we need to process each island separately because we might have different
     // extra perimeters for each one
     // detect how many perimeters must be generated for this island
@@ -1126,14 +1191,31 @@ void PerimeterGenerator::process_arachne(
     ExPolygons last        = offset_ex(surface.expolygon.simplify_p(params.scaled_resolution), - float(ext_perimeter_width / 2. - ext_perimeter_spacing / 2.));
     Polygons   last_p      = to_polygons(last);
 
-    Arachne::WallToolPaths wallToolPaths(last_p, ext_perimeter_spacing, perimeter_spacing, coord_t(loop_number + 1), 0, params.layer_height, params.object_config, params.print_config);
-    std::vector<Arachne::VariableWidthLines> perimeters = wallToolPaths.getToolPaths();
+    std::vector<Arachne::VariableWidthLines> perimeters;
+    Polygons                                 inner_contour;
+    ArachneCache::Key                        cache_key;
+    std::shared_ptr<const ArachneCache::Value> cached;
+    if (params.arachne_cache) {
+        cache_key = ArachneCache::Key{ last_p, ext_perimeter_spacing, perimeter_spacing, size_t(loop_number + 1), params.layer_height };
+        cache_key.update_hash();
+        cached = params.arachne_cache->find(cache_key);
+    }
+    if (cached) {
+        perimeters    = cached->perimeters;
+        inner_contour = cached->inner_contour;
+    } else {
+        Arachne::WallToolPaths wallToolPaths(last_p, ext_perimeter_spacing, perimeter_spacing, coord_t(loop_number + 1), 0, params.layer_height, params.object_config, params.print_config);
+        perimeters    = wallToolPaths.getToolPaths();
+        inner_contour = wallToolPaths.getInnerContour();
+        if (params.arachne_cache)
+            params.arachne_cache->insert(std::move(cache_key), std::make_shared<const ArachneCache::Value>(ArachneCache::Value{ perimeters, inner_contour }));
+    }
     loop_number = int(perimeters.size()) - 1;
 
 #ifdef ARACHNE_DEBUG
     {
         static int iRun = 0;
-        export_perimeters_to_svg(debug_out_path("arachne-perimeters-%d-%d.svg", layer_id, iRun++), to_polygons(last), perimeters, union_ex(wallToolPaths.getInnerContour()));
+        export_perimeters_to_svg(debug_out_path("arachne-perimeters-%d-%d.svg", layer_id, iRun++), to_polygons(last), perimeters, union_ex(inner_contour));
     }
 #endif
 
@@ -1280,7 +1362,7 @@ void PerimeterGenerator::process_arachne(
     if (ExtrusionEntityCollection extrusion_coll = traverse_extrusions(params, lower_slices_polygons_cache, ordered_extrusions); !extrusion_coll.empty())
         out_loops.append(extrusion_coll);
 
-    ExPolygons    infill_contour = union_ex(wallToolPaths.getInnerContour());
+    ExPolygons    infill_contour = union_ex(inner_contour);
     const coord_t spacing        = (perimeters.size() == 1) ? ext_perimeter_spacing2 : perimeter_spacing;
     if (offset_ex(infill_contour, -float(spacing / 2.)).empty())
         infill_contour.clear(); // Infill region is too small, so let's filter it out.
@@ -1336,8 +1418,8 @@ void PerimeterGenerator::process_classic(
     const Parameters           &params,
     const Surface              &surface,
     const ExPolygons           *lower_slices,
-    // Cache:
-    Polygons                   &lower_slices_polygons_cache,
+    // Lower slices grown for overhang detection, see lower_slices_for_overhangs().
+    const Polygons             &lower_slices_polygons_cache,
     // Output:
     // Loops with the external thin walls
     ExtrusionEntityCollection  &out_loops,
@@ -1370,15 +1452,6 @@ void PerimeterGenerator::process_classic(
     coord_t ext_min_spacing     = coord_t(ext_perimeter_spacing  * (1 - INSET_OVERLAP_TOLERANCE));
     bool    has_gap_fill 		= params.config.gap_fill_enabled.value && params.config.gap_fill_speed.value > 0;
 
-    // prepare grown lower layer slices for overhang detection
-    if (params.config.overhangs && lower_slices != nullptr && lower_slices_polygons_cache.empty()) {
-        // We consider overhang any part where the entire nozzle diameter is not supported by the
-        // lower layer, so we take lower slices and offset them by half the nozzle diameter used 
-        // in the current layer
-        double nozzle_diameter = params.print_config.nozzle_diameter.get_at(params.config.perimeter_extruder-1);
-        lower_slices_polygons_cache = offset(*lower_slices, float(scale_(+nozzle_diameter/2)));
-    }
-
     // we need to process each island separately because we might have different
     // extra perimeters for each one
     // detect how many perimeters must be generated for this island
@@ -1424,6 +1497,12 @@ void PerimeterGenerator::process_classic(
                 //FIXME Is this offset correct if the line width of the inner perimeters differs
                 // from the line width of the infill?
                 coord_t distance = (i == 1) ? ext_perimeter_spacing2 : perimeter_spacing;
+                // The next shell and the gap fill boundary are both offsetted from the last shell,
+                // offset both in a single pass over the last shell.
+                std::vector<float> deltas { params.config.thin_walls ? - float(distance + min_spacing / 2. - 1.) : - float(distance) };
+                if (has_gap_fill)
+                    deltas.emplace_back(- float(0.5 * distance));
+                std::vector<Polygons> shells = offset_multiple(last, deltas);
                 offsets = params.config.thin_walls ?
                     // This path will ensure, that the perimeters do not overfill, as in 
                     // prusa3d/Slic3r GH #32, but with the cost of rounding the perimeters
@@ -1431,20 +1510,18 @@ void PerimeterGenerator::process_classic(
                     // reliable gap fill algorithm.
                     // Also the offset2(perimeter, -x, x) may sometimes lead to a perimeter, which is larger than
                     // the original.
-                    offset2_ex(last,
-                            - float(distance + min_spacing / 2. - 1.),
-                            float(min_spacing / 2. - 1.)) :
+                    offset_ex(shells.front(), float(min_spacing / 2. - 1.)) :
                     // If "detect thin walls" is not enabled, this paths will be entered, which 
                     // leads to overflows, as in prusa3d/Slic3r GH #32
-                    offset_ex(last, - float(distance));
+                    union_ex(shells.front());
                 // look for gaps
                 if (has_gap_fill)
                     // not using safety offset here would "detect" very narrow gaps
                     // (but still long enough to escape the area threshold) that gap fill
                     // won't be able to fill but we'd still remove from infill area
                     append(gaps, diff_ex(
-                        offset(last,    - float(0.5 * distance)),
-                        offset(offsets,   float(0.5 * distance + 10))));  // safety offset
+                        shells.back(),
+                        offset(offsets, float(0.5 * distance + 10))));  // safety offset
             }
             if (offsets.empty()) {
                 // Store the number of loops actually generated.
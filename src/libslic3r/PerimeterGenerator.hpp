@@ -8,12 +8,56 @@
 #include "Polygon.hpp"
 #include "PrintConfig.hpp"
 #include "SurfaceCollection.hpp"
+#include "Arachne/utils/ExtrusionLine.hpp"
+
+#include <deque>
+#include <memory>
+#include <mutex>
 
 namespace Slic3r {
 
 namespace PerimeterGenerator
 {
 
+// Cache of Arachne perimeters shared by all layers of a PrintObject while generating its perimeters.
+// Prismatic objects produce long runs of layers with bit identical outlines, for which the skeletal trapezoidation
+// is then calculated just once. The cache is thread safe, it retains a limited number of the most recent entries.
+class ArachneCache
+{
+public:
+    // All the inputs of Arachne::WallToolPaths, which are not constant over a PrintObject.
+    struct Key {
+        Polygons    outline;
+        coord_t     bead_width_0;
+        coord_t     bead_width_x;
+        size_t      inset_count;
+        coordf_t    layer_height;
+        size_t      hash { 0 };
+
+        void        update_hash();
+        bool        operator==(const Key &rhs) const;
+    };
+    struct Value {
+        std::vector<Arachne::VariableWidthLines> perimeters;
+        Polygons                                 inner_contour;
+    };
+
+    explicit ArachneCache(size_t max_entries = 64) : m_max_entries(max_entries) {}
+
+    // Returns nullptr if the key is not cached.
+    std::shared_ptr<const Value> find(const Key &key) const;
+    void                         insert(Key &&key, std::shared_ptr<const Value> value);
+    // Number of the successful find() calls.
+    size_t                       hits() const { std::scoped_lock<std::mutex> lock(m_mutex); return m_hits; }
+
+private:
+    size_t                                                   m_max_entries;
+    mutable std::mutex                                       m_mutex;
+    mutable size_t                                           m_hits { 0 };
+    // Oldest entries first.
+    std::deque<std::pair<Key, std::shared_ptr<const Value>>> m_entries;
+};
+
 struct Parameters {    
     Parameters(
         double                      layer_height,
@@ -61,17 +105,24 @@ struct Parameters {
     double                       mm3_per_mm;
     double                       mm3_per_mm_overhang;
 
+    // Optional cache of Arachne perimeters, shared by the layers of a PrintObject.
+    ArachneCache                *arachne_cache { nullptr };
+
 private:
     Parameters() = delete;
 };
 
+// Grow the lower layer slices for overhang detection, returns empty polygons if overhang detection is disabled.
+// Calculated once per layer region and shared by process_classic() / process_arachne() of its islands.
+Polygons lower_slices_for_overhangs(const Parameters &params, const ExPolygons *lower_slices);
+
 void process_classic(
     // Inputs:
     const Parameters           &params,
     const Surface              &surface,
     const ExPolygons           *lower_slices,
-    // Cache:
-    Polygons                   &lower_slices_polygons_cache,
+    // Lower slices grown for overhang detection, see lower_slices_for_overhangs().
+    const Polygons             &lower_slices_polygons_cache,
     // Output:
     // Loops with the external thin walls
     ExtrusionEntityCollection  &out_loops,
@@ -85,8 +136,8 @@ void process_arachne(
     const Parameters           &params,
     const Surface              &surface,
     const ExPolygons           *lower_slices,
-    // Cache:
-    Polygons                   &lower_slices_polygons_cache,
+    // Lower slices grown for overhang detection, see lower_slices_for_overhangs().
+    const Polygons             &lower_slices_polygons_cache,
     // Output:
     // Loops with the external thin walls
     ExtrusionEntityCollection  &out_loops,
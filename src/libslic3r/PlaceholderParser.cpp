@@ -1435,8 +1435,25 @@ namespace client
     };
 }
 
+// Most of the custom G-code templates and the wipe tower G-code contain no macro at all.
+// Such a template evaluates to itself with the leading white spaces skipped, thus it does not need to be parsed.
+// Only 7bit ASCII templates are considered, the rest is validated by the UTF-8 parser of the macro processor.
+static bool is_plain_text_template(const std::string &templ)
+{
+    for (char c : templ)
+        if (c == '[' || c == '{' || static_cast<unsigned char>(c) >= 0x80)
+            return false;
+    return true;
+}
+
 static std::string process_macro(const std::string &templ, client::MyContext &context)
 {
+    if (! context.just_boolean_expression && is_plain_text_template(templ)) {
+        // Skip white spaces the same way the phrase_parse() skipper does.
+        auto it = std::find_if(templ.begin(), templ.end(), [](char c){ return ! spirit::char_encoding::iso8859_1::isspace(c); });
+        return std::string(it, templ.end());
+    }
+
     typedef std::string::const_iterator iterator_type;
     typedef client::macro_processor<iterator_type> macro_processor;
 
@@ -94,9 +94,8 @@ bool Polygon::make_clockwise()
 void Polygon::douglas_peucker(double tolerance)
 {
     this->points.push_back(this->points.front());
-    Points p = MultiPoint::_douglas_peucker(this->points, tolerance);
-    p.pop_back();
-    this->points = std::move(p);
+    MultiPoint::_douglas_peucker_inplace(this->points, tolerance);
+    this->points.pop_back();
 }
 
 Polygons Polygon::simplify(double tolerance) const
@@ -106,9 +105,9 @@ Polygons Polygon::simplify(double tolerance) const
 
     // repeat first point at the end in order to apply Douglas-Peucker
     // on the whole polygon
-    Points points = this->points;
-    points.push_back(points.front());
-    Polygon p(MultiPoint::_douglas_peucker(points, tolerance));
+    Polygon p(this->points);
+    p.points.push_back(p.points.front());
+    MultiPoint::_douglas_peucker_inplace(p.points, tolerance);
     p.points.pop_back();
     
     Polygons pp;
@@ -110,7 +110,7 @@ Points Polyline::equally_spaced_points(double distance) const
 
 void Polyline::simplify(double tolerance)
 {
-    this->points = MultiPoint::_douglas_peucker(this->points, tolerance);
+    MultiPoint::_douglas_peucker_inplace(this->points, tolerance);
 }
 
 #if 0
@@ -22,6 +22,7 @@
 
 #include <algorithm>
 #include <fstream>
+#include <optional>
 #include <stdexcept>
 #include <unordered_map>
 #include <boost/format.hpp>
@@ -39,6 +40,9 @@
 #include <boost/locale.hpp>
 #include <boost/log/trivial.hpp>
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
 #include "libslic3r.h"
 #include "Utils.hpp"
 #include "PlaceholderParser.hpp"
@@ -459,7 +463,7 @@ static std::vector<std::string> s_Preset_print_options {
     "ooze_prevention", "standby_temperature_delta", "interface_shells", "extrusion_width", "first_layer_extrusion_width",
     "perimeter_extrusion_width", "external_perimeter_extrusion_width", "infill_extrusion_width", "solid_infill_extrusion_width",
     "top_infill_extrusion_width", "support_material_extrusion_width", "infill_overlap", "infill_anchor", "infill_anchor_max", "bridge_flow_ratio",
-    "elefant_foot_compensation", "xy_size_compensation", "threads", "resolution", "gcode_resolution", "wipe_tower", "wipe_tower_x", "wipe_tower_y",
+    "elefant_foot_compensation", "xy_size_compensation", "threads", "resolution", "gcode_resolution", "arc_fitting", "wipe_tower", "wipe_tower_x", "wipe_tower_y",
     "wipe_tower_width", "wipe_tower_rotation_angle", "wipe_tower_brim_width", "wipe_tower_bridging", "single_extruder_multi_material_priming", "mmu_segmented_region_max_width",
     "wipe_tower_no_sparse_layers", "compatible_printers", "compatible_printers_condition", "inherits",
     "perimeter_generator", "wall_transition_length", "wall_transition_filter_deviation", "wall_transition_angle",
@@ -694,6 +698,8 @@ void PresetCollection::load_presets(
     // Store the loaded presets into a new vector, otherwise the binary search for already existing presets would be broken.
     // (see the "Preset already present, not loading" message).
     std::deque<Preset> presets_loaded;
+    // Collect the preset files first, then parse them in parallel and merge the results in the directory order.
+    std::vector<std::pair<std::string, std::string>> preset_files;
     for (auto &dir_entry : boost::filesystem::directory_iterator(dir))
         if (Slic3r::is_ini_file(dir_entry)) {
             std::string name = dir_entry.path().filename().string();
@@ -705,15 +711,24 @@ void PresetCollection::load_presets(
                 BOOST_LOG_TRIVIAL(warning) << "Preset already present, not loading: " << name;
                 continue;
             }
+            preset_files.emplace_back(std::move(name), dir_entry.path().string());
+        }
+    struct PresetFileLoaded {
+        std::optional<Preset>   preset;
+        ConfigSubstitutions     config_substitutions;
+        std::string             error;
+    };
+    std::vector<PresetFileLoaded> preset_files_loaded(preset_files.size());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, preset_files.size(), 1), [this, &preset_files, &preset_files_loaded, substitution_rule](const tbb::blocked_range<size_t> &range) {
+        for (size_t idx = range.begin(); idx < range.end(); ++ idx) {
+            PresetFileLoaded &out = preset_files_loaded[idx];
             try {
-                Preset preset(m_type, name, false);
-                preset.file = dir_entry.path().string();
+                Preset preset(m_type, preset_files[idx].first, false);
+                preset.file = preset_files[idx].second;
                 // Load the preset file, apply preset values on top of defaults.
                 try {
                     DynamicPrintConfig config;
-                    ConfigSubstitutions config_substitutions = config.load_from_ini(preset.file, substitution_rule);
-                    if (! config_substitutions.empty())
-                        substitutions.push_back({ preset.name, m_type, PresetConfigSubstitutions::Source::UserFile, preset.file, std::move(config_substitutions) });
+                    out.config_substitutions = config.load_from_ini(preset.file, substitution_rule);
                     // Find a default preset for the config. The PrintPresetCollection provides different default preset based on the "printer_technology" field.
                     const Preset &default_preset = this->default_preset_for(config);
                     preset.config = default_preset.config;
@@ -730,12 +745,23 @@ void PresetCollection::load_presets(
                 } catch (const std::runtime_error &err) {
                     throw Slic3r::RuntimeError(std::string("Failed loading the preset file: ") + preset.file + "\n\tReason: " + err.what());
                 }
-                presets_loaded.emplace_back(preset);
+                out.preset = std::move(preset);
             } catch (const std::runtime_error &err) {
-                errors_cummulative += err.what();
-                errors_cummulative += "\n";
+                out.error = err.what();
             }
         }
+    });
+    for (size_t idx = 0; idx < preset_files.size(); ++ idx) {
+        PresetFileLoaded &loaded = preset_files_loaded[idx];
+        if (! loaded.config_substitutions.empty())
+            substitutions.push_back({ preset_files[idx].first, m_type, PresetConfigSubstitutions::Source::UserFile, preset_files[idx].second, std::move(loaded.config_substitutions) });
+        if (loaded.preset)
+            presets_loaded.emplace_back(std::move(*loaded.preset));
+        else {
+            errors_cummulative += loaded.error;
+            errors_cummulative += "\n";
+        }
+    }
     m_presets.insert(m_presets.end(), std::make_move_iterator(presets_loaded.begin()), std::make_move_iterator(presets_loaded.end()));
     std::sort(m_presets.begin() + m_num_default_presets, m_presets.end());
     this->select_preset(first_visible_idx());
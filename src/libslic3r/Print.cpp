@@ -10,6 +10,7 @@
 #include "ShortestPath.hpp"
 #include "SupportMaterial.hpp"
 #include "Thread.hpp"
+#include "Trace.hpp"
 #include "GCode.hpp"
 #include "GCode/WipeTower.hpp"
 #include "Utils.hpp"
@@ -19,12 +20,16 @@
 
 #include <algorithm>
 #include <limits>
+#include <map>
+#include <numeric>
 #include <unordered_set>
 #include <boost/filesystem/path.hpp>
 #include <boost/format.hpp>
 #include <boost/log/trivial.hpp>
 #include <boost/regex.hpp>
 
+#include <tbb/parallel_for.h>
+
 // Mark string for localization and translate.
 #define L(s) Slic3r::I18N::translate(s)
 
@@ -58,6 +63,7 @@ bool Print::invalidate_state_by_config_options(const ConfigOptionResolver & /* n
     // Cache the plenty of parameters, which influence the G-code generator only,
     // or they are only notes not influencing the generated G-code.
     static std::unordered_set<std::string> steps_gcode = {
+        "arc_fitting",
         "avoid_crossing_perimeters",
         "avoid_crossing_perimeters_max_detour",
         "bed_shape",
@@ -422,21 +428,29 @@ bool Print::sequential_print_horizontal_clearance_valid(const Print& print, Poly
 	        // instance.shift is a position of a centered object, while model object may not be centered.
 	        // Convert the shift from the PrintObject's coordinates into ModelObject's coordinates by removing the centering offset.
 	        convex_hull.translate(instance.shift - print_object->center_offset());
-            // if output needed, collect indices (inside convex_hulls_other) of intersecting hulls
-            for (size_t i = 0; i < convex_hulls_other.size(); ++i) {
-                if (! intersection(convex_hulls_other[i], convex_hull).empty()) {
-                    if (polygons == nullptr)
-                        return false;
-                    else {
-                        intersecting_idxs.emplace_back(i);
-                        intersecting_idxs.emplace_back(convex_hulls_other.size());
-                    }
-                }
-            }
             convex_hulls_other.emplace_back(std::move(convex_hull));
 	    }
 	}
 
+    // Check the instances pairwise for intersections. Only the pairs of hulls with overlapping bounding boxes are intersected,
+    // they are found by sweeping the bounding boxes sorted by their left edges.
+    std::vector<BoundingBox> bboxes;
+    bboxes.reserve(convex_hulls_other.size());
+    for (const Polygon &convex_hull : convex_hulls_other)
+        bboxes.emplace_back(convex_hull.bounding_box());
+    std::vector<size_t> sorted_idxs(convex_hulls_other.size());
+    std::iota(sorted_idxs.begin(), sorted_idxs.end(), 0);
+    std::sort(sorted_idxs.begin(), sorted_idxs.end(), [&bboxes](size_t l, size_t r) { return bboxes[l].min.x() < bboxes[r].min.x(); });
+    for (auto it = sorted_idxs.begin(); it != sorted_idxs.end(); ++ it)
+        for (auto it2 = std::next(it); it2 != sorted_idxs.end() && bboxes[*it2].min.x() <= bboxes[*it].max.x(); ++ it2)
+            if (bboxes[*it].overlap(bboxes[*it2]) && ! intersection(convex_hulls_other[*it], convex_hulls_other[*it2]).empty()) {
+                if (polygons == nullptr)
+                    return false;
+                // if output needed, collect indices (inside convex_hulls_other) of intersecting hulls
+                intersecting_idxs.emplace_back(*it);
+                intersecting_idxs.emplace_back(*it2);
+            }
+
     if (!intersecting_idxs.empty()) {
         // use collected indices (inside convex_hulls_other) to update output
         std::sort(intersecting_idxs.begin(), intersecting_idxs.end());
@@ -515,15 +529,10 @@ std::string Print::validate(std::string* warning) const
     };
 
     // Checks that the print does not exceed the max print height
-    for (size_t print_object_idx = 0; print_object_idx < m_objects.size(); ++ print_object_idx) {
-        const PrintObject &print_object = *m_objects[print_object_idx];
-        //FIXME It is quite expensive to generate object layers just to get the print height!
-        if (auto layers = generate_object_layers(print_object.slicing_parameters(), layer_height_profile(print_object_idx));
-            ! layers.empty() && layers.back() > this->config().max_print_height + EPSILON) {
+    for (const PrintObject *print_object : m_objects)
+        if (print_object->layers_print_z_max() > this->config().max_print_height + EPSILON)
             return L("The print is taller than the maximum allowed height. You might want to reduce the size of your model"
                      " or change current print settings and retry.");
-        }
-    }
 
     // Some of the objects has variable layer height applied by painting or by a table.
     bool has_custom_layering = std::find_if(m_objects.begin(), m_objects.end(), 
@@ -869,28 +878,86 @@ void Print::auto_assign_extruders(ModelObject* model_object) const
     }
 }
 
+// Log the wall clock time spent by the finished steps of the print and of its objects.
+static void log_step_durations(const Print &print)
+{
+    static constexpr const char *object_step_names[] = { "slice", "perimeters", "prepare infill", "infill", "ironing", "support spots search", "support material", "estimate curled extrusions" };
+    static_assert(std::size(object_step_names) == posCount, "object_step_names does not match PrintObjectStep");
+    static constexpr const char *print_step_names[] = { "wipe tower", "alert when supports needed", "skirt and brim", "G-code export" };
+    static_assert(std::size(print_step_names) == psCount, "print_step_names does not match PrintStep");
+
+    auto append_step = [](std::string &out, const char *name, const PrintStateBase::StateWithTimeStamp &state) {
+        if (state.is_done())
+            out += (boost::format(" %1%: %2$.3fs,") % name % state.duration).str();
+    };
+    for (const PrintObject *object : print.objects()) {
+        std::string out;
+        for (size_t step = 0; step < posCount; ++ step)
+            append_step(out, object_step_names[step], object->step_state_with_timestamp(PrintObjectStep(step)));
+        if (! out.empty()) {
+            out.pop_back();
+            BOOST_LOG_TRIVIAL(info) << "Step durations of object " << object->model_object()->name << ":" << out;
+        }
+    }
+    std::string out;
+    for (size_t step = 0; step < psCount; ++ step)
+        append_step(out, print_step_names[step], print.step_state_with_timestamp(PrintStep(step)));
+    if (! out.empty()) {
+        out.pop_back();
+        BOOST_LOG_TRIVIAL(info) << "Step durations of the print:" << out;
+    }
+}
+
 // Slicing process, running at a background thread.
 void Print::process()
 {
+    if (this->execute_limited([this]() { this->process(); }))
+        return;
+
     name_tbb_thread_pool_threads_set_locale();
 
+    TraceScope trace("process");
     BOOST_LOG_TRIVIAL(info) << "Starting the slicing process." << log_memory_info();
-    for (PrintObject *obj : m_objects)
-        obj->make_perimeters();
-    this->set_status(70, L("Infilling layers"));
-    for (PrintObject *obj : m_objects)
-        obj->infill();
-    for (PrintObject *obj : m_objects)
-        obj->ironing();
-    for (PrintObject *obj : m_objects)
-        obj->generate_support_spots();
+    // The objects advance through their steps independently of each other, so that a small object does not wait
+    // for the largest one at each step boundary. The objects only meet at the support alert, which reports all of them at once.
+    // The steps are parallelized internally as well, running the objects concurrently fills the cores when the objects are small.
+    // Instances of a single ModelObject share their PrintObjectRegions, which the steps update without locking
+    // (the support spots), thus the objects sharing regions are processed serially by a single task.
+    std::vector<std::vector<PrintObject*>> object_groups;
+    {
+        std::map<const PrintObjectRegions*, size_t> group_of_regions;
+        for (PrintObject *object : m_objects) {
+            auto [it, inserted] = group_of_regions.emplace(object->shared_regions(), object_groups.size());
+            if (inserted)
+                object_groups.emplace_back();
+            object_groups[it->second].emplace_back(object);
+        }
+    }
+    auto for_each_object = [&object_groups](auto &&process_object) {
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, object_groups.size(), 1), [&object_groups, &process_object](const tbb::blocked_range<size_t> &range) {
+            for (size_t group_idx = range.begin(); group_idx < range.end(); ++ group_idx)
+                for (PrintObject *object : object_groups[group_idx])
+                    process_object(*object);
+        });
+    };
+    for_each_object([this](PrintObject &obj) {
+        obj.make_perimeters();
+        this->set_status(70, L("Infilling layers"));
+        obj.infill();
+        obj.ironing();
+        obj.generate_support_spots();
+    });
     // check data from previous step, format the error message(s) and send alert to ui
     alert_when_supports_needed();
-    for (PrintObject *obj : m_objects)
-        obj->generate_support_material();
-    for (PrintObject *obj : m_objects)
-        obj->estimate_curled_extrusions();
+    for_each_object([this](PrintObject &obj) {
+        obj.generate_support_material();
+        obj.estimate_curled_extrusions();
+        if (m_release_layers_on_export)
+            // No object step will be executed again before export, which invalidates them all.
+            obj.release_intermediate_data();
+    });
     if (this->set_started(psWipeTower)) {
+        TraceScope trace_wipe_tower("wipe tower");
         m_wipe_tower_data.clear();
         m_tool_ordering.clear();
         if (this->has_wipe_tower()) {
@@ -905,6 +972,7 @@ void Print::process()
         this->set_done(psWipeTower);
     }
     if (this->set_started(psSkirtBrim)) {
+        TraceScope trace_skirt_brim("skirt and brim");
         this->set_status(88, L("Generating skirt and brim"));
 
         m_skirt.clear();
@@ -939,6 +1007,21 @@ void Print::process()
         this->set_done(psSkirtBrim);
     }
     BOOST_LOG_TRIVIAL(info) << "Slicing process finished." << log_memory_info();
+    log_step_durations(*this);
+}
+
+void Print::process_slices()
+{
+    if (this->execute_limited([this]() { this->process_slices(); }))
+        return;
+
+    name_tbb_thread_pool_threads_set_locale();
+
+    TraceScope trace("process slices");
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, m_objects.size(), 1), [this](const tbb::blocked_range<size_t> &range) {
+        for (size_t object_idx = range.begin(); object_idx < range.end(); ++ object_idx)
+            m_objects[object_idx]->slice();
+    });
 }
 
 // G-code export process, running at a background thread.
@@ -947,6 +1030,9 @@ void Print::process()
 // It is up to the caller to show an error message.
 std::string Print::export_gcode(const std::string& path_template, GCodeProcessorResult* result, ThumbnailsGeneratorCallback thumbnail_cb)
 {
+    if (std::string path; this->execute_limited([this, &path, &path_template, result, &thumbnail_cb]() { path = this->export_gcode(path_template, result, thumbnail_cb); }))
+        return path;
+
     // output everything to a G-code file
     // The following call may die if the output_filename_format template substitution fails.
     std::string path = this->output_filepath(path_template);
@@ -960,9 +1046,14 @@ std::string Print::export_gcode(const std::string& path_template, GCodeProcessor
         message = L("Generating G-code");
     this->set_status(90, message);
 
+    TraceScope trace("export G-code");
     // Create GCode on heap, it has quite a lot of data.
     std::unique_ptr<GCode> gcode(new GCode);
     gcode->do_export(this, path.c_str(), result, thumbnail_cb);
+    if (m_release_layers_on_export)
+        // Extrusions of the object layers were released by the G-code generator.
+        for (PrintObject *object : m_objects)
+            object->invalidate_all_steps();
     return path.c_str();
 }
 
@@ -987,31 +1078,41 @@ void Print::_make_skirt()
     }
     
     // Collect points from all layers contained in skirt height.
-    Points points;
-    for (const PrintObject *object : m_objects) {
-        Points object_points;
-        // Get object layers up to skirt_height_z.
-        for (const Layer *layer : object->m_layers) {
-            if (layer->print_z > skirt_height_z)
-                break;
-            for (const ExPolygon &expoly : layer->lslices)
-                // Collect the outer contour points only, ignore holes for the calculation of the convex hull.
-                append(object_points, expoly.contour.points);
-        }
-        // Get support layers up to skirt_height_z.
-        for (const SupportLayer *layer : object->support_layers()) {
-            if (layer->print_z > skirt_height_z)
-                break;
-            layer->support_fills.collect_points(object_points);
+    // The points of each object are reduced to their convex hull in parallel, only the hulls are then repeated for each object copy.
+    std::vector<Points> objects_points(m_objects.size());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, m_objects.size()), [this, skirt_height_z, &objects_points](const tbb::blocked_range<size_t> &range) {
+        for (size_t object_idx = range.begin(); object_idx < range.end(); ++ object_idx) {
+            const PrintObject *object = m_objects[object_idx];
+            Points object_points;
+            // Get object layers up to skirt_height_z.
+            for (const Layer *layer : object->m_layers) {
+                if (layer->print_z > skirt_height_z)
+                    break;
+                for (const ExPolygon &expoly : layer->lslices)
+                    // Collect the outer contour points only, ignore holes for the calculation of the convex hull.
+                    append(object_points, expoly.contour.points);
+            }
+            // Get support layers up to skirt_height_z.
+            for (const SupportLayer *layer : object->support_layers()) {
+                if (layer->print_z > skirt_height_z)
+                    break;
+                layer->support_fills.collect_points(object_points);
+            }
+            if (object_points.size() >= 3)
+                objects_points[object_idx] = Slic3r::Geometry::convex_hull(std::move(object_points)).points;
+            else
+                objects_points[object_idx] = std::move(object_points);
         }
+    });
+    Points points;
+    for (size_t object_idx = 0; object_idx < m_objects.size(); ++ object_idx)
         // Repeat points for each object copy.
-        for (const PrintInstance &instance : object->instances()) {
-            Points copy_points = object_points;
+        for (const PrintInstance &instance : m_objects[object_idx]->instances()) {
+            Points copy_points = objects_points[object_idx];
             for (Point &pt : copy_points)
                 pt += instance.shift;
             append(points, copy_points);
         }
-    }
 
     // Include the wipe tower.
     append(points, this->first_layer_wipe_tower_corners());
@@ -33,6 +33,7 @@ class ModelObject;
 class Print;
 class PrintObject;
 class SupportLayer;
+struct PrintObjectSeamData;
 
 namespace FillAdaptive {
     struct Octree;
@@ -40,6 +41,10 @@ namespace FillAdaptive {
     using OctreePtr = std::unique_ptr<Octree, OctreeDeleter>;
 }; // namespace FillAdaptive
 
+namespace FFFTreeSupport {
+    class TreeModelVolumes;
+}; // namespace FFFTreeSupport
+
 namespace FillLightning {
     class Generator;
     struct GeneratorDeleter;
@@ -233,6 +238,19 @@ private:
     size_t                                      m_ref_cnt{ 0 };
 };
 
+// Slices of a single ModelVolume produced by the last PrintObject::slice_volumes() call.
+// The slices at Z heights, which did not change, are reused when the object is sliced again, for example
+// after a layer height range modifier was edited, so that only the layers of the modified Z range are sliced.
+struct CachedVolumeSlices {
+    ObjectID                                volume_id;
+    // Mesh and slicing parameters (including the object transformation) the slices were produced with.
+    std::shared_ptr<const TriangleMesh>     mesh;
+    size_t                                  params_hash { 0 };
+    // Sorted slicing planes and their slices.
+    std::vector<float>                      zs;
+    std::vector<ExPolygons>                 slices;
+};
+
 class PrintObject : public PrintObjectBaseWithState<Print, PrintObjectStep, posCount>
 {
 private: // Prevents erroneous use by other classes.
@@ -306,6 +324,9 @@ public:
     // (layer height, first layer height, raft settings, print nozzle diameter etc).
     const SlicingParameters&    slicing_parameters() const { return m_slicing_params; }
     static SlicingParameters    slicing_parameters(const DynamicPrintConfig &full_config, const ModelObject &model_object, float object_max_z);
+    // Top of the object layers generated from the layer height profile, used by Print::validate() to check the maximum print height.
+    // Cached until the slicing parameters are recalculated.
+    coordf_t                    layers_print_z_max() const;
 
     size_t                      num_printing_regions() const throw() { return m_shared_regions->all_regions.size(); }
     const PrintRegion&          printing_region(size_t idx) const throw() { return *m_shared_regions->all_regions[idx].get(); }
@@ -333,6 +354,14 @@ public:
     // Helpers to project custom facets on slices
     void project_and_append_custom_facets(bool seam, EnforcerBlockerType type, std::vector<Polygons>& expolys) const;
 
+    // Seam placement data calculated by the G-code export. Kept for the next G-code export until the perimeters,
+    // the seam configuration or the seam painting change.
+    const std::shared_ptr<PrintObjectSeamData>& seam_data() const { return m_seam_data; }
+    void                        set_seam_data(std::shared_ptr<PrintObjectSeamData> seam_data) { m_seam_data = std::move(seam_data); }
+    // Collision and avoidance areas of the last tree support generation, reused while the object slices stay valid.
+    const std::shared_ptr<FFFTreeSupport::TreeModelVolumes>& tree_model_volumes() const { return m_tree_model_volumes; }
+    void                        set_tree_model_volumes(std::shared_ptr<FFFTreeSupport::TreeModelVolumes> volumes) { m_tree_model_volumes = std::move(volumes); }
+
 private:
     // to be called from Print only.
     friend class Print;
@@ -374,6 +403,8 @@ private:
     void generate_support_spots();
     void generate_support_material();
     void estimate_curled_extrusions();
+    // See Print::set_release_layers_on_export() and Layer::release_intermediate_data().
+    void release_intermediate_data();
 
     void slice_volumes();
     // Has any support (not counting the raft).
@@ -385,7 +416,8 @@ private:
     void discover_horizontal_shells();
     void combine_infill();
     void _generate_support_material();
-    std::pair<FillAdaptive::OctreePtr, FillAdaptive::OctreePtr> prepare_adaptive_infill_data();
+    // Returns octrees owned by this PrintObject, they are reused until the infill is invalidated.
+    std::pair<FillAdaptive::Octree*, FillAdaptive::Octree*> prepare_adaptive_infill_data();
     FillLightning::GeneratorPtr prepare_lightning_infill_data();
 
     // XYZ in scaled coordinates
@@ -404,12 +436,29 @@ private:
     PrintObjectRegions                     *m_shared_regions { nullptr };
 
     SlicingParameters                       m_slicing_params;
+    // See layers_print_z_max().
+    mutable std::optional<coordf_t>         m_layers_print_z_max;
     LayerPtrs                               m_layers;
     SupportLayerPtrs                        m_support_layers;
 
     // this is set to true when LayerRegion->slices is split in top/internal/bottom
     // so that next call to make_perimeters() performs a union() before computing loops
     bool                    				m_typed_slices = false;
+
+    // See seam_data().
+    std::shared_ptr<PrintObjectSeamData>    m_seam_data;
+    // See tree_model_volumes().
+    std::shared_ptr<FFFTreeSupport::TreeModelVolumes> m_tree_model_volumes;
+    // Slices of the ModelVolumes produced by the last slice_volumes() call, see CachedVolumeSlices.
+    // Not cleared by invalidation, the cache is validated against the ModelVolumes, the object transformation and the slicing planes before being used.
+    // Handed over by Print::apply() to a PrintObject replacing this one with the same transformation, released with the intermediate data.
+    std::vector<CachedVolumeSlices>         m_cached_volume_slices;
+
+    // Adaptive cubic / support cubic infill octrees and the line spacings they were built for.
+    // Kept over infill re-runs, reset whenever the mesh or the internal bridges change.
+    std::shared_ptr<FillAdaptive::Octree>   m_adaptive_fill_octree;
+    std::shared_ptr<FillAdaptive::Octree>   m_support_fill_octree;
+    std::pair<double, double>               m_adaptive_fill_octrees_line_spacing { 0., 0. };
 };
 
 struct WipeTowerData
@@ -521,12 +570,20 @@ public:
     ApplyStatus         apply(const Model &model, DynamicPrintConfig config) override;
     void                set_task(const TaskParams &params) override { PrintBaseWithState<PrintStep, psCount>::set_task_impl(params, m_objects); }
     void                process() override;
+    // Only slice the objects, which stores their slices into the slice cache if enabled, see set_slice_cache_dir().
+    void                process_slices();
     void                finalize() override { PrintBaseWithState<PrintStep, psCount>::finalize_impl(m_objects); }
     void                cleanup() override;
 
     // Exports G-code into a file name based on the path_template, returns the file path of the generated G-code file.
     // If preview_data is not null, the preview_data is filled in for the G-code visualization (not used by the command line Slic3r).
     std::string         export_gcode(const std::string& path_template, GCodeProcessorResult* result, ThumbnailsGeneratorCallback thumbnail_cb = nullptr);
+    // Release extrusions of each object layer right after its G-code was generated to lower the peak memory consumption
+    // when exporting tall objects. The intermediate data of the object layers, which is only needed to regenerate perimeters
+    // and infill, is released by process() once the object steps are finished. All the object steps are invalidated
+    // by export_gcode() then, therefore this mode is only suitable for a Print being exported just once, as done by the command line slicer.
+    void                set_release_layers_on_export(bool release) { m_release_layers_on_export = release; }
+    bool                release_layers_on_export() const { return m_release_layers_on_export; }
 
     // methods for handling state
     bool                is_step_done(PrintStep step) const { return Inherited::is_step_done(step); }
@@ -646,6 +703,9 @@ private:
     // Estimated print time, filament consumed.
     PrintStatistics                         m_print_statistics;
 
+    // See set_release_layers_on_export().
+    bool                                    m_release_layers_on_export { false };
+
     // To allow GCode to set the Print's GCodeExport step status.
     friend class GCode;
     // Allow PrintObject to access m_mutex and m_cancel_callback.
@@ -52,8 +52,10 @@ namespace Slic3r {
             delete mv_with_status.first;
 }
 
-static inline void model_volume_list_copy_configs(ModelObject &model_object_dst, const ModelObject &model_object_src, const ModelVolumeType type)
+// Returns true if a config of any of the ModelVolumes changed.
+static inline bool model_volume_list_copy_configs(ModelObject &model_object_dst, const ModelObject &model_object_src, const ModelVolumeType type)
 {
+    bool   config_changed = false;
     size_t i_src, i_dst;
     for (i_src = 0, i_dst = 0; i_src < model_object_src.volumes.size() && i_dst < model_object_dst.volumes.size();) {
         const ModelVolume &mv_src = *model_object_src.volumes[i_src];
@@ -69,6 +71,8 @@ static inline void model_volume_list_copy_configs(ModelObject &model_object_dst,
         assert(mv_src.id() == mv_dst.id());
         // Copy the ModelVolume data.
         mv_dst.name   = mv_src.name;
+        if (! mv_dst.config.timestamp_matches(mv_src.config))
+            config_changed = true;
 		mv_dst.config.assign_config(mv_src.config);
         assert(mv_dst.supported_facets.id() == mv_src.supported_facets.id());
         mv_dst.supported_facets.assign(mv_src.supported_facets);
@@ -81,11 +85,14 @@ static inline void model_volume_list_copy_configs(ModelObject &model_object_dst,
         ++ i_src;
         ++ i_dst;
     }
+    return config_changed;
 }
 
-static inline void layer_height_ranges_copy_configs(t_layer_config_ranges &lr_dst, const t_layer_config_ranges &lr_src)
+// Returns true if a config of any of the layer ranges changed.
+static inline bool layer_height_ranges_copy_configs(t_layer_config_ranges &lr_dst, const t_layer_config_ranges &lr_src)
 {
     assert(lr_dst.size() == lr_src.size());
+    bool config_changed = false;
     auto it_src = lr_src.cbegin();
     for (auto &kvp_dst : lr_dst) {
         const auto &kvp_src = *it_src ++;
@@ -93,8 +100,12 @@ static inline void layer_height_ranges_copy_configs(t_layer_config_ranges &lr_ds
         assert(std::abs(kvp_dst.first.second - kvp_src.first.second) <= EPSILON);
         // Layer heights are allowed do differ in case the layer height table is being overriden by the smooth profile.
         // assert(std::abs(kvp_dst.second.option("layer_height")->getFloat() - kvp_src.second.option("layer_height")->getFloat()) <= EPSILON);
-        kvp_dst.second = kvp_src.second;
+        if (! kvp_dst.second.timestamp_matches(kvp_src.second)) {
+            kvp_dst.second.assign_config(kvp_src.second);
+            config_changed = true;
+        }
     }
+    return config_changed;
 }
 
 static inline bool transform3d_lower(const Transform3d &lhs, const Transform3d &rhs) 
@@ -344,6 +355,9 @@ struct ModelObjectStatus {
     PrintObjectRegions                         *print_object_regions { nullptr };
     // Status of the above.
     PrintObjectRegionsStatus                    print_object_regions_status { PrintObjectRegionsStatus::Invalid };
+    // Neither the configs of this ModelObject, of its ModelVolumes and layer ranges, nor the default region config
+    // and the number of extruders changed, thus the Valid regions do not need to be verified.
+    bool                                        region_configs_unchanged { false };
 
     // Search by id.
     bool operator<(const ModelObjectStatus &rhs) const { return id < rhs.id; }
@@ -1209,6 +1223,8 @@ Print::ApplyStatus Print::apply(const Model &model, DynamicPrintConfig new_full_
                 }
             } else if (model_custom_seam_data_changed(model_object, model_object_new)) {
                 update_apply_status(this->invalidate_step(psGCodeExport));
+                for (const PrintObjectStatus &print_object_status : print_objects_range)
+                    print_object_status.print_object->m_seam_data.reset();
             }
         }
         if (! solid_or_modifier_differ) {
@@ -1228,9 +1244,11 @@ Print::ApplyStatus Print::apply(const Model &model, DynamicPrintConfig new_full_
             }
             // Synchronize (just copy) the remaining data of ModelVolumes (name, config, custom supports data).
             //FIXME What to do with m_material_id?
-			model_volume_list_copy_configs(model_object /* dst */, model_object_new /* src */, ModelVolumeType::MODEL_PART);
-			model_volume_list_copy_configs(model_object /* dst */, model_object_new /* src */, ModelVolumeType::PARAMETER_MODIFIER);
-            layer_height_ranges_copy_configs(model_object.layer_config_ranges /* dst */, model_object_new.layer_config_ranges /* src */);
+			bool volume_configs_changed      = model_volume_list_copy_configs(model_object /* dst */, model_object_new /* src */, ModelVolumeType::MODEL_PART);
+			volume_configs_changed          |= model_volume_list_copy_configs(model_object /* dst */, model_object_new /* src */, ModelVolumeType::PARAMETER_MODIFIER);
+            bool layer_range_configs_changed = layer_height_ranges_copy_configs(model_object.layer_config_ranges /* dst */, model_object_new.layer_config_ranges /* src */);
+            model_object_status.region_configs_unchanged = region_diff.empty() && ! num_extruders_changed && ! object_config_changed &&
+                                                           ! volume_configs_changed && ! layer_range_configs_changed;
             // Copy the ModelObject name, input_file and instances. The instances will be compared against PrintObject instances in the next step.
             model_object.name       = model_object_new.name;
             model_object.input_file = model_object_new.input_file;
@@ -1286,11 +1304,20 @@ Print::ApplyStatus Print::apply(const Model &model, DynamicPrintConfig new_full_
                     PrintObject::object_config_from_model_object(m_default_object_config, *model_object, num_extruders));
                 print_object_last = print_object;
             };
+            // Take over the volume slices of a deleted PrintObject with the same transformation, see PrintObject::slice_volumes().
+            auto print_object_take_over_volume_slices = [&print_object_status_db, model_object](PrintObject *print_object) {
+                for (const PrintObjectStatus &print_object_status : print_object_status_db.get_range(*model_object))
+                    if (print_object_status.status == PrintObjectStatus::Deleted && transform3d_equal(print_object_status.trafo, print_object->trafo())) {
+                        print_object->m_cached_volume_slices = std::move(print_object_status.print_object->m_cached_volume_slices);
+                        break;
+                    }
+            };
             if (old.empty()) {
                 // Simple case, just generate new instances.
                 for (PrintObjectTrafoAndInstances &print_instances : model_object_status.print_instances) {
                     PrintObject *print_object = new PrintObject(this, model_object, print_instances.trafo, std::move(print_instances.instances));
                     print_object_apply_config(print_object);
+                    print_object_take_over_volume_slices(print_object);
                     print_objects_new.emplace_back(print_object);
                     // print_object_status.emplace(PrintObjectStatus(print_object, PrintObjectStatus::New));
                     new_objects = true;
@@ -1308,6 +1335,7 @@ Print::ApplyStatus Print::apply(const Model &model, DynamicPrintConfig new_full_
                     // This is a new instance (or a set of instances with the same trafo). Just add it.
                     PrintObject *print_object = new PrintObject(this, model_object, new_instances.trafo, std::move(new_instances.instances));
                     print_object_apply_config(print_object);
+                    print_object_take_over_volume_slices(print_object);
                     print_objects_new.emplace_back(print_object);
                     // print_object_status.emplace(PrintObjectStatus(print_object, PrintObjectStatus::New));
                     new_objects = true;
@@ -1381,6 +1409,8 @@ Print::ApplyStatus Print::apply(const Model &model, DynamicPrintConfig new_full_
                 print_object_regions->clear();
                 model_object_status.print_object_regions_status = ModelObjectStatus::PrintObjectRegionsStatus::Invalid;
                 print_regions_reshuffled = true;
+            } else if (print_object_regions && model_object_status.region_configs_unchanged) {
+                // None of the inputs of the regions changed since they were last verified or generated, just keep them.
             } else if (print_object_regions &&
                 verify_update_print_object_regions(
                     print_object.model_object()->volumes,
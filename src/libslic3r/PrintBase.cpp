@@ -4,6 +4,8 @@
 #include <boost/filesystem.hpp>
 #include <boost/lexical_cast.hpp>
 
+#include <tbb/task_arena.h>
+
 #include "I18N.hpp"
 
 //! macro used to mark string used at localization, 
@@ -20,6 +22,16 @@ void PrintTryCancel::operator()() const
 
 size_t PrintStateBase::g_last_timestamp = 0;
 
+bool PrintBase::execute_limited(const std::function<void()> &fn) const
+{
+    if (m_max_threads <= 0 || tbb::this_task_arena::max_concurrency() <= m_max_threads)
+        return false;
+    // Exceptions thrown by fn, namely CanceledException, are propagated by execute().
+    tbb::task_arena arena(m_max_threads);
+    arena.execute(fn);
+    return true;
+}
+
 // Update "scale", "input_filename", "input_filename_base" placeholders from the current m_objects.
 void PrintBase::update_object_placeholders(DynamicConfig &config, const std::string &default_ext) const
 {
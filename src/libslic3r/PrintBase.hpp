@@ -2,6 +2,7 @@
 #define slic3r_PrintBase_hpp_
 
 #include "libslic3r.h"
+#include <chrono>
 #include <set>
 #include <vector>
 #include <string>
@@ -61,6 +62,8 @@ public:
         State       state { State::Fresh };
         TimeStamp   timestamp { 0 };
         bool        enabled { true };
+        // Wall clock time in seconds spent by the last run of the milestone, valid if the milestone is Done.
+        float       duration { 0.f };
 
         bool        is_done() const { return state == State::Done; }
         // The milestone may have some data available, but it is no more valid and it should be cleaned up to conserve memory.
@@ -188,8 +191,10 @@ public:
             return false;
         state.state = State::Started;
         state.timestamp = ++ g_last_timestamp;
+        state.duration = 0.f;
         state.mark_warnings_non_current();
         m_step_active = static_cast<int>(step);
+        m_started_time[step] = std::chrono::steady_clock::now();
         return true;
     }
 
@@ -208,6 +213,7 @@ public:
         PrintStateBase::StateWithWarnings &state = m_state[step];
         state.state = State::Done;
         state.timestamp = ++ g_last_timestamp;
+        state.duration = std::chrono::duration<float>(std::chrono::steady_clock::now() - m_started_time[step]).count();
         m_step_active = -1;
         // Remove all non-current warnings.
     	auto it = std::remove_if(state.warnings.begin(), state.warnings.end(), [](const auto &w) { return ! w.current; });
@@ -348,6 +354,8 @@ public:
 
 private:
     StateWithWarnings   m_state[COUNT];
+    // Time when each step was last started, to measure StateWithTimeStamp::duration.
+    std::chrono::steady_clock::time_point m_started_time[COUNT];
     // Active class StepType or -1 if none is active.
     // If the background processing is canceled, m_step_active may not be resetted
     // to -1, see the comment in this->set_started().
@@ -522,6 +530,12 @@ public:
     const PlaceholderParser&   placeholder_parser() const { return m_placeholder_parser; }
     const DynamicPrintConfig&  full_print_config() const { return m_full_print_config; }
 
+    // Maximum number of threads the background processing of this print may occupy, zero for no limit.
+    // A limited print runs inside its own tbb::task_arena, so that multiple prints processed concurrently
+    // by a single process don't oversubscribe the CPU cores.
+    void                       set_max_threads(int max_threads) { m_max_threads = std::max(0, max_threads); }
+    int                        max_threads() const { return m_max_threads; }
+
     virtual std::string        output_filename(const std::string &filename_base = std::string()) const = 0;
     // If the filename_base is set, it is used as the input for the template processing. In that case the path is expected to be the directory (may be empty).
     // If filename_set is empty, than the path may be a file or directory. If it is a file, then the macro will not be processed.
@@ -549,6 +563,10 @@ protected:
     std::string            output_filename(const std::string &format, const std::string &default_ext, const std::string &filename_base, const DynamicConfig *config_override = nullptr) const;
     // Update "scale", "input_filename", "input_filename_base" placeholders from the current printable ModelObjects.
     void                   update_object_placeholders(DynamicConfig &config, const std::string &default_ext) const;
+    // Execute fn inside a task arena limited to max_threads() and return true.
+    // Return false without executing fn if the number of threads is not limited or if the calling thread
+    // already runs in an arena not larger than max_threads(), for example when fn calls the method that called execute_limited().
+    bool                   execute_limited(const std::function<void()> &fn) const;
 
 	Model                                   m_model;
 	DynamicPrintConfig						m_full_print_config;
@@ -563,6 +581,9 @@ private:
     // Callback to be evoked to stop the background processing before a state is updated.
     cancel_callback_type                    m_cancel_callback = [](){};
 
+    // Maximum number of threads of the background processing, zero for no limit.
+    int                                     m_max_threads { 0 };
+
     // Mutex used for synchronization of the worker thread with the UI thread:
     // The mutex will be used to guard the worker thread against entering a stage
     // while the data influencing the stage is modified.
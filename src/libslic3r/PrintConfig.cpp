@@ -402,6 +402,16 @@ void PrintConfigDef::init_fff_params()
 
     // Maximum extruder temperature, bumped to 1500 to support printing of glass.
     const int max_temp = 1500;
+    def = this->add("arc_fitting", coBool);
+    def->label = L("Arc fitting");
+    def->tooltip = L("Replace runs of short extrusion moves along curved paths by G2 / G3 arc moves, "
+                   "deviating from the original path by no more than the G-code resolution. "
+                   "This reduces the G-code size and the load on the printer planner. "
+                   "The firmware has to support G2 / G3 arc moves. "
+                   "Arcs are not exported in spiral vase mode and with the pressure equalizer enabled.");
+    def->mode = comExpert;
+    def->set_default_value(new ConfigOptionBool(false));
+
     def = this->add("avoid_crossing_curled_overhangs", coBool);
     def->label = L("Avoid crossing curled overhangs (Experimental)");
     def->tooltip = L("Plan travel moves such that the extruder avoids areas where the filament may be curled up. "
@@ -4767,6 +4777,63 @@ CLIMiscConfigDef::CLIMiscConfigDef()
     def->label = L("Data directory");
     def->tooltip = L("Load and store settings at the given directory. This is useful for maintaining different profiles or including configurations from a network storage.");
 
+    def = this->add("slice_cache", coString);
+    def->label = L("Slice cache directory");
+    def->tooltip = L("Store sliced object volumes into the given directory and reuse them when the same object is sliced "
+                     "again with the same slicing parameters, possibly by another PrusaSlicer process of the same version.");
+
+    def = this->add("slice_shard", coString);
+    def->label = L("Slice shard");
+    def->tooltip = L("Distribute the slicing of a plate with many objects over multiple processes or hosts sharing the slice cache directory. "
+                     "Given K/N, only every N-th object starting with the K-th one is sliced and its slices are stored into the slice cache, "
+                     "no G-code is exported. Once all the N shards are sliced, exporting the G-code of the whole plate with the same "
+                     "configuration and slice cache loads the slices from the cache.");
+
+    def = this->add("low_memory", coBool);
+    def->label = L("Low memory G-code export");
+    def->tooltip = L("Release the extrusions of each layer as soon as its G-code is generated. "
+                     "Lowers the peak memory consumption when exporting tall objects.");
+    def->set_default_value(new ConfigOptionBool(false));
+
+    def = this->add("gcode_variant", coStrings);
+    def->label = L("G-code variant");
+    def->tooltip = L("Export an additional G-code with the configuration from the specified file applied over the loaded configuration. "
+                     "The models are sliced once and only the steps affected by the options the variant differs in are processed again, "
+                     "thus variants differing in printer, filament, speed or temperature options only regenerate the G-code. "
+                     "The models are arranged for the loaded configuration. It can be used more than once to export multiple variants.");
+
+    def = this->add("batch", coString);
+    def->label = L("Batch job list");
+    def->tooltip = L("Process a list of jobs in a single PrusaSlicer process. Each non-empty line of the given file "
+                     "not starting with # contains command line arguments of a single job, for example input files, "
+                     "--load, --output and an action. The configuration definitions and the thread pool are shared by all the jobs.");
+
+    def = this->add("batch_jobs", coInt);
+    def->label = L("Concurrent batch jobs");
+    def->tooltip = L("Number of jobs of a batch job list processed concurrently.");
+    def->min = 1;
+    def->set_default_value(new ConfigOptionInt(1));
+
+    def = this->add("batch_threads", coInt);
+    def->label = L("Threads per batch job");
+    def->tooltip = L("Maximum number of threads a single job of a batch job list may use. "
+                     "Zero divides the available threads evenly among the concurrent jobs.");
+    def->min = 0;
+    def->set_default_value(new ConfigOptionInt(0));
+
+    def = this->add("max_threads", coInt);
+    def->label = L("Maximum threads");
+    def->tooltip = L("Maximum number of threads used to slice and export a single print. "
+                     "Zero uses all the available threads.");
+    def->min = 0;
+    def->set_default_value(new ConfigOptionInt(0));
+
+    def = this->add("trace", coString);
+    def->label = L("Trace file");
+    def->tooltip = L("Record the slicing steps and their parallel tasks on all threads and export them into the given "
+                     "Chrome trace JSON file, which may be viewed by chrome://tracing or Perfetto. "
+                     "The trace file may be set by the SLIC3R_TRACE environment variable as well, which also works for the GUI.");
+
     def = this->add("loglevel", coInt);
     def->label = L("Logging level");
     def->tooltip = L("Sets logging sensitivity. 0:fatal, 1:error, 2:warning, 3:info, 4:debug, 5:trace\n"
@@ -21,6 +21,8 @@
 #include "SLA/SupportTreeStrategies.hpp"
 #include "libslic3r/Arrange.hpp"
 
+#include <unordered_map>
+
 #include <boost/preprocessor/facilities/empty.hpp>
 #include <boost/preprocessor/punctuation/comma_if.hpp>
 #include <boost/preprocessor/seq/for_each.hpp>
@@ -295,7 +297,7 @@ protected:
         }
 
     protected:
-        std::map<std::string, ptrdiff_t>    m_map_name_to_offset;
+        std::unordered_map<std::string, ptrdiff_t> m_map_name_to_offset;
     };
 
     // Parametrized by the type of the topmost class owning the options.
@@ -324,6 +326,17 @@ protected:
         const std::vector<std::string>& keys()      const { return m_keys; }
         const T&                        defaults()  const { return *m_defaults; }
 
+        // Returns options differing in the two configs, in the order of keys().
+        // Compares the options at their cached offsets, avoiding the lookup of each option by its name.
+        t_config_option_keys            diff(const T *lhs, const T *rhs) const
+        {
+            t_config_option_keys out;
+            for (size_t i = 0; i < m_keys.size(); ++ i)
+                if (*reinterpret_cast<const ConfigOption*>((const char*)lhs + m_offsets[i]) != *reinterpret_cast<const ConfigOption*>((const char*)rhs + m_offsets[i]))
+                    out.emplace_back(m_keys[i]);
+            return out;
+        }
+
         // To be called during the StaticCache setup.
         // Collect option keys from m_map_name_to_offset,
         // assign default values to m_defaults.
@@ -331,25 +344,33 @@ protected:
         {
             assert(defs != nullptr);
             m_defaults = defaults;
+            // Walk just the options of T instead of the whole ConfigDef, sorted by their keys to match the order of ConfigDef::options.
+            std::vector<std::pair<const std::string*, ptrdiff_t>> options;
+            options.reserve(m_map_name_to_offset.size());
+            for (const auto &kvp : m_map_name_to_offset)
+                options.emplace_back(&kvp.first, kvp.second);
+            std::sort(options.begin(), options.end(), [](const auto &l, const auto &r) { return *l.first < *r.first; });
             m_keys.clear();
-            m_keys.reserve(m_map_name_to_offset.size());
-            for (const auto &kvp : defs->options) {
-                // Find the option given the option name kvp.first by an offset from (char*)m_defaults.
-                ConfigOption *opt = this->optptr(kvp.first, m_defaults);
-                if (opt == nullptr)
-                    // This option is not defined by the ConfigBase of type T.
+            m_keys.reserve(options.size());
+            m_offsets.clear();
+            m_offsets.reserve(options.size());
+            for (const auto &[key, offset] : options) {
+                const ConfigOptionDef *def = defs->get(*key);
+                if (def == nullptr)
+                    // This option is not defined by the ConfigDef.
                     continue;
-                m_keys.emplace_back(kvp.first);
-                const ConfigOptionDef *def = defs->get(kvp.first);
-                assert(def != nullptr);
+                m_keys.emplace_back(*key);
+                m_offsets.emplace_back(offset);
                 if (def->default_value)
-                    opt->set(def->default_value.get());
+                    reinterpret_cast<ConfigOption*>((char*)m_defaults + offset)->set(def->default_value.get());
             }
         }
 
     private:
         T                                  *m_defaults;
         std::vector<std::string>            m_keys;
+        // Offsets of the options from the start of T, matching m_keys.
+        std::vector<ptrdiff_t>              m_offsets;
     };
 };
 
@@ -364,6 +385,9 @@ public: \
     /* Overrides ConfigBase::keys(). Collect names of all configuration values maintained by this configuration store. */ \
     t_config_option_keys     keys() const override { return s_cache_##CLASS_NAME.keys(); } \
     const t_config_option_keys& keys_ref() const override { return s_cache_##CLASS_NAME.keys(); } \
+    /* Overloads ConfigBase::diff() for two configs of the same type, comparing the options at their cached offsets. */ \
+    using ConfigBase::diff; \
+    t_config_option_keys     diff(const CLASS_NAME &other) const { return s_cache_##CLASS_NAME.diff(this, &other); } \
     static const CLASS_NAME& defaults() { assert(s_cache_##CLASS_NAME.initialized()); return s_cache_##CLASS_NAME.defaults(); } \
 private: \
     friend int print_config_static_initializer(); \
@@ -744,6 +768,7 @@ PRINT_CONFIG_CLASS_DERIVED_DEFINE(
     PrintConfig, 
     (MachineEnvelopeConfig, GCodeConfig),
 
+    ((ConfigOptionBool,               arc_fitting))
     ((ConfigOptionBool,               avoid_crossing_curled_overhangs))
     ((ConfigOptionBool,               avoid_crossing_perimeters))
     ((ConfigOptionFloatOrPercent,     avoid_crossing_perimeters_max_detour))
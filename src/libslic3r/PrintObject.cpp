@@ -15,14 +15,17 @@
 #include "I18N.hpp"
 #include "Layer.hpp"
 #include "MutablePolygon.hpp"
+#include "PerimeterGenerator.hpp"
 #include "PrintBase.hpp"
 #include "SupportMaterial.hpp"
 #include "TreeSupport.hpp"
 #include "Surface.hpp"
 #include "Slicing.hpp"
 #include "Tesselate.hpp"
+#include "Trace.hpp"
 #include "TriangleMeshSlicer.hpp"
 #include "Utils.hpp"
+#include "Fill/Fill.hpp"
 #include "Fill/FillAdaptive.hpp"
 #include "Fill/FillLightning.hpp"
 #include "Format/STL.hpp"
@@ -36,9 +39,11 @@
 #include <cmath>
 #include <cstddef>
 #include <float.h>
+#include <functional>
 #include <limits>
 #include <oneapi/tbb/blocked_range.h>
 #include <oneapi/tbb/parallel_for.h>
+#include <oneapi/tbb/parallel_invoke.h>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -148,6 +153,7 @@ void PrintObject::make_perimeters()
 
     if (! this->set_started(posPerimeters))
         return;
+    TraceScope trace("perimeters", this->id().id);
 
     m_print->set_status(20, L("Generating perimeters"));
     BOOST_LOG_TRIVIAL(info) << "Generating perimeters..." << log_memory_info();
@@ -234,12 +240,17 @@ void PrintObject::make_perimeters()
     }
 
     BOOST_LOG_TRIVIAL(debug) << "Generating perimeters in parallel - start";
+    // Layers with identical outlines share the Arachne perimeters.
+    std::unique_ptr<PerimeterGenerator::ArachneCache> arachne_cache;
+    if (m_config.perimeter_generator.value == PerimeterGeneratorType::Arachne)
+        arachne_cache = std::make_unique<PerimeterGenerator::ArachneCache>();
     tbb::parallel_for(
         tbb::blocked_range<size_t>(0, m_layers.size()),
-        [this](const tbb::blocked_range<size_t>& range) {
+        [this, arachne_cache = arachne_cache.get()](const tbb::blocked_range<size_t>& range) {
             for (size_t layer_idx = range.begin(); layer_idx < range.end(); ++ layer_idx) {
                 m_print->throw_if_canceled();
-                m_layers[layer_idx]->make_perimeters();
+                TraceScope trace("perimeters of layer", layer_idx);
+                m_layers[layer_idx]->make_perimeters(arachne_cache);
             }
         }
     );
@@ -253,6 +264,7 @@ void PrintObject::prepare_infill()
 {
     if (! this->set_started(posPrepareInfill))
         return;
+    TraceScope trace("prepare infill", this->id().id);
 
     m_print->set_status(30, L("Preparing infill"));
 
@@ -399,17 +411,22 @@ void PrintObject::infill()
     this->prepare_infill();
 
     if (this->set_started(posInfill)) {
+        TraceScope trace("infill", this->id().id);
         m_print->set_status(45, L("making infill"));
         auto [adaptive_fill_octree, support_fill_octree] = this->prepare_adaptive_infill_data();
         auto lightning_generator                         = this->prepare_lightning_infill_data();
+        FillCache fill_cache;
 
         BOOST_LOG_TRIVIAL(debug) << "Filling layers in parallel - start";
         tbb::parallel_for(
             tbb::blocked_range<size_t>(0, m_layers.size()),
-            [this, &adaptive_fill_octree = adaptive_fill_octree, &support_fill_octree = support_fill_octree, &lightning_generator](const tbb::blocked_range<size_t>& range) {
+            [this, &adaptive_fill_octree = adaptive_fill_octree, &support_fill_octree = support_fill_octree, &lightning_generator, &fill_cache](const tbb::blocked_range<size_t>& range) {
                 for (size_t layer_idx = range.begin(); layer_idx < range.end(); ++ layer_idx) {
                     m_print->throw_if_canceled();
-                    m_layers[layer_idx]->make_fills(adaptive_fill_octree.get(), support_fill_octree.get(), lightning_generator.get());
+                    TraceScope trace("infill of layer", layer_idx);
+                    m_layers[layer_idx]->make_fills(adaptive_fill_octree, support_fill_octree, lightning_generator.get(), &fill_cache);
+                    // The slices are final now, build the search structure queried by the G-code export.
+                    m_layers[layer_idx]->build_internal_islands();
                 }
             }
         );
@@ -425,14 +442,16 @@ void PrintObject::infill()
 void PrintObject::ironing()
 {
     if (this->set_started(posIroning)) {
+        TraceScope trace("ironing", this->id().id);
         BOOST_LOG_TRIVIAL(debug) << "Ironing in parallel - start";
+        FillCache fill_cache;
         tbb::parallel_for(
             // Ironing starting with layer 0 to support ironing all surfaces.
             tbb::blocked_range<size_t>(0, m_layers.size()),
-            [this](const tbb::blocked_range<size_t>& range) {
+            [this, &fill_cache](const tbb::blocked_range<size_t>& range) {
                 for (size_t layer_idx = range.begin(); layer_idx < range.end(); ++ layer_idx) {
                     m_print->throw_if_canceled();
-                    m_layers[layer_idx]->make_ironing();
+                    m_layers[layer_idx]->make_ironing(&fill_cache);
                 }
             }
         );
@@ -445,6 +464,7 @@ void PrintObject::ironing()
 void PrintObject::generate_support_spots()
 {
     if (this->set_started(posSupportSpotsSearch)) {
+        TraceScope trace("support spots search", this->id().id);
         BOOST_LOG_TRIVIAL(debug) << "Searching support spots - start";
         m_print->set_status(65, L("Searching support spots"));
         if (!this->shared_regions()->generated_support_points.has_value()) {
@@ -469,6 +489,7 @@ void PrintObject::generate_support_spots()
 void PrintObject::generate_support_material()
 {
     if (this->set_started(posSupportMaterial)) {
+        TraceScope trace("support material", this->id().id);
         this->clear_support_layers();
         if ((this->has_support() && m_layers.size() > 1) || (this->has_raft() && ! m_layers.empty())) {
             m_print->set_status(70, L("Generating support material"));    
@@ -490,6 +511,7 @@ void PrintObject::generate_support_material()
 void PrintObject::estimate_curled_extrusions()
 {
     if (this->set_started(posEstimateCurledExtrusions)) {
+        TraceScope trace("estimate curled extrusions", this->id().id);
         if (this->print()->config().avoid_crossing_curled_overhangs) {
             BOOST_LOG_TRIVIAL(debug) << "Estimating areas with curled extrusions - start";
             m_print->set_status(88, L("Estimating curled extrusions"));
@@ -509,13 +531,36 @@ void PrintObject::estimate_curled_extrusions()
     }
 }
 
-std::pair<FillAdaptive::OctreePtr, FillAdaptive::OctreePtr> PrintObject::prepare_adaptive_infill_data()
+void PrintObject::release_intermediate_data()
+{
+    TraceScope trace("release intermediate data", this->id().id);
+    BOOST_LOG_TRIVIAL(debug) << "Releasing intermediate layer data - start" << log_memory_info();
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, m_layers.size()),
+        [this](const tbb::blocked_range<size_t> &range) {
+            for (size_t layer_idx = range.begin(); layer_idx < range.end(); ++ layer_idx)
+                m_layers[layer_idx]->release_intermediate_data();
+        });
+    // No object step will be executed again before export, the volume slices will not be reused.
+    m_cached_volume_slices.clear();
+    m_cached_volume_slices.shrink_to_fit();
+    BOOST_LOG_TRIVIAL(debug) << "Releasing intermediate layer data - end" << log_memory_info();
+}
+
+std::pair<FillAdaptive::Octree*, FillAdaptive::Octree*> PrintObject::prepare_adaptive_infill_data()
 {
     using namespace FillAdaptive;
 
     auto [adaptive_line_spacing, support_line_spacing] = adaptive_fill_line_spacing(*this);
-    if ((adaptive_line_spacing == 0. && support_line_spacing == 0.) || this->layers().empty())
-        return std::make_pair(OctreePtr(), OctreePtr());
+    if ((adaptive_line_spacing == 0. && support_line_spacing == 0.) || this->layers().empty()) {
+        m_adaptive_fill_octree.reset();
+        m_support_fill_octree.reset();
+        return { nullptr, nullptr };
+    }
+
+    if ((m_adaptive_fill_octree || m_support_fill_octree) &&
+        m_adaptive_fill_octrees_line_spacing == std::make_pair(adaptive_line_spacing, support_line_spacing))
+        // Neither the mesh nor the internal bridges changed since the octrees were built, see invalidate_step().
+        return { m_adaptive_fill_octree.get(), m_support_fill_octree.get() };
 
     indexed_triangle_set mesh = this->model_object()->raw_indexed_triangle_set();
     // Rotate mesh and build octree on it with axis-aligned (standart base) cubes.
@@ -543,9 +588,16 @@ std::pair<FillAdaptive::OctreePtr, FillAdaptive::OctreePtr> PrintObject::prepare
     for (size_t i = 1; i < overhangs.size(); ++ i)
         append(overhangs.front(), std::move(overhangs[i]));
 
-    return std::make_pair(
-        adaptive_line_spacing ? build_octree(mesh, overhangs.front(), adaptive_line_spacing, false) : OctreePtr(),
-        support_line_spacing  ? build_octree(mesh, overhangs.front(), support_line_spacing, true) : OctreePtr());
+    // Both octrees only read the mesh and the overhangs, build them concurrently.
+    OctreePtr adaptive_fill_octree, support_fill_octree;
+    tbb::parallel_invoke(
+        [&]() { if (adaptive_line_spacing) adaptive_fill_octree = build_octree(mesh, overhangs.front(), adaptive_line_spacing, false); },
+        [&]() { if (support_line_spacing)  support_fill_octree  = build_octree(mesh, overhangs.front(), support_line_spacing, true); });
+
+    m_adaptive_fill_octree               = std::move(adaptive_fill_octree);
+    m_support_fill_octree                = std::move(support_fill_octree);
+    m_adaptive_fill_octrees_line_spacing = { adaptive_line_spacing, support_line_spacing };
+    return { m_adaptive_fill_octree.get(), m_support_fill_octree.get() };
 }
 
 FillLightning::GeneratorPtr PrintObject::prepare_lightning_infill_data()
@@ -779,8 +831,11 @@ bool PrintObject::invalidate_state_by_config_options(
         } else if (
                opt_key == "seam_position"
             || opt_key == "seam_preferred_direction"
-            || opt_key == "seam_preferred_direction_jitter"
-            || opt_key == "support_material_speed"
+            || opt_key == "seam_preferred_direction_jitter") {
+            m_seam_data.reset();
+            invalidated |= m_print->invalidate_step(psGCodeExport);
+        } else if (
+               opt_key == "support_material_speed"
             || opt_key == "support_material_interface_speed"
             || opt_key == "bridge_speed"
             || opt_key == "enable_dynamic_overhang_speeds"
@@ -816,6 +871,15 @@ bool PrintObject::invalidate_state_by_config_options(
 bool PrintObject::invalidate_step(PrintObjectStep step)
 {
 	bool invalidated = Inherited::invalidate_step(step);
+
+    // Seams are placed on perimeters.
+    if (step == posSlice || step == posPerimeters)
+        m_seam_data.reset();
+    // Adaptive infill octrees are built over the mesh and the internal bridges.
+    if (step == posSlice || step == posPerimeters || step == posPrepareInfill) {
+        m_adaptive_fill_octree.reset();
+        m_support_fill_octree.reset();
+    }
     
     // propagate to dependent steps
     if (step == posPerimeters) {
@@ -831,6 +895,7 @@ bool PrintObject::invalidate_step(PrintObjectStep step)
                                                posSupportMaterial, posEstimateCurledExtrusions});
         invalidated |= m_print->invalidate_steps({ psSkirtBrim });
         m_slicing_params.valid = false;
+        m_tree_model_volumes.reset();
     } else if (step == posSupportMaterial) {
         invalidated |= m_print->invalidate_steps({ psSkirtBrim,  });
         invalidated |= this->invalidate_steps({ posEstimateCurledExtrusions });
@@ -854,6 +919,10 @@ bool PrintObject::invalidate_all_steps()
     bool result = Inherited::invalidate_all_steps() | m_print->invalidate_all_steps();
 	// Then reset some of the depending values.
 	m_slicing_params.valid = false;
+    m_seam_data.reset();
+    m_adaptive_fill_octree.reset();
+    m_support_fill_octree.reset();
+    m_tree_model_volumes.reset();
 	return result;
 }
 
@@ -1165,6 +1234,64 @@ void PrintObject::process_external_surfaces()
     }
 } // void PrintObject::process_external_surfaces()
 
+namespace {
+
+// Unions or intersections of per layer polygons over runs of consecutive layers, answered from a sparse table:
+// m_levels[k - 1][i] aggregates the layers <i, i + 2^k). Both union and intersection are idempotent, thus any run <begin, end)
+// up to max_run long is covered by just two overlapping table entries and it costs a single Clipper operation
+// instead of one Clipper operation per layer of the run. The table is built in parallel, one level after the other.
+class LayerRunAggregator
+{
+public:
+    using LayerPolygons = std::function<const Polygons&(size_t)>;
+    using Operation     = std::function<Polygons(const Polygons&, const Polygons&)>;
+
+    LayerRunAggregator(size_t num_layers, size_t max_run, LayerPolygons layer_polygons, Operation op, const std::function<void()> &throw_if_canceled) :
+        m_layer_polygons(std::move(layer_polygons)), m_op(std::move(op))
+    {
+        for (size_t level = 1; (size_t(1) << level) <= std::min(max_run, num_layers); ++ level) {
+            const size_t           half = size_t(1) << (level - 1);
+            std::vector<Polygons> &dst  = m_levels.emplace_back(num_layers + 1 - 2 * half);
+            tbb::parallel_for(tbb::blocked_range<size_t>(0, dst.size()),
+                [this, level, half, &dst, &throw_if_canceled](const tbb::blocked_range<size_t> &range) {
+                    for (size_t i = range.begin(); i < range.end(); ++ i) {
+                        throw_if_canceled();
+                        dst[i] = m_op(this->entry(level - 1, i), this->entry(level - 1, i + half));
+                    }
+                });
+        }
+    }
+
+    // Aggregate the layers <begin, end).
+    Polygons operator()(size_t begin, size_t end) const
+    {
+        assert(begin < end);
+        size_t level = 0;
+        while (level < m_levels.size() && (size_t(2) << level) <= end - begin)
+            ++ level;
+        const size_t step   = size_t(1) << level;
+        Polygons     out    = this->entry(level, begin);
+        // Runs longer than max_run passed to the constructor are folded from multiple table entries.
+        for (size_t i = begin + step; i < end; i += step)
+            out = m_op(out, this->entry(level, std::min(i + step, end) - step));
+        return out;
+    }
+
+    static Polygons union_op(const Polygons &a, const Polygons &b)
+        { return a.empty() ? b : b.empty() ? a : union_(a, b); }
+    static Polygons intersection_op(const Polygons &a, const Polygons &b)
+        { return a.empty() || b.empty() ? Polygons() : intersection(a, b); }
+
+private:
+    const Polygons& entry(size_t level, size_t idx) const { return level == 0 ? m_layer_polygons(idx) : m_levels[level - 1][idx]; }
+
+    LayerPolygons                      m_layer_polygons;
+    Operation                          m_op;
+    std::vector<std::vector<Polygons>> m_levels;
+};
+
+} // namespace
+
 void PrintObject::discover_vertical_shells()
 {
     BOOST_LOG_TRIVIAL(info) << "Discovering vertical shells..." << log_memory_info();
@@ -1319,10 +1446,53 @@ void PrintObject::discover_vertical_shells()
             BOOST_LOG_TRIVIAL(debug) << "Discovering vertical shells for region " << region_id << " in parallel - end : cache top / bottom";
         }
 
+        // For each layer, the runs of layers above <idx_layer + 1, top_end) and below <bottom_begin, idx_layer),
+        // which project their top resp. bottom surfaces to this layer to guarantee a minimum shell thickness.
+        const PrintRegionConfig               &region_config = region.config();
+        std::vector<std::pair<size_t, size_t>> shell_runs(num_layers);
+        size_t                                 max_top_run = 0, max_bottom_run = 0;
+        for (size_t idx_layer = 0; idx_layer < num_layers; ++ idx_layer) {
+            size_t top_end = idx_layer + 1;
+            if (int n_top_layers = region_config.top_solid_layers.value; n_top_layers > 0) {
+                coordf_t print_z = m_layers[idx_layer]->print_z;
+                while (top_end < num_layers &&
+                    (int(top_end) < int(idx_layer) + n_top_layers ||
+                        m_layers[top_end]->print_z - print_z < region_config.top_solid_min_thickness - EPSILON))
+                    ++ top_end;
+            }
+            size_t bottom_begin = idx_layer;
+            if (int n_bottom_layers = region_config.bottom_solid_layers.value; n_bottom_layers > 0) {
+                coordf_t bottom_z = m_layers[idx_layer]->bottom_z();
+                while (bottom_begin > 0 &&
+                    (int(bottom_begin) - 1 > int(idx_layer) - n_bottom_layers ||
+                        bottom_z - m_layers[bottom_begin - 1]->bottom_z() < region_config.bottom_solid_min_thickness - EPSILON))
+                    -- bottom_begin;
+            }
+            shell_runs[idx_layer] = { bottom_begin, top_end };
+            max_top_run    = std::max(max_top_run, top_end - idx_layer - 1);
+            max_bottom_run = std::max(max_bottom_run, idx_layer - bottom_begin);
+        }
+
+        // Instead of accumulating the shell of each layer by one union per layer of its runs, accumulate the top / bottom surfaces
+        // and the holes over power of two long runs of layers once, shared by all the layers.
+        BOOST_LOG_TRIVIAL(debug) << "Discovering vertical shells for region " << region_id << " in parallel - start : aggregate top / bottom";
+        auto throw_if_canceled = [this]() { m_print->throw_if_canceled(); };
+        LayerRunAggregator top_surfaces(num_layers, max_top_run,
+            [&cache_top_botom_regions](size_t i) -> const Polygons& { return cache_top_botom_regions[i].top_surfaces; },
+            LayerRunAggregator::union_op, throw_if_canceled);
+        LayerRunAggregator bottom_surfaces(num_layers, max_bottom_run,
+            [&cache_top_botom_regions](size_t i) -> const Polygons& { return cache_top_botom_regions[i].bottom_surfaces; },
+            LayerRunAggregator::union_op, throw_if_canceled);
+        // The holes of this layer are intersected with the holes of both runs, thus the holes are aggregated over <bottom_begin, top_end).
+        LayerRunAggregator holes_intersection(num_layers, max_top_run + max_bottom_run + 1,
+            [&cache_top_botom_regions](size_t i) -> const Polygons& { return cache_top_botom_regions[i].holes; },
+            LayerRunAggregator::intersection_op, throw_if_canceled);
+        m_print->throw_if_canceled();
+
         BOOST_LOG_TRIVIAL(debug) << "Discovering vertical shells for region " << region_id << " in parallel - start : ensure vertical wall thickness";
         tbb::parallel_for(
             tbb::blocked_range<size_t>(0, num_layers, grain_size),
-            [this, region_id, &cache_top_botom_regions]
+            [this, region_id, &shell_runs, &top_surfaces, &bottom_surfaces, &holes_intersection]
             (const tbb::blocked_range<size_t>& range) {
                 // printf("discover_vertical_shells from %d to %d\n", range.begin(), range.end());
                 for (size_t idx_layer = range.begin(); idx_layer < range.end(); ++ idx_layer) {
@@ -1334,7 +1504,6 @@ void PrintObject::discover_vertical_shells()
 
                     Layer       	        *layer          = m_layers[idx_layer];
                     LayerRegion 	        *layerm         = layer->m_regions[region_id];
-                    const PrintRegionConfig &region_config  = layerm->region().config();
 
 #ifdef SLIC3R_DEBUG_SLICE_PROCESSING
                     layerm->export_region_slices_to_svg_debug("3_discover_vertical_shells-initial");
@@ -1372,45 +1541,13 @@ void PrintObject::discover_vertical_shells()
                         }
                     }
 #endif /* SLIC3R_DEBUG_SLICE_PROCESSING */
-			        polygons_append(holes, cache_top_botom_regions[idx_layer].holes);
-			        if (int n_top_layers = region_config.top_solid_layers.value; n_top_layers > 0) {
-                        // Gather top regions projected to this layer.
-                        coordf_t print_z = layer->print_z;
-	                    for (int i = int(idx_layer) + 1; 
-	                        i < int(cache_top_botom_regions.size()) && 
-	                        	(i < int(idx_layer) + n_top_layers ||
-	                        		m_layers[i]->print_z - print_z < region_config.top_solid_min_thickness - EPSILON);
-	                        ++ i) {
-	                        const DiscoverVerticalShellsCacheEntry &cache = cache_top_botom_regions[i];
-							if (! holes.empty())
-								holes = intersection(holes, cache.holes);
-							if (! cache.top_surfaces.empty()) {
-		                        polygons_append(shell, cache.top_surfaces);
-		                        // Running the union_ using the Clipper library piece by piece is cheaper 
-		                        // than running the union_ all at once.
-	                            shell = union_(shell);
-	                        }
-	                    }
-	                }
-	                if (int n_bottom_layers = region_config.bottom_solid_layers.value; n_bottom_layers > 0) {
-                        // Gather bottom regions projected to this layer.
-                        coordf_t bottom_z = layer->bottom_z();
-	                    for (int i = int(idx_layer) - 1;
-	                        i >= 0 &&
-	                        	(i > int(idx_layer) - n_bottom_layers ||
-	                        		bottom_z - m_layers[i]->bottom_z() < region_config.bottom_solid_min_thickness - EPSILON);
-	                        -- i) {
-	                        const DiscoverVerticalShellsCacheEntry &cache = cache_top_botom_regions[i];
-							if (! holes.empty())
-								holes = intersection(holes, cache.holes);
-							if (! cache.bottom_surfaces.empty()) {
-		                        polygons_append(shell, cache.bottom_surfaces);
-		                        // Running the union_ using the Clipper library piece by piece is cheaper 
-		                        // than running the union_ all at once.
-		                        shell = union_(shell);
-		                    }
-	                    }
-	                }
+                    // Gather top and bottom regions projected to this layer, intersect the holes over all these layers.
+                    const auto [bottom_begin, top_end] = shell_runs[idx_layer];
+                    holes = holes_intersection(bottom_begin, top_end);
+                    if (top_end > idx_layer + 1)
+                        shell = top_surfaces(idx_layer + 1, top_end);
+                    if (bottom_begin < idx_layer)
+                        shell = LayerRunAggregator::union_op(shell, bottom_surfaces(bottom_begin, idx_layer));
 #ifdef SLIC3R_DEBUG_SLICE_PROCESSING
                     {
         				Slic3r::SVG svg(debug_out_path("discover_vertical_shells-perimeters-before-union-%d.svg", debug_idx), get_extents(shell));
@@ -1592,7 +1729,9 @@ void PrintObject::bridge_over_infill()
         double             bridge_angle;
     };
 
-    std::unordered_map<const LayerSlice *, std::vector<ModifiedSurface>> bridging_surfaces;
+    // Modified surfaces per layer and per LayerSlice of that layer, indexed by the LayerSlice index.
+    // Each slot is written by a single thread only.
+    std::vector<std::vector<std::vector<ModifiedSurface>>> bridging_surfaces(this->layers().size());
 
     tbb::parallel_for(tbb::blocked_range<size_t>(0, this->layers().size()), [po = static_cast<const PrintObject*>(this),
                                                                              &bridging_surfaces](tbb::blocked_range<size_t> r) {
@@ -1630,7 +1769,7 @@ void PrintObject::bridge_over_infill()
                     // NOTE: we are keeping even very small internal ensuring overhangs here. The aim is to later differentiate between expanding wall ensuring regions
                     // where briding them would be conterproductive, and small ensuring islands that expand into large ones, where bridging is quite necessary
                     region_internal_solids.erase(std::remove_if(region_internal_solids.begin(), region_internal_solids.end(),
-                                                                [slice_island_tree](const Surface *s) {
+                                                                [&slice_island_tree](const Surface *s) {
                                                                     if (slice_island_tree.outside(s->expolygon.contour.first_point()) > 0) {
                                                                         return true;
                                                                     }
@@ -1658,12 +1797,51 @@ void PrintObject::bridge_over_infill()
             }
 
             // generate sparse infill polylines from lower layers to get anchorable polylines
-            Polylines lower_layer_polylines = po->get_layer(lidx)->lower_layer->generate_sparse_infill_polylines_for_anchoring();
+            const Polylines lower_layer_polylines = po->get_layer(lidx)->lower_layer->generate_sparse_infill_polylines_for_anchoring();
+            // Index the anchorable polylines by their bounding boxes, so that each candidate clips just the polylines close to it
+            // instead of all the polylines of the lower layer.
+            AABBTreeIndirect::Tree<2, coord_t> lower_layer_polylines_tree;
+            {
+                std::vector<AABBTreeIndirect::BoundingBoxWrapper> bboxes;
+                bboxes.reserve(lower_layer_polylines.size());
+                for (size_t i = 0; i < lower_layer_polylines.size(); ++ i)
+                    bboxes.emplace_back(i, get_extents(lower_layer_polylines[i]));
+                lower_layer_polylines_tree.build_modify_input(bboxes);
+            }
+            auto lower_layer_polylines_near = [&lower_layer_polylines, &lower_layer_polylines_tree](const Polygons &area) {
+                Polylines   out;
+                BoundingBox bbox = get_extents(area);
+                AABBTreeIndirect::traverse(lower_layer_polylines_tree,
+                    AABBTreeIndirect::intersecting(AABBTreeIndirect::BoundingBoxWrapper::BoundingBox(bbox.min, bbox.max)),
+                    [&lower_layer_polylines, &out](const AABBTreeIndirect::Tree<2, coord_t>::Node &node) {
+                        out.emplace_back(lower_layer_polylines[node.idx]);
+                        return true;
+                    });
+                return out;
+            };
 
-            for (std::pair<const LayerSlice *, SurfacesPtr> candidates : bridging_surface_candidates) {
-                if (candidates.second.empty()) {
-                    continue;
-                };
+            // Sparse infill of each region closed over small gaps, independent of the island processed, thus shared by all the islands of this layer.
+            std::unordered_map<const LayerRegion *, std::pair<Polygons, Polygons>> closed_infill_per_region;
+            for (const auto &surface_region : surface_to_region) {
+                const LayerRegion *r = surface_region.second;
+                if (closed_infill_per_region.find(r) == closed_infill_per_region.end()) {
+                    const Flow &flow          = r->bridging_flow(frSolidInfill, true);
+                    Polygons    infill_region = to_polygons(r->fill_expolygons());
+                    closed_infill_per_region[r] = { closing(infill_region, scale_(0.1)),
+                                                    closing(infill_region, scale_(0.01), scale_(0.01) + 4.0 * flow.scaled_spacing()) };
+                }
+            }
+
+            // The islands of a layer are independent of each other, process them in parallel.
+            std::vector<std::pair<const LayerSlice *, SurfacesPtr>> candidates_per_slice;
+            for (auto &candidates : bridging_surface_candidates)
+                if (! candidates.second.empty())
+                    candidates_per_slice.emplace_back(candidates.first, std::move(candidates.second));
+            bridging_surfaces[lidx].assign(layer->lslices_ex.size(), {});
+            tbb::parallel_for(tbb::blocked_range<size_t>(0, candidates_per_slice.size()), [&](const tbb::blocked_range<size_t> &range) {
+            for (size_t candidates_idx = range.begin(); candidates_idx < range.end(); ++ candidates_idx) {
+                std::pair<const LayerSlice *, SurfacesPtr> &candidates = candidates_per_slice[candidates_idx];
+                std::vector<ModifiedSurface>               &slice_bridging_surfaces = bridging_surfaces[lidx][candidates.first - layer->lslices_ex.data()];
 
                 auto region_has_special_infill = [](const LayerRegion *layer_region) {
                     switch (layer_region->region().config().fill_pattern.value) {
@@ -1679,7 +1857,7 @@ void PrintObject::bridge_over_infill()
                 Polygons special_infill{};
                 Polygons not_sparse_infill{};
                 {
-                    double                        bottom_z = layer->print_z - max_bridge_flow_height[candidates.first] - EPSILON;
+                    double                        bottom_z = layer->print_z - max_bridge_flow_height.at(candidates.first) - EPSILON;
                     std::vector<LayerSlice::Link> current_links{};
                     current_links.insert(current_links.end(), candidates.first->overlaps_below.begin(),
                                          candidates.first->overlaps_below.end());
@@ -1733,22 +1911,22 @@ void PrintObject::bridge_over_infill()
 
                     lower_layers_sparse_infill.insert(lower_layers_sparse_infill.end(), special_infill.begin(), special_infill.end());
 
-                    if (shrink(lower_layers_sparse_infill, 3.0 * scale_(max_bridge_flow_height[candidates.first])).empty()) {
+                    if (shrink(lower_layers_sparse_infill, 3.0 * scale_(max_bridge_flow_height.at(candidates.first))).empty()) {
                         continue;
                     }
                 }
 
-                if (expansion_space[candidates.first].empty() && special_infill.empty()) {
+                if (expansion_space.at(candidates.first).empty() && special_infill.empty()) {
                     // there is no expansion space to which can anchors expand on this island, add back original polygons and skip the island
                     for (const Surface *candidate : candidates.second) {
-                        bridging_surfaces[candidates.first].emplace_back(candidate, to_polygons(candidate->expolygon),
-                                                                        surface_to_region[candidate], 0);
+                        slice_bridging_surfaces.emplace_back(candidate, to_polygons(candidate->expolygon),
+                                                                        surface_to_region.at(candidate), 0);
                     }
                     continue;
                 }
 
                 Polygons expand_area;
-                for (const Surface *sparse_infill : expansion_space[candidates.first]) {
+                for (const Surface *sparse_infill : expansion_space.at(candidates.first)) {
                     assert(sparse_infill->surface_type == stInternal);
                     Polygons a = to_polygons(sparse_infill->expolygon);
                     expand_area.insert(expand_area.end(), a.begin(), a.end());
@@ -1767,17 +1945,12 @@ void PrintObject::bridge_over_infill()
                 });
 
                 std::unordered_map<const LayerRegion *, std::pair<Polygons, Polygons>> infill_and_deep_infill_polygons_per_region;
-                for (const auto &surface_region : surface_to_region) {
-                    const LayerRegion *r = surface_region.second;
-                    if (infill_and_deep_infill_polygons_per_region.find(r) == infill_and_deep_infill_polygons_per_region.end()) {
-                        const Flow &flow                 = r->bridging_flow(frSolidInfill, true);
-                        Polygons    infill_region        = to_polygons(r->fill_expolygons());
-                        Polygons    deep_infill_area     = closing(infill_region, scale_(0.01), scale_(0.01) + 4.0 * flow.scaled_spacing());
-                        Polygons    solid_supported_area = expand(not_sparse_infill, 4.0 * flow.scaled_spacing());
-                        infill_and_deep_infill_polygons_per_region[r] = {closing(infill_region, scale_(0.1)),
-                                                                         intersection(lower_layers_sparse_infill,
-                                                                                      diff(deep_infill_area, solid_supported_area))};
-                    }
+                for (const auto &[r, closed_infill] : closed_infill_per_region) {
+                    const Flow &flow                 = r->bridging_flow(frSolidInfill, true);
+                    Polygons    solid_supported_area = expand(not_sparse_infill, 4.0 * flow.scaled_spacing());
+                    infill_and_deep_infill_polygons_per_region[r] = { closed_infill.first,
+                                                                      intersection(lower_layers_sparse_infill,
+                                                                                   diff(closed_infill.second, solid_supported_area)) };
                 }
 
                 // Lower layers sparse infill sections gathered
@@ -1785,14 +1958,14 @@ void PrintObject::bridge_over_infill()
                 // bridging. These areas we then expand (within the surrounding sparse infill only!)
                 // to touch the infill polylines on previous layer.
                 for (const Surface *candidate : candidates.second) {
-                    const Flow &flow = surface_to_region[candidate]->bridging_flow(frSolidInfill, true);
+                    const Flow &flow = surface_to_region.at(candidate)->bridging_flow(frSolidInfill, true);
                     assert(candidate->surface_type == stInternalSolid);
 
                     Polygons bridged_area = intersection(expand(to_polygons(candidate->expolygon), flow.scaled_spacing()),
-                                                         infill_and_deep_infill_polygons_per_region[surface_to_region[candidate]].first);
+                                                         infill_and_deep_infill_polygons_per_region[surface_to_region.at(candidate)].first);
                     // cut off parts which are not over sparse infill - material overflow
                     Polygons worth_bridging = intersection(bridged_area,
-                                                           infill_and_deep_infill_polygons_per_region[surface_to_region[candidate]].second);
+                                                           infill_and_deep_infill_polygons_per_region[surface_to_region.at(candidate)].second);
                     if (worth_bridging.empty()) {
                         continue;
                     }
@@ -1802,7 +1975,7 @@ void PrintObject::bridge_over_infill()
                     max_area.insert(max_area.end(), bridged_area.begin(), bridged_area.end());
                     max_area = closing(max_area, flow.scaled_spacing());
 
-                    Polylines anchors = intersection_pl(lower_layer_polylines, max_area);
+                    Polylines anchors = intersection_pl(lower_layer_polylines_near(max_area), max_area);
                     if (!special_infill.empty()) {
                         auto part_over_special_infill = intersection(special_infill, bridged_area);
                         auto artificial_boundary = to_polylines(expand(part_over_special_infill, 0.5 * flow.scaled_width())); 
@@ -1826,7 +1999,7 @@ void PrintObject::bridge_over_infill()
 
                     double bridging_angle = 0;
                     Polygons tmp_expanded_area  = expand(bridged_area, 3.0 * flow.scaled_spacing());
-                    for (const ModifiedSurface& s : bridging_surfaces[candidates.first]) {
+                    for (const ModifiedSurface& s : slice_bridging_surfaces) {
                         if (!intersection(s.new_polys, tmp_expanded_area).empty()) {
                             bridging_angle = s.bridge_angle;
                             break;
@@ -1895,7 +2068,7 @@ void PrintObject::bridge_over_infill()
                         if (bridging_angle == 0) {
                             bridging_angle = 0.001;
                         }
-                        switch (surface_to_region[candidate]->region().config().fill_pattern.value) {
+                        switch (surface_to_region.at(candidate)->region().config().fill_pattern.value) {
                         case ipHilbertCurve: bridging_angle += 0.25 * PI; break;
                         case ipOctagramSpiral: bridging_angle += (1.0 / 16.0) * PI; break;
                         default: break;
@@ -2083,7 +2256,7 @@ void PrintObject::bridge_over_infill()
                     expanded_bridged_area = opening(expanded_bridged_area, flow.scaled_spacing());
                     expand_area           = diff(expand_area, expanded_bridged_area);
 
-                    bridging_surfaces[candidates.first].emplace_back(candidate, expanded_bridged_area, surface_to_region[candidate],
+                    slice_bridging_surfaces.emplace_back(candidate, expanded_bridged_area, surface_to_region.at(candidate),
                                                                              bridging_angle);
 #ifdef DEBUG_BRIDGE_OVER_INFILL
                     debug_draw(std::to_string(lidx) + "cadidate_added", to_lines(expanded_bridged_area), to_lines(bridged_area),
@@ -2091,6 +2264,7 @@ void PrintObject::bridge_over_infill()
 #endif
                 }
             }
+            });
         }
         });
 
@@ -2102,9 +2276,10 @@ void PrintObject::bridge_over_infill()
                 Layer *layer = po->get_layer(lidx);
                 std::unordered_map<const LayerRegion*, Surfaces> new_surfaces;
 
-                for (const LayerSlice &slice : layer->lslices_ex) {
-                    if (const auto &modified_surfaces = bridging_surfaces.find(&slice);
-                        modified_surfaces != bridging_surfaces.end()) {
+                for (size_t slice_idx = 0; slice_idx < bridging_surfaces[lidx].size(); ++ slice_idx) {
+                    const LayerSlice                   &slice             = layer->lslices_ex[slice_idx];
+                    const std::vector<ModifiedSurface> &modified_surfaces = bridging_surfaces[lidx][slice_idx];
+                    if (! modified_surfaces.empty()) {
                         std::unordered_set<LayerRegion *> regions_to_check;
                         for (const LayerIsland &island : slice.islands) {
                             regions_to_check.insert(layer->regions()[island.perimeters.region()]);
@@ -2119,12 +2294,12 @@ void PrintObject::bridge_over_infill()
                         }
 
                         Polygons cut_from_infill{};
-                        for (const auto &surface : modified_surfaces->second) {
+                        for (const auto &surface : modified_surfaces) {
                             cut_from_infill.insert(cut_from_infill.end(), surface.new_polys.begin(), surface.new_polys.end());
                         }
 
                         for (const LayerRegion *region : regions_to_check) {
-                            for (const ModifiedSurface &s : modified_surfaces->second) {
+                            for (const ModifiedSurface &s : modified_surfaces) {
                                 for (const Surface &surface : region->m_fill_surfaces.surfaces) {
                                     if (s.original_surface == &surface) {
                                         Surface tmp(surface, {});
@@ -2248,9 +2423,23 @@ PrintRegionConfig region_config_from_model_volume(const PrintRegionConfig &defau
 
 void PrintObject::update_slicing_parameters()
 {
-    if (!m_slicing_params.valid)
+    if (!m_slicing_params.valid) {
         m_slicing_params = SlicingParameters::create_from_config(
             this->print()->config(), m_config, this->model_object()->max_z(), this->object_extruders());
+        m_layers_print_z_max.reset();
+    }
+}
+
+coordf_t PrintObject::layers_print_z_max() const
+{
+    if (! m_layers_print_z_max) {
+        //FIXME It is quite expensive to generate object layers just to get the print height!
+        std::vector<coordf_t> layer_height_profile;
+        update_layer_height_profile(*this->model_object(), m_slicing_params, layer_height_profile);
+        std::vector<coordf_t> layers = generate_object_layers(m_slicing_params, layer_height_profile);
+        m_layers_print_z_max = layers.empty() ? 0. : layers.back();
+    }
+    return *m_layers_print_z_max;
 }
 
 SlicingParameters PrintObject::slicing_parameters(const DynamicPrintConfig& full_config, const ModelObject& model_object, float object_max_z)
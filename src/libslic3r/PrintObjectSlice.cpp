@@ -5,8 +5,14 @@
 #include "MultiMaterialSegmentation.hpp"
 #include "Print.hpp"
 #include "ShortestPath.hpp"
+#include "Trace.hpp"
+#include "Utils.hpp"
+#include "libslic3r_version.h"
 
+#include <boost/filesystem.hpp>
+#include <boost/functional/hash.hpp>
 #include <boost/log/trivial.hpp>
+#include <boost/nowide/cstdio.hpp>
 
 #include <tbb/parallel_for.h>
 
@@ -109,6 +115,89 @@ struct VolumeSlices
     std::vector<ExPolygons> slices;
 };
 
+// Hash of the parameters a ModelVolume is sliced with, see slice_volume().
+static size_t slicing_params_hash(const ModelVolume &volume, const MeshSlicingParamsEx &params)
+{
+    size_t seed = 0;
+    const Transform3d trafo = params.trafo * volume.get_matrix();
+    for (size_t i = 0; i < 16; ++ i)
+        boost::hash_combine(seed, trafo.matrix().data()[i]);
+    boost::hash_combine(seed, int(params.mode));
+    boost::hash_combine(seed, int(params.mode_below));
+    boost::hash_combine(seed, params.slicing_mode_normal_below_layer);
+    boost::hash_combine(seed, params.closing_radius);
+    boost::hash_combine(seed, params.extra_offset);
+    boost::hash_combine(seed, params.resolution);
+    return seed;
+}
+
+// Slice a single triangle mesh at the zs inside ranges (all zs if ranges is null).
+// Slices of the last slicing of the same volume with the same parameters are taken over from cache_old for the zs that did not change,
+// only the remaining zs are sliced. The slices of this call are stored into cache_new.
+static std::vector<ExPolygons> slice_volume_cached(
+    const ModelVolume                                       &volume,
+    const std::vector<float>                                &zs,
+    const std::vector<t_layer_height_range>                 *ranges,
+    const MeshSlicingParamsEx                               &params,
+    std::vector<CachedVolumeSlices>                         &cache_old,
+    std::vector<CachedVolumeSlices>                         &cache_new,
+    const std::function<void()>                             &throw_on_cancel_callback)
+{
+    std::vector<ExPolygons> out;
+    if (zs.empty() || volume.mesh().its.indices.empty() || (ranges != nullptr && ranges->empty()))
+        return out;
+
+    // Indices of zs to be sliced. The ranges are closed at the bottom and open at the top, they are sorted and non overlapping.
+    std::vector<size_t> idx_sliced;
+    idx_sliced.reserve(zs.size());
+    if (ranges == nullptr) {
+        for (size_t i = 0; i < zs.size(); ++ i)
+            idx_sliced.emplace_back(i);
+    } else {
+        size_t i = 0;
+        for (const t_layer_height_range &range : *ranges) {
+            for (; i < zs.size() && zs[i] < range.first; ++ i) ;
+            for (; i < zs.size() && zs[i] < range.second; ++ i)
+                idx_sliced.emplace_back(i);
+        }
+    }
+    if (idx_sliced.empty())
+        return out;
+
+    CachedVolumeSlices cached { volume.id(), volume.get_mesh_shared_ptr(), slicing_params_hash(volume, params) };
+    auto it_old = std::find_if(cache_old.begin(), cache_old.end(), [&cached](const CachedVolumeSlices &c)
+        { return c.volume_id == cached.volume_id && c.mesh == cached.mesh && c.params_hash == cached.params_hash; });
+
+    cached.zs.reserve(idx_sliced.size());
+    cached.slices.assign(idx_sliced.size(), ExPolygons());
+    std::vector<float>  z_missing;
+    std::vector<size_t> idx_missing;
+    for (size_t i = 0; i < idx_sliced.size(); ++ i) {
+        const float z = zs[idx_sliced[i]];
+        cached.zs.emplace_back(z);
+        if (it_old != cache_old.end())
+            if (auto it = std::lower_bound(it_old->zs.begin(), it_old->zs.end(), z); it != it_old->zs.end() && *it == z) {
+                cached.slices[i] = std::move(it_old->slices[it - it_old->zs.begin()]);
+                continue;
+            }
+        z_missing.emplace_back(z);
+        idx_missing.emplace_back(i);
+    }
+    if (! z_missing.empty()) {
+        std::vector<ExPolygons> layers = slice_volume(volume, z_missing, params, throw_on_cancel_callback);
+        assert(layers.size() == z_missing.size());
+        for (size_t i = 0; i < layers.size(); ++ i)
+            cached.slices[idx_missing[i]] = std::move(layers[i]);
+    }
+    BOOST_LOG_TRIVIAL(trace) << "Slicing volume " << volume.id().id << ": " << z_missing.size() << " of " << idx_sliced.size() << " layers sliced, the rest reused";
+
+    out.assign(zs.size(), ExPolygons());
+    for (size_t i = 0; i < idx_sliced.size(); ++ i)
+        out[idx_sliced[i]] = cached.slices[i];
+    cache_new.emplace_back(std::move(cached));
+    return out;
+}
+
 static inline bool model_volume_needs_slicing(const ModelVolume &mv)
 {
     ModelVolumeType type = mv.type();
@@ -119,6 +208,7 @@ static inline bool model_volume_needs_slicing(const ModelVolume &mv)
 // Apply closing radius.
 // Apply positive XY compensation to ModelVolumeType::MODEL_PART and ModelVolumeType::PARAMETER_MODIFIER, not to ModelVolumeType::NEGATIVE_VOLUME.
 // Apply contour simplification.
+// Reuse the slices of slices_cache at unchanged Z heights, replace slices_cache with the slices produced.
 static std::vector<VolumeSlices> slice_volumes_inner(
     const PrintConfig                                        &print_config,
     const PrintObjectConfig                                  &print_object_config,
@@ -126,12 +216,14 @@ static std::vector<VolumeSlices> slice_volumes_inner(
     ModelVolumePtrs                                           model_volumes,
     const std::vector<PrintObjectRegions::LayerRangeRegions> &layer_ranges,
     const std::vector<float>                                 &zs,
+    std::vector<CachedVolumeSlices>                          &slices_cache,
     const std::function<void()>                              &throw_on_cancel_callback)
 {
     model_volumes_sort_by_id(model_volumes);
 
     std::vector<VolumeSlices> out;
     out.reserve(model_volumes.size());
+    std::vector<CachedVolumeSlices> slices_cache_new;
 
     std::vector<t_layer_height_range> slicing_ranges;
     if (layer_ranges.size() > 1)
@@ -175,7 +267,9 @@ static std::vector<VolumeSlices> slice_volumes_inner(
                     }
                     out.push_back({
                         model_volume->id(), 
-                        slice_volume(*model_volume, zs, params, throw_on_cancel_callback)
+                        print_config.spiral_vase ?
+                            slice_volume(*model_volume, zs, params, throw_on_cancel_callback) :
+                            slice_volume_cached(*model_volume, zs, nullptr, params, slices_cache, slices_cache_new, throw_on_cancel_callback)
                     });
                 }
             } else {
@@ -187,13 +281,233 @@ static std::vector<VolumeSlices> slice_volumes_inner(
                 if (! slicing_ranges.empty())
                     out.push_back({ 
                         model_volume->id(), 
-                        slice_volume(*model_volume, zs, slicing_ranges, params, throw_on_cancel_callback)
+                        slice_volume_cached(*model_volume, zs, &slicing_ranges, params, slices_cache, slices_cache_new, throw_on_cancel_callback)
                     });
             }
             if (! out.empty() && out.back().slices.empty())
                 out.pop_back();
         }
 
+    slices_cache = std::move(slices_cache_new);
+    return out;
+}
+
+// Persistent cache of the slices produced by slice_volumes_inner(), enabled by set_slice_cache_dir().
+// The slices are stored in binary files named by a hash of all the inputs of slice_volumes_inner().
+// The files are only valid for the PrusaSlicer version that produced them.
+namespace SliceCache {
+
+static constexpr const uint32_t file_magic   = 0x43535350; // "PSSC"
+static constexpr const uint32_t file_version = 2;
+
+// Identity of a cache entry: all inputs of slice_volumes_inner() serialized. The cache file is named by the hash of the data.
+// The file stores the full key, which is compared when loading, thus a hash collision does not return slices of another object.
+struct Key {
+    std::string data;
+    size_t      hash { 0 };
+
+    bool operator==(const Key &rhs) const { return this->hash == rhs.hash && this->data == rhs.data; }
+    bool operator!=(const Key &rhs) const { return ! (*this == rhs); }
+
+    template<typename T>
+    void append(const T &value) { this->data.append(reinterpret_cast<const char*>(&value), sizeof(T)); }
+    // Append an array of plain old data (including fixed size Eigen vectors) with its size.
+    template<typename T>
+    void append_array(const T *ptr, size_t size) {
+        this->append(uint64_t(size));
+        this->data.append(reinterpret_cast<const char*>(ptr), size * sizeof(T));
+    }
+    template<typename T>
+    void append_array(const std::vector<T> &v) { this->append_array(v.data(), v.size()); }
+    void append_matrix(const Transform3d &trafo) { this->append_array(trafo.matrix().data(), 16); }
+};
+
+// All inputs of slice_volumes_inner(). Model volumes are expected to be sorted by their ObjectIDs.
+static Key key(
+    const PrintConfig                                        &print_config,
+    const PrintObjectConfig                                  &print_object_config,
+    const Transform3d                                        &object_trafo,
+    const ModelVolumePtrs                                    &model_volumes,
+    const std::vector<PrintObjectRegions::LayerRangeRegions> &layer_ranges,
+    const std::vector<float>                                 &zs)
+{
+    Key out;
+    const std::string version(SLIC3R_VERSION);
+    out.append_array(version.data(), version.size());
+    out.append(print_config.resolution.value);
+    out.append(print_config.spiral_vase.value);
+    out.append(uint64_t(print_config.nozzle_diameter.size()));
+    out.append(print_object_config.slice_closing_radius.value);
+    out.append(int(print_object_config.slicing_mode.value));
+    out.append(print_object_config.xy_size_compensation.value);
+    out.append_matrix(object_trafo);
+    out.append_array(zs);
+    out.append(uint64_t(model_volumes.size()));
+    for (const ModelVolume *model_volume : model_volumes) {
+        out.append(int(model_volume->type()));
+        out.append(model_volume->is_mm_painted());
+        out.append_matrix(model_volume->get_matrix());
+        out.append_array(model_volume->mesh().its.vertices);
+        out.append_array(model_volume->mesh().its.indices);
+    }
+    out.append(uint64_t(layer_ranges.size()));
+    for (const PrintObjectRegions::LayerRangeRegions &layer_range : layer_ranges) {
+        out.append(layer_range.layer_height_range.first);
+        out.append(layer_range.layer_height_range.second);
+        // Store the volumes of this range by their index into model_volumes, ObjectIDs are not persistent.
+        for (size_t i = 0; i < model_volumes.size(); ++ i)
+            out.append(layer_range.has_volume(model_volumes[i]->id()));
+        if (print_config.spiral_vase) {
+            // Spiral vase slicing depends on bottom_solid_layers / bottom_solid_min_thickness of the regions.
+            out.append(uint64_t(layer_range.volume_regions.size()));
+            for (const PrintObjectRegions::VolumeRegion &volume_region : layer_range.volume_regions)
+                out.append(uint64_t(volume_region.region->config_hash()));
+        }
+    }
+    out.hash = std::hash<std::string>()(out.data);
+    return out;
+}
+
+static boost::filesystem::path file_path(const Key &key)
+{
+    char name[64];
+    sprintf(name, "%016llx.slices", (unsigned long long)key.hash);
+    return boost::filesystem::path(slice_cache_dir()) / name;
+}
+
+template<typename T>
+static inline void write_pod(FILE *f, const T &value) { ::fwrite(&value, sizeof(T), 1, f); }
+template<typename T>
+static inline bool read_pod(FILE *f, T &value) { return ::fread(&value, sizeof(T), 1, f) == 1; }
+
+static void write_points(FILE *f, const Points &pts)
+{
+    write_pod(f, uint64_t(pts.size()));
+    ::fwrite(pts.data(), sizeof(Point), pts.size(), f);
+}
+
+static bool read_points(FILE *f, Points &pts)
+{
+    uint64_t n;
+    if (! read_pod(f, n))
+        return false;
+    pts.assign(size_t(n), Point());
+    return ::fread(pts.data(), sizeof(Point), pts.size(), f) == pts.size();
+}
+
+static void store(const Key &key, const std::vector<VolumeSlices> &volume_slices, const ModelVolumePtrs &model_volumes)
+{
+    boost::filesystem::path path     = file_path(key);
+    std::string             path_tmp = path.string() + ".tmp";
+    {
+        FilePtr out{ boost::nowide::fopen(path_tmp.c_str(), "wb") };
+        if (out.f == nullptr) {
+            BOOST_LOG_TRIVIAL(error) << "Slice cache: Failed to open " << path_tmp << " for writing";
+            return;
+        }
+        write_pod(out.f, file_magic);
+        write_pod(out.f, file_version);
+        write_pod(out.f, uint64_t(key.data.size()));
+        ::fwrite(key.data.data(), 1, key.data.size(), out.f);
+        write_pod(out.f, uint64_t(volume_slices.size()));
+        for (const VolumeSlices &vs : volume_slices) {
+            auto it = std::find_if(model_volumes.begin(), model_volumes.end(), [&vs](const ModelVolume *mv) { return mv->id() == vs.volume_id; });
+            assert(it != model_volumes.end());
+            write_pod(out.f, uint64_t(it - model_volumes.begin()));
+            write_pod(out.f, uint64_t(vs.slices.size()));
+            for (const ExPolygons &expolygons : vs.slices) {
+                write_pod(out.f, uint64_t(expolygons.size()));
+                for (const ExPolygon &expoly : expolygons) {
+                    write_points(out.f, expoly.contour.points);
+                    write_pod(out.f, uint64_t(expoly.holes.size()));
+                    for (const Polygon &hole : expoly.holes)
+                        write_points(out.f, hole.points);
+                }
+            }
+        }
+        if (::ferror(out.f)) {
+            out.close();
+            boost::nowide::remove(path_tmp.c_str());
+            BOOST_LOG_TRIVIAL(error) << "Slice cache: Failed to write " << path_tmp;
+            return;
+        }
+    }
+    if (rename_file(path_tmp, path.string())) {
+        boost::nowide::remove(path_tmp.c_str());
+        BOOST_LOG_TRIVIAL(error) << "Slice cache: Failed to rename " << path_tmp << " to " << path.string();
+    }
+}
+
+static bool load(const Key &key, std::vector<VolumeSlices> &volume_slices, const ModelVolumePtrs &model_volumes, size_t num_layers)
+{
+    boost::filesystem::path path = file_path(key);
+    FilePtr in{ boost::nowide::fopen(path.string().c_str(), "rb") };
+    if (in.f == nullptr)
+        return false;
+    uint32_t magic, version;
+    uint64_t key_size, num_volumes;
+    if (! read_pod(in.f, magic) || magic != file_magic || ! read_pod(in.f, version) || version != file_version ||
+        ! read_pod(in.f, key_size) || key_size != key.data.size())
+        return false;
+    Key stored_key;
+    stored_key.data.assign(size_t(key_size), 0);
+    if (::fread(stored_key.data.data(), 1, stored_key.data.size(), in.f) != stored_key.data.size())
+        return false;
+    stored_key.hash = key.hash;
+    if (stored_key != key || ! read_pod(in.f, num_volumes) || num_volumes > model_volumes.size())
+        return false;
+    std::vector<VolumeSlices> out { size_t(num_volumes) };
+    for (VolumeSlices &vs : out) {
+        uint64_t volume_idx, num_slices;
+        if (! read_pod(in.f, volume_idx) || volume_idx >= model_volumes.size() || ! read_pod(in.f, num_slices) || num_slices != num_layers)
+            return false;
+        vs.volume_id = model_volumes[size_t(volume_idx)]->id();
+        vs.slices.assign(size_t(num_slices), ExPolygons());
+        for (ExPolygons &expolygons : vs.slices) {
+            uint64_t num_expolygons;
+            if (! read_pod(in.f, num_expolygons))
+                return false;
+            expolygons.assign(size_t(num_expolygons), ExPolygon());
+            for (ExPolygon &expoly : expolygons) {
+                uint64_t num_holes;
+                if (! read_points(in.f, expoly.contour.points) || ! read_pod(in.f, num_holes))
+                    return false;
+                expoly.holes.assign(size_t(num_holes), Polygon());
+                for (Polygon &hole : expoly.holes)
+                    if (! read_points(in.f, hole.points))
+                        return false;
+            }
+        }
+    }
+    volume_slices = std::move(out);
+    return true;
+}
+
+} // namespace SliceCache
+
+// slice_volumes_inner() with the results stored to / loaded from the persistent slice cache if enabled.
+static std::vector<VolumeSlices> slice_volumes_inner_cached(
+    const PrintConfig                                        &print_config,
+    const PrintObjectConfig                                  &print_object_config,
+    const Transform3d                                        &object_trafo,
+    ModelVolumePtrs                                           model_volumes,
+    const std::vector<PrintObjectRegions::LayerRangeRegions> &layer_ranges,
+    const std::vector<float>                                 &zs,
+    std::vector<CachedVolumeSlices>                          &slices_cache,
+    const std::function<void()>                              &throw_on_cancel_callback)
+{
+    if (slice_cache_dir().empty())
+        return slice_volumes_inner(print_config, print_object_config, object_trafo, std::move(model_volumes), layer_ranges, zs, slices_cache, throw_on_cancel_callback);
+
+    model_volumes_sort_by_id(model_volumes);
+    std::vector<VolumeSlices> out;
+    SliceCache::Key key = SliceCache::key(print_config, print_object_config, object_trafo, model_volumes, layer_ranges, zs);
+    if (SliceCache::load(key, out, model_volumes, zs.size())) {
+        BOOST_LOG_TRIVIAL(debug) << "Slicing volumes - loaded from the slice cache";
+    } else {
+        out = slice_volumes_inner(print_config, print_object_config, object_trafo, model_volumes, layer_ranges, zs, slices_cache, throw_on_cancel_callback);
+        SliceCache::store(key, out, model_volumes);
+    }
     return out;
 }
 
@@ -499,6 +813,7 @@ void PrintObject::slice()
 {
     if (! this->set_started(posSlice))
         return;
+    TraceScope trace("slice", this->id().id);
     m_print->set_status(10, L("Processing triangulated mesh"));
     std::vector<coordf_t> layer_height_profile;
     this->update_layer_height_profile(*this->model_object(), m_slicing_params, layer_height_profile);
@@ -699,9 +1014,9 @@ void PrintObject::slice_volumes()
 
     std::vector<float>                   slice_zs      = zs_from_layers(m_layers);
     std::vector<std::vector<ExPolygons>> region_slices = slices_to_regions(this->model_object()->volumes, *m_shared_regions, slice_zs,
-        slice_volumes_inner(
+        slice_volumes_inner_cached(
             print->config(), this->config(), this->trafo_centered(),
-            this->model_object()->volumes, m_shared_regions->layer_ranges, slice_zs, throw_on_cancel_callback),
+            this->model_object()->volumes, m_shared_regions->layer_ranges, slice_zs, m_cached_volume_slices, throw_on_cancel_callback),
         throw_on_cancel_callback);
 
     for (size_t region_id = 0; region_id < region_slices.size(); ++ region_id) {
@@ -59,6 +59,13 @@ protected:
     Scanline m_scanlines;
     Rasterizer m_rasterizer;
     
+    static TPixel to_pixel(const TColor &color)
+    {
+        TPixel px;
+        px.set(color);
+        return px;
+    }
+
     void flipy(agg::path_storage &path) const
     {
         path.flip_y(0, double(m_resolution.height_px));
@@ -130,7 +137,7 @@ public:
               GammaFn &&        gammafn)
         : m_resolution(res)
         , m_pxdim_scaled(SCALING_FACTOR, SCALING_FACTOR)
-        , m_buf(res.pixels())
+        , m_buf(res.pixels(), to_pixel(background))
         , m_rbuf(reinterpret_cast<TValue *>(m_buf.data()),
                  unsigned(res.width_px),
                  unsigned(res.height_px),
@@ -146,8 +153,9 @@ public:
             m_pxdim_scaled.w_mm /= pd.w_mm;
             m_pxdim_scaled.h_mm /= pd.h_mm;
         }
+        // The buffer is initialized with the background already, clearing
+        // it once more would be another pass over a display sized buffer.
         m_renderer.color(foreground);
-        clear(background);
         
         m_rasterizer.gamma(gammafn);
     }
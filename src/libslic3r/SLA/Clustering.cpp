@@ -96,11 +96,11 @@ ClusteredPoints cluster(
     double dist,
     unsigned max_points)
 {
-    // A spatial index for querying the nearest points
-    Index3D sindex;
+    // A spatial index for querying the nearest points, bulk loaded
+    auto els = reserve_vector<PointIndexEl>(indices.size());
+    for(auto idx : indices) els.emplace_back(pointfn(idx), idx);
 
-    // Build the index
-    for(auto idx : indices) sindex.insert( std::make_pair(pointfn(idx), idx));
+    Index3D sindex(els.begin(), els.end());
 
     return cluster(sindex, max_points,
                    [dist, max_points](const Index3D& sidx, const PointIndexEl& p)
@@ -116,11 +116,11 @@ ClusteredPoints cluster(
     std::function<bool(const PointIndexEl&, const PointIndexEl&)> predicate,
     unsigned max_points)
 {
-    // A spatial index for querying the nearest points
-    Index3D sindex;
+    // A spatial index for querying the nearest points, bulk loaded
+    auto els = reserve_vector<PointIndexEl>(indices.size());
+    for(auto idx : indices) els.emplace_back(pointfn(idx), idx);
 
-    // Build the index
-    for(auto idx : indices) sindex.insert( std::make_pair(pointfn(idx), idx));
+    Index3D sindex(els.begin(), els.end());
 
     return cluster(sindex, max_points,
                    [max_points, predicate](const Index3D& sidx, const PointIndexEl& p)
@@ -135,12 +135,12 @@ ClusteredPoints cluster(
 
 ClusteredPoints cluster(const Eigen::MatrixXd& pts, double dist, unsigned max_points)
 {
-    // A spatial index for querying the nearest points
-    Index3D sindex;
-
-    // Build the index
+    // A spatial index for querying the nearest points, bulk loaded
+    auto els = reserve_vector<PointIndexEl>(size_t(pts.rows()));
     for(Eigen::Index i = 0; i < pts.rows(); i++)
-        sindex.insert(std::make_pair(Vec3d(pts.row(i)), unsigned(i)));
+        els.emplace_back(Vec3d(pts.row(i)), unsigned(i));
+
+    Index3D sindex(els.begin(), els.end());
 
     return cluster(sindex, max_points,
                    [dist, max_points](const Index3D& sidx, const PointIndexEl& p)
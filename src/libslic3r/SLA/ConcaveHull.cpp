@@ -61,13 +61,20 @@ void ConcaveHull::add_connector_rectangles(const Points &centroids,
     // connector sticks are routed.
     Point cc = centroid(centroids);
 
-    PointIndex ctrindex;
-    unsigned  idx = 0;
-    for(const Point &ct : centroids) ctrindex.insert(to_vec3(ct), idx++);
+    auto ctrpts = reserve_vector<Vec3d>(centroids.size());
+    auto ctrels = reserve_vector<PointIndexEl>(centroids.size());
+    for (const Point &ct : centroids) {
+        ctrpts.emplace_back(to_vec3(ct));
+        ctrels.emplace_back(ctrpts.back(), unsigned(ctrels.size()));
+    }
+
+    // The index is read only, thus it is bulk loaded and queried in a batch.
+    const PointIndex ctrindex(ctrels);
+    const std::vector<std::vector<PointIndexEl>> results = ctrindex.nearest(ctrpts, 2);
 
     m_polys.reserve(m_polys.size() + centroids.size());
 
-    idx = 0;
+    unsigned idx = 0;
     for (const Point &c : centroids) {
         thr();
 
@@ -77,7 +84,7 @@ void ConcaveHull::add_connector_rectangles(const Points &centroids,
 
         const Point &ct = centroids[idx];
 
-        std::vector<PointIndexEl> result = ctrindex.nearest(to_vec3(ct), 2);
+        const std::vector<PointIndexEl> &result = results[idx];
 
         double dist = max_dist;
         for (const PointIndexEl &el : result)
@@ -554,56 +554,87 @@ void DefaultSupportTree::classify()
 
 void DefaultSupportTree::routing_to_ground()
 {
-    ClusterEl cl_centroids;
-    cl_centroids.reserve(m_pillar_clusters.size());
-
-    for (auto &cl : m_pillar_clusters) {
-        m_thr();
-
-        // place all the centroid head positions into the index. We
-        // will query for alternative pillar positions. If a sidehead
-        // cannot connect to the cluster centroid, we have to search
-        // for another head with a full pillar. Also when there are two
-        // elements in the cluster, the centroid is arbitrary and the
-        // sidehead is allowed to connect to a nearby pillar to
-        // increase structural stability.
+    // The centroid head of every cluster and the route of its pillar to the
+    // ground. Both depend only on the cluster and the mesh, so the clusters
+    // are processed concurrently. The routes are inserted into the builder
+    // in cluster order afterwards, keeping the element ids reproducible.
+    struct ClusterRoute {
+        long              centroid = -1; // Head ID, -1 for an empty cluster
+        GroundPillarRoute route;
+    };
 
-        if (cl.empty()) continue;
+    std::vector<ClusterRoute> cl_routes(m_pillar_clusters.size());
 
-           // get the current cluster centroid
-        auto &      thr    = m_thr;
-        const auto &points = m_points;
+    execution::for_each(
+        suptree_ex_policy, size_t(0), m_pillar_clusters.size(),
+        [this, &cl_routes](size_t ci) {
+            m_thr();
 
-        long lcid = cluster_centroid(
-            cl, [&points](size_t idx) { return points.row(long(idx)); },
-            [thr](const Vec3d &p1, const Vec3d &p2) {
-                thr();
-                return distance(Vec2d(p1.x(), p1.y()), Vec2d(p2.x(), p2.y()));
-            });
+            // place all the centroid head positions into the index. We
+            // will query for alternative pillar positions. If a sidehead
+            // cannot connect to the cluster centroid, we have to search
+            // for another head with a full pillar. Also when there are two
+            // elements in the cluster, the centroid is arbitrary and the
+            // sidehead is allowed to connect to a nearby pillar to
+            // increase structural stability.
+
+            const ClusterEl &cl = m_pillar_clusters[ci];
+            if (cl.empty()) return;
+
+            // get the current cluster centroid
+            auto &      thr    = m_thr;
+            const auto &points = m_points;
+
+            long lcid = cluster_centroid(
+                cl, [&points](size_t idx) { return points.row(long(idx)); },
+                [thr](const Vec3d &p1, const Vec3d &p2) {
+                    thr();
+                    return distance(Vec2d(p1.x(), p1.y()), Vec2d(p2.x(), p2.y()));
+                });
+
+            assert(lcid >= 0);
+            unsigned hid = cl[size_t(lcid)]; // Head ID
+
+            const Head &h = m_builder.head(hid);
+            const Junction j = h.junction();
+
+            cl_routes[ci].centroid = hid;
+            cl_routes[ci].route = search_ground_pillar_route(suptree_ex_policy,
+                                                             m_sm, j.pos, h.dir,
+                                                             j.r, j.r);
+        },
+        execution::max_concurrency(suptree_ex_policy));
 
-        assert(lcid >= 0);
-        unsigned hid = cl[size_t(lcid)]; // Head ID
+    for (const ClusterRoute &clr : cl_routes) {
+        m_thr();
 
-        cl_centroids.emplace_back(hid);
+        if (clr.centroid < 0) continue;
 
-        Head &h = m_builder.head(hid);
+        Head &h = m_builder.head(unsigned(clr.centroid));
 
-        if (!create_ground_pillar(h.junction(), h.dir, h.id)) {
+        long pillar_id = add_ground_pillar(m_builder, m_sm, clr.route, h.id);
+        if (pillar_id < 0) {
             BOOST_LOG_TRIVIAL(warning)
-                << "Pillar cannot be created for support point id: " << hid;
+                << "Pillar cannot be created for support point id: " << clr.centroid;
             m_iheads_onmodel.emplace_back(h.id);
             continue;
         }
+
+        // Save the pillar endpoint in the spatial index
+        m_pillar_index.guarded_insert(m_builder.pillar(pillar_id).endpt,
+                                      unsigned(pillar_id));
     }
 
     // now we will go through the clusters ones again and connect the
     // sidepoints with the cluster centroid (which is a ground pillar)
     // or a nearby pillar if the centroid is unreachable.
-    size_t ci = 0;
-    for (const std::vector<unsigned> &cl : m_pillar_clusters) {
+    for (size_t ci = 0; ci < m_pillar_clusters.size(); ++ci) {
         m_thr();
 
-        auto cidx = cl_centroids[ci++];
+        const ClusterEl &cl = m_pillar_clusters[ci];
+        if (cl_routes[ci].centroid < 0) continue;
+
+        auto cidx = unsigned(cl_routes[ci].centroid);
 
         auto q = m_pillar_index.query(m_builder.head(cidx).junction_point(), 1);
         if (!q.empty()) {
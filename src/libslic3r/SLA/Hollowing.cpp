@@ -14,6 +14,7 @@
 #include <libslic3r/QuadricEdgeCollapse.hpp>
 #include <libslic3r/SLA/SupportTreeMesher.hpp>
 #include <libslic3r/Execution/ExecutionSeq.hpp>
+#include <libslic3r/Execution/ExecutionTBB.hpp>
 #include <libslic3r/Model.hpp>
 
 #include <libslic3r/MeshBoolean.hpp>
@@ -819,43 +820,59 @@ int hollow_mesh_and_drill(indexed_triangle_set &hollowed_mesh,
 
     std::uniform_real_distribution<float> dist(0., float(EPSILON));
     auto holes_mesh_cgal = MeshBoolean::cgal::triangle_mesh_to_cgal({}, {});
-    indexed_triangle_set part_to_drill = hollowed_mesh;
 
     std::mt19937 m_rng{std::random_device{}()};
 
-    for (size_t i = 0; i < drainholes.size(); ++i) {
-        sla::DrainHole holept = drainholes[i];
-
+    // The holes are slightly perturbed in the order of the holes, so that
+    // the random sequence does not depend on the scheduling below.
+    std::vector<sla::DrainHole> holepts(drainholes.begin(), drainholes.end());
+    for (sla::DrainHole &holept : holepts) {
         holept.normal += Vec3f{dist(m_rng), dist(m_rng), dist(m_rng)};
         holept.normal.normalize();
         holept.pos += Vec3f{dist(m_rng), dist(m_rng), dist(m_rng)};
-        indexed_triangle_set m = holept.to_mesh();
-
-        part_to_drill.indices.clear();
-        auto bb = bounding_box(m);
-        Eigen::AlignedBox<float, 3> ebb{bb.min.cast<float>(),
-                                        bb.max.cast<float>()};
+    }
 
-        AABBTreeIndirect::traverse(
-            tree,
-            AABBTreeIndirect::intersecting(ebb),
-            [&part_to_drill, &hollowed_mesh](const auto& node)
-            {
-                part_to_drill.indices.emplace_back(hollowed_mesh.indices[node.idx]);
-                // continue traversal
-                return true;
-            });
+    // Check the part of the mesh around every hole for self intersections
+    // independently, only the holes that pass are united afterwards.
+    std::vector<MeshBoolean::cgal::CGALMeshPtr> cgal_holes(holepts.size());
+    execution::for_each(
+        ex_tbb, size_t(0), holepts.size(),
+        [&holepts, &cgal_holes, &tree, &hollowed_mesh](size_t i) {
+            indexed_triangle_set m = holepts[i].to_mesh();
+
+            indexed_triangle_set part_to_drill;
+            part_to_drill.vertices = hollowed_mesh.vertices;
+            auto bb = bounding_box(m);
+            Eigen::AlignedBox<float, 3> ebb{bb.min.cast<float>(),
+                                            bb.max.cast<float>()};
+
+            AABBTreeIndirect::traverse(
+                tree,
+                AABBTreeIndirect::intersecting(ebb),
+                [&part_to_drill, &hollowed_mesh](const auto& node)
+                {
+                    part_to_drill.indices.emplace_back(hollowed_mesh.indices[node.idx]);
+                    // continue traversal
+                    return true;
+                });
+
+            auto cgal_meshpart = MeshBoolean::cgal::triangle_mesh_to_cgal(
+                remove_unconnected_vertices(part_to_drill));
+
+            if (MeshBoolean::cgal::does_self_intersect(*cgal_meshpart))
+                return;
 
-        auto cgal_meshpart = MeshBoolean::cgal::triangle_mesh_to_cgal(
-            remove_unconnected_vertices(part_to_drill));
+            cgal_holes[i] = MeshBoolean::cgal::triangle_mesh_to_cgal(m);
+        },
+        execution::max_concurrency(ex_tbb));
 
-        if (MeshBoolean::cgal::does_self_intersect(*cgal_meshpart)) {
+    for (size_t i = 0; i < cgal_holes.size(); ++i) {
+        if (!cgal_holes[i]) {
             on_hole_fail(i);
             continue;
         }
 
-        auto cgal_hole = MeshBoolean::cgal::triangle_mesh_to_cgal(m);
-        MeshBoolean::cgal::plus(*holes_mesh_cgal, *cgal_hole);
+        MeshBoolean::cgal::plus(*holes_mesh_cgal, *cgal_holes[i]);
     }
 
     auto ret = static_cast<int>(HollowMeshResult::Ok);
@@ -9,25 +9,39 @@
 #include <cstdint>
 
 #include <libslic3r/ExPolygon.hpp>
+#include <libslic3r/PNGReadWrite.hpp>
 
 namespace Slic3r {
 
 namespace sla {
 
 // Raw byte buffer paired with its size. Suitable for compressed image data.
+// The buffer may hold the encoded data compressed by raw deflate, see deflated(),
+// to be stored into a zip archive without compressing them again.
 class EncodedRaster {
 protected:
     std::vector<uint8_t> m_buffer;
     std::string m_ext;
+    // Size and CRC-32 of the encoded data before they were deflated.
+    size_t   m_inflated_size = 0;
+    uint32_t m_crc32 = 0;
+    bool     m_deflated = false;
 public:
     EncodedRaster() = default;
     explicit EncodedRaster(std::vector<uint8_t> &&buf, std::string ext)
         : m_buffer(std::move(buf)), m_ext(std::move(ext))
     {}
+    EncodedRaster(std::vector<uint8_t> &&deflated_buf, std::string ext, size_t inflated_size, uint32_t crc32)
+        : m_buffer(std::move(deflated_buf)), m_ext(std::move(ext)), m_inflated_size(inflated_size), m_crc32(crc32), m_deflated(true)
+    {}
     
     size_t size() const { return m_buffer.size(); }
     const void * data() const { return m_buffer.data(); }
     const char * extension() const { return m_ext.c_str(); }
+
+    bool deflated() const { return m_deflated; }
+    size_t inflated_size() const { return m_inflated_size; }
+    uint32_t crc32() const { return m_crc32; }
 };
 
 /// Type that represents a resolution in pixels.
@@ -97,6 +111,7 @@ public:
 };
 
 struct PNGRasterEncoder {
+    png::EncodeMode mode = png::EncodeMode::Default;
     EncodedRaster operator()(const void *ptr, size_t w, size_t h, size_t num_components);
 };
 
@@ -5,7 +5,6 @@
 #include <libslic3r/Execution/ExecutionTBB.hpp>
 #include <libslic3r/Execution/ExecutionSeq.hpp>
 
-#include <libslic3r/Optimize/BruteforceOptimizer.hpp>
 #include <libslic3r/Optimize/NLoptOptimizer.hpp>
 
 #include "libslic3r/SLAPrint.hpp"
@@ -13,6 +12,7 @@
 
 #include <libslic3r/Geometry.hpp>
 
+#include <atomic>
 #include <thread>
 
 namespace Slic3r { namespace sla {
@@ -47,15 +47,15 @@ template<class T> Vec<3, T> normal(const std::array<Vec<3, T>, 3> &tri)
     return U.cross(V).normalized();
 }
 
-template<class T, class AccessFn>
-T sum_score(AccessFn &&accessfn, size_t facecount, size_t Nthreads)
+template<class T, class EP, class AccessFn>
+T sum_score(const EP &ep, AccessFn &&accessfn, size_t facecount, size_t Nthreads)
 {
     T  initv         = 0.;
     auto   mergefn   = [](T a, T b) { return a + b; };
     size_t grainsize = facecount / Nthreads;
     size_t from = 0, to = facecount;
 
-    return execution::reduce(ex_tbb, from, to, initv, mergefn, accessfn, grainsize);
+    return execution::reduce(ep, from, to, initv, mergefn, accessfn, grainsize);
 }
 
 // Get area and normal of a triangle
@@ -73,36 +73,71 @@ struct Facestats {
     }
 };
 
-// Try to guess the number of support points needed to support a mesh
-double get_misalginment_score(const TriangleMesh &mesh, const Transform3f &tr)
+// Distinct face normals of a mesh with the summed areas and the summed square roots of areas of the faces sharing them.
+// Rotation preserves the face areas, thus the rotation dependent scores are evaluated by rotating just the distinct normals
+// instead of transforming all the triangles and recalculating their normals. Meshes with large planar regions
+// tesselated into many triangles collapse into a small fraction of normals.
+struct FaceNormals {
+    std::vector<Vec3f>  normals;
+    std::vector<double> areas;
+    std::vector<double> sqrt_areas;
+    // Number of faces of the source mesh, the scores are normalized by the face count.
+    size_t              facecount = 0;
+
+    explicit FaceNormals(const TriangleMesh &mesh) : facecount(mesh.its.indices.size())
+    {
+        std::vector<Facestats> stats;
+        stats.reserve(facecount);
+        for (size_t fi = 0; fi < facecount; ++ fi)
+            if (Facestats fc{get_triangle_vertices(mesh, fi)}; fc.area > 0. && fc.normal.allFinite())
+                stats.emplace_back(fc);
+        std::sort(stats.begin(), stats.end(), [](const Facestats &l, const Facestats &r) {
+            return l.normal.x() < r.normal.x() || (l.normal.x() == r.normal.x() &&
+                (l.normal.y() < r.normal.y() || (l.normal.y() == r.normal.y() && l.normal.z() < r.normal.z())));
+        });
+        for (const Facestats &fc : stats) {
+            if (normals.empty() || normals.back() != fc.normal) {
+                normals.emplace_back(fc.normal);
+                areas.emplace_back(0.);
+                sqrt_areas.emplace_back(0.);
+            }
+            areas.back()      += fc.area;
+            sqrt_areas.back() += std::sqrt(fc.area);
+        }
+    }
+};
+
+// Try to guess the number of support points needed to support a mesh.
+// Summed sequentially, the candidate rotations are scored in parallel.
+double get_misalginment_score(const FaceNormals &fn, const Transform3f &tr)
 {
-    if (mesh.its.vertices.empty()) return NaNd;
+    if (fn.facecount == 0) return NaNd;
 
-    auto accessfn = [&mesh, &tr](size_t fi) {
-        Facestats fc{get_transformed_triangle(mesh, tr, fi)};
+    const Matrix3f rot = tr.linear();
+    auto accessfn = [&fn, &rot](size_t ni) {
+        Vec3f normal = rot * fn.normals[ni];
 
-        float score = fc.area
-                      * (std::abs(fc.normal.dot(Vec3f::UnitX()))
-                         + std::abs(fc.normal.dot(Vec3f::UnitY()))
-                         + std::abs(fc.normal.dot(Vec3f::UnitZ())));
+        double score = fn.areas[ni]
+                      * (std::abs(normal.dot(Vec3f::UnitX()))
+                         + std::abs(normal.dot(Vec3f::UnitY()))
+                         + std::abs(normal.dot(Vec3f::UnitZ())));
 
         // We should score against the alignment with the reference planes
         return scaled<int_fast64_t>(score);
     };
 
-    size_t facecount = mesh.its.indices.size();
-    size_t Nthreads  = std::thread::hardware_concurrency();
-    double S = unscaled(sum_score<int_fast64_t>(accessfn, facecount, Nthreads));
+    double S = unscaled(sum_score<int_fast64_t>(ex_seq, accessfn, fn.normals.size(), 1));
 
-    return S / facecount;
+    return S / fn.facecount;
 }
 
-// The score function for a particular face
-inline double get_supportedness_score(const Facestats &fc)
+// The score function for a particular face normal, sqrt_area is the square root of the face area
+// or the sum of square roots of areas of faces sharing the normal.
+inline double get_supportedness_score(const Vec3f &normal, double sqrt_area)
 {
     // Simply get the angle (acos of dot product) between the face normal and
     // the DOWN vector.
-    float cosphi = fc.normal.dot(DOWN);
+    float cosphi = normal.dot(DOWN);
     float phi = 1.f - std::acos(cosphi) / float(PI);
 
     // Make the huge slopes more significant than the smaller slopes
@@ -111,24 +146,28 @@ inline double get_supportedness_score(const Facestats &fc)
     // Multiply with the square root of face area of the current face,
     // the area is less important as it grows.
     // This makes many smaller overhangs a bigger impact.
-    return std::sqrt(fc.area) * POINTS_PER_UNIT_AREA * phi;
+    return sqrt_area * POINTS_PER_UNIT_AREA * phi;
 }
 
-// Try to guess the number of support points needed to support a mesh
-double get_supportedness_score(const TriangleMesh &mesh, const Transform3f &tr)
+inline double get_supportedness_score(const Facestats &fc)
 {
-    if (mesh.its.vertices.empty()) return NaNd;
+    return get_supportedness_score(fc.normal, std::sqrt(fc.area));
+}
 
-    auto accessfn = [&mesh, &tr](size_t fi) {
-        Facestats fc{get_transformed_triangle(mesh, tr, fi)};
-        return scaled<int_fast64_t>(get_supportedness_score(fc));
+// Try to guess the number of support points needed to support a mesh.
+// Summed sequentially, the candidate rotations are scored in parallel.
+double get_supportedness_score(const FaceNormals &fn, const Transform3f &tr)
+{
+    if (fn.facecount == 0) return NaNd;
+
+    const Matrix3f rot = tr.linear();
+    auto accessfn = [&fn, &rot](size_t ni) {
+        return scaled<int_fast64_t>(get_supportedness_score(rot * fn.normals[ni], fn.sqrt_areas[ni]));
     };
 
-    size_t facecount = mesh.its.indices.size();
-    size_t Nthreads  = std::thread::hardware_concurrency();
-    double S = unscaled(sum_score<int_fast64_t>(accessfn, facecount, Nthreads));
+    double S = unscaled(sum_score<int_fast64_t>(ex_seq, accessfn, fn.normals.size(), 1));
 
-    return S / facecount;
+    return S / fn.facecount;
 }
 
 // Find transformed mesh ground level without copy and with parallel reduce.
@@ -170,7 +209,7 @@ double get_supportedness_onfloor_score(const TriangleMesh &mesh,
     };
 
     size_t facecount = mesh.its.indices.size();
-    double S = unscaled(sum_score<int_fast64_t>(accessfn, facecount, Nthreads));
+    double S = unscaled(sum_score<int_fast64_t>(ex_tbb, accessfn, facecount, Nthreads));
 
     return S / facecount;
 }
@@ -252,6 +291,24 @@ std::vector<XYRotation> get_chull_rotations(const TriangleMesh &mesh, size_t max
     return ret;
 }
 
+// Sample the rotations around the X and Y axes in an equidistant grid spanning <-PI, PI> in both axes,
+// row by row, returning at most max_count samples.
+std::vector<XYRotation> get_grid_rotations(size_t max_count)
+{
+    size_t gridsize = std::max(size_t(2), size_t(std::sqrt(max_count)));
+    double step     = 2. * PI / (gridsize - 1);
+
+    auto ret = reserve_vector<XYRotation>(std::min(max_count, gridsize * gridsize));
+    for (size_t iy = 0; iy < gridsize; ++iy)
+        for (size_t ix = 0; ix < gridsize; ++ix) {
+            if (ret.size() == max_count)
+                return ret;
+            ret.push_back({-PI + ix * step, -PI + iy * step});
+        }
+
+    return ret;
+}
+
 // Find the best score from a set of function inputs. Evaluate for every point.
 template<size_t N, class Fn, class It, class StopCond>
 std::array<double, N> find_min_score(Fn &&fn, It from, It to, StopCond &&stopfn)
@@ -288,7 +345,8 @@ template<unsigned MAX_ITER>
 struct RotfinderBoilerplate {
     static constexpr unsigned MAX_TRIES = MAX_ITER;
 
-    int status = 0, prev_status = 0;
+    // The status is updated from the threads evaluating the candidate rotations.
+    std::atomic<int> status{0}, prev_status{0};
     TriangleMesh mesh;
     unsigned max_tries;
     const RotOptimizeParams &params;
@@ -324,13 +382,10 @@ struct RotfinderBoilerplate {
     {}
 
     void statusfn() {
-        int s = status * 100 / max_tries;
-        if (s != prev_status) {
+        int s = status.fetch_add(1) * 100 / int(max_tries);
+        int prev = prev_status.load();
+        if (s > prev && prev_status.compare_exchange_strong(prev, s))
             params.statuscb()(s);
-            prev_status = s;
-        }
-
-        ++status;
     }
 
     bool stopcond() { return ! params.statuscb()(-1); }
@@ -340,28 +395,22 @@ Vec2d find_best_misalignment_rotation(const ModelObject &      mo,
                                       const RotOptimizeParams &params)
 {
     RotfinderBoilerplate<1000> bp{mo, params};
-
-    // Preparing the optimizer.
-    size_t gridsize = std::sqrt(bp.max_tries);
-    opt::Optimizer<opt::AlgBruteForce> solver(
-        opt::StopCriteria{}.max_iterations(bp.max_tries)
-                           .stop_condition([&bp] { return bp.stopcond(); }),
-        gridsize
-    );
+    const FaceNormals          face_normals{bp.mesh};
 
     // We are searching rotations around only two axes x, y. Thus the
-    // problem becomes a 2 dimensional optimization task.
-    // We can specify the bounds for a dimension in the following way:
-    auto bounds = opt::bounds({ {-PI, PI}, {-PI, PI} });
+    // problem becomes a 2 dimensional optimization task, the grid of the
+    // candidate rotations is evaluated in parallel.
+    std::vector<XYRotation> inputs = get_grid_rotations(bp.max_tries);
 
-    auto result = solver.to_max().optimize(
-        [&bp] (const XYRotation &rot)
+    // The misalignment score is maximized.
+    XYRotation result = find_min_score<2>(
+        [&bp, &face_normals] (const XYRotation &rot)
         {
             bp.statusfn();
-            return get_misalginment_score(bp.mesh, to_transform3f(rot));
-        }, opt::initvals({0., 0.}), bounds);
+            return -get_misalginment_score(face_normals, to_transform3f(rot));
+        }, inputs.begin(), inputs.end(), [&bp] { return bp.stopcond(); });
 
-    return {result.optimum[0], result.optimum[1]};
+    return {result[0], result[1]};
 }
 
 Vec2d find_least_supports_rotation(const ModelObject &      mo,
@@ -397,28 +446,19 @@ Vec2d find_least_supports_rotation(const ModelObject &      mo,
         });
 
     } else {
-        // Preparing the optimizer.
-        size_t gridsize = std::sqrt(bp.max_tries); // 2D grid has gridsize^2 calls
-        opt::Optimizer<opt::AlgBruteForce> solver(
-            opt::StopCriteria{}.max_iterations(bp.max_tries)
-                               .stop_condition([&bp] { return bp.stopcond(); }),
-            gridsize
-        );
+        const FaceNormals face_normals{bp.mesh};
 
         // We are searching rotations around only two axes x, y. Thus the
-        // problem becomes a 2 dimensional optimization task.
-        // We can specify the bounds for a dimension in the following way:
-        auto bounds = opt::bounds({ {-PI, PI}, {-PI, PI} });
+        // problem becomes a 2 dimensional optimization task, the grid of the
+        // candidate rotations is evaluated in parallel.
+        std::vector<XYRotation> inputs = get_grid_rotations(bp.max_tries);
 
-        auto result = solver.to_min().optimize(
-            [&bp] (const XYRotation &rot)
+        rot = find_min_score<2>(
+            [&bp, &face_normals] (const XYRotation &rot)
             {
                 bp.statusfn();
-                return get_supportedness_score(bp.mesh, to_transform3f(rot));
-            }, opt::initvals({0., 0.}), bounds);
-
-        // Save the result
-        rot = result.optimum;
+                return get_supportedness_score(face_normals, to_transform3f(rot));
+            }, inputs.begin(), inputs.end(), [&bp] { return bp.stopcond(); });
     }
 
     return {rot[0], rot[1]};
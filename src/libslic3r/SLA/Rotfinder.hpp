@@ -53,7 +53,8 @@ public:
   * an optimum before max iterations are reached. It should return a boolean
   * signaling if the operation may continue (true) or not (false). A status
   * value lower than 0 shall not update the status but still return a valid
-  * continuation indicator.
+  * continuation indicator. The candidate rotations are evaluated in parallel,
+  * thus the callback may be called concurrently from multiple threads.
   *
   * @return Returns the rotations around each axis (x, y, z)
   */
@@ -2,6 +2,7 @@
 
 // for concave hull merging decisions
 #include <libslic3r/BoostAdapter.hpp>
+#include <libslic3r/Execution/ExecutionTBB.hpp>
 
 #ifdef _MSC_VER
 #pragma warning(push)
@@ -26,10 +27,15 @@ public:
     using BoostIndex = boost::geometry::index::rtree< PointIndexEl,
                                                      boost::geometry::index::rstar<16, 4> /* ? */ >;
 
+    Impl() = default;
+    // The range constructor of the rtree uses the packing algorithm.
+    template<class It> Impl(It from, It to) : m_store(from, to) {}
+
     BoostIndex m_store;
 };
 
 PointIndex::PointIndex(): m_impl(new Impl()) {}
+PointIndex::PointIndex(const std::vector<PointIndexEl> &els): m_impl(new Impl(els.begin(), els.end())) {}
 PointIndex::~PointIndex() {}
 
 PointIndex::PointIndex(const PointIndex &cpy): m_impl(new Impl(*cpy.m_impl)) {}
@@ -75,6 +81,18 @@ std::vector<PointIndexEl> PointIndex::nearest(const Vec3d &el, unsigned k = 1) c
     return ret;
 }
 
+std::vector<std::vector<PointIndexEl>> PointIndex::nearest(const std::vector<Vec3d> &pts, unsigned k) const
+{
+    namespace bgi = boost::geometry::index;
+    std::vector<std::vector<PointIndexEl>> ret(pts.size());
+    // Querying the rtree concurrently is safe as long as it is not modified.
+    execution::for_each(ex_tbb, size_t(0), pts.size(), [this, &pts, &ret, k](size_t i) {
+        ret[i].reserve(k);
+        m_impl->m_store.query(bgi::nearest(pts[i], k), std::back_inserter(ret[i]));
+    }, execution::max_concurrency(ex_tbb));
+    return ret;
+}
+
 size_t PointIndex::size() const
 {
     return m_impl->m_store.size();
@@ -99,10 +117,15 @@ public:
     using BoostIndex = boost::geometry::index::
         rtree<BoxIndexEl, boost::geometry::index::rstar<16, 4> /* ? */>;
 
+    Impl() = default;
+    // The range constructor of the rtree uses the packing algorithm.
+    template<class It> Impl(It from, It to) : m_store(from, to) {}
+
     BoostIndex m_store;
 };
 
 BoxIndex::BoxIndex(): m_impl(new Impl()) {}
+BoxIndex::BoxIndex(const std::vector<BoxIndexEl> &els): m_impl(new Impl(els.begin(), els.end())) {}
 BoxIndex::~BoxIndex() {}
 
 BoxIndex::BoxIndex(const BoxIndex &cpy): m_impl(new Impl(*cpy.m_impl)) {}
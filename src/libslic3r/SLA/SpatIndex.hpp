@@ -26,6 +26,10 @@ public:
     PointIndex();
     ~PointIndex();
 
+    // Bulk load the index by the packing algorithm, which is much faster than
+    // inserting the elements one by one and gives a better balanced tree.
+    explicit PointIndex(const std::vector<PointIndexEl> &els);
+
     PointIndex(const PointIndex&);
     PointIndex(PointIndex&&);
     PointIndex& operator=(const PointIndex&);
@@ -41,6 +45,9 @@ public:
 
     std::vector<PointIndexEl> query(std::function<bool(const PointIndexEl&)>) const;
     std::vector<PointIndexEl> nearest(const Vec3d&, unsigned k) const;
+    // Batched k nearest neighbors queries, one result per query point.
+    // The queries are evaluated in parallel.
+    std::vector<std::vector<PointIndexEl>> nearest(const std::vector<Vec3d> &pts, unsigned k) const;
     std::vector<PointIndexEl> query(const Vec3d &v, unsigned k) const // wrapper
     {
         return nearest(v, k);
@@ -66,6 +73,9 @@ public:
     
     BoxIndex();
     ~BoxIndex();
+
+    // Bulk load the index by the packing algorithm, see PointIndex.
+    explicit BoxIndex(const std::vector<BoxIndexEl> &els);
     
     BoxIndex(const BoxIndex&);
     BoxIndex(BoxIndex&&);
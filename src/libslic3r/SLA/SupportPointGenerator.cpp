@@ -350,6 +350,7 @@ std::vector<Vec2f> sample_expolygon(const ExPolygon &expoly, float samples_per_m
         }
 
         size_t num_samples = size_t(ceil(areas.back() * samples_per_mm2));
+        out.reserve(num_samples);
         std::uniform_real_distribution<> random_triangle(0., double(areas.back()));
         std::uniform_real_distribution<> random_float(0., 1.);
         for (size_t i = 0; i < num_samples; ++ i) {
@@ -16,6 +16,7 @@
 #include <libslic3r/TriangleMeshSlicer.hpp>
 
 #include <boost/log/trivial.hpp>
+#include <tbb/parallel_invoke.h>
 #include <libslic3r/I18N.hpp>
 
 #include <libnest2d/tools/benchmark.h>
@@ -109,24 +110,29 @@ std::vector<ExPolygons> slice(const indexed_triangle_set &sup_mesh,
     using Slices = std::vector<ExPolygons>;
 
     auto slices = reserve_vector<Slices>(2);
-
-    if (!sup_mesh.empty()) {
+    if (!sup_mesh.empty())
         slices.emplace_back();
-        slices.back() = slice_mesh_ex(sup_mesh, grid, cr, ctl.cancelfn);
-    }
-
-    if (!pad_mesh.empty()) {
+    if (!pad_mesh.empty())
         slices.emplace_back();
 
-        auto bb     = bounding_box(pad_mesh);
-        auto maxzit = std::upper_bound(grid.begin(), grid.end(), bb.max.z());
-
-        auto cap     = grid.end() - maxzit;
-        auto padgrid = reserve_vector<float>(size_t(cap > 0 ? cap : 0));
-        std::copy(grid.begin(), maxzit, std::back_inserter(padgrid));
-
-        slices.back() = slice_mesh_ex(pad_mesh, padgrid, cr, ctl.cancelfn);
-    }
+    // The support tree and the pad are sliced concurrently.
+    tbb::parallel_invoke(
+        [&]() {
+            if (!sup_mesh.empty())
+                slices.front() = slice_mesh_ex(sup_mesh, grid, cr, ctl.cancelfn);
+        },
+        [&]() {
+            if (!pad_mesh.empty()) {
+                auto bb     = bounding_box(pad_mesh);
+                auto maxzit = std::upper_bound(grid.begin(), grid.end(), bb.max.z());
+
+                auto cap     = grid.end() - maxzit;
+                auto padgrid = reserve_vector<float>(size_t(cap > 0 ? cap : 0));
+                std::copy(grid.begin(), maxzit, std::back_inserter(padgrid));
+
+                slices.back() = slice_mesh_ex(pad_mesh, padgrid, cr, ctl.cancelfn);
+            }
+        });
 
     size_t len = grid.size();
     for (const Slices &slv : slices)
@@ -140,12 +146,12 @@ std::vector<ExPolygons> slice(const indexed_triangle_set &sup_mesh,
     for (auto it = std::next(slices.begin()); it != slices.end(); ++it) {
         for (size_t i = 0; i < len; ++i) {
             Slices &slv = *it;
-            std::copy(slv[i].begin(), slv[i].end(), std::back_inserter(mrg[i]));
+            append(mrg[i], std::move(slv[i]));
             slv[i] = {}; // clear and delete
         }
     }
 
-    return mrg;
+    return std::move(mrg);
 }
 
 }} // namespace Slic3r::sla
@@ -87,46 +87,51 @@ const indexed_triangle_set &SupportTreeBuilder::merged_mesh(size_t steps) const
 {
     if (m_meshcache_valid) return m_meshcache;
     
-    indexed_triangle_set merged;
-    
-    for (auto &head : m_heads) {
-        if (ctl().stopcondition()) break;
-        if (head.is_valid()) its_merge(merged, get_mesh(head, steps));
-    }
-    
-    for (auto &pill : m_pillars) {
-        if (ctl().stopcondition()) break;
-        its_merge(merged, get_mesh(pill, steps));
-    }
+    // The primitives are instanced from the meshes cached by their sizes,
+    // the merged mesh is allocated at once.
+    PrimitiveMeshCache        cache{steps};
+    std::vector<MeshInstance> instances;
+    instances.reserve(m_heads.size() + m_pillars.size() + m_pedestals.size() + m_junctions.size() +
+                      m_bridges.size() + m_crossbridges.size() + m_diffbridges.size() + m_anchors.size());
 
-    for (auto &pedest : m_pedestals) {
-        if (ctl().stopcondition()) break;
-        its_merge(merged, get_mesh(pedest, steps));
-    }
-    
-    for (auto &j : m_junctions) {
-        if (ctl().stopcondition()) break;
-        its_merge(merged, get_mesh(j, steps));
-    }
+    for (auto &head : m_heads)
+        if (head.is_valid()) instances.emplace_back(cache.instance(head));
 
-    for (auto &bs : m_bridges) {
-        if (ctl().stopcondition()) break;
-        its_merge(merged, get_mesh(bs, steps));
-    }
-    
-    for (auto &bs : m_crossbridges) {
-        if (ctl().stopcondition()) break;
-        its_merge(merged, get_mesh(bs, steps));
-    }
+    for (auto &pill : m_pillars)
+        instances.emplace_back(cache.instance(pill));
 
-    for (auto &bs : m_diffbridges) {
-        if (ctl().stopcondition()) break;
-        its_merge(merged, get_mesh(bs, steps));
-    }
+    for (auto &pedest : m_pedestals)
+        instances.emplace_back(cache.instance(pedest));
+
+    for (auto &j : m_junctions)
+        instances.emplace_back(cache.instance(j));
+
+    for (auto &bs : m_bridges)
+        instances.emplace_back(cache.instance(bs));
+
+    for (auto &bs : m_crossbridges)
+        instances.emplace_back(cache.instance(bs));
+
+    for (auto &bs : m_diffbridges)
+        instances.emplace_back(cache.instance(bs));
+
+    for (auto &anch : m_anchors)
+        instances.emplace_back(cache.instance(anch));
+
+    size_t num_vertices = 0, num_indices = 0;
+    for (const MeshInstance &inst : instances)
+        if (inst.mesh) {
+            num_vertices += inst.mesh->vertices.size();
+            num_indices  += inst.mesh->indices.size();
+        }
+
+    indexed_triangle_set merged;
+    merged.vertices.reserve(num_vertices);
+    merged.indices.reserve(num_indices);
 
-    for (auto &anch : m_anchors) {
+    for (const MeshInstance &inst : instances) {
         if (ctl().stopcondition()) break;
-        its_merge(merged, get_mesh(anch, steps));
+        its_append(merged, inst);
     }
 
     if (ctl().stopcondition()) {
@@ -268,4 +268,107 @@ indexed_triangle_set get_mesh(const DiffBridge &br, size_t steps)
     return mesh;
 }
 
+template<class Fn>
+const indexed_triangle_set &PrimitiveMeshCache::get(const Key &key, Fn &&make)
+{
+    auto it = m_meshes.find(key);
+    if (it == m_meshes.end())
+        it = m_meshes.emplace(key, make()).first;
+
+    return it->second;
+}
+
+MeshInstance PrimitiveMeshCache::instance(const Head &h)
+{
+    MeshInstance ret;
+    ret.mesh = &get({Primitive::Pinhead, h.r_pin_mm, h.r_back_mm, h.width_mm}, [this, &h] {
+        return pinhead(h.r_pin_mm, h.r_back_mm, h.width_mm, m_steps);
+    });
+
+    // See get_mesh(const Head &), the head's pointing side is facing upwards.
+    auto quatern = Eigen::Quaternion<float>::FromTwoVectors(Vec3f{0.f, 0.f, -1.f}, h.dir.cast<float>());
+    ret.trafo.translate(h.pos.cast<float>()).rotate(quatern).translate(Vec3f{0.f, 0.f, -float(h.fullwidth() - h.r_back_mm)});
+
+    return ret;
+}
+
+MeshInstance PrimitiveMeshCache::instance(const Pillar &p)
+{
+    MeshInstance ret;
+    if (p.height > EPSILON) {
+        ret.mesh = &get({Primitive::Halfcone, p.r_end, p.r_start, 0.}, [this, &p] {
+            return halfcone(1., p.r_end, p.r_start, Vec3d::Zero(), m_steps);
+        });
+        ret.trafo.translate(p.endpt.cast<float>()).scale(Vec3f{1.f, 1.f, float(p.height)});
+    }
+
+    return ret;
+}
+
+MeshInstance PrimitiveMeshCache::instance(const Pedestal &p)
+{
+    MeshInstance ret;
+    if (p.height > 0.) {
+        ret.mesh = &get({Primitive::Halfcone, p.r_bottom, p.r_top, 0.}, [this, &p] {
+            return halfcone(1., p.r_bottom, p.r_top, Vec3d::Zero(), m_steps);
+        });
+        ret.trafo.translate(p.pos.cast<float>()).scale(Vec3f{1.f, 1.f, float(p.height)});
+    }
+
+    return ret;
+}
+
+MeshInstance PrimitiveMeshCache::instance(const Junction &j)
+{
+    MeshInstance ret;
+    ret.mesh = &get({Primitive::Sphere, j.r, 0., 0.}, [this, &j] {
+        return sphere(j.r, make_portion(0, PI), 2 * PI / m_steps);
+    });
+    ret.trafo.translate(j.pos.cast<float>());
+
+    return ret;
+}
+
+MeshInstance PrimitiveMeshCache::instance(const Bridge &br)
+{
+    MeshInstance ret;
+    ret.mesh = &get({Primitive::Cylinder, br.r, 0., 0.}, [this, &br] {
+        return cylinder(br.r, 1., m_steps);
+    });
+
+    Vec3d v = br.endp - br.startp;
+    auto quatern = Eigen::Quaternion<float>::FromTwoVectors(Vec3f{0.f, 0.f, 1.f}, v.normalized().cast<float>());
+    ret.trafo.translate(br.startp.cast<float>()).rotate(quatern).scale(Vec3f{1.f, 1.f, float(v.norm())});
+
+    return ret;
+}
+
+MeshInstance PrimitiveMeshCache::instance(const DiffBridge &br)
+{
+    MeshInstance ret;
+    double h = br.get_length();
+    if (h > 0.) {
+        ret.mesh = &get({Primitive::Halfcone, br.r, br.end_r, 0.}, [this, &br] {
+            return halfcone(1., br.r, br.end_r, Vec3d::Zero(), m_steps);
+        });
+        auto quatern = Eigen::Quaternion<float>::FromTwoVectors(Vec3f{0.f, 0.f, 1.f}, br.get_dir().cast<float>());
+        ret.trafo.translate(br.startp.cast<float>()).rotate(quatern).scale(Vec3f{1.f, 1.f, float(h)});
+    }
+
+    return ret;
+}
+
+void its_append(indexed_triangle_set &its, const MeshInstance &inst)
+{
+    if (!inst.mesh)
+        return;
+
+    const auto offset = int(its.vertices.size());
+    for (const Vec3f &p : inst.mesh->vertices)
+        its.vertices.emplace_back(inst.trafo * p);
+
+    for (const Vec3i &face : inst.mesh->indices)
+        its.indices.emplace_back(face + Vec3i::Constant(offset));
+}
+
 }} // namespace Slic3r::sla
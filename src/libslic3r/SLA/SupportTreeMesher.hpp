@@ -5,6 +5,9 @@
 
 #include "libslic3r/SLA/SupportTreeBuilder.hpp"
 #include "libslic3r/TriangleMesh.hpp"
+
+#include <map>
+#include <tuple>
 //#include "libslic3r/SLA/Contour3D.hpp"
 
 namespace Slic3r { namespace sla {
@@ -74,6 +77,43 @@ indexed_triangle_set get_mesh(const Bridge &br, size_t steps);
 
 indexed_triangle_set get_mesh(const DiffBridge &br, size_t steps);
 
+// A support tree primitive given by a cached mesh in its local coordinate
+// system and a transformation placing it into the support tree.
+struct MeshInstance {
+    const indexed_triangle_set *mesh  = nullptr;
+    Transform3f                 trafo = Transform3f::Identity();
+};
+
+// Cache of the support tree primitive meshes keyed by their parameters.
+// A support tree is built from a few distinct sizes of heads, junctions,
+// pillars and bridges, thus the meshes are generated once per size and
+// instanced by a transformation. The lengths of the pillars and bridges are
+// applied by scaling a primitive of a unit height along its axis.
+class PrimitiveMeshCache {
+public:
+    explicit PrimitiveMeshCache(size_t steps) : m_steps{steps} {}
+
+    MeshInstance instance(const Head &h);
+    MeshInstance instance(const Pillar &p);
+    MeshInstance instance(const Pedestal &p);
+    MeshInstance instance(const Junction &j);
+    MeshInstance instance(const Bridge &br);
+    MeshInstance instance(const DiffBridge &br);
+
+private:
+    enum class Primitive { Pinhead, Sphere, Cylinder, Halfcone };
+    using Key = std::tuple<Primitive, double, double, double>;
+
+    template<class Fn> const indexed_triangle_set &get(const Key &key, Fn &&make);
+
+    size_t                              m_steps;
+    std::map<Key, indexed_triangle_set> m_meshes;
+};
+
+// Append the instanced primitive to a mesh, transforming its vertices.
+// The caller is expected to reserve the mesh for all the instances.
+void its_append(indexed_triangle_set &its, const MeshInstance &inst);
+
 }} // namespace Slic3r::sla
 
 #endif // SUPPORTTREEMESHER_HPP
@@ -88,24 +88,42 @@ std::optional<DiffBridge> search_widening_path(Ex                     policy,
     return {};
 }
 
+// The outcome of the search for a ground pillar route, see
+// search_ground_pillar_route. It does not depend on the contents of the
+// support tree builder so it can be computed concurrently for several
+// starting points and committed into the builder afterwards.
+struct GroundPillarRoute {
+    bool found = false;
+
+    // Optional widening bridge of a mini pillar
+    std::optional<DiffBridge> diffbridge;
+
+    // Optional corrector bridge avoiding the pad gap in zero elevation mode
+    std::optional<std::pair<Vec3d, Vec3d>> bridge;
+
+    Vec3d  endp = Vec3d::Zero(); // Top of the pillar
+    double ground_z = 0.;        // Bottom of the pillar
+    double radius = 0., end_radius = 0.;
+    bool   can_add_base = false, non_head = false;
+};
+
 // This is a proxy function for pillar creation which will mind the gap
 // between the pad and the model bottom in zero elevation mode.
 // 'pinhead_junctionpt' is the starting junction point which needs to be
 // routed down. sourcedir is the allowed direction of an optional bridge
 // between the jp junction and the final pillar.
 template<class Ex>
-std::pair<bool, long> create_ground_pillar(
+GroundPillarRoute search_ground_pillar_route(
     Ex                     policy,
-    SupportTreeBuilder    &builder,
     const SupportableMesh &sm,
     const Vec3d           &pinhead_junctionpt,
     const Vec3d           &sourcedir,
     double                 radius,
-    double                 end_radius,
-    long                   head_id = SupportTreeNode::ID_UNSET)
+    double                 end_radius)
 {
+    GroundPillarRoute route;
+
     Vec3d  jp           = pinhead_junctionpt, endp = jp, dir = sourcedir;
-    long   pillar_id    = SupportTreeNode::ID_UNSET;
     bool   can_add_base = false, non_head = false;
 
     double gndlvl = 0.; // The Z level where pedestals should be
@@ -137,16 +155,14 @@ std::pair<bool, long> create_ground_pillar(
                                  sm.cfg.head_back_radius_mm);
 
         if (diffbr && diffbr->endp.z() > jp_gnd) {
-            auto &br = builder.add_diffbridge(*diffbr);
-            if (head_id >= 0) builder.head(head_id).bridge_id = br.id;
+            route.diffbridge = diffbr;
             endp = diffbr->endp;
             radius = diffbr->end_r;
             end_radius = diffbr->end_r;
-            builder.add_junction(endp, radius);
             non_head = true;
             dir = diffbr->get_dir();
             eval_limits();
-        } else return {false, pillar_id};
+        } else return route;
     }
 
     if (sm.cfg.object_elevation_mm < EPSILON)
@@ -194,29 +210,86 @@ std::pair<bool, long> create_ground_pillar(
         }
 
         // Could not find a path to avoid the pad gap
-        if (dlast < gap_dist) return {false, pillar_id};
+        if (dlast < gap_dist) return route;
 
         if (t > 0.) { // Need to make additional bridge
-            const Bridge& br = builder.add_bridge(endp, nexp, radius);
-            if (head_id >= 0) builder.head(head_id).bridge_id = br.id;
-
-            builder.add_junction(nexp, radius);
+            route.bridge = std::make_pair(endp, nexp);
             endp = nexp;
             non_head = true;
         }
     }
 
-    Vec3d gp = to_floor(endp);
-    double h = endp.z() - gp.z();
+    route.found        = true;
+    route.endp         = endp;
+    route.ground_z     = gndlvl;
+    route.radius       = radius;
+    route.end_radius   = end_radius;
+    route.can_add_base = can_add_base;
+    route.non_head     = non_head;
+
+    return route;
+}
+
+// Insert the elements of a route found by search_ground_pillar_route into
+// the builder. Returns the id of the new pillar or ID_UNSET if there was no
+// route. The widening bridge is inserted even if the route could not be
+// finished, just as it always was.
+inline long add_ground_pillar(SupportTreeBuilder      &builder,
+                              const SupportableMesh   &sm,
+                              const GroundPillarRoute &route,
+                              long head_id = SupportTreeNode::ID_UNSET)
+{
+    if (route.diffbridge) {
+        auto &br = builder.add_diffbridge(*route.diffbridge);
+        if (head_id >= 0) builder.head(head_id).bridge_id = br.id;
+        builder.add_junction(route.diffbridge->endp, route.diffbridge->end_r);
+    }
+
+    if (!route.found)
+        return SupportTreeNode::ID_UNSET;
+
+    if (route.bridge) {
+        const Bridge& br = builder.add_bridge(route.bridge->first,
+                                              route.bridge->second,
+                                              route.radius);
+        if (head_id >= 0) builder.head(head_id).bridge_id = br.id;
+
+        builder.add_junction(route.bridge->second, route.radius);
+    }
 
-    pillar_id = head_id >= 0 && !non_head ? builder.add_pillar(head_id, h) :
-                                            builder.add_pillar(gp, h, radius, end_radius);
+    Vec3d gp{route.endp.x(), route.endp.y(), route.ground_z};
+    double h = route.endp.z() - gp.z();
 
-    if (can_add_base)
+    long pillar_id = head_id >= 0 && !route.non_head ?
+                         builder.add_pillar(head_id, h) :
+                         builder.add_pillar(gp, h, route.radius, route.end_radius);
+
+    if (route.can_add_base)
         builder.add_pillar_base(pillar_id, sm.cfg.base_height_mm,
                                 sm.cfg.base_radius_mm);
 
-    return {true, pillar_id};
+    return pillar_id;
+}
+
+template<class Ex>
+std::pair<bool, long> create_ground_pillar(
+    Ex                     policy,
+    SupportTreeBuilder    &builder,
+    const SupportableMesh &sm,
+    const Vec3d           &pinhead_junctionpt,
+    const Vec3d           &sourcedir,
+    double                 radius,
+    double                 end_radius,
+    long                   head_id = SupportTreeNode::ID_UNSET)
+{
+    GroundPillarRoute route = search_ground_pillar_route(policy, sm,
+                                                         pinhead_junctionpt,
+                                                         sourcedir, radius,
+                                                         end_radius);
+
+    long pillar_id = add_ground_pillar(builder, sm, route, head_id);
+
+    return {pillar_id >= 0, pillar_id};
 }
 
 template<class Ex>
@@ -5,6 +5,7 @@
 
 #include "Geometry.hpp"
 #include "Thread.hpp"
+#include "Trace.hpp"
 
 #include <unordered_set>
 #include <numeric>
@@ -600,13 +601,24 @@ bool SLAPrint::invalidate_step(SLAPrintStep step)
     return invalidated;
 }
 
+// Names of the steps recorded by TraceScope, which requires string literals.
+static constexpr const char *object_step_trace_names[] = { "assembly", "hollowing", "drill holes", "object slice", "support points", "support tree", "pad", "slice supports" };
+static_assert(std::size(object_step_trace_names) == slaposCount, "object_step_trace_names does not match SLAPrintObjectStep");
+static constexpr const char *print_step_trace_names[] = { "merge slices and eval", "rasterize" };
+static_assert(std::size(print_step_trace_names) == slapsCount, "print_step_trace_names does not match SLAPrintStep");
+
 void SLAPrint::process()
 {
     if (m_objects.empty())
         return;
 
+    if (this->execute_limited([this]() { this->process(); }))
+        return;
+
     name_tbb_thread_pool_threads_set_locale();
 
+    TraceScope trace("process");
+
     // Assumption: at this point the print objects should be populated only with
     // the model objects we have to process and the instances are also filtered
     
@@ -638,12 +650,16 @@ void SLAPrint::process()
 
     std::array<double, slaposCount + slapsCount> step_times {};
 
+    // The objects advance through the steps concurrently, so that hollowing of one object does not block the supports of another.
+    // Each step is parallelized internally as well, all of them share the thread budget of the arena of execute_limited().
+    std::mutex status_mutex;
     auto apply_steps_on_objects =
-        [this, &st, &printsteps, &step_times, &bench]
+        [this, &st, &printsteps, &step_times, &status_mutex]
         (const std::vector<SLAPrintObjectStep> &steps)
     {
-        double incr = 0;
-        for (SLAPrintObject *po : m_objects) {
+        execution::for_each(ex_tbb, m_objects.begin(), m_objects.end(),
+            [this, &st, &printsteps, &step_times, &status_mutex, &steps](SLAPrintObject *po) {
+            decltype(bench) step_bench;
             for (SLAPrintObjectStep step : steps) {
 
                 // Cancellation checking. Each step will check for
@@ -652,21 +668,27 @@ void SLAPrint::process()
                 // throws the canceled signal.
                 throw_if_canceled();
 
-                st += incr;
-
                 if (po->set_started(step)) {
-                    m_report_status(*this, st, printsteps.label(step));
-                    bench.start();
-                    printsteps.execute(step, *po);
-                    bench.stop();
-                    step_times[step] += bench.getElapsedSec();
+                    {
+                        std::lock_guard<std::mutex> lock(status_mutex);
+                        m_report_status(*this, st, printsteps.label(step));
+                    }
+                    step_bench.start();
+                    {
+                        TraceScope trace_step(object_step_trace_names[step], po->id().id);
+                        printsteps.execute(step, *po);
+                    }
+                    step_bench.stop();
                     throw_if_canceled();
                     po->set_done(step);
                 }
-                
-                incr = printsteps.progressrange(step);
+
+                // The progress is the sum of the steps finished by all the objects.
+                std::lock_guard<std::mutex> lock(status_mutex);
+                st += printsteps.progressrange(step);
+                step_times[step] += step_bench.getElapsedSec();
             }
-        }
+        }, 1);
     };
 
     apply_steps_on_objects(level1_obj_steps);
@@ -679,7 +701,10 @@ void SLAPrint::process()
         if (set_started(currentstep)) {
             m_report_status(*this, st, printsteps.label(currentstep));
             bench.start();
-            printsteps.execute(currentstep);
+            {
+                TraceScope trace_step(print_step_trace_names[currentstep]);
+                printsteps.execute(currentstep);
+            }
             bench.stop();
             step_times[slaposCount + currentstep] += bench.getElapsedSec();
             throw_if_canceled();
@@ -1,8 +1,10 @@
 #ifndef slic3r_SLAPrint_hpp_
 #define slic3r_SLAPrint_hpp_
 
+#include <atomic>
 #include <cstdint>
 #include <mutex>
+#include <optional>
 #include <set>
 
 #include "PrintBase.hpp"
@@ -341,6 +343,15 @@ private:
         sla::SupportableMesh    input; // the input
         std::vector<ExPolygons> support_slices;   // sliced supports
         TriangleMesh tree_mesh, pad_mesh, full_mesh; // cached artifacts
+
+        // Support points and configuration the tree_mesh was created from. When only the support points step
+        // was recalculated and produced the same points, for example after a change of the automatic support point
+        // density while the points were placed manually, the tree is not created again.
+        std::optional<sla::SupportPoints> tree_pts;
+        SLAPrintObjectConfig              tree_config;
+        // Output of the automatic support point generator before the filtering by support blockers
+        // and enforcers, reused by copies of the object with the same geometry.
+        std::optional<sla::SupportPoints> generated_pts;
         
         inline SupportData(const TriangleMesh &t)
             : input{t.its, {}, {}}
@@ -577,7 +588,8 @@ private:
     
     class StatusReporter
     {
-        double m_st = 0;
+        // The objects are processed concurrently, thus the status may be reported from several threads.
+        std::atomic<double> m_st { 0. };
         
     public:
         void operator()(SLAPrint &         p,
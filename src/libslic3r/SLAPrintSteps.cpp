@@ -1,3 +1,4 @@
+#include <unordered_map>
 #include <unordered_set>
 
 #include <libslic3r/Exception.hpp>
@@ -116,17 +117,19 @@ void SLAPrint::Steps::apply_printer_corrections(SLAPrintObject &po, SliceOrigin
                                           po.m_model_slices :
                                           po.m_supportdata->support_slices;
 
-    if (clpr_offs != 0) for (size_t i = 0; i < po.m_slice_index.size(); ++i) {
-        size_t idx = po.m_slice_index[i].get_slice_idx(o);
-        if (idx < slices.size())
-            slices[idx] = offset_ex(slices[idx], float(clpr_offs));
-    }
+    if (clpr_offs != 0)
+        execution::for_each(ex_tbb, size_t(0), po.m_slice_index.size(), [&po, &slices, o, clpr_offs](size_t i) {
+            size_t idx = po.m_slice_index[i].get_slice_idx(o);
+            if (idx < slices.size())
+                slices[idx] = offset_ex(slices[idx], float(clpr_offs));
+        });
 
-    if (start_efc > 0.) for (size_t i = 0; i < faded_lyrs; ++i) {
-        size_t idx = po.m_slice_index[i].get_slice_idx(o);
-        if (idx < slices.size())
-            slices[idx] = elephant_foot_compensation(slices[idx], min_w, efc(i));
-    }
+    if (start_efc > 0.)
+        execution::for_each(ex_tbb, size_t(0), faded_lyrs, [&po, &slices, o, min_w, &efc](size_t i) {
+            size_t idx = po.m_slice_index[i].get_slice_idx(o);
+            if (idx < slices.size())
+                slices[idx] = elephant_foot_compensation(slices[idx], min_w, efc(i));
+        });
 }
 
 template<class Cont> bool is_all_positive(const Cont &csgmesh)
@@ -332,8 +335,29 @@ struct csg_inserter {
     csg_inserter& operator++() { return *this; }
 };
 
+// Move the CGAL meshes cached by the previous parts to the new parts with the same mesh and transformation,
+// so that the volumes not touched by an edit are not converted again. The previous parts keep their meshes alive,
+// thus a mesh pointer cannot be reused by another mesh while matching.
+static void reuse_cgal_meshes(const std::multiset<CSGPartForStep> &prev, const std::multiset<CSGPartForStep> &parts)
+{
+    std::unordered_multimap<const indexed_triangle_set*, const CSGPartForStep*> cached;
+    for (const CSGPartForStep &part : prev)
+        if (part.cgalcache)
+            cached.emplace(csg::get_mesh(part), &part);
+
+    for (const CSGPartForStep &part : parts) {
+        auto [begin, end] = cached.equal_range(csg::get_mesh(part));
+        for (auto it = begin; it != end; ++ it)
+            if (it->second->cgalcache && it->second->trafo.matrix() == part.trafo.matrix()) {
+                part.cgalcache = std::move(it->second->cgalcache);
+                break;
+            }
+    }
+}
+
 void SLAPrint::Steps::mesh_assembly(SLAPrintObject &po)
 {
+    std::multiset<CSGPartForStep> prev_mesh_to_slice = std::move(po.m_mesh_to_slice);
     po.m_mesh_to_slice.clear();
     po.m_supportdata.reset();
     po.m_hollowing_data.reset();
@@ -341,6 +365,8 @@ void SLAPrint::Steps::mesh_assembly(SLAPrintObject &po)
     csg::model_to_csgmesh(*po.model_object(), po.trafo(),
                           csg_inserter{po.m_mesh_to_slice, slaposAssembly},
                           csg::mpartsPositive | csg::mpartsNegative | csg::mpartsDoSplits);
+    reuse_cgal_meshes(prev_mesh_to_slice, po.m_mesh_to_slice);
+    prev_mesh_to_slice.clear();
 
     generate_preview(po, slaposAssembly);
 }
@@ -601,6 +627,32 @@ static void filter_support_points_by_modifiers(sla::SupportPoints &pts,
     pts.swap(new_pts);
 }
 
+// Find another object, which has the given step finished and whose supports are generated from the same geometry
+// as the supports of po, and which satisfies pred. Instances of a single ModelObject already share one SLAPrintObject,
+// this matches copies of an object added to the scene as separate objects.
+const SLAPrintObject* SLAPrint::Steps::find_same_geometry(
+    const SLAPrintObject &po, SLAPrintObjectStep step, const std::function<bool(const SLAPrintObject&)> &pred) const
+{
+    const SLAPrintObject::SupportData &sd    = *po.m_supportdata;
+    const indexed_triangle_set        &its   = *po.get_mesh_to_print();
+    for (const SLAPrintObject *other : m_print->m_objects) {
+        // The objects are processed concurrently. Only objects done with all the steps up to the pad
+        // do not modify the data compared below anymore.
+        if (other == &po || ! other->is_step_done(step) || ! other->is_step_done(slaposPad) || ! other->m_supportdata)
+            continue;
+        const SLAPrintObject::SupportData &osd = *other->m_supportdata;
+        // Cheap tests first, the meshes and slices are compared last.
+        if (osd.input.zoffset != sd.input.zoffset || other->trafo().matrix() != po.trafo().matrix() ||
+            other->m_model_height_levels != po.m_model_height_levels || ! pred(*other))
+            continue;
+        const indexed_triangle_set &oits = *other->get_mesh_to_print();
+        if ((&oits == &its || (oits.indices == its.indices && oits.vertices == its.vertices)) &&
+            other->get_model_slices() == po.get_model_slices())
+            return other;
+    }
+    return nullptr;
+}
+
 // In this step we check the slices, identify island and cover them with
 // support points. Then we sprinkle the rest of the mesh.
 void SLAPrint::Steps::support_points(SLAPrintObject &po)
@@ -651,14 +703,31 @@ void SLAPrint::Steps::support_points(SLAPrintObject &po)
                 report_status(current, OBJ_STEP_LABELS(slaposSupportPoints));
         };
 
-        // Construction of this object does the calculation.
-        throw_if_canceled();
-        sla::SupportPointGenerator auto_supports(
-            po.m_supportdata->input.emesh, po.get_model_slices(),
-            heights, config, [this]() { throw_if_canceled(); }, statuscb);
+        SLAPrintObject::SupportData &sd = *po.m_supportdata;
+        sd.generated_pts.reset();
+        // A copy of this object with the same geometry may have its support points generated already.
+        const SLAPrintObject *source = find_same_geometry(po, slaposSupportPoints, [&cfg](const SLAPrintObject &other) {
+            const SLAPrintObjectConfig &ocfg = other.config();
+            return other.m_supportdata->generated_pts &&
+                   ocfg.support_points_density_relative.value == cfg.support_points_density_relative.value &&
+                   ocfg.support_points_minimal_distance.value == cfg.support_points_minimal_distance.value &&
+                   ocfg.support_head_front_diameter.value     == cfg.support_head_front_diameter.value;
+        });
+
+        if (source) {
+            BOOST_LOG_TRIVIAL(debug) << "Reusing the automatic support points of an identical object";
+            sd.generated_pts = source->m_supportdata->generated_pts;
+        } else {
+            // Construction of this object does the calculation.
+            throw_if_canceled();
+            sla::SupportPointGenerator auto_supports(
+                sd.input.emesh, po.get_model_slices(),
+                heights, config, [this]() { throw_if_canceled(); }, statuscb);
+            sd.generated_pts = std::move(auto_supports.output());
+        }
 
         // Now let's extract the result.
-        std::vector<sla::SupportPoint>& points = auto_supports.output();
+        std::vector<sla::SupportPoint> points = *sd.generated_pts;
         throw_if_canceled();
 
         MeshSlicingParamsEx params;
@@ -713,6 +782,17 @@ void SLAPrint::Steps::support_tree(SLAPrintObject &po)
     po.m_supportdata->input.cfg = make_support_cfg(po.m_config);
     po.m_supportdata->input.pad_cfg = make_pad_cfg(po.m_config);
 
+    SLAPrintObject::SupportData &sd = *po.m_supportdata;
+    // The keys only influence the support points, which are compared directly.
+    static const t_config_option_keys support_points_keys {
+        "support_points_density_relative", "support_points_minimal_distance", "support_enforcers_only" };
+    auto tree_config_changed = [&sd, &po]() {
+        for (const t_config_option_key &key : sd.tree_config.diff(po.m_config))
+            if (std::find(support_points_keys.begin(), support_points_keys.end(), key) == support_points_keys.end())
+                return true;
+        return false;
+    };
+
     // scaling for the sub operations
     double d = objectstep_scale * OBJ_STEP_LEVELS[slaposSupportTree] / 100.0;
     double init = current_status();
@@ -727,7 +807,27 @@ void SLAPrint::Steps::support_tree(SLAPrintObject &po)
     ctl.stopcondition = [this]() { return canceled(); };
     ctl.cancelfn = [this]() { throw_if_canceled(); };
 
-    po.m_supportdata->create_support_tree(ctl);
+    if (sd.tree_pts && *sd.tree_pts == sd.input.pts && ! tree_config_changed()) {
+        BOOST_LOG_TRIVIAL(debug) << "Support points and support tree configuration did not change, reusing the support tree";
+    } else {
+        sd.tree_pts.reset();
+        const SLAPrintObject *source = find_same_geometry(po, slaposSupportTree, [&sd, &po](const SLAPrintObject &other) {
+            const SLAPrintObject::SupportData &osd = *other.m_supportdata;
+            if (! osd.tree_pts || *osd.tree_pts != sd.input.pts)
+                return false;
+            for (const t_config_option_key &key : osd.tree_config.diff(po.m_config))
+                if (std::find(support_points_keys.begin(), support_points_keys.end(), key) == support_points_keys.end())
+                    return false;
+            return true;
+        });
+        if (source) {
+            BOOST_LOG_TRIVIAL(debug) << "Reusing the support tree of an identical object";
+            sd.tree_mesh = source->m_supportdata->tree_mesh;
+        } else
+            sd.create_support_tree(ctl);
+        sd.tree_pts    = sd.input.pts;
+        sd.tree_config = po.m_config;
+    }
 
     if (!po.m_config.supports_enable.getBool()) return;
 
@@ -967,17 +1067,18 @@ void SLAPrint::Steps::merge_slices_and_eval_stats() {
     const double delta_fade_time = (init_exp_time - exp_time) / (fade_layers_cnt + 1);
     double fade_layer_time = init_exp_time;
 
-    execution::SpinningMutex<ExecutionTBB> mutex;
-    using Lock = std::lock_guard<decltype(mutex)>;
-
-    // Going to parallel:
-    auto printlayerfn = [this,
-            // functions and read only vars
-            area_fill, display_area, exp_time, init_exp_time, fast_tilt, slow_tilt, hv_tilt, material_config, delta_fade_time,
+    // Areas of the merged model and support slices of a single printer layer.
+    struct LayerAreas {
+        double model_area   = 0.;
+        double support_area = 0.;
+        double height       = 0.;
+        bool   printed      = false;
+    };
+    std::vector<LayerAreas> layer_areas(printer_input.size());
 
-            // write vars
-            &mutex, &models_volume, &supports_volume, &estim_time, &slow_layers,
-            &fast_layers, &fade_layer_time, &layers_times](size_t sliced_layer_cnt)
+    // Going to parallel: The slices of each layer are merged independently, the statistics
+    // depending on the order of layers are accumulated sequentially below.
+    auto printlayerfn = [this, &layer_areas](size_t sliced_layer_cnt)
     {
         PrintLayer &layer = m_print->m_printer_input[sliced_layer_cnt];
 
@@ -1027,10 +1128,6 @@ void SLAPrint::Steps::merge_slices_and_eval_stats() {
         for (const ExPolygon& polygon : model_polygons)
             layer_model_area += area(polygon);
 
-        if (layer_model_area < 0 || layer_model_area > 0) {
-            Lock lck(mutex); models_volume += layer_model_area * l_height;
-        }
-
         if(!supports_polygons.empty()) {
             if(model_polygons.empty()) supports_polygons = union_ex(supports_polygons);
             else supports_polygons = diff_ex(supports_polygons, model_polygons);
@@ -1041,10 +1138,6 @@ void SLAPrint::Steps::merge_slices_and_eval_stats() {
         for (const ExPolygon& polygon : supports_polygons)
             layer_support_area += area(polygon);
 
-        if (layer_support_area < 0 || layer_support_area > 0) {
-            Lock lck(mutex); supports_volume += layer_support_area * l_height;
-        }
-
         // Here we can save the expensively calculated polygons for printing
         ExPolygons trslices;
         trslices.reserve(model_polygons.size() + supports_polygons.size());
@@ -1053,60 +1146,68 @@ void SLAPrint::Steps::merge_slices_and_eval_stats() {
 
         layer.transformed_slices(union_ex(trslices));
 
+        layer_areas[sliced_layer_cnt] = { layer_model_area, layer_support_area, l_height, true };
+    };
+
+    // sequential version for debugging:
+    // for(size_t i = 0; i < m_printer_input.size(); ++i) printlayerfn(i);
+    execution::for_each(ex_tbb, size_t(0), printer_input.size(), printlayerfn);
+
+    for (size_t sliced_layer_cnt = 0; sliced_layer_cnt < layer_areas.size(); ++ sliced_layer_cnt) {
+        const LayerAreas &la = layer_areas[sliced_layer_cnt];
+        if (! la.printed)
+            continue;
+
+        models_volume   += la.model_area * la.height;
+        supports_volume += la.support_area * la.height;
+
         // Calculation of the slow and fast layers to the future controlling those values on FW
 
-        const bool is_fast_layer = (layer_model_area + layer_support_area) <= display_area*area_fill;
+        const bool is_fast_layer = (la.model_area + la.support_area) <= display_area*area_fill;
         const double tilt_time = material_config.material_print_speed == slamsSlow              ? slow_tilt :
                                  material_config.material_print_speed == slamsHighViscosity     ? hv_tilt   :
                                  is_fast_layer ? fast_tilt : slow_tilt;
 
-        { Lock lck(mutex);
-            if (is_fast_layer)
-                fast_layers++;
-            else
-                slow_layers++;
+        if (is_fast_layer)
+            fast_layers++;
+        else
+            slow_layers++;
 
-            // Calculation of the printing time
+        // Calculation of the printing time
 
-            double layer_times = 0.0;
-            if (sliced_layer_cnt < 3)
-                layer_times += init_exp_time;
-            else if (fade_layer_time > exp_time) {
-                fade_layer_time -= delta_fade_time;
-                layer_times += fade_layer_time;
-            }
-            else
-                layer_times += exp_time;
-            layer_times += tilt_time;
-
-            //// Per layer times (magical constants cuclulated from FW)
-
-            static double exposure_safe_delay_before{ 3.0 };
-            static double exposure_high_viscosity_delay_before{ 3.5 };
-            static double exposure_slow_move_delay_before{ 1.0 };
-
-            if (material_config.material_print_speed == slamsSlow)
-                layer_times += exposure_safe_delay_before;
-            else if (material_config.material_print_speed == slamsHighViscosity)
-                layer_times += exposure_high_viscosity_delay_before;
-            else if (!is_fast_layer)
-                layer_times += exposure_slow_move_delay_before;
-
-            // Increase layer time for "magic constants" from FW
-            layer_times += (
-                l_height * 5  // tower move
-                + 120 / 1000  // Magical constant to compensate remaining computation delay in exposure thread
-            );
-
-            layers_times.push_back(layer_times);
-            estim_time += layer_times;
+        double layer_times = 0.0;
+        if (sliced_layer_cnt < 3)
+            layer_times += init_exp_time;
+        else if (fade_layer_time > exp_time) {
+            fade_layer_time -= delta_fade_time;
+            layer_times += fade_layer_time;
         }
-    };
-
-    // sequential version for debugging:
-    // for(size_t i = 0; i < m_printer_input.size(); ++i) printlayerfn(i);
-    execution::for_each(ex_tbb, size_t(0), printer_input.size(), printlayerfn,
-                        execution::max_concurrency(ex_tbb));
+        else
+            layer_times += exp_time;
+        layer_times += tilt_time;
+
+        //// Per layer times (magical constants cuclulated from FW)
+
+        static double exposure_safe_delay_before{ 3.0 };
+        static double exposure_high_viscosity_delay_before{ 3.5 };
+        static double exposure_slow_move_delay_before{ 1.0 };
+
+        if (material_config.material_print_speed == slamsSlow)
+            layer_times += exposure_safe_delay_before;
+        else if (material_config.material_print_speed == slamsHighViscosity)
+            layer_times += exposure_high_viscosity_delay_before;
+        else if (!is_fast_layer)
+            layer_times += exposure_slow_move_delay_before;
+
+        // Increase layer time for "magic constants" from FW
+        layer_times += (
+            la.height * 5  // tower move
+            + 120 / 1000  // Magical constant to compensate remaining computation delay in exposure thread
+        );
+
+        layers_times.push_back(layer_times);
+        estim_time += layer_times;
+    }
 
     auto SCALING2 = SCALING_FACTOR * SCALING_FACTOR;
     print_statistics.support_used_material = supports_volume * SCALING2;
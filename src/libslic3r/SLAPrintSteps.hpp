@@ -1,6 +1,7 @@
 #ifndef SLAPRINTSTEPS_HPP
 #define SLAPRINTSTEPS_HPP
 
+#include <functional>
 #include <random>
 
 #include <libslic3r/SLAPrint.hpp>
@@ -47,6 +48,9 @@ private:
     void generate_preview(SLAPrintObject &po, SLAPrintObjectStep step);
     indexed_triangle_set generate_preview_vdb(SLAPrintObject &po, SLAPrintObjectStep step);
 
+    const SLAPrintObject* find_same_geometry(
+        const SLAPrintObject &po, SLAPrintObjectStep step, const std::function<bool(const SLAPrintObject&)> &pred) const;
+
 public:
     explicit Steps(SLAPrint *print);
 
@@ -1006,7 +1006,7 @@ std::vector<std::pair<size_t, bool>> chain_segments_greedy2(SegmentEndPointFunc
 	return chain_segments_greedy_constrained_reversals2_<PointType, SegmentEndPointFunc, false, decltype(could_reverse_func)>(end_point_func, could_reverse_func, num_segments, start_near);
 }
 
-std::vector<std::pair<size_t, bool>> chain_extrusion_entities(std::vector<ExtrusionEntity*> &entities, const Point *start_near)
+std::vector<std::pair<size_t, bool>> chain_extrusion_entities(const std::vector<ExtrusionEntity*> &entities, const Point *start_near)
 {
 	auto segment_end_point = [&entities](size_t idx, bool first_point) -> const Point& { return first_point ? entities[idx]->first_point() : entities[idx]->last_point(); };
 	auto could_reverse = [&entities](size_t idx) { const ExtrusionEntity *ee = entities[idx]; return ee->is_loop() || ee->can_reverse(); };
@@ -1564,6 +1564,11 @@ static inline void reorder_by_two_exchanges_with_segment_flipping(std::vector<Fl
 	std::vector<std::pair<double, size_t>>	connection_lengths(edges.size() - 1, std::pair<double, size_t>(0., 0));
 	std::vector<char>						connection_tried(edges.size(), false);
 	const size_t 							max_iterations = std::min(edges.size(), size_t(100));
+	// Each first crossover candidate is tested against all the other connections, thus an iteration is O(n^2).
+	// For chains with thousands of segments (gap fill, ironing) limit the number of first crossover candidates tried,
+	// starting with the longest connections, so that the total number of crossover evaluations per iteration is bounded.
+	const size_t 							max_crossover_evaluations = 1000000;
+	const size_t 							max_first_crossover_candidates = std::max(size_t(16), max_crossover_evaluations / edges.size());
 	for (size_t iter = 0; iter < max_iterations; ++ iter) {
 		// Initialize connection costs and connection lengths.
 		for (size_t i = 1; i < edges.size(); ++ i) {
@@ -1576,13 +1581,15 @@ static inline void reorder_by_two_exchanges_with_segment_flipping(std::vector<Fl
 			c.cost_flipped += (e2.p2 - e1.p1).norm();
 			connection_lengths[i - 1] = std::make_pair(l, i);
 		}
-		std::sort(connection_lengths.begin(), connection_lengths.end(), [](const std::pair<double, size_t> &l, const std::pair<double, size_t> &r) { return l.first > r.first; });
+		// Only the first crossover candidates need to be sorted.
+		auto first_crossover_candidates_end = connection_lengths.begin() + std::min(connection_lengths.size(), max_first_crossover_candidates);
+		std::partial_sort(connection_lengths.begin(), first_crossover_candidates_end, connection_lengths.end(), [](const std::pair<double, size_t> &l, const std::pair<double, size_t> &r) { return l.first > r.first; });
 		std::fill(connection_tried.begin(), connection_tried.end(), false);
 		size_t crossover1_pos_final = std::numeric_limits<size_t>::max();
 		size_t crossover2_pos_final = std::numeric_limits<size_t>::max();
 		size_t crossover_flip_final = 0;
-        for (const std::pair<double, size_t>& first_crossover_candidate : connection_lengths) {
-            size_t longest_connection_idx = first_crossover_candidate.second;
+        for (auto it_candidate = connection_lengths.begin(); it_candidate != first_crossover_candidates_end; ++ it_candidate) {
+            size_t longest_connection_idx = it_candidate->second;
 			connection_tried[longest_connection_idx] = true;
 			// Find the second crossover connection with the lowest total chain cost.
 			size_t crossover_pos_min  = std::numeric_limits<size_t>::max();
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <numeric>
 
 #include "SlicesToTriangleMesh.hpp"
@@ -69,13 +70,26 @@ indexed_triangle_set slices_to_mesh(
         its_merge(layers[i], straight_walls(upper, grid[i], grid[i + 1]));
         }, threads_cnt);
 
-    auto merge_fn = []( const indexed_triangle_set &a, const indexed_triangle_set &b ) {
-        indexed_triangle_set res{a}; its_merge(res, b); return res;
-    };
+    // Concatenate the layers into a preallocated mesh. Pairwise merging of the layers by a parallel reduction
+    // copied the accumulated mesh over and over, which dominated the reconstruction of tall objects.
+    std::vector<size_t> vertex_offsets(layers.size() + 1, 0), index_offsets(layers.size() + 1, 0);
+    for (size_t i = 0; i < layers.size(); ++i) {
+        vertex_offsets[i + 1] = vertex_offsets[i] + layers[i].vertices.size();
+        index_offsets[i + 1]  = index_offsets[i] + layers[i].indices.size();
+    }
 
-    auto ret = execution::reduce(ex_tbb, layers.begin(), layers.end(),
-                                 indexed_triangle_set{}, merge_fn,
-                                 threads_cnt);
+    indexed_triangle_set ret;
+    ret.vertices.resize(vertex_offsets.back());
+    ret.indices.resize(index_offsets.back());
+    execution::for_each(ex_tbb, size_t(0), layers.size(), [&layers, &ret, &vertex_offsets, &index_offsets](size_t i) {
+        indexed_triangle_set &layer = layers[i];
+        const int             voffs = int(vertex_offsets[i]);
+        std::copy(layer.vertices.begin(), layer.vertices.end(), ret.vertices.begin() + vertex_offsets[i]);
+        std::transform(layer.indices.begin(), layer.indices.end(), ret.indices.begin() + index_offsets[i],
+                       [voffs](const stl_triangle_vertex_indices &face) { return face + stl_triangle_vertex_indices::Constant(voffs); });
+        // Release the layer as soon as it is copied to keep the peak memory low.
+        layer = {};
+    }, threads_cnt);
 
     its_merge(ret, triangulate_expolygons_3d(slices.front(), zmin, NORMALS_DOWN));
     its_merge(ret, straight_walls(slices.front(), zmin, grid.front()));
@@ -235,8 +235,13 @@ std::vector<double> layer_height_profile_adaptive(const SlicingParameters& slici
 {
     // 1) Initialize the SlicingAdaptive class with the object meshes.
     SlicingAdaptive as;
-    as.set_slicing_parameters(slicing_params);
     as.prepare(object);
+    return layer_height_profile_adaptive(slicing_params, as, quality_factor);
+}
+
+std::vector<double> layer_height_profile_adaptive(const SlicingParameters& slicing_params, SlicingAdaptive& as, float quality_factor)
+{
+    as.set_slicing_parameters(slicing_params);
 
     // 2) Generate layers using the algorithm of @platsch 
     std::vector<double> layer_height_profile;
@@ -20,6 +20,7 @@ class PrintObjectConfig;
 class ModelConfig;
 class ModelObject;
 class DynamicPrintConfig;
+class SlicingAdaptive;
 
 // Parameters to guide object slicing and support generation.
 // The slicing parameters account for a raft and whether the 1st object layer is printed with a normal or a bridging flow
@@ -136,6 +137,10 @@ std::vector<coordf_t> layer_height_profile_from_ranges(
 std::vector<double> layer_height_profile_adaptive(
     const SlicingParameters& slicing_params,
     const ModelObject& object, float quality_factor);
+// Variant reusing the faces collected by SlicingAdaptive::prepare(), so that the profile may be recalculated cheaply for another quality.
+std::vector<double> layer_height_profile_adaptive(
+    const SlicingParameters& slicing_params,
+    SlicingAdaptive& slicing_adaptive, float quality_factor);
 
 struct HeightProfileSmoothingParams
 {
@@ -6,6 +6,9 @@
 #include <boost/log/trivial.hpp>
 #include <cfloat>
 
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
+
 // Based on the work of Florens Waserfall (@platch on github)
 // and his paper
 // Florens Wasserfall, Norman Hendrich, Jianwei Zhang:
@@ -70,30 +73,61 @@ static inline float layer_height_from_slope(const SlicingAdaptive::FaceZ &face,
 void SlicingAdaptive::clear()
 {
 	m_faces.clear();
+	m_volumes.clear();
 }
 
 void SlicingAdaptive::prepare(const ModelObject &object)
 {
     this->clear();
 
-    TriangleMesh		 mesh			= object.raw_mesh();
     const ModelInstance &first_instance = *object.instances.front();
-    mesh.transform(first_instance.get_matrix(), first_instance.is_left_handed());
-
-    // 1) Collect faces from mesh.
-    m_faces.reserve(mesh.facets_count());
-	for (stl_triangle_vertex_indices face : mesh.its.indices) {
-		stl_vertex vertex[3] = { mesh.its.vertices[face[0]], mesh.its.vertices[face[1]], mesh.its.vertices[face[2]] };
-		stl_vertex n         = face_normal_normalized(vertex);
-		std::pair<float, float> face_z_span {
-			std::min(std::min(vertex[0].z(), vertex[1].z()), vertex[2].z()),
-			std::max(std::max(vertex[0].z(), vertex[1].z()), vertex[2].z())
-		};
-		m_faces.emplace_back(FaceZ({ face_z_span, std::abs(n.z()), std::sqrt(n.x() * n.x() + n.y() * n.y()) }));
+    m_instance_matrix = first_instance.get_matrix();
+    size_t num_faces = 0;
+    for (const ModelVolume *volume : object.volumes)
+        if (volume->is_model_part()) {
+            m_volumes.emplace_back(volume->get_mesh_shared_ptr(), volume->get_matrix());
+            num_faces += volume->mesh().facets_count();
+        }
+
+    // 1) Collect faces from the meshes, transformed by the volume and instance transformations.
+    // The orientation of the faces does not matter, thus the meshes are not merged and the left handed transformations are not fixed.
+    m_faces.assign(num_faces, FaceZ());
+    size_t offset = 0;
+    for (const auto &[mesh, volume_matrix] : m_volumes) {
+        const indexed_triangle_set &its   = mesh->its;
+        const Transform3f           trafo = (m_instance_matrix * volume_matrix).cast<float>();
+        FaceZ                      *faces = m_faces.data() + offset;
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, its.indices.size()), [&its, &trafo, faces](const tbb::blocked_range<size_t> &range) {
+            for (size_t i = range.begin(); i < range.end(); ++ i) {
+                const stl_triangle_vertex_indices &face = its.indices[i];
+                stl_vertex vertex[3] = { trafo * its.vertices[face[0]], trafo * its.vertices[face[1]], trafo * its.vertices[face[2]] };
+                stl_vertex n         = face_normal_normalized(vertex);
+                std::pair<float, float> face_z_span {
+                    std::min(std::min(vertex[0].z(), vertex[1].z()), vertex[2].z()),
+                    std::max(std::max(vertex[0].z(), vertex[1].z()), vertex[2].z())
+                };
+                faces[i] = FaceZ({ face_z_span, std::abs(n.z()), std::sqrt(n.x() * n.x() + n.y() * n.y()) });
+            }
+        });
+        offset += its.indices.size();
     }
 
 	// 2) Sort faces lexicographically by their Z span.
-	std::sort(m_faces.begin(), m_faces.end(), [](const FaceZ &f1, const FaceZ &f2) { return f1.z_span < f2.z_span; });
+	tbb::parallel_sort(m_faces.begin(), m_faces.end(), [](const FaceZ &f1, const FaceZ &f2) { return f1.z_span < f2.z_span; });
+}
+
+bool SlicingAdaptive::prepared_for(const ModelObject &object) const
+{
+    if (object.instances.empty() || ! object.instances.front()->get_matrix().isApprox(m_instance_matrix))
+        return false;
+    size_t idx = 0;
+    for (const ModelVolume *volume : object.volumes)
+        if (volume->is_model_part()) {
+            if (idx == m_volumes.size() || volume->get_mesh_shared_ptr() != m_volumes[idx].first || ! volume->get_matrix().isApprox(m_volumes[idx].second))
+                return false;
+            ++ idx;
+        }
+    return idx == m_volumes.size() && ! m_volumes.empty();
 }
 
 // current_facet is in/out parameter, rememebers the index of the last face of m_faces visited, 
@@ -4,12 +4,16 @@
 #define slic3r_SlicingAdaptive_hpp_
 
 #include "Slicing.hpp"
+#include "Point.hpp"
 #include "admesh/stl.h"
 
+#include <memory>
+
 namespace Slic3r
 {
 
 class ModelVolume;
+class TriangleMesh;
 
 class SlicingAdaptive
 {
@@ -17,6 +21,10 @@ public:
     void  clear();
     void  set_slicing_parameters(SlicingParameters params) { m_slicing_params = params; }
     void  prepare(const ModelObject &object);
+    // Are the faces collected by prepare() still valid for the object, i.e. were neither its meshes nor its transformations changed?
+    // The slopes of the faces do not depend on the slicing parameters, thus the adaptive profile may be recalculated for another
+    // quality without calling prepare() again.
+    bool  prepared_for(const ModelObject &object) const;
     // Return next layer height starting from the last print_z, using a quality measure
     // (quality in range from 0 to 1, 0 - highest quality at low layer heights, 1 - lowest print quality at high layer heights).
     // The layer height curve shall be centered roughly around the default profile's layer height for quality 0.5.
@@ -35,6 +43,10 @@ protected:
 	SlicingParameters 		m_slicing_params;
 
 	std::vector<FaceZ>		m_faces;
+
+	// Meshes and transformations m_faces were collected from. The meshes are held to make the pointer comparison in prepared_for() safe.
+	std::vector<std::pair<std::shared_ptr<const TriangleMesh>, Transform3d>> m_volumes;
+	Transform3d 			m_instance_matrix { Transform3d::Identity() };
 };
 
 }; // namespace Slic3r
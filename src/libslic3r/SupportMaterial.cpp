@@ -2274,6 +2274,36 @@ SupportGeneratorLayersPtr PrintObjectSupportMaterial::bottom_contact_layers_and_
     // we'll use them to clip our support and detect where does it stick
     SupportGeneratorLayersPtr bottom_contacts;
 
+    // Contact areas of the top contact layers to be projected downwards, see below. They are independent of each other,
+    // thus they are merged in parallel ahead of the inherently serial downward projection.
+    std::vector<Polygons> top_contacts_projection(top_contacts.size());
+    std::vector<Polygons> top_contacts_enforcers_projection(top_contacts.size());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, top_contacts.size()),
+        [&top_contacts, &top_contacts_projection, &top_contacts_enforcers_projection](const tbb::blocked_range<size_t>& range) {
+            for (size_t contact_idx = range.begin(); contact_idx < range.end(); ++ contact_idx) {
+                SupportGeneratorLayer &top_contact = *top_contacts[contact_idx];
+                Polygons polygons_new;
+                // Contact surfaces are expanded away from the object, trimmed by the object.
+                // Use a slight positive offset to overlap the touching regions.
+#if 0
+                // Merge and collect the contact polygons. The contact polygons are inflated, but not extended into a grid form.
+                polygons_append(polygons_new,  offset(*top_contact.contact_polygons,  SCALED_EPSILON));
+                if (top_contact.enforcer_polygons)
+                    polygons_append(top_contacts_enforcers_projection[contact_idx], offset(*top_contact.enforcer_polygons, SCALED_EPSILON));
+#else
+                // Consume the contact_polygons. The contact polygons are already expanded into a grid form, and they are a tiny bit smaller
+                // than the grid cells.
+                polygons_append(polygons_new, std::move(*top_contact.contact_polygons));
+                if (top_contact.enforcer_polygons)
+                    top_contacts_enforcers_projection[contact_idx] = std::move(*top_contact.enforcer_polygons);
+#endif
+                // These are the overhang surfaces. They are touching the object and they are not expanded away from the object.
+                // Use a slight positive offset to overlap the touching regions.
+                polygons_append(polygons_new, expand(*top_contact.overhang_polygons, float(SCALED_EPSILON)));
+                top_contacts_projection[contact_idx] = union_(polygons_new);
+            }
+        });
+
     // There is some support to be built, if there are non-empty top surfaces detected.
     // Sum of unsupported contact areas above the current layer.print_z.
     Polygons  overhangs_projection;
@@ -2291,30 +2321,12 @@ SupportGeneratorLayersPtr PrintObjectSupportMaterial::bottom_contact_layers_and_
         Polygons enforcers_new;
 #endif // SLIC3R_DEBUG
         for (; contact_idx >= 0 && top_contacts[contact_idx]->print_z > layer.print_z - EPSILON; -- contact_idx) {
-            SupportGeneratorLayer &top_contact = *top_contacts[contact_idx];
-#ifndef SLIC3R_DEBUG
-            Polygons polygons_new;
-            Polygons enforcers_new;
+#ifdef SLIC3R_DEBUG
+            polygons_append(polygons_new, top_contacts_projection[contact_idx]);
+            polygons_append(enforcers_new, top_contacts_enforcers_projection[contact_idx]);
 #endif // SLIC3R_DEBUG
-            // Contact surfaces are expanded away from the object, trimmed by the object.
-            // Use a slight positive offset to overlap the touching regions.
-#if 0
-            // Merge and collect the contact polygons. The contact polygons are inflated, but not extended into a grid form.
-            polygons_append(polygons_new,  offset(*top_contact.contact_polygons,  SCALED_EPSILON));
-            if (top_contact.enforcer_polygons)
-                polygons_append(enforcers_new, offset(*top_contact.enforcer_polygons, SCALED_EPSILON));
-#else
-            // Consume the contact_polygons. The contact polygons are already expanded into a grid form, and they are a tiny bit smaller
-            // than the grid cells.
-            polygons_append(polygons_new,  std::move(*top_contact.contact_polygons));
-            if (top_contact.enforcer_polygons)
-                polygons_append(enforcers_new, std::move(*top_contact.enforcer_polygons));
-#endif
-            // These are the overhang surfaces. They are touching the object and they are not expanded away from the object.
-            // Use a slight positive offset to overlap the touching regions.
-            polygons_append(polygons_new, expand(*top_contact.overhang_polygons, float(SCALED_EPSILON)));
-            polygons_append(overhangs_projection, union_(polygons_new));
-            polygons_append(enforcers_projection, enforcers_new);
+            polygons_append(overhangs_projection, std::move(top_contacts_projection[contact_idx]));
+            polygons_append(enforcers_projection, std::move(top_contacts_enforcers_projection[contact_idx]));
         }
         if (overhangs_projection.empty() && enforcers_projection.empty())
             continue;
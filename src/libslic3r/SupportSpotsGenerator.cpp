@@ -737,6 +737,58 @@ public:
     }
 };
 
+// Data of a slice, which only depend on the slice and on the layer below, not on the stability of the object
+// evaluated over the previous layers. They are calculated in parallel ahead of the sequential stability check.
+struct SliceLocalData
+{
+    ObjectPart                           part;
+    SliceConnection                      connection_to_below;
+    AABBTreeLines::LinesDistancer<Linef> prev_layer_boundary;
+    // Per island, bridge extrusion lines which generated a support point.
+    std::vector<std::vector<ExtrusionLine>> unsupported_bridges;
+};
+
+std::vector<SliceLocalData> calculate_slice_local_data(const Layer *layer, const Params &params)
+{
+    std::vector<SliceLocalData> out(layer->lslices_ex.size());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, layer->lslices_ex.size()), [layer, &params, &out](tbb::blocked_range<size_t> r) {
+        for (size_t slice_idx = r.begin(); slice_idx < r.end(); ++slice_idx) {
+            const LayerSlice &slice = layer->lslices_ex[slice_idx];
+            SliceLocalData   &data  = out[slice_idx];
+            data.part                = std::get<0>(build_object_part_from_slice(slice_idx, layer, params));
+            data.connection_to_below = estimate_slice_connection(slice_idx, layer);
+
+            std::vector<Linef> boundary_lines;
+            for (const auto &link : slice.overlaps_below) {
+                auto ls = to_unscaled_linesf({layer->lower_layer->lslices[link.slice_idx]});
+                boundary_lines.insert(boundary_lines.end(), ls.begin(), ls.end());
+            }
+            data.prev_layer_boundary = AABBTreeLines::LinesDistancer<Linef>{std::move(boundary_lines)};
+
+            // The stability of bridges does not depend on the previous layer extrusions, only on the previous layer boundary.
+            const LD no_prev_layer_lines;
+            data.unsupported_bridges.reserve(slice.islands.size());
+            for (const auto &island : slice.islands) {
+                std::vector<ExtrusionLine> &bridges = data.unsupported_bridges.emplace_back();
+                for (const LayerExtrusionRange &fill_range : island.fills) {
+                    const LayerRegion *fill_region = layer->get_region(fill_range.region());
+                    for (const auto &fill_idx : fill_range) {
+                        const ExtrusionEntity *entity = fill_region->fills().entities[fill_idx];
+                        if (entity->role() == ExtrusionRole::BridgeInfill) {
+                            for (const ExtrusionLine &bridge : check_extrusion_entity_stability(entity, fill_region, no_prev_layer_lines,
+                                                                                                data.prev_layer_boundary, params)) {
+                                if (bridge.support_point_generated.has_value())
+                                    bridges.emplace_back(bridge);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    });
+    return out;
+}
+
 std::tuple<SupportPoints, PartialObjects> check_stability(const PrintObject *po, const PrintTryCancel &cancel_func, const Params &params)
 {
     SupportPoints     supp_points{};
@@ -758,16 +810,33 @@ std::tuple<SupportPoints, PartialObjects> check_stability(const PrintObject *po,
         }
     };
 
+    // The slice local data are calculated for a batch of layers ahead, to limit the memory held by their AABB trees.
+    const size_t                             layers_batch = 64;
+    std::vector<std::vector<SliceLocalData>> slice_local_data;
+    size_t                                   slice_local_data_begin = 0;
+
     for (size_t layer_idx = 0; layer_idx < po->layer_count(); ++layer_idx) {
         cancel_func();
+        if (layer_idx == slice_local_data_begin + slice_local_data.size()) {
+            slice_local_data_begin = layer_idx;
+            slice_local_data.assign(std::min(layers_batch, po->layer_count() - layer_idx), {});
+            tbb::parallel_for(tbb::blocked_range<size_t>(0, slice_local_data.size()),
+                              [po, &params, &slice_local_data, slice_local_data_begin](tbb::blocked_range<size_t> r) {
+                                  for (size_t i = r.begin(); i < r.end(); ++i)
+                                      slice_local_data[i] = calculate_slice_local_data(po->get_layer(slice_local_data_begin + i), params);
+                              });
+            cancel_func();
+        }
+        std::vector<SliceLocalData> &layer_data = slice_local_data[layer_idx - slice_local_data_begin];
+
         const Layer *layer                 = po->get_layer(layer_idx);
         float        bottom_z              = layer->bottom_z();
         auto create_support_point_position = [bottom_z](const Vec2f &layer_pos) { return Vec3f{layer_pos.x(), layer_pos.y(), bottom_z}; };
 
         for (size_t slice_idx = 0; slice_idx < layer->lslices_ex.size(); ++slice_idx) {
-            const LayerSlice &slice             = layer->lslices_ex.at(slice_idx);
-            auto [new_part, covered_area]       = build_object_part_from_slice(slice_idx, layer, params);
-            SliceConnection connection_to_below = estimate_slice_connection(slice_idx, layer);
+            const LayerSlice      &slice               = layer->lslices_ex.at(slice_idx);
+            const ObjectPart      &new_part            = layer_data[slice_idx].part;
+            const SliceConnection &connection_to_below = layer_data[slice_idx].connection_to_below;
 
 #ifdef DETAILED_DEBUG_LOGS
             std::cout << "SLICE IDX: " << slice_idx << std::endl;
@@ -843,13 +912,7 @@ std::tuple<SupportPoints, PartialObjects> check_stability(const PrintObject *po,
             ObjectPart                &part         = active_object_parts.access(prev_slice_idx_to_object_part_mapping[slice_idx]);
             SliceConnection           &weakest_conn = prev_slice_idx_to_weakest_connection[slice_idx];
 
-            std::vector<Linef> boundary_lines;
-            for (const auto &link : slice.overlaps_below) { 
-                auto ls = to_unscaled_linesf({layer->lower_layer->lslices[link.slice_idx]});
-                boundary_lines.insert(boundary_lines.end(), ls.begin(), ls.end());
-            }
-            AABBTreeLines::LinesDistancer<Linef> prev_layer_boundary{std::move(boundary_lines)};
-
+            const AABBTreeLines::LinesDistancer<Linef> &prev_layer_boundary = layer_data[slice_idx].prev_layer_boundary;
 
             std::vector<ExtrusionLine> current_slice_ext_perims_lines{};
             current_slice_ext_perims_lines.reserve(prev_layer_ext_perim_lines.get_lines().size() / layer->lslices_ex.size());
@@ -891,22 +954,9 @@ std::tuple<SupportPoints, PartialObjects> check_stability(const PrintObject *po,
             // account for most of the curling and possible crashes, so on them we will run also global stability check
             for (const auto &island : slice.islands) {
                 // Support bridges where needed.
-                for (const LayerExtrusionRange &fill_range : island.fills) {
-                    const LayerRegion *fill_region = layer->get_region(fill_range.region());
-                    for (const auto &fill_idx : fill_range) {
-                        const ExtrusionEntity *entity = fill_region->fills().entities[fill_idx];
-                        if (entity->role() == ExtrusionRole::BridgeInfill) {
-                            for (const ExtrusionLine &bridge :
-                                 check_extrusion_entity_stability(entity, fill_region, prev_layer_ext_perim_lines, prev_layer_boundary,
-                                                                  params)) {
-                                if (bridge.support_point_generated.has_value()) {
-                                    reckon_new_support_point(*bridge.support_point_generated, create_support_point_position(bridge.b),
-                                                             float(-EPSILON), Vec2f::Zero());
-                                }
-                            }
-                        }
-                    }
-                }
+                for (const ExtrusionLine &bridge : layer_data[slice_idx].unsupported_bridges[&island - slice.islands.data()])
+                    reckon_new_support_point(*bridge.support_point_generated, create_support_point_position(bridge.b),
+                                             float(-EPSILON), Vec2f::Zero());
 
                 const LayerRegion *perimeter_region = layer->get_region(island.perimeters.region());
                 for (const auto &perimeter_idx : island.perimeters) {
@@ -1096,7 +1146,7 @@ void estimate_supports_malformations(SupportLayerPtrs &layers, float flow_width,
         }
 #endif
 
-        prev_layer_lines = LD{current_layer_lines};
+        prev_layer_lines = LD{std::move(current_layer_lines)};
     }
 
 #ifdef DEBUG_FILES
@@ -1112,22 +1162,53 @@ void estimate_malformations(LayerPtrs &layers, const Params &params)
     FILE *full_file = boost::nowide::fopen(debug_out_path("object_full.obj").c_str(), "w");
 #endif
 
+    // The curling of a layer depends on the curling of the layer below, thus the layers are processed sequentially.
+    // Their inputs do not depend on the curling: the boundaries of the layer below and the external perimeters
+    // are prepared for all layers in parallel ahead of the sequential sweep.
+    struct LayerExtrusion
+    {
+        const LayerRegion     *layer_region;
+        const ExtrusionEntity *extrusion;
+        float                  flow_width;
+        Points                 points;
+    };
+    struct LayerInput
+    {
+        AABBTreeLines::LinesDistancer<Linef>   prev_layer_boundary;
+        // Owners of the extrusions referenced by LayerExtrusion and by the ExtrusionLines of the layer.
+        std::vector<ExtrusionEntityCollection> perimeters;
+        std::vector<LayerExtrusion>            extrusions;
+    };
+    std::vector<LayerInput> inputs(layers.size());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, layers.size()), [&layers, &inputs](const tbb::blocked_range<size_t> &range) {
+        for (size_t layer_idx = range.begin(); layer_idx < range.end(); ++ layer_idx) {
+            const Layer *l     = layers[layer_idx];
+            LayerInput  &input = inputs[layer_idx];
+            if (l->lower_layer != nullptr)
+                input.prev_layer_boundary = AABBTreeLines::LinesDistancer<Linef>{to_unscaled_linesf(l->lower_layer->lslices)};
+            for (const LayerRegion *layer_region : l->regions())
+                for (const ExtrusionEntity *extrusion : input.perimeters.emplace_back(layer_region->perimeters().flatten()).entities)
+                    if (extrusion->role().is_external_perimeter()) {
+                        LayerExtrusion &out = input.extrusions.emplace_back(
+                            LayerExtrusion{ layer_region, extrusion, get_flow_width(layer_region, extrusion->role()), {} });
+                        extrusion->collect_points(out.points);
+                    }
+        }
+    });
+
     LD prev_layer_lines{};
 
-    for (Layer *l : layers) {
+    for (size_t layer_idx = 0; layer_idx < layers.size(); ++ layer_idx) {
+        Layer *l = layers[layer_idx];
         l->malformed_lines.clear();
-        std::vector<Linef> boundary_lines = l->lower_layer != nullptr ? to_unscaled_linesf(l->lower_layer->lslices) : std::vector<Linef>();
-        AABBTreeLines::LinesDistancer<Linef> prev_layer_boundary{std::move(boundary_lines)};
-        std::vector<ExtrusionLine>           current_layer_lines;
-        for (const LayerRegion *layer_region : l->regions()) {
-            for (const ExtrusionEntity *extrusion : layer_region->perimeters().flatten().entities) {
-                
-                if (!extrusion->role().is_external_perimeter()) continue;
-
-                Points extrusion_pts;
-                extrusion->collect_points(extrusion_pts);
-                float flow_width       = get_flow_width(layer_region, extrusion->role());
-                auto  annotated_points = estimate_points_properties<true, false, false, false>(extrusion_pts, prev_layer_lines, flow_width,
+        const AABBTreeLines::LinesDistancer<Linef> &prev_layer_boundary = inputs[layer_idx].prev_layer_boundary;
+        std::vector<ExtrusionLine>                  current_layer_lines;
+        {
+            for (const LayerExtrusion &layer_extrusion : inputs[layer_idx].extrusions) {
+                const LayerRegion     *layer_region = layer_extrusion.layer_region;
+                const ExtrusionEntity *extrusion    = layer_extrusion.extrusion;
+                float flow_width       = layer_extrusion.flow_width;
+                auto  annotated_points = estimate_points_properties<true, false, false, false>(layer_extrusion.points, prev_layer_lines, flow_width,
                                                                                               params.bridge_distance);
                 for (size_t i = 0; i < annotated_points.size(); ++i) {
                     ExtendedPoint &curr_point = annotated_points[i];
@@ -1170,7 +1251,10 @@ void estimate_malformations(LayerPtrs &layers, const Params &params)
         }
 #endif
 
-        prev_layer_lines = LD{current_layer_lines};
+        prev_layer_lines = LD{std::move(current_layer_lines)};
+        // Release the inputs of the layer below, prev_layer_lines now references the extrusions of this layer.
+        if (layer_idx > 0)
+            inputs[layer_idx - 1] = {};
     }
 
 #ifdef DEBUG_FILES
@@ -0,0 +1,127 @@
+#include "Trace.hpp"
+#include "Thread.hpp"
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <boost/log/trivial.hpp>
+#include <boost/nowide/fstream.hpp>
+
+namespace Slic3r {
+
+namespace trace_detail {
+
+std::atomic<bool> enabled { false };
+static std::string s_path;
+
+static const std::chrono::steady_clock::time_point s_time_origin = std::chrono::steady_clock::now();
+
+int64_t now_us()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - s_time_origin).count();
+}
+
+struct Region
+{
+    const char *name;
+    int64_t     id;
+    int64_t     begin_us;
+    int64_t     end_us;
+};
+
+// Regions recorded by a single thread. The mutex is only contended by trace_export().
+struct ThreadRegions
+{
+    std::mutex          mutex;
+    size_t              thread_idx;
+    std::string         thread_name;
+    std::vector<Region> regions;
+};
+
+// The ThreadRegions are never released, so that a thread_local pointer stays valid
+// and the regions of the threads already finished are exported.
+static std::mutex                                  s_threads_mutex;
+static std::vector<std::unique_ptr<ThreadRegions>> s_threads;
+static thread_local ThreadRegions                 *t_regions = nullptr;
+
+void record(const char *name, int64_t id, int64_t begin_us, int64_t end_us)
+{
+    if (t_regions == nullptr) {
+        auto regions = std::make_unique<ThreadRegions>();
+        // TBB worker threads are named by name_tbb_thread_pool_threads_set_locale() before they record anything.
+        regions->thread_name = get_current_thread_name().value_or(std::string());
+        std::scoped_lock<std::mutex> lock(s_threads_mutex);
+        regions->thread_idx = s_threads.size();
+        if (regions->thread_name.empty())
+            regions->thread_name = "thread " + std::to_string(regions->thread_idx);
+        t_regions = regions.get();
+        s_threads.emplace_back(std::move(regions));
+    }
+    std::scoped_lock<std::mutex> lock(t_regions->mutex);
+    t_regions->regions.push_back({ name, id, begin_us, end_us });
+}
+
+static void write_json_string(std::ostream &out, const std::string &str)
+{
+    out << '"';
+    for (char c : str)
+        if (c == '"' || c == '\\')
+            out << '\\' << c;
+        else if (static_cast<unsigned char>(c) >= 0x20)
+            out << c;
+    out << '"';
+}
+
+} // namespace trace_detail
+
+void trace_start(const std::string &path)
+{
+    trace_detail::s_path = path;
+    trace_detail::enabled.store(true, std::memory_order_relaxed);
+}
+
+bool trace_export()
+{
+    using namespace trace_detail;
+    const std::string &path = s_path;
+    boost::nowide::ofstream out(path);
+    if (! out) {
+        BOOST_LOG_TRIVIAL(error) << "Failed to open the trace file " << path;
+        return false;
+    }
+    size_t num_regions = 0;
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    const char *separator = "\n";
+    {
+        std::scoped_lock<std::mutex> lock(s_threads_mutex);
+        for (const std::unique_ptr<ThreadRegions> &thread : s_threads) {
+            std::scoped_lock<std::mutex> lock_thread(thread->mutex);
+            out << separator << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << thread->thread_idx << ",\"args\":{\"name\":";
+            write_json_string(out, thread->thread_name);
+            out << "}}";
+            separator = ",\n";
+            for (const Region &region : thread->regions) {
+                out << separator << "{\"name\":";
+                write_json_string(out, region.name);
+                out << ",\"cat\":\"slic3r\",\"ph\":\"X\",\"pid\":1,\"tid\":" << thread->thread_idx <<
+                    ",\"ts\":" << region.begin_us << ",\"dur\":" << region.end_us - region.begin_us;
+                if (region.id >= 0)
+                    out << ",\"args\":{\"id\":" << region.id << "}";
+                out << "}";
+            }
+            num_regions += thread->regions.size();
+        }
+    }
+    out << "\n]}\n";
+    out.close();
+    if (! out) {
+        BOOST_LOG_TRIVIAL(error) << "Failed to write the trace file " << path;
+        return false;
+    }
+    BOOST_LOG_TRIVIAL(info) << "Exported " << num_regions << " traced regions to " << path;
+    return true;
+}
+
+} // namespace Slic3r
@@ -0,0 +1,51 @@
+#ifndef slic3r_Trace_hpp_
+#define slic3r_Trace_hpp_
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace Slic3r {
+
+// Recording of the scoped regions of the slicing process and of its TBB tasks for tuning of the thread counts.
+// The recorded regions are exported into a Chrome trace JSON, which is viewed by chrome://tracing or https://ui.perfetto.dev
+// The tracing is always compiled in, but it records nothing until enabled, therefore a disabled TraceScope only costs an atomic load.
+
+// Start recording, the regions will be exported into a Chrome trace JSON file of the given path.
+void trace_start(const std::string &path);
+inline bool trace_enabled();
+// Export all the regions recorded so far into the file passed to trace_start(), overwriting the file.
+// Returns false if the file could not be written.
+bool trace_export();
+
+namespace trace_detail {
+    extern std::atomic<bool> enabled;
+    // Time of the recorded region relative to the process start, in microseconds.
+    int64_t now_us();
+    void record(const char *name, int64_t id, int64_t begin_us, int64_t end_us);
+}
+
+inline bool trace_enabled() { return trace_detail::enabled.load(std::memory_order_relaxed); }
+
+// Records the lifetime of this object as a region of the current thread.
+// The name has to be a string literal or to outlive the trace export, the optional id (a layer or an object index)
+// is exported as an argument of the region.
+class TraceScope
+{
+public:
+    explicit TraceScope(const char *name, int64_t id = -1) :
+        m_name(trace_enabled() ? name : nullptr), m_id(id), m_begin_us(m_name ? trace_detail::now_us() : 0) {}
+    ~TraceScope() { if (m_name) trace_detail::record(m_name, m_id, m_begin_us, trace_detail::now_us()); }
+
+    TraceScope(const TraceScope &) = delete;
+    TraceScope& operator=(const TraceScope &) = delete;
+
+private:
+    const char *m_name;
+    int64_t     m_id;
+    int64_t     m_begin_us;
+};
+
+} // namespace Slic3r
+
+#endif // slic3r_Trace_hpp_
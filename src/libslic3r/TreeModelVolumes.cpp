@@ -217,6 +217,39 @@ TreeModelVolumes::TreeModelVolumes(
 #endif
 }
 
+bool TreeModelVolumes::take_caches(TreeModelVolumes &&rhs)
+{
+    auto same_settings = [](const TreeSupportMeshGroupSettings &l, const TreeSupportMeshGroupSettings &r) {
+        return l.layer_height == r.layer_height && l.resolution == r.resolution && l.support_material_buildplate_only == r.support_material_buildplate_only &&
+               l.support_xy_distance == r.support_xy_distance && l.support_top_distance == r.support_top_distance && l.support_bottom_distance == r.support_bottom_distance;
+    };
+    if (m_layer_outlines.size() != rhs.m_layer_outlines.size())
+        return false;
+    for (size_t i = 0; i < m_layer_outlines.size(); ++ i)
+        if (! same_settings(m_layer_outlines[i].first, rhs.m_layer_outlines[i].first) || m_layer_outlines[i].second != rhs.m_layer_outlines[i].second)
+            return false;
+    if (m_current_outline_idx != rhs.m_current_outline_idx || m_current_min_xy_dist != rhs.m_current_min_xy_dist || 
+        m_current_min_xy_dist_delta != rhs.m_current_min_xy_dist_delta || m_increase_until_radius != rhs.m_increase_until_radius ||
+        m_min_resolution != rhs.m_min_resolution || m_support_rests_on_model != rhs.m_support_rests_on_model || 
+        m_raft_layers != rhs.m_raft_layers || m_machine_border != rhs.m_machine_border || m_anti_overhang != rhs.m_anti_overhang)
+        return false;
+
+    m_collision_cache               = std::move(rhs.m_collision_cache);
+    m_collision_cache_holefree      = std::move(rhs.m_collision_cache_holefree);
+    m_placeable_areas_cache         = std::move(rhs.m_placeable_areas_cache);
+    m_wall_restrictions_cache       = std::move(rhs.m_wall_restrictions_cache);
+    m_wall_restrictions_cache_min   = std::move(rhs.m_wall_restrictions_cache_min);
+    if (m_max_move == rhs.m_max_move && m_max_move_slow == rhs.m_max_move_slow) {
+        m_avoidance_cache                   = std::move(rhs.m_avoidance_cache);
+        m_avoidance_cache_slow              = std::move(rhs.m_avoidance_cache_slow);
+        m_avoidance_cache_to_model          = std::move(rhs.m_avoidance_cache_to_model);
+        m_avoidance_cache_to_model_slow     = std::move(rhs.m_avoidance_cache_to_model_slow);
+        m_avoidance_cache_holefree          = std::move(rhs.m_avoidance_cache_holefree);
+        m_avoidance_cache_holefree_to_model = std::move(rhs.m_avoidance_cache_holefree_to_model);
+    }
+    return true;
+}
+
 void TreeModelVolumes::precalculate(const PrintObject& print_object, const coord_t max_layer, std::function<void()> throw_on_cancel)
 {
     auto t_start = std::chrono::high_resolution_clock::now();
@@ -900,13 +933,32 @@ coord_t TreeModelVolumes::ceilRadius(const coord_t radius) const
     return out;
 }
 
-void TreeModelVolumes::RadiusLayerPolygonCache::allocate_layers(size_t num_layers)
+std::shared_mutex& TreeModelVolumes::RadiusLayerPolygonCache::lock_allocated_layers(size_t num_layers)
 {
+    {
+        std::shared_lock<std::shared_mutex> guard(m_mutex);
+        if (num_layers <= m_data.size())
+            return m_mutex;
+    }
+    // Growing the vector of layers moves the layers, thus no layer may be accessed meanwhile.
+    // The Polygons are allocated separately, references to them stay valid.
+    std::unique_lock<std::shared_mutex> guard(m_mutex);
     if (num_layers > m_data.size()) {
         if (num_layers > m_data.capacity())
             reserve_power_of_2(m_data, num_layers);
-        m_data.resize(num_layers, {});
+        m_data.resize(num_layers);
     }
+    return m_mutex;
+}
+
+void TreeModelVolumes::RadiusLayerPolygonCache::emplace(LayerIndex layer_idx, coord_t radius, Polygons &&polygons)
+{
+    std::unique_lock<std::shared_mutex> guard(this->layer_mutex(layer_idx));
+    LayerData &layer = m_data[layer_idx];
+    auto it = std::lower_bound(layer.begin(), layer.end(), radius, [](const LayerData::value_type &l, coord_t r) { return l.first < r; });
+    // Keep the first inserted value, as std::map::emplace() would.
+    if (it == layer.end() || it->first != radius)
+        layer.insert(it, std::make_pair(radius, std::make_unique<Polygons>(std::move(polygons))));
 }
 
 // For debugging purposes, sorted by layer index, then by radius.
@@ -916,7 +968,7 @@ std::vector<std::pair<TreeModelVolumes::RadiusLayerPair, std::reference_wrapper<
     for (auto &layer : m_data) {
         auto layer_idx = LayerIndex(&layer - m_data.data());
         for (auto &radius_polygons : layer)
-            out.emplace_back(std::make_pair(radius_polygons.first, layer_idx), radius_polygons.second);
+            out.emplace_back(std::make_pair(radius_polygons.first, layer_idx), *radius_polygons.second);
     }
     assert(std::is_sorted(out.begin(), out.end(), [](auto &l, auto &r){ return l.first.second < r.first.second || (l.first.second == r.first.second) && l.first.first < r.first.first; }));
     return out;
@@ -9,7 +9,11 @@
 #ifndef slic3r_TreeModelVolumes_hpp
 #define slic3r_TreeModelVolumes_hpp
 
+#include <algorithm>
+#include <array>
+#include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <unordered_map>
 
 #include <boost/functional/hash.hpp>
@@ -212,6 +216,14 @@ public:
     TreeModelVolumes(const TreeModelVolumes&) = delete;
     TreeModelVolumes& operator=(const TreeModelVolumes&) = delete;
 
+    /*!
+     * \brief Takes over the areas precalculated by \p rhs for the same object, as far as they are valid for this instance.
+     * Collisions, placeable areas and wall restrictions only depend on the layer outlines, support blockers and the z and xy distances,
+     * the avoidances further depend on the maximum move distances derived from the branch angles.
+     * \return Whether any of the caches was taken over.
+     */
+    bool take_caches(TreeModelVolumes &&rhs);
+
     void clear() { 
         this->clear_all_but_object_collision();
         m_collision_cache.clear();
@@ -333,10 +345,10 @@ private:
      */
     using RadiusLayerPair             = std::pair<coord_t, LayerIndex>;
     class RadiusLayerPolygonCache {
-        // Map from radius to Polygons. Cache of one layer collision regions.
-        using LayerData = std::map<coord_t, Polygons>;
+        // Radius to Polygons, sorted by radius. Cache of one layer collision regions.
+        // Polygons are allocated separately, so that references to them are stable to insertion.
+        using LayerData = std::vector<std::pair<coord_t, std::unique_ptr<Polygons>>>;
         // Vector of layers, at each layer map of radius to Polygons.
-        // Reference to Polygons returned shall be stable to insertion.
         using Layers = std::vector<LayerData>;
     public:
         RadiusLayerPolygonCache() = default;
@@ -347,21 +359,26 @@ private:
         RadiusLayerPolygonCache& operator=(const RadiusLayerPolygonCache&) = delete;
 
         void insert(std::vector<std::pair<RadiusLayerPair, Polygons>> &&in) {
-            std::lock_guard<std::mutex> guard(m_mutex);
+            LayerIndex max_layer_idx = -1;
+            for (const auto &d : in)
+                max_layer_idx = std::max(max_layer_idx, d.first.second);
+            std::shared_lock<std::shared_mutex> guard(this->lock_allocated_layers(max_layer_idx + 1));
             for (auto &d : in)
-                this->get_allocate_layer_data(d.first.second).emplace(d.first.first, std::move(d.second));
+                this->emplace(d.first.second, d.first.first, std::move(d.second));
         }
         // by layer
         void insert(std::vector<std::pair<coord_t, Polygons>> &&in, coord_t radius) {
-            std::lock_guard<std::mutex> guard(m_mutex);
+            LayerIndex max_layer_idx = -1;
+            for (const auto &d : in)
+                max_layer_idx = std::max(max_layer_idx, LayerIndex(d.first));
+            std::shared_lock<std::shared_mutex> guard(this->lock_allocated_layers(max_layer_idx + 1));
             for (auto &d : in)
-                this->get_allocate_layer_data(d.first).emplace(radius, std::move(d.second));
+                this->emplace(d.first, radius, std::move(d.second));
         }
         void insert(std::vector<Polygons> &&in, coord_t first_layer_idx, coord_t radius) {
-            std::lock_guard<std::mutex> guard(m_mutex);
-            allocate_layers(first_layer_idx + in.size());
+            std::shared_lock<std::shared_mutex> guard(this->lock_allocated_layers(first_layer_idx + in.size()));
             for (auto &d : in)
-                m_data[first_layer_idx ++].emplace(radius, std::move(d));
+                this->emplace(first_layer_idx ++, radius, std::move(d));
         }
         /*!
          * \brief Checks a cache for a given RadiusLayerPair and returns it if it is found
@@ -369,29 +386,31 @@ private:
          * \return A wrapped optional reference of the requested area (if it was found, an empty optional if nothing was found)
          */
         std::optional<std::reference_wrapper<const Polygons>> getArea(const TreeModelVolumes::RadiusLayerPair &key) const {
-            std::lock_guard<std::mutex> guard(m_mutex);
-            if (key.second >= m_data.size())
+            std::shared_lock<std::shared_mutex> guard(m_mutex);
+            if (key.second >= LayerIndex(m_data.size()))
                 return std::optional<std::reference_wrapper<const Polygons>>{};
+            std::shared_lock<std::shared_mutex> layer_guard(this->layer_mutex(key.second));
             const auto &layer = m_data[key.second];
-            auto it = layer.find(key.first);
-            return it == layer.end() ? 
-                std::optional<std::reference_wrapper<const Polygons>>{} : std::optional<std::reference_wrapper<const Polygons>>{ it->second };
+            auto it = lower_bound_radius(layer, key.first);
+            return it == layer.end() || it->first != key.first ?
+                std::optional<std::reference_wrapper<const Polygons>>{} : std::optional<std::reference_wrapper<const Polygons>>{ *it->second };
         }
         // Get a collision area at a given layer for a radius that is a lower or equial to the key radius.
         std::optional<std::pair<coord_t, std::reference_wrapper<const Polygons>>> get_lower_bound_area(const TreeModelVolumes::RadiusLayerPair &key) const {
-            std::lock_guard<std::mutex> guard(m_mutex);
-            if (key.second >= m_data.size())
+            std::shared_lock<std::shared_mutex> guard(m_mutex);
+            if (key.second >= LayerIndex(m_data.size()))
                 return {};
+            std::shared_lock<std::shared_mutex> layer_guard(this->layer_mutex(key.second));
             const auto &layer = m_data[key.second];
             if (layer.empty())
                 return {};
-            auto it = layer.lower_bound(key.first);
+            auto it = lower_bound_radius(layer, key.first);
             if (it == layer.end() || it->first != key.first) {
                 if (it == layer.begin())
                     return {};
                 -- it;
             }
-            return std::make_pair(it->first, std::reference_wrapper<const Polygons>(it->second));
+            return std::make_pair(it->first, std::reference_wrapper<const Polygons>(*it->second));
         }
         /*!
          * \brief Get the highest already calculated layer in the cache.
@@ -401,11 +420,14 @@ private:
          * \return A wrapped optional reference of the requested area (if it was found, an empty optional if nothing was found)
          */
         LayerIndex getMaxCalculatedLayer(coord_t radius) const {
-            std::lock_guard<std::mutex> guard(m_mutex);
+            std::shared_lock<std::shared_mutex> guard(m_mutex);
             auto layer_idx = LayerIndex(m_data.size()) - 1;
-            for (; layer_idx > 0; -- layer_idx)
-                if (const auto &layer = m_data[layer_idx]; layer.find(radius) != layer.end())
+            for (; layer_idx > 0; -- layer_idx) {
+                std::shared_lock<std::shared_mutex> layer_guard(this->layer_mutex(layer_idx));
+                if (const auto &layer = m_data[layer_idx]; 
+                    std::binary_search(layer.begin(), layer.end(), radius, [](const auto &l, const auto &r) { return radius_of(l) < radius_of(r); }))
                     break;
+            }
             // The placeable on model areas do not exist on layer 0, as there can not be model below it. As such it may be possible that layer 1 is available, but layer 0 does not exist.
             return layer_idx == 0 ? -1 : layer_idx;
         }
@@ -415,23 +437,29 @@ private:
 
         void clear() { m_data.clear(); }
         void clear_all_but_radius0() { 
-            for (LayerData &l : m_data) {
-                auto begin = l.begin();
-                auto end = l.end();
-                if (begin != end && ++ begin != end)
-                    l.erase(begin, end);
-            }
+            for (LayerData &l : m_data)
+                if (l.size() > 1)
+                    l.erase(l.begin() + 1, l.end());
         }
 
     private:
-        LayerData&          get_allocate_layer_data(LayerIndex layer_idx) {
-            allocate_layers(layer_idx + 1);
-            return m_data[layer_idx];
+        static coord_t      radius_of(coord_t radius) { return radius; }
+        static coord_t      radius_of(const LayerData::value_type &v) { return v.first; }
+        static LayerData::const_iterator lower_bound_radius(const LayerData &layer, coord_t radius) {
+            return std::lower_bound(layer.begin(), layer.end(), radius, [](const LayerData::value_type &l, coord_t r) { return l.first < r; });
         }
-        void                allocate_layers(size_t num_layers);
-
-        Layers              m_data;
-        mutable std::mutex  m_mutex;
+        // Layers are guarded by a fixed number of shards, readers of a layer do not block each other.
+        std::shared_mutex&  layer_mutex(LayerIndex layer_idx) const { return m_layer_mutexes[size_t(layer_idx) % m_layer_mutexes.size()]; }
+        // Returns m_mutex after making sure that num_layers are allocated. Shall be locked shared by the caller while inserting.
+        std::shared_mutex&  lock_allocated_layers(size_t num_layers);
+        // Caller holds m_mutex shared.
+        void                emplace(LayerIndex layer_idx, coord_t radius, Polygons &&polygons);
+
+        Layers                                  m_data;
+        // Guards the allocation of m_data.
+        mutable std::shared_mutex               m_mutex;
+        // Guard the content of the layers of m_data.
+        mutable std::array<std::shared_mutex, 64> m_layer_mutexes;
     };
 
 
@@ -12,6 +12,7 @@
 #include "BuildVolume.hpp"
 #include "ClipperUtils.hpp"
 #include "EdgeGrid.hpp"
+#include "Geometry/ConvexHull.hpp"
 #include "Fill/Fill.hpp"
 #include "Layer.hpp"
 #include "Print.hpp"
@@ -2302,6 +2303,22 @@ static SupportElementMerging* merge_influence_areas_leaves(
     return dst_end;
 }
 
+// Bounding box of a range of elements inflated by the largest radius of their branches.
+// merge_influence_areas_two_elements() inflates the bounding box of the smaller branch by the difference of the two radii,
+// which is bounded by the larger of the two radii, thus elements of two ranges with non-overlapping inflated bounding boxes never merge.
+static Eigen::AlignedBox<coord_t, 2> merging_inflated_bbox(const TreeSupportSettings &config, const SupportElementMerging *begin, const SupportElementMerging *end)
+{
+    Eigen::AlignedBox<coord_t, 2> bbox;
+    coord_t                       radius = 0;
+    for (const SupportElementMerging *it = begin; it != end; ++ it) {
+        bbox.extend(it->bbox());
+        radius = std::max(radius, config.getRadius(it->state));
+    }
+    bbox.min() -= Point{ radius, radius };
+    bbox.max() += Point{ radius, radius };
+    return bbox;
+}
+
 static SupportElementMerging* merge_influence_areas_two_sets(
     const TreeModelVolumes &volumes, const TreeSupportSettings &config, const LayerIndex layer_idx,
     SupportElementMerging * const dst_begin, SupportElementMerging *       dst_end,
@@ -2315,6 +2332,8 @@ static SupportElementMerging* merge_influence_areas_two_sets(
     assert(src_begin < src_end);
     assert(dst_begin < dst_end);
     assert(dst_end <= src_begin);
+    // Skip the O(n^2) pairwise test of AABB subtrees far from each other, their elements are just concatenated below.
+    if (merging_inflated_bbox(config, dst_begin, dst_end).intersects(merging_inflated_bbox(config, src_begin, src_end)))
     for (SupportElementMerging *src = src_begin; src != src_end; ++ src) {
         SupportElementMerging         *dst      = dst_begin;
         SupportElementMerging         *merged   = nullptr;
@@ -3568,7 +3587,7 @@ static std::pair<int, int> discretize_circle(const Vec3f &center, const Vec3f &n
     return { begin, int(pts.size()) };
 }
 
-static void extrude_branch(
+[[maybe_unused]] static void extrude_branch(
     const std::vector<SupportElement*>      &path, 
     const TreeSupportSettings               &config,
     const SlicingParameters                 &slicing_params,
@@ -3979,8 +3998,17 @@ static void organic_smooth_branches_avoid_collisions(
 }
 #endif // TREE_SUPPORT_ORGANIC_NUDGE_NEW
 
-// Organic specific: Smooth branches and produce one cummulative mesh to be sliced.
-static indexed_triangle_set draw_branches(
+// Organic specific: Sphere of a single SupportElement of an organic branch, in unscaled coordinates.
+struct BranchSphere {
+    Vec3d  center;
+    double radius;
+};
+// Organic specific: Branch of an organic tree between two bifurcations. Its volume is the union of convex sweeps
+// of the pairs of consecutive spheres, approximating the tube extruded by extrude_branch() including its half sphere caps.
+using OrganicBranch = std::vector<BranchSphere>;
+
+// Organic specific: Smooth branches and produce the chains of spheres to be sliced by slice_branches().
+static std::vector<OrganicBranch> draw_branches(
     PrintObject                     &print_object,
     const TreeModelVolumes          &volumes, 
     const TreeSupportSettings       &config,
@@ -4040,13 +4068,11 @@ static indexed_triangle_set draw_branches(
         for (SupportElement &element : elements)
             element.state.marked = false;
 
-    // Traverse all nodes, generate tubes.
+    // Traverse all nodes, collect the branches.
     // Traversal stack with nodes and thier current parent
     const SlicingParameters &slicing_params = print_object.slicing_parameters();
     std::vector<SupportElement*> path;
-    indexed_triangle_set cummulative_mesh;
-    indexed_triangle_set partial_mesh;
-    indexed_triangle_set temp_mesh;
+    std::vector<OrganicBranch>   branches;
     for (LayerIndex layer_idx = 0; layer_idx + 1 < LayerIndex(move_bounds.size()); ++ layer_idx) {
         SupportElements &layer = move_bounds[layer_idx];
         SupportElements &layer_above = move_bounds[layer_idx + 1];
@@ -4077,11 +4103,16 @@ static indexed_triangle_set draw_branches(
                             parent = &next_parent;
                         }
                     }
-                    // Triangulate the tube.
-                    partial_mesh.clear();
-                    extrude_branch(path, config, slicing_params, move_bounds, partial_mesh);
+                    OrganicBranch &branch = branches.emplace_back();
+                    branch.reserve(path.size());
+                    for (const SupportElement *element : path)
+                        branch.push_back({ to_3d(unscaled<double>(element->state.result_on_layer), layer_z(slicing_params, config, element->state.layer_idx)),
+                                           unscaled<double>(config.getRadius(element->state)) });
 #if 0
+                    // Triangulate the tube for debugging. The tubes are sliced directly by slice_branches().
                     {
+                        indexed_triangle_set partial_mesh;
+                        extrude_branch(path, config, slicing_params, move_bounds, partial_mesh);
                         char fname[2048];
                         static int irun = 0;
                         sprintf(fname, "d:\\temp\\meshes\\tree-raw-%d.obj", ++ irun);
@@ -4098,22 +4129,46 @@ static indexed_triangle_set draw_branches(
                         its_write_obj(partial_mesh, fname);
                     }
 #endif
-                    its_merge(cummulative_mesh, partial_mesh);
                 }
                 throw_on_cancel();
             }
     }
-    return cummulative_mesh;
+    return branches;
 }
 
-// Organic specific: Slice the cummulative mesh produced by draw_branches().
+// Organic specific: Section of the convex sweep of two spheres by a horizontal plane at z, in scaled coordinates.
+// Approximated by a convex hull of the plane sections of spheres interpolated between the two spheres.
+// pts is a temporary storage.
+static Polygon slice_sphere_sweep(const BranchSphere &s1, const BranchSphere &s2, const double z, Points &pts)
+{
+    // Same discretization as of the circles of extrude_branch().
+    static constexpr const double eps         = 0.015;
+    static constexpr const int    num_samples = 8;
+    pts.clear();
+    for (int i = 0; i <= num_samples; ++ i) {
+        const double t      = double(i) / double(num_samples);
+        const Vec3d  center = (1. - t) * s1.center + t * s2.center;
+        const double r2     = sqr((1. - t) * s1.radius + t * s2.radius) - sqr(z - center.z());
+        if (r2 <= sqr(eps))
+            continue;
+        const double radius = sqrt(r2);
+        const int    nsteps = std::max(3, int(ceil(M_PI / acos(1. - eps / radius))));
+        for (int j = 0; j < nsteps; ++ j) {
+            const double angle = 2. * M_PI * double(j) / double(nsteps);
+            pts.emplace_back(scaled<coord_t>(center.x() + radius * cos(angle)), scaled<coord_t>(center.y() + radius * sin(angle)));
+        }
+    }
+    return pts.size() < 3 ? Polygon() : Geometry::convex_hull(std::move(pts));
+}
+
+// Organic specific: Slice the branches produced by draw_branches().
 static void slice_branches(
     PrintObject                     &print_object,
     const TreeModelVolumes          &volumes, 
     const TreeSupportSettings       &config,
     const std::vector<Polygons>     &overhangs,
     std::vector<SupportElements>    &move_bounds,
-    const indexed_triangle_set      &cummulative_mesh,
+    const std::vector<OrganicBranch> &branches,
 
     SupportGeneratorLayersPtr       &bottom_contacts,
     SupportGeneratorLayersPtr       &top_contacts,
@@ -4136,21 +4191,37 @@ static void slice_branches(
         else
             break;
 
-#if 0
-    its_write_obj(cummulative_mesh, "d:\\temp\\meshes\\tree.obj");
-#endif
+    // Intersect the branches with the slicing planes directly instead of triangulating and slicing them.
+    // Collect segments of branches (pairs of consecutive spheres) intersecting each slicing plane.
+    std::vector<std::vector<std::pair<uint32_t, uint32_t>>> layer_segments(slice_z.size());
+    for (uint32_t branch_idx = 0; branch_idx < uint32_t(branches.size()); ++ branch_idx) {
+        const OrganicBranch &branch = branches[branch_idx];
+        for (uint32_t i = 1; i < uint32_t(branch.size()); ++ i) {
+            const BranchSphere &s1 = branch[i - 1];
+            const BranchSphere &s2 = branch[i];
+            const float zmin = float(std::min(s1.center.z() - s1.radius, s2.center.z() - s2.radius));
+            const float zmax = float(std::max(s1.center.z() + s1.radius, s2.center.z() + s2.radius));
+            for (auto it = std::upper_bound(slice_z.begin(), slice_z.end(), zmin); it != slice_z.end() && *it < zmax; ++ it)
+                layer_segments[it - slice_z.begin()].emplace_back(branch_idx, i);
+        }
+    }
+    throw_on_cancel();
 
-    MeshSlicingParamsEx params;
-    params.closing_radius = float(print_object.config().slice_closing_radius.value);
-    params.mode = MeshSlicingParams::SlicingMode::Positive;
-    std::vector<ExPolygons> slices = slice_mesh_ex(cummulative_mesh, slice_z, params, throw_on_cancel);
-    // Trim the slices.
+    // Slice and trim the slices.
     std::vector<Polygons> support_layer_storage(move_bounds.size());
-    tbb::parallel_for(tbb::blocked_range<size_t>(0, slices.size()),
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, slice_z.size()),
         [&](const tbb::blocked_range<size_t> &range) {
+            Points pts;
             for (size_t layer_idx = range.begin(); layer_idx < range.end(); ++layer_idx)
-                if (ExPolygons &src = slices[layer_idx]; ! src.empty())
-                    support_layer_storage[layer_idx] = diff_clipped(to_polygons(std::move(src)), volumes.getCollision(0, layer_idx, true));
+                if (const std::vector<std::pair<uint32_t, uint32_t>> &segments = layer_segments[layer_idx]; ! segments.empty()) {
+                    Polygons src;
+                    src.reserve(segments.size());
+                    for (const auto &[branch_idx, i] : segments)
+                        if (Polygon section = slice_sphere_sweep(branches[branch_idx][i - 1], branches[branch_idx][i], slice_z[layer_idx], pts); ! section.empty())
+                            src.emplace_back(std::move(section));
+                    throw_on_cancel();
+                    support_layer_storage[layer_idx] = diff_clipped(union_(src), volumes.getCollision(0, layer_idx, true));
+                }
         });
 
     std::vector<Polygons> support_roof_storage(move_bounds.size());
@@ -4213,6 +4284,11 @@ static void generate_support_areas(Print &print, const BuildVolume &build_volume
             m_progress_multiplier, m_progress_offset, 
 #endif // SLIC3R_TREESUPPORTS_PROGRESS
             /* additional_excluded_areas */{} };
+        // Collision and avoidance areas of the previous support generation are still valid if only the branch shape changed.
+        if (const std::shared_ptr<TreeModelVolumes> &cached_volumes = print_object.tree_model_volumes(); 
+            cached_volumes && volumes.take_caches(std::move(*cached_volumes)))
+            BOOST_LOG_TRIVIAL(debug) << "Tree support: reusing the collision and avoidance areas of the previous support generation";
+        print_object.set_tree_model_volumes(nullptr);
 
         //FIXME generating overhangs just for the furst mesh of the group.
         assert(processing.second.size() == 1);
@@ -4272,7 +4348,7 @@ static void generate_support_areas(Print &print, const BuildVolume &build_volume
                     bottom_contacts, top_contacts, intermediate_layers, layer_storage, throw_on_cancel);
             else {
                 assert(print_object.config().support_material_style == smsOrganic);
-                indexed_triangle_set branches = draw_branches(*print.get_object(processing.second.front()), volumes, config, move_bounds, throw_on_cancel);
+                std::vector<OrganicBranch> branches = draw_branches(*print.get_object(processing.second.front()), volumes, config, move_bounds, throw_on_cancel);
                 // Reduce memory footprint. After this point only slice_branches() will use volumes and from that only collisions with zero radius will be used.
                 volumes.clear_all_but_object_collision();
                 slice_branches(*print.get_object(processing.second.front()), volumes, config, overhangs, move_bounds, branches,
@@ -4297,6 +4373,7 @@ static void generate_support_areas(Print &print, const BuildVolume &build_volume
     //            BOOST_LOG_TRIVIAL(error) << "Why ask questions when you already know the answer twice.\n (This is not a real bug, please dont report it.)";
             
             move_bounds.clear();
+            print_object.set_tree_model_volumes(std::make_shared<TreeModelVolumes>(std::move(volumes)));
         } else {
             top_contacts.assign(config.raft_layers.size(), nullptr);
             if (generate_raft_contact(print_object, config, top_contacts, layer_storage) < 0)
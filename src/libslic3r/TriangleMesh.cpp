@@ -16,6 +16,7 @@
 
 #include <cmath>
 #include <deque>
+#include <mutex>
 #include <queue>
 #include <vector>
 #include <utility>
@@ -26,6 +27,8 @@
 #include <boost/nowide/cstdio.hpp>
 #include <boost/predef/other/endian.h>
 
+#include <tbb/parallel_sort.h>
+
 #include <Eigen/Core>
 #include <Eigen/Dense>
 
@@ -47,9 +50,23 @@ static void fill_initial_stats(const indexed_triangle_set &its, TriangleMeshStat
     out.volume              = its_volume(its);
     update_bounding_box(its, out);
 
-    const std::vector<Vec3i> face_neighbors = its_face_neighbors(its);
-    out.number_of_parts = its_number_of_patches(its, face_neighbors);
-    out.open_edges      = its_num_open_edges(face_neighbors);
+    // The number of parts and open edges require the face neighbors, which is costly to calculate.
+    // Many meshes never have these queried, thus they are calculated on demand by TriangleMesh::stats().
+    out.number_of_parts     = -1;
+    out.open_edges          = -1;
+}
+
+const TriangleMeshStats& TriangleMesh::stats() const
+{
+    // The mesh may be shared between the UI and the background processing threads.
+    static std::mutex mutex;
+    std::lock_guard<std::mutex> lock(mutex);
+    if (m_stats.number_of_parts < 0) {
+        const std::vector<Vec3i> face_neighbors = its_face_neighbors(this->its);
+        m_stats.number_of_parts = its_number_of_patches(this->its, face_neighbors);
+        m_stats.open_edges      = its_num_open_edges(face_neighbors);
+    }
+    return m_stats;
 }
 
 TriangleMesh::TriangleMesh(const std::vector<Vec3f> &vertices, const std::vector<Vec3i> &faces) : its { faces, vertices }
@@ -405,7 +422,11 @@ std::vector<TriangleMesh> TriangleMesh::split() const
 void TriangleMesh::merge(const TriangleMesh &mesh)
 {
     its_merge(this->its, mesh.its);
+    bool topology_deferred = m_stats.number_of_parts < 0 || mesh.m_stats.number_of_parts < 0;
     m_stats = m_stats.merge(mesh.m_stats);
+    if (topology_deferred)
+        // Calculate the number of parts and open edges of the merged mesh on demand.
+        m_stats.number_of_parts = m_stats.open_edges = -1;
 }
 
 // Calculate projection of the mesh into the XY plane, in scaled coordinates.
@@ -534,27 +555,35 @@ template<typename FaceFilter, typename ThrowOnCancelCallback>
 static std::vector<EdgeToFace> create_edge_map(
     const indexed_triangle_set &its, FaceFilter face_filter, ThrowOnCancelCallback throw_on_cancel)
 {
-    std::vector<EdgeToFace> edges_map;
-    edges_map.reserve(its.indices.size() * 3);
-    for (uint32_t facet_idx = 0; facet_idx < its.indices.size(); ++ facet_idx)
-        if (face_filter(facet_idx))
-            for (int i = 0; i < 3; ++ i) {
-                edges_map.push_back({});
-                EdgeToFace &e2f = edges_map.back();
-                e2f.vertex_low  = its.indices[facet_idx][i];
-                e2f.vertex_high = its.indices[facet_idx][(i + 1) % 3];
-                e2f.face        = facet_idx;
-                // 1 based indexing, to be always strictly positive.
-                e2f.face_edge   = i + 1;
-                if (e2f.vertex_low > e2f.vertex_high) {
-                    // Sort the vertices
-                    std::swap(e2f.vertex_low, e2f.vertex_high);
-                    // and make the face_edge negative to indicate a flipped edge.
-                    e2f.face_edge = - e2f.face_edge;
-                }
+    std::vector<EdgeToFace> edges_map(its.indices.size() * 3);
+    execution::for_each(ex_tbb, size_t(0), its.indices.size(), [&its, &face_filter, &edges_map](size_t facet_idx) {
+        for (int i = 0; i < 3; ++ i) {
+            EdgeToFace &e2f = edges_map[facet_idx * 3 + i];
+            if (! face_filter(uint32_t(facet_idx))) {
+                // Filtered out, to be removed below.
+                e2f.face = -1;
+                continue;
+            }
+            e2f.vertex_low  = its.indices[facet_idx][i];
+            e2f.vertex_high = its.indices[facet_idx][(i + 1) % 3];
+            e2f.face        = int(facet_idx);
+            // 1 based indexing, to be always strictly positive.
+            e2f.face_edge   = i + 1;
+            if (e2f.vertex_low > e2f.vertex_high) {
+                // Sort the vertices
+                std::swap(e2f.vertex_low, e2f.vertex_high);
+                // and make the face_edge negative to indicate a flipped edge.
+                e2f.face_edge = - e2f.face_edge;
             }
+        }
+    }, execution::max_concurrency(ex_tbb));
+    edges_map.erase(std::remove_if(edges_map.begin(), edges_map.end(), [](const EdgeToFace &e2f) { return e2f.face == -1; }), edges_map.end());
     throw_on_cancel();
-    std::sort(edges_map.begin(), edges_map.end());
+    // Order the edges sharing their vertices by the face and edge index, so that the parallel sort produces
+    // the same order as a stable sort would, and the resulting edge IDs do not depend on scheduling.
+    tbb::parallel_sort(edges_map.begin(), edges_map.end(), [](const EdgeToFace &l, const EdgeToFace &r) {
+        return l < r || (l == r && (l.face < r.face || (l.face == r.face && std::abs(l.face_edge) < std::abs(r.face_edge))));
+    });
 
     return edges_map;
 }
@@ -150,12 +150,14 @@ public:
     // Restore optional data possibly released by release_optional().
     void   restore_optional() {}
 
-    const TriangleMeshStats& stats() const { return m_stats; }
+    // The number of parts and open edges are calculated on the first call.
+    const TriangleMeshStats& stats() const;
     
     indexed_triangle_set its;
 
 private:
-    TriangleMeshStats m_stats;
+    // number_of_parts and open_edges are set to -1 until calculated by stats().
+    mutable TriangleMeshStats m_stats;
 };
 
 // Index of face indices incident with a vertex index.
@@ -1351,6 +1351,37 @@ static Polygons make_loops(
     return loops;
 }
 
+// Post-process loops of a single layer according to the slicing mode of that layer.
+static void apply_slicing_mode(Polygons &polygons, const MeshSlicingParams &params, const size_t layer_idx)
+{
+    auto this_mode = layer_idx < params.slicing_mode_normal_below_layer ? params.mode_below : params.mode;
+    if (! polygons.empty()) {
+        if (this_mode == MeshSlicingParams::SlicingMode::Positive) {
+            // Reorient all loops to be CCW.
+            for (Polygon& p : polygons)
+                p.make_counter_clockwise();
+        }
+        else if (this_mode == MeshSlicingParams::SlicingMode::PositiveLargestContour) {
+            // Keep just the largest polygon, make it CCW.
+            double   max_area = 0.;
+            Polygon* max_area_polygon = nullptr;
+            for (Polygon& p : polygons) {
+                double a = p.area();
+                if (std::abs(a) > std::abs(max_area)) {
+                    max_area = a;
+                    max_area_polygon = &p;
+                }
+            }
+            assert(max_area_polygon != nullptr);
+            if (max_area < 0.)
+                max_area_polygon->reverse();
+            Polygon p(std::move(*max_area_polygon));
+            polygons.clear();
+            polygons.emplace_back(std::move(p));
+        }
+    }
+}
+
 template<typename ThrowOnCancel>
 static std::vector<Polygons> make_loops(
     // Lines will have their flags modified.
@@ -1369,37 +1400,145 @@ static std::vector<Polygons> make_loops(
 
                 Polygons &polygons = layers[line_idx];
                 polygons = make_loops(lines[line_idx]);
+                apply_slicing_mode(polygons, params, line_idx);
+            }
+        }
+    );
 
-                auto this_mode = line_idx < params.slicing_mode_normal_below_layer ? params.mode_below : params.mode;
-                if (! polygons.empty()) {
-                    if (this_mode == MeshSlicingParams::SlicingMode::Positive) {
-                        // Reorient all loops to be CCW.
-                        for (Polygon& p : polygons)
-                            p.make_counter_clockwise();
-                    }
-                    else if (this_mode == MeshSlicingParams::SlicingMode::PositiveLargestContour) {
-                        // Keep just the largest polygon, make it CCW.
-                        double   max_area = 0.;
-                        Polygon* max_area_polygon = nullptr;
-                        for (Polygon& p : polygons) {
-                            double a = p.area();
-                            if (std::abs(a) > std::abs(max_area)) {
-                                max_area = a;
-                                max_area_polygon = &p;
-                            }
-                        }
-                        assert(max_area_polygon != nullptr);
-                        if (max_area < 0.)
-                            max_area_polygon->reverse();
-                        Polygon p(std::move(*max_area_polygon));
-                        polygons.clear();
-                        polygons.emplace_back(std::move(p));
-                    }
+    return layers;
+}
+
+// Indices of facets crossed by each slicing plane, stored in a compressed row storage.
+// Facets of each plane are sorted by their index.
+struct FacetsByLayer
+{
+    // zs.size() + 1 offsets into facets.
+    std::vector<size_t>     layer_begin;
+    std::vector<int>        facets;
+};
+
+// Build an index of facets by the slicing planes crossing their [min_z, max_z] interval, so that the planes may be sliced independently
+// and in parallel without the synchronization required when collecting the intersection lines by facets.
+// Horizontal facets are not indexed, they are ignored by slice_facet_at_zs() as well.
+template<typename ThrowOnCancel>
+static FacetsByLayer facets_by_layer(
+    // Vertices transformed for slicing, Z not scaled.
+    const std::vector<stl_vertex>                   &vertices,
+    const std::vector<stl_triangle_vertex_indices>  &indices,
+    const std::vector<float>                        &zs,
+    ThrowOnCancel                                    throw_on_cancel)
+{
+    // Range of planes [first, second) crossing each facet.
+    std::vector<std::pair<int, int>> facet_layers(indices.size());
+    tbb::parallel_for(
+        tbb::blocked_range<int>(0, int(indices.size())),
+        [&vertices, &indices, &zs, &facet_layers, throw_on_cancel](const tbb::blocked_range<int> &range) {
+            for (int face_idx = range.begin(); face_idx < range.end(); ++ face_idx) {
+                if ((face_idx & 0x0ffff) == 0)
+                    throw_on_cancel();
+                const stl_triangle_vertex_indices &face = indices[face_idx];
+                const float z0 = vertices[face(0)].z();
+                const float z1 = vertices[face(1)].z();
+                const float z2 = vertices[face(2)].z();
+                const float min_z = fminf(z0, fminf(z1, z2));
+                const float max_z = fmaxf(z0, fmaxf(z1, z2));
+                if (min_z == max_z) {
+                    facet_layers[face_idx] = { 0, 0 };
+                } else {
+                    auto min_layer = std::lower_bound(zs.begin(), zs.end(), min_z); // first layer whose slice_z is >= min_z
+                    auto max_layer = std::upper_bound(min_layer, zs.end(), max_z); // first layer whose slice_z is > max_z
+                    facet_layers[face_idx] = { int(min_layer - zs.begin()), int(max_layer - zs.begin()) };
                 }
             }
+        });
+
+    // Count the facets per plane in parallel over blocks of facets, then fill in the facet indices into the offsets
+    // reserved for each block, so that the facets of each plane end up sorted by their index without any synchronization.
+    const size_t num_layers   = zs.size();
+    const size_t block_size   = 65536;
+    const size_t num_blocks   = (indices.size() + block_size - 1) / block_size;
+    std::vector<size_t> counts(num_blocks * num_layers, 0);
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, num_blocks, 1),
+        [&facet_layers, &counts, num_layers, block_size](const tbb::blocked_range<size_t> &range) {
+            for (size_t block_idx = range.begin(); block_idx < range.end(); ++ block_idx) {
+                size_t *block_counts = counts.data() + block_idx * num_layers;
+                for (size_t face_idx = block_idx * block_size; face_idx < std::min(facet_layers.size(), (block_idx + 1) * block_size); ++ face_idx)
+                    for (int layer_idx = facet_layers[face_idx].first; layer_idx < facet_layers[face_idx].second; ++ layer_idx)
+                        ++ block_counts[layer_idx];
+            }
+        });
+
+    FacetsByLayer out;
+    out.layer_begin.assign(num_layers + 1, 0);
+    // Convert counts to offsets, ordered by layer first, then by block.
+    size_t offset = 0;
+    for (size_t layer_idx = 0; layer_idx < num_layers; ++ layer_idx) {
+        out.layer_begin[layer_idx] = offset;
+        for (size_t block_idx = 0; block_idx < num_blocks; ++ block_idx) {
+            size_t &cnt = counts[block_idx * num_layers + layer_idx];
+            size_t  n   = cnt;
+            cnt     = offset;
+            offset += n;
         }
-    );
+    }
+    out.layer_begin[num_layers] = offset;
+    out.facets.assign(offset, 0);
+    throw_on_cancel();
 
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, num_blocks, 1),
+        [&facet_layers, &counts, &out, num_layers, block_size](const tbb::blocked_range<size_t> &range) {
+            for (size_t block_idx = range.begin(); block_idx < range.end(); ++ block_idx) {
+                size_t *block_offsets = counts.data() + block_idx * num_layers;
+                for (size_t face_idx = block_idx * block_size; face_idx < std::min(facet_layers.size(), (block_idx + 1) * block_size); ++ face_idx)
+                    for (int layer_idx = facet_layers[face_idx].first; layer_idx < facet_layers[face_idx].second; ++ layer_idx)
+                        out.facets[block_offsets[layer_idx] ++] = int(face_idx);
+            }
+        });
+
+    return out;
+}
+
+// Slice the mesh plane by plane in parallel. The intersection lines of a plane are chained into loops right away,
+// thus only the intersection lines of the planes being processed are kept in memory.
+template<typename ThrowOnCancel>
+static std::vector<Polygons> slice_make_loops_by_layer(
+    // Vertices transformed for slicing, Z not scaled.
+    const std::vector<stl_vertex>                   &vertices,
+    const std::vector<stl_triangle_vertex_indices>  &indices,
+    const std::vector<Vec3i>                        &face_edge_ids,
+    const std::vector<float>                        &zs,
+    const MeshSlicingParams                         &params,
+    ThrowOnCancel                                    throw_on_cancel)
+{
+    const FacetsByLayer facets = facets_by_layer(vertices, indices, zs, throw_on_cancel);
+
+    std::vector<Polygons> layers(zs.size());
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, zs.size()),
+        [&vertices, &indices, &face_edge_ids, &zs, &params, &facets, &layers, throw_on_cancel](const tbb::blocked_range<size_t> &range) {
+            IntersectionLines lines;
+            for (size_t layer_idx = range.begin(); layer_idx < range.end(); ++ layer_idx) {
+                throw_on_cancel();
+                const float slice_z = zs[layer_idx];
+                lines.clear();
+                lines.reserve(facets.layer_begin[layer_idx + 1] - facets.layer_begin[layer_idx]);
+                for (size_t i = facets.layer_begin[layer_idx]; i < facets.layer_begin[layer_idx + 1]; ++ i) {
+                    const int                          face_idx = facets.facets[i];
+                    const stl_triangle_vertex_indices &face     = indices[face_idx];
+                    const stl_vertex                   facet_vertices[3] { vertices[face(0)], vertices[face(1)], vertices[face(2)] };
+                    const float                        min_z    = fminf(facet_vertices[0].z(), fminf(facet_vertices[1].z(), facet_vertices[2].z()));
+                    const int idx_vertex_lowest = (facet_vertices[1].z() == min_z) ? 1 : ((facet_vertices[2].z() == min_z) ? 2 : 0);
+                    IntersectionLine il;
+                    if (slice_facet(slice_z, facet_vertices, face, face_edge_ids[face_idx], idx_vertex_lowest, false, il) == FacetSliceType::Slicing) {
+                        assert(il.edge_type != IntersectionLine::FacetEdgeType::Horizontal);
+                        lines.emplace_back(il);
+                    }
+                }
+                Polygons &polygons = layers[layer_idx];
+                polygons = make_loops(lines);
+                apply_slicing_mode(polygons, params, layer_idx);
+            }
+        });
     return layers;
 }
 
@@ -1742,6 +1881,7 @@ std::vector<Polygons> slice_mesh(
     BOOST_LOG_TRIVIAL(debug) << "slice_mesh to polygons";
        
     std::vector<IntersectionLines> lines;
+    std::vector<Polygons>          layers;
 
     {
         //FIXME facets_edges is likely not needed and quite costly to calculate.
@@ -1762,15 +1902,16 @@ std::vector<Polygons> slice_mesh(
             }
         } else {
             // Copy and scale vertices in XY, don't scale in Z. Possibly apply the transformation.
-            lines = slice_make_lines(
-                transform_mesh_vertices_for_slicing(mesh, params.trafo), 
-                [](const Vec3f &p) { return p; },  mesh.indices, face_edge_ids, zs, throw_on_cancel);
+            // Slice by planes using an index of facets by planes, chain the loops of each plane right after slicing it.
+            layers = slice_make_loops_by_layer(
+                transform_mesh_vertices_for_slicing(mesh, params.trafo), mesh.indices, face_edge_ids, zs, params, throw_on_cancel);
         }
     }
 
     throw_on_cancel();
 
-    std::vector<Polygons> layers = make_loops(lines, params, throw_on_cancel);
+    if (zs.size() <= 1)
+        layers = make_loops(lines, params, throw_on_cancel);
 
 #ifdef SLIC3R_DEBUG
     {
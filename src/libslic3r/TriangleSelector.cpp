@@ -264,8 +264,9 @@ void TriangleSelector::select_patch(int facet_start, std::unique_ptr<Cursor> &&c
         if (!visited[facet] && (highlight_by_angle_deg == 0.f || vec_down.dot(facet_normal) >= highlight_angle_limit)) {
             if (select_triangle(facet, new_state, triangle_splitting)) {
                 // add neighboring facets to list to be processed later
+                // Skip the already processed facets early, they would only be popped from facets_to_check and ignored.
                 for (int neighbor_idx : m_neighbors[facet])
-                    if (neighbor_idx >= 0 && m_cursor->is_facet_visible(neighbor_idx, m_face_normals))
+                    if (neighbor_idx >= 0 && ! visited[neighbor_idx] && m_cursor->is_facet_visible(neighbor_idx, m_face_normals))
                         facets_to_check.push_back(neighbor_idx);
             }
         }
@@ -1,5 +1,5 @@
 #include "TriangleSetSampling.hpp"
-#include <map>
+#include <algorithm>
 #include <random>
 #include <tbb/parallel_for.h>
 #include <tbb/blocked_range.h>
@@ -21,11 +21,13 @@ TriangleSetSamples sample_its_uniform_parallel(size_t samples_count, const index
                 }
             });
 
-    std::map<double, size_t> area_sum_to_triangle_idx;
-    float area_sum = 0;
+    // Prefix sums of the triangle areas, searched by bisection. Accumulated in double, as the sum of many small
+    // triangles would lose the small areas when accumulated in float.
+    std::vector<double> area_prefix_sum(triangles_area.size());
+    double area_sum = 0;
     for (size_t t_idx = 0; t_idx < triangles_area.size(); ++t_idx) {
         area_sum += triangles_area[t_idx];
-        area_sum_to_triangle_idx[area_sum] = t_idx;
+        area_prefix_sum[t_idx] = area_sum;
     }
 
     std::mt19937_64 mersenne_engine { 27644437 };
@@ -40,17 +42,19 @@ TriangleSetSamples sample_its_uniform_parallel(size_t samples_count, const index
     std::generate(random_samples.begin(), random_samples.end(), get_random);
 
     TriangleSetSamples result;
-    result.total_area = area_sum;
+    result.total_area = float(area_sum);
     result.positions.resize(samples_count);
     result.normals.resize(samples_count);
     result.triangle_indices.resize(samples_count);
 
     tbb::parallel_for(tbb::blocked_range<size_t>(0, samples_count),
-            [&triangle_set, &area_sum_to_triangle_idx, &area_sum, &random_samples, &result](
+            [&triangle_set, &area_prefix_sum, &area_sum, &random_samples, &result](
                     tbb::blocked_range<size_t> r) {
                 for (size_t s_idx = r.begin(); s_idx < r.end(); ++s_idx) {
                     double t_sample = random_samples[s_idx].x() * area_sum;
-                    size_t t_idx = area_sum_to_triangle_idx.upper_bound(t_sample)->second;
+                    size_t t_idx = std::min<size_t>(
+                        std::upper_bound(area_prefix_sum.begin(), area_prefix_sum.end(), t_sample) - area_prefix_sum.begin(),
+                        area_prefix_sum.size() - 1);
 
                     double sq_u = std::sqrt(random_samples[s_idx].y());
                     double v = random_samples[s_idx].z();
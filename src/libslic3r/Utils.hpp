@@ -58,6 +58,11 @@ void set_data_dir(const std::string &path);
 // Return a full path to the GUI resource files.
 const std::string& data_dir();
 
+// Set a directory of the persistent cache of sliced object volumes. The cache is disabled if the path is empty (default).
+void set_slice_cache_dir(const std::string &path);
+// Return a full path to the directory of the persistent cache of sliced object volumes, empty if the cache is disabled.
+const std::string& slice_cache_dir();
+
 // Format an output path for debugging purposes.
 // Writes out the output path prefix to the console for the first time the function is called,
 // so the user knows where to search for the debugging output.
@@ -111,6 +111,25 @@ void Zipper::add_entry(const std::string &name, const void *data, size_t l)
     m_data.clear();
 }
 
+void Zipper::add_deflated_entry(const std::string &name,
+                                const void        *deflated_data,
+                                size_t             deflated_bytes,
+                                size_t             bytes,
+                                uint32_t           crc32)
+{
+    if(!m_impl->is_alive()) return;
+
+    finish_entry();
+
+    if(!mz_zip_writer_add_mem_ex(&m_impl->arch, name.c_str(), deflated_data,
+                                 deflated_bytes, nullptr, 0,
+                                 MZ_ZIP_FLAG_COMPRESSED_DATA, bytes, crc32))
+        m_impl->blow_up();
+
+    m_entry.clear();
+    m_data.clear();
+}
+
 void Zipper::finish_entry()
 {
     if(!m_impl->is_alive()) return;
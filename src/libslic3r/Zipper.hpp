@@ -51,6 +51,16 @@ public:
     /// This method throws exactly like finish_entry() does.
     void add_entry(const std::string& name, const void* data, size_t bytes);
 
+    /// Add a new binary file entry with a byte buffer already compressed by
+    /// raw deflate (no zlib header), which is stored into the archive as is.
+    /// The size and the CRC-32 of the uncompressed data have to be given.
+    /// This method throws exactly like finish_entry() does.
+    void add_deflated_entry(const std::string& name,
+                            const void*        deflated_data,
+                            size_t             deflated_bytes,
+                            size_t             bytes,
+                            uint32_t           crc32);
+
     // Writing data to the archive works like with standard streams. The target
     // within the zip file is the entry created with the add_entry method.
 
@@ -212,6 +212,18 @@ std::string custom_shapes_dir()
     return (boost::filesystem::path(g_data_dir) / "shapes").string();
 }
 
+static std::string g_slice_cache_dir;
+
+void set_slice_cache_dir(const std::string &dir)
+{
+    g_slice_cache_dir = dir;
+}
+
+const std::string& slice_cache_dir()
+{
+    return g_slice_cache_dir;
+}
+
 static std::atomic<bool> debug_out_path_called(false);
 
 std::string debug_out_path(const char *name, ...)
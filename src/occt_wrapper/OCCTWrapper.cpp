@@ -21,6 +21,7 @@
 #include "BRepBuilderAPI_Transform.hxx"
 #include "TopExp_Explorer.hxx"
 #include "BRep_Tool.hxx"
+#include "OSD_Parallel.hxx"
 
 const double STEP_TRANS_CHORD_ERROR = 0.005;
 const double STEP_TRANS_ANGLE_RES = 1;
@@ -126,7 +127,11 @@ try {
     std::string obj_name((last_slash == nullptr) ? path : last_slash + 1);
     res->object_name = obj_name;
 
-    for (size_t i = 0; i < namedSolids.size(); ++i) {
+    // Tessellate the solids in parallel. The solids were copied by BRepBuilderAPI_Transform,
+    // thus they do not share faces and their triangulations may be stored concurrently.
+    std::vector<OCCTVolume>  volumes(namedSolids.size());
+    std::vector<std::string> errors(namedSolids.size());
+    OSD_Parallel::For(0, int(namedSolids.size()), [&namedSolids, &volumes, &errors](int i) {
         //BBS:if (proFn) {
         //    proFn(LOAD_STEP_STAGE_GET_MESH, i, namedSolids.size(), cb_cancel);
         //    if (cb_cancel) {
@@ -136,50 +141,62 @@ try {
         //        return false;
         //    }
         //}
-
-        res->volumes.emplace_back();
-        auto& vertices = res->volumes.back().vertices;
-        auto& indices  = res->volumes.back().indices;
-
-        BRepMesh_IncrementalMesh mesh(namedSolids[i].solid, STEP_TRANS_CHORD_ERROR, false, STEP_TRANS_ANGLE_RES, true);
-
-        for (TopExp_Explorer anExpSF(namedSolids[i].solid, TopAbs_FACE); anExpSF.More(); anExpSF.Next()) {
-            const int aNodeOffset = int(vertices.size());
-            const TopoDS_Shape& aFace = anExpSF.Current();
-            TopLoc_Location aLoc;
-            Handle(Poly_Triangulation) aTriangulation = BRep_Tool::Triangulation(TopoDS::Face(aFace), aLoc);
-            if (aTriangulation.IsNull())
-                continue;
-
-            // First copy vertices (will create duplicates).
-            gp_Trsf aTrsf = aLoc.Transformation();
-            for (Standard_Integer aNodeIter = 1; aNodeIter <= aTriangulation->NbNodes(); ++aNodeIter) {
-                gp_Pnt aPnt = aTriangulation->Node(aNodeIter);
-                aPnt.Transform(aTrsf);
-                vertices.push_back({float(aPnt.X()), float(aPnt.Y()), float(aPnt.Z())});
-            }
-            // Now the indices.
-            const TopAbs_Orientation anOrientation = anExpSF.Current().Orientation();
-            for (Standard_Integer aTriIter = 1; aTriIter <= aTriangulation->NbTriangles(); ++aTriIter) {
-                Poly_Triangle aTri = aTriangulation->Triangle(aTriIter);
-
-                Standard_Integer anId[3];
-                aTri.Get(anId[0], anId[1], anId[2]);
-                if (anOrientation == TopAbs_REVERSED)
-                    std::swap(anId[1], anId[2]);
-
-                // Account for the vertices we already have from previous faces.
-                // anId is 1-based index !
-                indices.push_back({anId[0] - 1 + aNodeOffset,
-                                   anId[1] - 1 + aNodeOffset,
-                                   anId[2] - 1 + aNodeOffset});
+        try {
+            auto& vertices = volumes[i].vertices;
+            auto& indices  = volumes[i].indices;
+
+            BRepMesh_IncrementalMesh mesh(namedSolids[i].solid, STEP_TRANS_CHORD_ERROR, false, STEP_TRANS_ANGLE_RES, true);
+
+            for (TopExp_Explorer anExpSF(namedSolids[i].solid, TopAbs_FACE); anExpSF.More(); anExpSF.Next()) {
+                const int aNodeOffset = int(vertices.size());
+                const TopoDS_Shape& aFace = anExpSF.Current();
+                TopLoc_Location aLoc;
+                Handle(Poly_Triangulation) aTriangulation = BRep_Tool::Triangulation(TopoDS::Face(aFace), aLoc);
+                if (aTriangulation.IsNull())
+                    continue;
+
+                // First copy vertices (will create duplicates).
+                gp_Trsf aTrsf = aLoc.Transformation();
+                for (Standard_Integer aNodeIter = 1; aNodeIter <= aTriangulation->NbNodes(); ++aNodeIter) {
+                    gp_Pnt aPnt = aTriangulation->Node(aNodeIter);
+                    aPnt.Transform(aTrsf);
+                    vertices.push_back({float(aPnt.X()), float(aPnt.Y()), float(aPnt.Z())});
+                }
+                // Now the indices.
+                const TopAbs_Orientation anOrientation = anExpSF.Current().Orientation();
+                for (Standard_Integer aTriIter = 1; aTriIter <= aTriangulation->NbTriangles(); ++aTriIter) {
+                    Poly_Triangle aTri = aTriangulation->Triangle(aTriIter);
+
+                    Standard_Integer anId[3];
+                    aTri.Get(anId[0], anId[1], anId[2]);
+                    if (anOrientation == TopAbs_REVERSED)
+                        std::swap(anId[1], anId[2]);
+
+                    // Account for the vertices we already have from previous faces.
+                    // anId is 1-based index !
+                    indices.push_back({anId[0] - 1 + aNodeOffset,
+                                       anId[1] - 1 + aNodeOffset,
+                                       anId[2] - 1 + aNodeOffset});
+                }
             }
-        }
 
-        res->volumes.back().volume_name = namedSolids[i].name;
-
-        if (vertices.empty())
-            res->volumes.pop_back();        
+            volumes[i].volume_name = namedSolids[i].name;
+        } catch (const std::exception& ex) {
+            errors[i] = ex.what();
+        } catch (...) {
+            errors[i] = "An exception was thrown in load_step_internal.";
+        }
+    });
+
+    for (size_t i = 0; i < volumes.size(); ++i) {
+        if (! errors[i].empty()) {
+            shapeTool.reset(nullptr);
+            application->Close(document);
+            res->error_str = errors[i];
+            return false;
+        }
+        if (! volumes[i].vertices.empty())
+            res->volumes.emplace_back(std::move(volumes[i]));
     }
 
     shapeTool.reset(nullptr);
@@ -399,7 +399,16 @@ void Bed3D::render_texture(bool bottom, GLCanvas3D& canvas, const Transform3d& v
         if (boost::algorithm::iends_with(m_texture_filename, ".svg")) {
             // use higher resolution images if graphic card and opengl version allow
             GLint max_tex_size = OpenGLManager::get_gl_info().get_max_tex_size();
-            if (m_temp_texture.get_id() == 0 || m_temp_texture.get_source() != m_texture_filename) {
+            // starts generating the main texture, compression will run asynchronously unless loaded from the texture cache
+            if (!m_texture.load_from_svg_file(m_texture_filename, true, true, true, max_tex_size)) {
+                render_default(bottom, false, true, view_matrix, projection_matrix);
+                return;
+            }
+
+            if (m_texture.all_compressed_data_sent_to_gpu())
+                // the main texture was loaded from the texture cache
+                m_temp_texture.reset();
+            else if (m_temp_texture.get_id() == 0 || m_temp_texture.get_source() != m_texture_filename) {
                 // generate a temporary lower resolution texture to show while no main texture levels have been compressed
                 if (!m_temp_texture.load_from_svg_file(m_texture_filename, false, false, false, max_tex_size / 8)) {
                     render_default(bottom, false, true, view_matrix, projection_matrix);
@@ -407,28 +416,25 @@ void Bed3D::render_texture(bool bottom, GLCanvas3D& canvas, const Transform3d& v
                 }
                 canvas.request_extra_frame();
             }
-
-            // starts generating the main texture, compression will run asynchronously
-            if (!m_texture.load_from_svg_file(m_texture_filename, true, true, true, max_tex_size)) {
+        } 
+        else if (boost::algorithm::iends_with(m_texture_filename, ".png")) {
+            // starts generating the main texture, compression will run asynchronously unless loaded from the texture cache
+            if (!m_texture.load_from_file(m_texture_filename, true, GLTexture::MultiThreaded, true)) {
                 render_default(bottom, false, true, view_matrix, projection_matrix);
                 return;
             }
-        } 
-        else if (boost::algorithm::iends_with(m_texture_filename, ".png")) {
-            // generate a temporary lower resolution texture to show while no main texture levels have been compressed
-            if (m_temp_texture.get_id() == 0 || m_temp_texture.get_source() != m_texture_filename) {
+
+            if (m_texture.all_compressed_data_sent_to_gpu())
+                // the main texture was loaded from the texture cache
+                m_temp_texture.reset();
+            else if (m_temp_texture.get_id() == 0 || m_temp_texture.get_source() != m_texture_filename) {
+                // generate a temporary lower resolution texture to show while no main texture levels have been compressed
                 if (!m_temp_texture.load_from_file(m_texture_filename, false, GLTexture::None, false)) {
                     render_default(bottom, false, true, view_matrix, projection_matrix);
                     return;
                 }
                 canvas.request_extra_frame();
             }
-
-            // starts generating the main texture, compression will run asynchronously
-            if (!m_texture.load_from_file(m_texture_filename, true, GLTexture::MultiThreaded, true)) {
-                render_default(bottom, false, true, view_matrix, projection_matrix);
-                return;
-            }
         }
         else {
             render_default(bottom, false, true, view_matrix, projection_matrix);
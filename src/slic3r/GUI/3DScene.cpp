@@ -804,64 +804,71 @@ void GLVolumeCollection::render(GLVolumeCollection::ERenderType type, bool disab
     if (disable_cullface)
         glsafe(::glDisable(GL_CULL_FACE));
 
+    // Uniforms are stored with the shader program, thus the ones shared by all the volumes are set just once,
+    // even if the program is switched to render the sinking contours.
+    shader->set_uniform("z_range", m_z_range);
+    shader->set_uniform("clipping_plane", m_clipping_plane);
+    shader->set_uniform("use_color_clip_plane", m_use_color_clip_plane);
+    shader->set_uniform("color_clip_plane", m_color_clip_plane);
+    shader->set_uniform("uniform_color_clip_plane_1", m_color_clip_plane_colors[0]);
+    shader->set_uniform("uniform_color_clip_plane_2", m_color_clip_plane_colors[1]);
+    shader->set_uniform("print_volume.type", static_cast<int>(m_print_volume.type));
+    shader->set_uniform("print_volume.xy_data", m_print_volume.data);
+    shader->set_uniform("print_volume.z_data", m_print_volume.zs);
+    shader->set_uniform("slope.normal_z", m_slope.normal_z);
+    shader->set_uniform("projection_matrix", projection_matrix);
+
+#if ENABLE_ENVIRONMENT_MAP
+    unsigned int environment_texture_id = GUI::wxGetApp().plater()->get_environment_texture_id();
+    bool use_environment_texture = environment_texture_id > 0 && GUI::wxGetApp().app_config->get_bool("use_environment_map");
+    shader->set_uniform("use_environment_tex", use_environment_texture);
+    if (use_environment_texture)
+        glsafe(::glBindTexture(GL_TEXTURE_2D, environment_texture_id));
+#endif // ENABLE_ENVIRONMENT_MAP
+    glcheck();
+
+    // The uniforms set for each volume are resolved just once.
+    const int volume_world_matrix_id = shader->get_uniform_location("volume_world_matrix");
+    const int slope_actived_id       = shader->get_uniform_location("slope.actived");
+    const int slope_normal_matrix_id = shader->get_uniform_location("slope.volume_world_normal_matrix");
+    const int view_model_matrix_id   = shader->get_uniform_location("view_model_matrix");
+    const int view_normal_matrix_id  = shader->get_uniform_location("view_normal_matrix");
+
     for (GLVolumeWithIdAndZ& volume : to_render) {
         const Transform3d& world_matrix = volume.first->world_matrix();
         volume.first->set_render_color(true);
 
         // render sinking contours of non-hovered volumes
-        shader->stop_using();
-        if (sink_shader != nullptr) {
+        if (m_show_sinking_contours && sink_shader != nullptr &&
+            volume.first->is_sinking() && !volume.first->is_below_printbed() &&
+            volume.first->hover == GLVolume::HS_None && !volume.first->force_sinking_contours) {
+            shader->stop_using();
             sink_shader->start_using();
-            if (m_show_sinking_contours) {
-                if (volume.first->is_sinking() && !volume.first->is_below_printbed() &&
-                    volume.first->hover == GLVolume::HS_None && !volume.first->force_sinking_contours) {
-                    volume.first->render_sinking_contours();
-                }
-            }
+            volume.first->render_sinking_contours();
             sink_shader->stop_using();
+            shader->start_using();
         }
-        shader->start_using();
 
-        shader->set_uniform("z_range", m_z_range);
-        shader->set_uniform("clipping_plane", m_clipping_plane);
-        shader->set_uniform("use_color_clip_plane", m_use_color_clip_plane);
-        shader->set_uniform("color_clip_plane", m_color_clip_plane);
-        shader->set_uniform("uniform_color_clip_plane_1", m_color_clip_plane_colors[0]);
-        shader->set_uniform("uniform_color_clip_plane_2", m_color_clip_plane_colors[1]);
-        shader->set_uniform("print_volume.type", static_cast<int>(m_print_volume.type));
-        shader->set_uniform("print_volume.xy_data", m_print_volume.data);
-        shader->set_uniform("print_volume.z_data", m_print_volume.zs);
-        shader->set_uniform("volume_world_matrix", world_matrix);
-        shader->set_uniform("slope.actived", m_slope.active && !volume.first->is_modifier && !volume.first->is_wipe_tower);
-        shader->set_uniform("slope.volume_world_normal_matrix", static_cast<Matrix3f>(world_matrix.matrix().block(0, 0, 3, 3).inverse().transpose().cast<float>()));
-        shader->set_uniform("slope.normal_z", m_slope.normal_z);
-
-#if ENABLE_ENVIRONMENT_MAP
-        unsigned int environment_texture_id = GUI::wxGetApp().plater()->get_environment_texture_id();
-        bool use_environment_texture = environment_texture_id > 0 && GUI::wxGetApp().app_config->get_bool("use_environment_map");
-        shader->set_uniform("use_environment_tex", use_environment_texture);
-        if (use_environment_texture)
-            glsafe(::glBindTexture(GL_TEXTURE_2D, environment_texture_id));
-#endif // ENABLE_ENVIRONMENT_MAP
-        glcheck();
+        shader->set_uniform(volume_world_matrix_id, world_matrix);
+        shader->set_uniform(slope_actived_id, m_slope.active && !volume.first->is_modifier && !volume.first->is_wipe_tower);
+        shader->set_uniform(slope_normal_matrix_id, static_cast<Matrix3f>(world_matrix.matrix().block(0, 0, 3, 3).inverse().transpose().cast<float>()));
 
         volume.first->model.set_color(volume.first->render_color);
         const Transform3d model_matrix = world_matrix;
-        shader->set_uniform("view_model_matrix", view_matrix * model_matrix);
-        shader->set_uniform("projection_matrix", projection_matrix);
+        shader->set_uniform(view_model_matrix_id, view_matrix * model_matrix);
         const Matrix3d view_normal_matrix = view_matrix.matrix().block(0, 0, 3, 3) * model_matrix.matrix().block(0, 0, 3, 3).inverse().transpose();
-        shader->set_uniform("view_normal_matrix", view_normal_matrix);
+        shader->set_uniform(view_normal_matrix_id, view_normal_matrix);
         volume.first->render();
 
-#if ENABLE_ENVIRONMENT_MAP
-        if (use_environment_texture)
-            glsafe(::glBindTexture(GL_TEXTURE_2D, 0));
-#endif // ENABLE_ENVIRONMENT_MAP
-
         glsafe(::glBindBuffer(GL_ARRAY_BUFFER, 0));
         glsafe(::glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0));
     }
 
+#if ENABLE_ENVIRONMENT_MAP
+    if (use_environment_texture)
+        glsafe(::glBindTexture(GL_TEXTURE_2D, 0));
+#endif // ENABLE_ENVIRONMENT_MAP
+
     if (m_show_sinking_contours) {
         shader->stop_using();
         if (sink_shader != nullptr) {
@@ -1556,52 +1563,63 @@ void _3DScene::thick_lines_to_verts(
     thick_lines_to_geometry(lines, widths, heights, closed, geometry);
 }
 
+// Lines of an extrusion entity being converted to triangles with their widths and heights.
+// The sliced preview converts the layers in parallel, each thread reuses its buffers for all the paths it converts.
+struct ExtrusionLines
+{
+    Lines               lines;
+    std::vector<double> widths;
+    std::vector<double> heights;
+
+    void clear() { lines.clear(); widths.clear(); heights.clear(); }
+
+    // Append lines of the path without the zero length ones, shifted by copy.
+    void append(const ExtrusionPath &extrusion_path, const Point &copy) {
+        const Points &pts = extrusion_path.polyline.points;
+        if (! pts.empty()) {
+            const Point *prev = &pts.front();
+            for (const Point &pt : pts)
+                if (pt != *prev) {
+                    lines.emplace_back(*prev + copy, pt + copy);
+                    prev = &pt;
+                }
+        }
+        widths.resize(lines.size(), extrusion_path.width);
+        heights.resize(lines.size(), extrusion_path.height);
+    }
+};
+
+static ExtrusionLines& extrusion_lines_cleared()
+{
+    static thread_local ExtrusionLines s_lines;
+    s_lines.clear();
+    return s_lines;
+}
+
 // Fill in the qverts and tverts with quads and triangles for the extrusion_path.
 void _3DScene::extrusionentity_to_verts(const ExtrusionPath& extrusion_path, float print_z, const Point& copy, GUI::GLModel::Geometry& geometry)
 {
-    Polyline            polyline = extrusion_path.polyline;
-    polyline.remove_duplicate_points();
-    polyline.translate(copy);
-    const Lines               lines = polyline.lines();
-    std::vector<double> widths(lines.size(), extrusion_path.width);
-    std::vector<double> heights(lines.size(), extrusion_path.height);
-    thick_lines_to_verts(lines, widths, heights, false, print_z, geometry);
+    ExtrusionLines &lines = extrusion_lines_cleared();
+    lines.append(extrusion_path, copy);
+    thick_lines_to_verts(lines.lines, lines.widths, lines.heights, false, print_z, geometry);
 }
 
 // Fill in the qverts and tverts with quads and triangles for the extrusion_loop.
 void _3DScene::extrusionentity_to_verts(const ExtrusionLoop& extrusion_loop, float print_z, const Point& copy, GUI::GLModel::Geometry& geometry)
 {
-    Lines               lines;
-    std::vector<double> widths;
-    std::vector<double> heights;
-    for (const ExtrusionPath& extrusion_path : extrusion_loop.paths) {
-        Polyline            polyline = extrusion_path.polyline;
-        polyline.remove_duplicate_points();
-        polyline.translate(copy);
-        const Lines lines_this = polyline.lines();
-        append(lines, lines_this);
-        widths.insert(widths.end(), lines_this.size(), extrusion_path.width);
-        heights.insert(heights.end(), lines_this.size(), extrusion_path.height);
-    }
-    thick_lines_to_verts(lines, widths, heights, true, print_z, geometry);
+    ExtrusionLines &lines = extrusion_lines_cleared();
+    for (const ExtrusionPath& extrusion_path : extrusion_loop.paths)
+        lines.append(extrusion_path, copy);
+    thick_lines_to_verts(lines.lines, lines.widths, lines.heights, true, print_z, geometry);
 }
 
 // Fill in the qverts and tverts with quads and triangles for the extrusion_multi_path.
 void _3DScene::extrusionentity_to_verts(const ExtrusionMultiPath& extrusion_multi_path, float print_z, const Point& copy, GUI::GLModel::Geometry& geometry)
 {
-    Lines               lines;
-    std::vector<double> widths;
-    std::vector<double> heights;
-    for (const ExtrusionPath& extrusion_path : extrusion_multi_path.paths) {
-        Polyline            polyline = extrusion_path.polyline;
-        polyline.remove_duplicate_points();
-        polyline.translate(copy);
-        const Lines lines_this = polyline.lines();
-        append(lines, lines_this);
-        widths.insert(widths.end(), lines_this.size(), extrusion_path.width);
-        heights.insert(heights.end(), lines_this.size(), extrusion_path.height);
-    }
-    thick_lines_to_verts(lines, widths, heights, false, print_z, geometry);
+    ExtrusionLines &lines = extrusion_lines_cleared();
+    for (const ExtrusionPath& extrusion_path : extrusion_multi_path.paths)
+        lines.append(extrusion_path, copy);
+    thick_lines_to_verts(lines.lines, lines.widths, lines.heights, false, print_z, geometry);
 }
 
 void _3DScene::extrusionentity_to_verts(const ExtrusionEntityCollection& extrusion_entity_collection, float print_z, const Point& copy, GUI::GLModel::Geometry& geometry)
@@ -19,9 +19,11 @@
 #include "libslic3r/Print.hpp"
 #include "libslic3r/SLAPrint.hpp"
 #include "libslic3r/Utils.hpp"
+#include "libslic3r/AppConfig.hpp"
 #include "libslic3r/GCode/PostProcessor.hpp"
 #include "libslic3r/Format/SL1.hpp"
 #include "libslic3r/Thread.hpp"
+#include "libslic3r/Trace.hpp"
 #include "libslic3r/libslic3r.h"
 
 #include <cassert>
@@ -227,6 +229,9 @@ void BackgroundSlicingProcess::thread_proc()
 		this->call_process(exception);
 #endif
 		m_print->finalize();
+		if (trace_enabled())
+			// Export all the regions traced since the application started, see the SLIC3R_TRACE environment variable.
+			trace_export();
 		lck.lock();
 		m_state = m_print->canceled() ? STATE_CANCELED : STATE_FINISHED;
 		if (m_print->cancel_status() != Print::CANCELED_INTERNAL) {
@@ -705,6 +710,10 @@ void BackgroundSlicingProcess::finalize_gcode()
 		break;
 	}
 
+	// The result references lines of the G-code, a post-processed G-code does not match it.
+	if (! post_processed && m_gcode_result != nullptr && GUI::wxGetApp().app_config->get_bool("export_gcode_result_cache"))
+		GCodeProcessor::save_result_cache(*m_gcode_result, export_path);
+
 	m_print->set_status(100, (boost::format(_utf8(L("G-code file exported to %1%"))) % export_path).str());
 }
 
@@ -3,6 +3,8 @@
 #include "NotificationManager.hpp"
 #include "format.hpp"
 
+#include <algorithm>
+
 #include <boost/algorithm/string.hpp>
 #include <boost/log/trivial.hpp>
 
@@ -10,6 +12,9 @@ namespace Slic3r {
 namespace GUI {
 
 namespace {
+// Further downloads wait for one of the ongoing downloads to finish, each download may run several parallel requests.
+const size_t MAX_CONCURRENT_DOWNLOADS = 3;
+
 void open_folder(const std::string& path)
 {
 	// Code taken from NotificationManager.cpp
@@ -158,10 +163,24 @@ void Downloader::start_download(const std::string& full_url)
     m_downloads.emplace_back(std::make_unique<Download>(id, std::move(escaped_url), this, m_dest_folder));
 	NotificationManager* ntf_mngr = wxGetApp().notification_manager();
 	ntf_mngr->push_download_URL_progress_notification(id, m_downloads.back()->get_filename(), std::bind(&Downloader::user_action_callback, this, std::placeholders::_1, std::placeholders::_2));
-	m_downloads.back()->start();
+	start_pending_downloads();
 	BOOST_LOG_TRIVIAL(debug) << "started download";
 }
 
+void Downloader::start_pending_downloads()
+{
+	size_t ongoing = std::count_if(m_downloads.begin(), m_downloads.end(),
+		[](const std::unique_ptr<Download>& download) { return download->get_state() == DownloadState::DownloadOngoing; });
+	for (std::unique_ptr<Download>& download : m_downloads) {
+		if (ongoing >= MAX_CONCURRENT_DOWNLOADS)
+			break;
+		if (download->get_state() == DownloadState::DownloadPending) {
+			download->start();
+			++ongoing;
+		}
+	}
+}
+
 void Downloader::on_progress(wxCommandEvent& event)
 {
 	size_t id = event.GetInt();
@@ -179,12 +198,14 @@ void Downloader::on_error(wxCommandEvent& event)
 	NotificationManager* ntf_mngr = wxGetApp().notification_manager();
 	ntf_mngr->set_download_URL_error(id, boost::nowide::narrow(event.GetString()));
 	show_error(nullptr, format_wxstr(L"%1%\n%2%", _L("The download has failed:"), event.GetString()));
+	start_pending_downloads();
 }
 void Downloader::on_complete(wxCommandEvent& event)
 {
 	// TODO: is this always true? :
 	// here we open the file itself, notification should get 1.f progress from on progress.
     set_download_state(event.GetInt(), DownloadState::DownloadDone);
+	start_pending_downloads();
 	wxArrayString paths;
 	paths.Add(event.GetString());
 	wxGetApp().plater()->load_files(paths);
@@ -224,6 +245,7 @@ void Downloader::on_paused(wxCommandEvent& event)
 	size_t id = event.GetInt();
 	NotificationManager* ntf_mngr = wxGetApp().notification_manager();
 	ntf_mngr->set_download_URL_paused(id);
+	start_pending_downloads();
 }
 
 void Downloader::on_canceled(wxCommandEvent& event)
@@ -231,6 +253,7 @@ void Downloader::on_canceled(wxCommandEvent& event)
 	size_t id = event.GetInt();
 	NotificationManager* ntf_mngr = wxGetApp().notification_manager();
 	ntf_mngr->set_download_URL_canceled(id);
+	start_pending_downloads();
 }
 
 void Downloader::set_download_state(int id, DownloadState state)
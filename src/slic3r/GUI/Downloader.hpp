@@ -82,6 +82,8 @@ private:
     void on_canceled(wxCommandEvent& event);
 
     void set_download_state(int id, DownloadState state);
+    // Starts the pending downloads while less than MAX_CONCURRENT_DOWNLOADS downloads are ongoing.
+    void start_pending_downloads();
     /*
     bool is_in_state(int id, DownloadState state) const;
     DownloadState get_download_state(int id) const;
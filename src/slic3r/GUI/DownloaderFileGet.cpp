@@ -1,6 +1,10 @@
 #include "DownloaderFileGet.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <mutex>
 #include <thread>
+#include <vector>
 #include <curl/curl.h>
 #include <boost/nowide/fstream.hpp>
 #include <boost/format.hpp>
@@ -17,6 +21,9 @@ namespace GUI {
 
 const size_t DOWNLOAD_MAX_CHUNK_SIZE	= 10 * 1024 * 1024;
 const size_t DOWNLOAD_SIZE_LIMIT		= 1024 * 1024 * 1024;
+// Files at least this large are downloaded by DOWNLOAD_RANGES parallel range requests, if the server supports them.
+const size_t DOWNLOAD_RANGES_MIN_SIZE	= 8 * 1024 * 1024;
+const size_t DOWNLOAD_RANGES			= 4;
 
 std::string FileGet::escape_url(const std::string& unescaped)
 {
@@ -107,9 +114,20 @@ struct FileGet::priv
 	std::atomic_bool m_stopped { false }; // either canceled or paused - download is not running
 	size_t m_written { 0 };
 	size_t m_absolute_size { 0 };
+	// Byte ranges of the file downloaded in parallel, empty if the file is downloaded by a single request.
+	struct Range {
+		size_t begin;
+		size_t end;
+		size_t written { 0 };
+	};
+	std::vector<Range> m_ranges;
 	priv(int ID, std::string&& url, const std::string& filename, wxEvtHandler* evt_handler, const boost::filesystem::path& dest_folder);
 
 	void get_perform();
+	// Size of the file, if the server supports range requests. Zero otherwise.
+	size_t get_size_by_range_request() const;
+	void get_perform_ranges(const boost::filesystem::path& dest_path);
+	void queue_event(const wxEventType& type, const wxString& str = wxString()) const;
 };
 
 FileGet::priv::priv(int ID, std::string&& url, const std::string& filename, wxEvtHandler* evt_handler, const boost::filesystem::path& dest_folder)
@@ -121,6 +139,152 @@ FileGet::priv::priv(int ID, std::string&& url, const std::string& filename, wxEv
 {
 }
 
+void FileGet::priv::queue_event(const wxEventType& type, const wxString& str) const
+{
+	wxCommandEvent* evt = new wxCommandEvent(type);
+	evt->SetString(str);
+	evt->SetInt(m_id);
+	m_evt_handler->QueueEvent(evt);
+}
+
+size_t FileGet::priv::get_size_by_range_request() const
+{
+	size_t size = 0;
+	std::string content_range;
+	Http::get(m_url)
+		// A server ignoring the range would send the whole file, which is cut off by the size limit.
+		.size_limit(16)
+		.set_range("0-0")
+		.on_header([&content_range](std::string name, std::string value) {
+			if (boost::iequals(name, "Content-Range"))
+				content_range = std::move(value);
+		})
+		.on_complete([&](std::string /* body */, unsigned http_status) {
+			// Content-Range: bytes 0-0/size
+			if (size_t slash = content_range.find('/'); http_status == 206 && slash != std::string::npos) {
+				try {
+					size = std::stoull(content_range.substr(slash + 1));
+				} catch (const std::exception&) {
+				}
+			}
+		})
+		.perform_sync();
+	return size;
+}
+
+// Download the byte ranges of the file in parallel, each by a range request on its own thread, into the temporary file.
+// The ranges are resumed after a pause from where they were paused.
+void FileGet::priv::get_perform_ranges(const boost::filesystem::path& dest_path)
+{
+	wxString temp_path_wstring(m_tmp_path.wstring());
+	size_t written_previously = 0;
+	for (const Range& range : m_ranges)
+		written_previously += range.written;
+	if (written_previously == 0) {
+		// create the file, each range is written through its own FILE
+		FILE* file = fopen(temp_path_wstring.c_str(), "wb");
+		if (file == NULL) {
+			queue_event(EVT_DWNLDR_FILE_ERROR, GUI::format_wxstr(_L("Can't create file at %1%."), temp_path_wstring));
+			return;
+		}
+		fclose(file);
+	}
+
+	std::atomic<size_t> downloaded { written_previously };
+	std::atomic<int>    last_percent { -1 };
+	std::atomic_bool    failed { false };
+	std::mutex          error_mutex;
+	wxString            error_message;
+	auto set_error = [&](const wxString& message) {
+		std::scoped_lock<std::mutex> lock(error_mutex);
+		if (!failed.exchange(true))
+			error_message = message;
+	};
+
+	auto download_range = [&](Range& range) {
+		if (range.begin + range.written == range.end)
+			return;
+		FILE* file = fopen(temp_path_wstring.c_str(), "r+b");
+		if (file == NULL || fseek(file, long(range.begin + range.written), SEEK_SET) != 0) {
+			if (file != NULL)
+				fclose(file);
+			set_error(GUI::format_wxstr(_L("Can't create file at %1%."), temp_path_wstring));
+			return;
+		}
+		size_t written_this_session = 0;
+		// write the data received so far, without copying it out of the buffer
+		auto write_received = [&](const std::string& buffer, size_t received) {
+			received = std::min(received, buffer.size());
+			if (received > written_this_session) {
+				const size_t len = received - written_this_session;
+				if (fwrite(buffer.data() + written_this_session, 1, len, file) != len)
+					return false;
+				written_this_session = received;
+				range.written += len;
+				downloaded += len;
+			}
+			return true;
+		};
+		Http::get(m_url)
+			.size_limit(DOWNLOAD_SIZE_LIMIT)
+			.set_range(std::to_string(range.begin + range.written) + "-" + std::to_string(range.end - 1))
+			.on_progress([&](Http::Progress progress, bool& cancel) {
+				if (m_cancel || m_pause || failed) {
+					cancel = true;
+					return;
+				}
+				if (!write_received(progress.buffer, progress.dlnow)) {
+					set_error(GUI::format_wxstr(_L("Failed to write to %1%."), temp_path_wstring));
+					cancel = true;
+					return;
+				}
+				if (int percent = int(downloaded * 100 / m_absolute_size); last_percent.exchange(percent) != percent)
+					queue_event(EVT_DWNLDR_FILE_PROGRESS, std::to_string(percent));
+			})
+			.on_error([&](std::string body, std::string error, unsigned /* http_status */) {
+				set_error(error.empty() ? GUI::from_u8(body) : GUI::from_u8(error));
+			})
+			.on_complete([&](std::string body, unsigned http_status) {
+				if (http_status != 206) {
+					set_error(_L("The server does not support downloading parts of the file."));
+					return;
+				}
+				if (!write_received(body, body.size()))
+					set_error(GUI::format_wxstr(_L("Failed to write to %1%."), temp_path_wstring));
+			})
+			.perform_sync();
+		fclose(file);
+	};
+
+	std::vector<std::thread> threads;
+	threads.reserve(m_ranges.size());
+	for (Range& range : m_ranges)
+		threads.emplace_back([&download_range, &range]() { download_range(range); });
+	for (std::thread& thread : threads)
+		thread.join();
+
+	if (m_cancel) {
+		m_stopped = true;
+		std::remove(m_tmp_path.string().c_str());
+		m_ranges.clear();
+		queue_event(EVT_DWNLDR_FILE_CANCELED);
+	} else if (m_pause) {
+		m_stopped = true;
+		queue_event(EVT_DWNLDR_FILE_PAUSED);
+	} else if (failed) {
+		m_ranges.clear();
+		queue_event(EVT_DWNLDR_FILE_ERROR, error_message);
+	} else {
+		try {
+			boost::filesystem::rename(m_tmp_path, dest_path);
+		} catch (const std::exception& /*e*/) {
+			queue_event(EVT_DWNLDR_FILE_ERROR, "Failed to write and move.");
+			return;
+		}
+		queue_event(EVT_DWNLDR_FILE_COMPLETE, dest_path.wstring());
+	}
+}
+
 void FileGet::priv::get_perform()
 {
 	assert(m_evt_handler);
@@ -131,7 +295,7 @@ void FileGet::priv::get_perform()
 	m_stopped = false;
 
 	// open dest file
-	if (m_written == 0)
+	if (m_written == 0 && m_ranges.empty())
 	{
 		boost::filesystem::path dest_path = m_dest_folder / m_filename;
 		std::string extension = boost::filesystem::extension(dest_path);
@@ -173,6 +337,20 @@ void FileGet::priv::get_perform()
 	
 	boost::filesystem::path dest_path = m_dest_folder / m_filename;
 
+	if (m_written == 0 && m_ranges.empty()) {
+		// Large files are downloaded by several parallel requests, which is faster on high latency connections.
+		if (size_t size = get_size_by_range_request(); size >= DOWNLOAD_RANGES_MIN_SIZE) {
+			m_absolute_size = size;
+			for (size_t i = 0; i < DOWNLOAD_RANGES; ++ i)
+				m_ranges.push_back({ size * i / DOWNLOAD_RANGES, size * (i + 1) / DOWNLOAD_RANGES });
+		}
+	}
+	if (! m_ranges.empty()) {
+		BOOST_LOG_TRIVIAL(info) << GUI::format("Starting download from %1% to %2% by %3% range requests. Temp path is %4%", m_url, dest_path, m_ranges.size(), m_tmp_path);
+		get_perform_ranges(dest_path);
+		return;
+	}
+
 	wxString temp_path_wstring(m_tmp_path.wstring());
 	
 	//std::cout << "dest_path: " << dest_path.string() << std::endl;
@@ -350,6 +528,13 @@ void FileGet::get()
 
 void FileGet::cancel()
 {
+	if (p && !p->m_io_thread.joinable()) {
+		// not started yet, waiting for other downloads to finish
+		p->m_cancel = true;
+		p->queue_event(EVT_DWNLDR_FILE_CANCELED);
+		return;
+	}
+
 	if(p && p->m_stopped) {
 		if (p->m_io_thread.joinable()) {
 			p->m_cancel = true;
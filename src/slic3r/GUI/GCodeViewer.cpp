@@ -29,12 +29,15 @@
 #include <boost/algorithm/string/split.hpp>
 #include <boost/nowide/cstdio.hpp>
 #include <boost/nowide/fstream.hpp>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
 #include <wx/progdlg.h>
 #include <wx/numformatter.h>
 
 #include <array>
 #include <algorithm>
 #include <chrono>
+#include <string_view>
 
 namespace Slic3r {
 namespace GUI {
@@ -371,6 +374,8 @@ void GCodeViewer::SequentialView::GCodeWindow::load_gcode(const std::string& fil
 
     m_selected_line_id = 0;
     m_last_lines_size = 0;
+    m_lines.clear();
+    m_lines_start_id = 0;
 
     try
     {
@@ -385,39 +390,54 @@ void GCodeViewer::SequentialView::GCodeWindow::load_gcode(const std::string& fil
 
 void GCodeViewer::SequentialView::GCodeWindow::render(float top, float bottom, uint64_t curr_line_id) const
 {
-    auto update_lines = [this](uint64_t start_id, uint64_t end_id) {
-        std::vector<Line> ret;
-        ret.reserve(end_id - start_id + 1);
-        for (uint64_t id = start_id; id <= end_id; ++id) {
-            // read line from file
-            const size_t start = id == 1 ? 0 : m_lines_ends[id - 2];
-            const size_t len   = m_lines_ends[id - 1] - start;
-            std::string gline(m_file.data() + start, len);
-
-            std::string command;
-            std::string parameters;
-            std::string comment;
-
-            // extract comment
-            std::vector<std::string> tokens;
-            boost::split(tokens, gline, boost::is_any_of(";"), boost::token_compress_on);
-            command = tokens.front();
-            if (tokens.size() > 1)
-                comment = ";" + tokens.back();
-
-            // extract gcode command and parameters
-            if (!command.empty()) {
-                boost::split(tokens, command, boost::is_any_of(" "), boost::token_compress_on);
-                command = tokens.front();
-                if (tokens.size() > 1) {
-                    for (size_t i = 1; i < tokens.size(); ++i) {
-                        parameters += " " + tokens[i];
-                    }
-                }
+    auto parse_line = [this](uint64_t id, Line& line) {
+        // read line from file
+        const size_t start = id == 1 ? 0 : m_lines_ends[id - 2];
+        const size_t len   = m_lines_ends[id - 1] - start;
+        const std::string_view gline(m_file.data() + start, len);
+
+        // extract comment
+        const size_t comment_start = gline.find(';');
+        std::string_view command = gline.substr(0, comment_start);
+        if (comment_start != std::string_view::npos)
+            line.comment = gline.substr(comment_start);
+
+        // extract gcode command and parameters, separated by single spaces
+        size_t token_start = 0;
+        bool first_token = true;
+        while (token_start <= command.size()) {
+            size_t token_end = command.find(' ', token_start);
+            if (token_end == std::string_view::npos)
+                token_end = command.size();
+            const std::string_view token = command.substr(token_start, token_end - token_start);
+            if (first_token) {
+                line.command = token;
+                first_token = false;
+            }
+            else if (!token.empty()) {
+                line.parameters += ' ';
+                line.parameters += token;
             }
-            ret.push_back({ command, parameters, comment });
+            token_start = token_end + 1;
         }
-        return ret;
+    };
+
+    // Lines which were visible before are moved to the new list, only the newly visible lines are read from file,
+    // so scrolling line by line parses a single line.
+    auto update_lines = [this, &parse_line](uint64_t start_id, uint64_t end_id) {
+        std::vector<Line>& lines = *const_cast<std::vector<Line>*>(&m_lines);
+        const uint64_t old_start_id = m_lines_start_id;
+        const uint64_t old_end_id   = old_start_id + lines.size();
+        // The new lines are parsed first, as parsing may throw. The old lines are moved only once all the new lines were parsed,
+        // so that m_lines stays intact on failure.
+        std::vector<Line> ret(end_id - start_id + 1);
+        for (uint64_t id = start_id; id <= end_id; ++id)
+            if (id < old_start_id || old_end_id <= id)
+                parse_line(id, ret[id - start_id]);
+        for (uint64_t id = std::max(start_id, old_start_id); id <= end_id && id < old_end_id; ++id)
+            ret[id - start_id] = std::move(lines[id - old_start_id]);
+        lines.swap(ret);
+        *const_cast<uint64_t*>(&m_lines_start_id) = start_id;
     };
 
     static const ImVec4 LINE_NUMBER_COLOR    = ImGuiWrapper::COL_ORANGE_LIGHT;
@@ -454,7 +474,7 @@ void GCodeViewer::SequentialView::GCodeWindow::render(float top, float bottom, u
     if (m_selected_line_id != curr_line_id || m_last_lines_size != end_id - start_id + 1) {
         try
         {
-            *const_cast<std::vector<Line>*>(&m_lines) = update_lines(start_id, end_id);
+            update_lines(start_id, end_id);
         }
         catch (...)
         {
@@ -735,6 +755,7 @@ void GCodeViewer::load(const GCodeProcessorResult& gcode_result, const Print& pr
     m_max_print_height = gcode_result.max_print_height;
 
     load_toolpaths(gcode_result);
+    load_moves_ranges(gcode_result);
 
     if (m_layers.empty())
         return;
@@ -824,35 +845,18 @@ void GCodeViewer::refresh(const GCodeProcessorResult& gcode_result, const std::v
 
     // update ranges for coloring / legend
     m_extrusions.reset_ranges();
-    for (size_t i = 0; i < m_moves_count; ++i) {
-        // skip first vertex
-        if (i == 0)
-            continue;
-
-        const GCodeProcessorResult::MoveVertex& curr = gcode_result.moves[i];
-
-        switch (curr.type)
-        {
-        case EMoveType::Extrude:
-        {
-            m_extrusions.ranges.height.update_from(round_to_bin(curr.height));
-            m_extrusions.ranges.width.update_from(round_to_bin(curr.width));
-            m_extrusions.ranges.fan_speed.update_from(curr.fan_speed);
-            m_extrusions.ranges.temperature.update_from(curr.temperature);
-            if (curr.extrusion_role != GCodeExtrusionRole::Custom || is_visible(GCodeExtrusionRole::Custom))
-                m_extrusions.ranges.volumetric_rate.update_from(round_to_bin(curr.volumetric_rate()));
-            [[fallthrough]];
-        }
-        case EMoveType::Travel:
-        {
-            if (m_buffers[buffer_id(curr.type)].visible)
-                m_extrusions.ranges.feedrate.update_from(curr.feedrate);
-
-            break;
-        }
-        default: { break; }
-        }
-    }
+    const Extrusions::MovesRanges& moves_ranges = m_extrusions.moves_ranges;
+    m_extrusions.ranges.height.update_from(moves_ranges.height);
+    m_extrusions.ranges.width.update_from(moves_ranges.width);
+    m_extrusions.ranges.fan_speed.update_from(moves_ranges.fan_speed);
+    m_extrusions.ranges.temperature.update_from(moves_ranges.temperature);
+    m_extrusions.ranges.volumetric_rate.update_from(moves_ranges.volumetric_rate);
+    if (is_visible(GCodeExtrusionRole::Custom))
+        m_extrusions.ranges.volumetric_rate.update_from(moves_ranges.custom_volumetric_rate);
+    if (m_buffers[buffer_id(EMoveType::Extrude)].visible)
+        m_extrusions.ranges.feedrate.update_from(moves_ranges.extrude_feedrate);
+    if (m_buffers[buffer_id(EMoveType::Travel)].visible)
+        m_extrusions.ranges.feedrate.update_from(moves_ranges.travel_feedrate);
 
     for (size_t i = 0; i < gcode_result.print_statistics.modes.size(); ++i) {
         m_layers_times[i] = gcode_result.print_statistics.modes[i].layers_times;
@@ -895,6 +899,7 @@ void GCodeViewer::reset()
     m_filament_diameters = std::vector<float>();
     m_filament_densities = std::vector<float>();
     m_extrusions.reset_ranges();
+    m_extrusions.moves_ranges.reset();
     m_shells.volumes.clear();
     m_layers.reset();
     m_layers_z_range = { 0, 0 };
@@ -949,10 +954,11 @@ void GCodeViewer::update_sequential_view_current(unsigned int first, unsigned in
     auto is_visible = [this](unsigned int id) {
         for (const TBuffer& buffer : m_buffers) {
             if (buffer.visible) {
-                for (const Path& path : buffer.paths) {
-                    if (path.sub_paths.front().first.s_id <= id && id <= path.sub_paths.back().last.s_id)
-                        return true;
-                }
+                // paths are stored in the order of the moves, binary search the last path starting at or before id
+                auto it = std::upper_bound(buffer.paths.begin(), buffer.paths.end(), id,
+                    [](unsigned int id, const Path& path) { return id < path.sub_paths.front().first.s_id; });
+                if (it != buffer.paths.begin() && id <= std::prev(it)->sub_paths.back().last.s_id)
+                    return true;
             }
         }
         return false;
@@ -1568,6 +1574,28 @@ void GCodeViewer::load_toolpaths(const GCodeProcessorResult& gcode_result)
         m_contained_in_bed = wxGetApp().plater()->build_volume().all_paths_inside(gcode_result, m_paths_bounding_box);
 
     m_cog.reset();
+    // skip first vertex
+    m_cog.add_mass(tbb::parallel_reduce(tbb::blocked_range<size_t>(1, m_moves_count), COG::Mass(),
+        [&gcode_result](const tbb::blocked_range<size_t>& range, COG::Mass mass) {
+            for (size_t i = range.begin(); i < range.end(); ++i) {
+                const GCodeProcessorResult::MoveVertex& curr = gcode_result.moves[i];
+                if (curr.type == EMoveType::Extrude &&
+                    curr.extrusion_role != GCodeExtrusionRole::Skirt &&
+                    curr.extrusion_role != GCodeExtrusionRole::SupportMaterial &&
+                    curr.extrusion_role != GCodeExtrusionRole::SupportMaterialInterface &&
+                    curr.extrusion_role != GCodeExtrusionRole::WipeTower &&
+                    curr.extrusion_role != GCodeExtrusionRole::Custom) {
+                    const Vec3d curr_pos = curr.position.cast<double>();
+                    const Vec3d prev_pos = gcode_result.moves[i - 1].position.cast<double>();
+                    mass.add_segment(curr_pos, prev_pos, curr.mm3_per_mm * (curr_pos - prev_pos).norm());
+                }
+            }
+            return mass;
+        },
+        [](COG::Mass left, const COG::Mass& right) {
+            left.add(right);
+            return left;
+        }));
 
     m_sequential_view.gcode_ids.clear();
     for (size_t i = 0; i < gcode_result.moves.size(); ++i) {
@@ -1601,17 +1629,6 @@ void GCodeViewer::load_toolpaths(const GCodeProcessorResult& gcode_result)
 
         const GCodeProcessorResult::MoveVertex& prev = gcode_result.moves[i - 1];
 
-        if (curr.type == EMoveType::Extrude &&
-            curr.extrusion_role != GCodeExtrusionRole::Skirt &&
-            curr.extrusion_role != GCodeExtrusionRole::SupportMaterial &&
-            curr.extrusion_role != GCodeExtrusionRole::SupportMaterialInterface &&
-            curr.extrusion_role != GCodeExtrusionRole::WipeTower &&
-            curr.extrusion_role != GCodeExtrusionRole::Custom) {
-            const Vec3d curr_pos = curr.position.cast<double>();
-            const Vec3d prev_pos = prev.position.cast<double>();
-            m_cog.add_segment(curr_pos, prev_pos, curr.mm3_per_mm * (curr_pos - prev_pos).norm());
-        }
-
         // update progress dialog
         ++progress_count;
         if (progress_dialog != nullptr && progress_count % progress_threshold == 0) {
@@ -1768,70 +1785,74 @@ void GCodeViewer::load_toolpaths(const GCodeProcessorResult& gcode_result)
         };
 
         const size_t vertex_size_floats = t_buffer.vertices.vertex_size_floats();
-        for (const Path& path : t_buffer.paths) {
-            // the two segments of the path sharing the current vertex may belong
-            // to two different vertex buffers
-            size_t prev_sub_path_id = 0;
-            size_t next_sub_path_id = 0;
-            const size_t path_vertices_count = path.vertices_count();
-            const float half_width = 0.5f * path.width;
-            for (size_t j = 1; j < path_vertices_count - 1; ++j) {
-                const size_t curr_s_id = path.sub_paths.front().first.s_id + j;
-                const size_t move_id = extract_move_id(curr_s_id);
-                const Vec3f& prev = gcode_result.moves[move_id - 1].position;
-                const Vec3f& curr = gcode_result.moves[move_id].position;
-                const Vec3f& next = gcode_result.moves[move_id + 1].position;
-
-                // select the subpaths which contains the previous/next segments
-                if (!path.sub_paths[prev_sub_path_id].contains(curr_s_id))
-                    ++prev_sub_path_id;
-                if (!path.sub_paths[next_sub_path_id].contains(curr_s_id + 1))
-                    ++next_sub_path_id;
-                const Path::Sub_Path& prev_sub_path = path.sub_paths[prev_sub_path_id];
-                const Path::Sub_Path& next_sub_path = path.sub_paths[next_sub_path_id];
-
-                const Vec3f prev_dir = (curr - prev).normalized();
-                const Vec3f prev_right = Vec3f(prev_dir.y(), -prev_dir.x(), 0.0f).normalized();
-                const Vec3f prev_up = prev_right.cross(prev_dir);
-
-                const Vec3f next_dir = (next - curr).normalized();
-
-                const bool is_right_turn = prev_up.dot(prev_dir.cross(next_dir)) <= 0.0f;
-                const float cos_dir = prev_dir.dot(next_dir);
-                // whether the angle between adjacent segments is greater than 45 degrees
-                const bool is_sharp = cos_dir < 0.7071068f;
-
-                float displacement = 0.0f;
-                if (cos_dir > -0.9998477f) {
-                    // if the angle between adjacent segments is smaller than 179 degrees
-                    const Vec3f med_dir = (prev_dir + next_dir).normalized();
-                    displacement = half_width * ::tan(::acos(std::clamp(next_dir.dot(med_dir), -1.0f, 1.0f)));
-                }
-
-                const float sq_prev_length = (curr - prev).squaredNorm();
-                const float sq_next_length = (next - curr).squaredNorm();
-                const float sq_displacement = sqr(displacement);
-                const bool can_displace = displacement > 0.0f && sq_displacement < sq_prev_length && sq_displacement < sq_next_length;
-
-                if (can_displace) {
-                    // displacement to apply to the vertices to match
-                    const Vec3f displacement_vec = displacement * prev_dir;
-                    // matches inner corner vertices
-                    if (is_right_turn)
-                        match_right_vertices(prev_sub_path, next_sub_path, curr_s_id, vertex_size_floats, -displacement_vec);
-                    else
-                        match_left_vertices(prev_sub_path, next_sub_path, curr_s_id, vertex_size_floats, -displacement_vec);
+        // The paths do not share vertices, thus their corners are smoothed in parallel.
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, t_buffer.paths.size()), [&](const tbb::blocked_range<size_t>& range) {
+            for (size_t path_id = range.begin(); path_id < range.end(); ++path_id) {
+                const Path& path = t_buffer.paths[path_id];
+                    // the two segments of the path sharing the current vertex may belong
+                    // to two different vertex buffers
+                    size_t prev_sub_path_id = 0;
+                    size_t next_sub_path_id = 0;
+                    const size_t path_vertices_count = path.vertices_count();
+                    const float half_width = 0.5f * path.width;
+                    for (size_t j = 1; j < path_vertices_count - 1; ++j) {
+                        const size_t curr_s_id = path.sub_paths.front().first.s_id + j;
+                        const size_t move_id = extract_move_id(curr_s_id);
+                        const Vec3f& prev = gcode_result.moves[move_id - 1].position;
+                        const Vec3f& curr = gcode_result.moves[move_id].position;
+                        const Vec3f& next = gcode_result.moves[move_id + 1].position;
+
+                        // select the subpaths which contains the previous/next segments
+                        if (!path.sub_paths[prev_sub_path_id].contains(curr_s_id))
+                            ++prev_sub_path_id;
+                        if (!path.sub_paths[next_sub_path_id].contains(curr_s_id + 1))
+                            ++next_sub_path_id;
+                        const Path::Sub_Path& prev_sub_path = path.sub_paths[prev_sub_path_id];
+                        const Path::Sub_Path& next_sub_path = path.sub_paths[next_sub_path_id];
+
+                        const Vec3f prev_dir = (curr - prev).normalized();
+                        const Vec3f prev_right = Vec3f(prev_dir.y(), -prev_dir.x(), 0.0f).normalized();
+                        const Vec3f prev_up = prev_right.cross(prev_dir);
+
+                        const Vec3f next_dir = (next - curr).normalized();
+
+                        const bool is_right_turn = prev_up.dot(prev_dir.cross(next_dir)) <= 0.0f;
+                        const float cos_dir = prev_dir.dot(next_dir);
+                        // whether the angle between adjacent segments is greater than 45 degrees
+                        const bool is_sharp = cos_dir < 0.7071068f;
+
+                        float displacement = 0.0f;
+                        if (cos_dir > -0.9998477f) {
+                            // if the angle between adjacent segments is smaller than 179 degrees
+                            const Vec3f med_dir = (prev_dir + next_dir).normalized();
+                            displacement = half_width * ::tan(::acos(std::clamp(next_dir.dot(med_dir), -1.0f, 1.0f)));
+                        }
 
-                    if (!is_sharp) {
-                        // matches outer corner vertices
-                        if (is_right_turn)
-                            match_left_vertices(prev_sub_path, next_sub_path, curr_s_id, vertex_size_floats, displacement_vec);
-                        else
-                            match_right_vertices(prev_sub_path, next_sub_path, curr_s_id, vertex_size_floats, displacement_vec);
+                        const float sq_prev_length = (curr - prev).squaredNorm();
+                        const float sq_next_length = (next - curr).squaredNorm();
+                        const float sq_displacement = sqr(displacement);
+                        const bool can_displace = displacement > 0.0f && sq_displacement < sq_prev_length && sq_displacement < sq_next_length;
+
+                        if (can_displace) {
+                            // displacement to apply to the vertices to match
+                            const Vec3f displacement_vec = displacement * prev_dir;
+                            // matches inner corner vertices
+                            if (is_right_turn)
+                                match_right_vertices(prev_sub_path, next_sub_path, curr_s_id, vertex_size_floats, -displacement_vec);
+                            else
+                                match_left_vertices(prev_sub_path, next_sub_path, curr_s_id, vertex_size_floats, -displacement_vec);
+
+                            if (!is_sharp) {
+                                // matches outer corner vertices
+                                if (is_right_turn)
+                                    match_left_vertices(prev_sub_path, next_sub_path, curr_s_id, vertex_size_floats, displacement_vec);
+                                else
+                                    match_right_vertices(prev_sub_path, next_sub_path, curr_s_id, vertex_size_floats, displacement_vec);
+                            }
+                        }
                     }
-                }
             }
-        }
+        });
     };
 
 #if ENABLE_GCODE_VIEWER_STATISTICS
@@ -1863,28 +1884,32 @@ void GCodeViewer::load_toolpaths(const GCodeProcessorResult& gcode_result)
         }
     }
 
+    log_memory_usage("Loaded G-code generated vertex buffers ", vertices, indices);
+
     // send vertices data to gpu, where needed
+    // the instance and vertex data are released as soon as they are moved to the TBuffers or uploaded,
+    // so that the peak memory does not hold both copies of the whole toolpaths
     for (size_t i = 0; i < m_buffers.size(); ++i) {
         TBuffer& t_buffer = m_buffers[i];
         if (t_buffer.render_primitive_type == TBuffer::ERenderPrimitiveType::InstancedModel) {
-            const InstanceBuffer& inst_buffer = instances[i];
+            InstanceBuffer& inst_buffer = instances[i];
             if (!inst_buffer.empty()) {
-                t_buffer.model.instances.buffer = inst_buffer;
-                t_buffer.model.instances.s_ids = instances_ids[i];
-                t_buffer.model.instances.offsets = instances_offsets[i];
+                t_buffer.model.instances.buffer = std::move(inst_buffer);
+                t_buffer.model.instances.s_ids = std::move(instances_ids[i]);
+                t_buffer.model.instances.offsets = std::move(instances_offsets[i]);
             }
         }
         else {
             if (t_buffer.render_primitive_type == TBuffer::ERenderPrimitiveType::BatchedModel) {
-                const InstanceBuffer& inst_buffer = instances[i];
+                InstanceBuffer& inst_buffer = instances[i];
                 if (!inst_buffer.empty()) {
-                    t_buffer.model.instances.buffer = inst_buffer;
-                    t_buffer.model.instances.s_ids = instances_ids[i];
-                    t_buffer.model.instances.offsets = instances_offsets[i];
+                    t_buffer.model.instances.buffer = std::move(inst_buffer);
+                    t_buffer.model.instances.s_ids = std::move(instances_ids[i]);
+                    t_buffer.model.instances.offsets = std::move(instances_offsets[i]);
                 }
             }
-            const MultiVertexBuffer& v_multibuffer = vertices[i];
-            for (const VertexBuffer& v_buffer : v_multibuffer) {
+            MultiVertexBuffer& v_multibuffer = vertices[i];
+            for (VertexBuffer& v_buffer : v_multibuffer) {
                 const size_t size_elements = v_buffer.size();
                 const size_t size_bytes = size_elements * sizeof(float);
                 const size_t vertices_count = size_elements / t_buffer.vertices.vertex_size_floats();
@@ -1909,6 +1934,7 @@ void GCodeViewer::load_toolpaths(const GCodeProcessorResult& gcode_result)
                 glsafe(::glBindBuffer(GL_ARRAY_BUFFER, vbo_id));
                 glsafe(::glBufferData(GL_ARRAY_BUFFER, size_bytes, v_buffer.data(), GL_STATIC_DRAW));
                 glsafe(::glBindBuffer(GL_ARRAY_BUFFER, 0));
+                VertexBuffer().swap(v_buffer);
 
 #if ENABLE_GL_CORE_PROFILE
                 if (OpenGLManager::get_gl_info().is_version_greater_or_equal_to(3, 0)) {
@@ -1926,7 +1952,6 @@ void GCodeViewer::load_toolpaths(const GCodeProcessorResult& gcode_result)
     auto smooth_vertices_time = std::chrono::high_resolution_clock::now();
     m_statistics.smooth_vertices = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - load_vertices_time).count();
 #endif // ENABLE_GCODE_VIEWER_STATISTICS
-    log_memory_usage("Loaded G-code generated vertex buffers ", vertices, indices);
 
     // dismiss vertices data, no more needed
     std::vector<MultiVertexBuffer>().swap(vertices);
@@ -2212,6 +2237,44 @@ void GCodeViewer::load_toolpaths(const GCodeProcessorResult& gcode_result)
         progress_dialog->Destroy();
 }
 
+void GCodeViewer::load_moves_ranges(const GCodeProcessorResult& gcode_result)
+{
+    m_extrusions.moves_ranges.reset();
+    if (m_moves_count == 0)
+        return;
+
+    // skip first vertex
+    m_extrusions.moves_ranges = tbb::parallel_reduce(tbb::blocked_range<size_t>(1, m_moves_count), Extrusions::MovesRanges(),
+        [&gcode_result](const tbb::blocked_range<size_t>& range, Extrusions::MovesRanges ranges) {
+            for (size_t i = range.begin(); i < range.end(); ++i) {
+                const GCodeProcessorResult::MoveVertex& curr = gcode_result.moves[i];
+                switch (curr.type)
+                {
+                case EMoveType::Extrude:
+                {
+                    ranges.height.update_from(round_to_bin(curr.height));
+                    ranges.width.update_from(round_to_bin(curr.width));
+                    ranges.fan_speed.update_from(curr.fan_speed);
+                    ranges.temperature.update_from(curr.temperature);
+                    if (curr.extrusion_role != GCodeExtrusionRole::Custom)
+                        ranges.volumetric_rate.update_from(round_to_bin(curr.volumetric_rate()));
+                    else
+                        ranges.custom_volumetric_rate.update_from(round_to_bin(curr.volumetric_rate()));
+                    ranges.extrude_feedrate.update_from(curr.feedrate);
+                    break;
+                }
+                case EMoveType::Travel: { ranges.travel_feedrate.update_from(curr.feedrate); break; }
+                default: { break; }
+                }
+            }
+            return ranges;
+        },
+        [](Extrusions::MovesRanges left, const Extrusions::MovesRanges& right) {
+            left.update_from(right);
+            return left;
+        });
+}
+
 void GCodeViewer::load_shells(const Print& print)
 {
     if (print.objects().empty())
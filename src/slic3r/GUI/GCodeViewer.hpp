@@ -383,6 +383,26 @@ class GCodeViewer
     // helper to render center of gravity
     class COG
     {
+    public:
+        // Mass weighted sum of the centers of the extrusion segments and their total mass,
+        // accumulated apart from the COG (in parallel) and added to it by add_mass().
+        struct Mass
+        {
+            Vec3d position{ Vec3d::Zero() };
+            double total{ 0.0 };
+
+            void add_segment(const Vec3d& v1, const Vec3d& v2, double mass) {
+                assert(mass > 0.0);
+                position += mass * 0.5 * (v1 + v2);
+                total += mass;
+            }
+            void add(const Mass& other) {
+                position += other.position;
+                total += other.total;
+            }
+        };
+
+    private:
         GLModel m_model;
         bool m_visible{ false };
         // whether or not to render the model with fixed screen size
@@ -401,10 +421,9 @@ class GCodeViewer
         bool is_visible() const { return m_visible; }
         void set_visible(bool visible) { m_visible = visible; }
 
-        void add_segment(const Vec3d& v1, const Vec3d& v2, double mass) {
-            assert(mass > 0.0);
-            m_position += mass * 0.5 * (v1 + v2);
-            m_total_mass += mass;
+        void add_mass(const Mass& mass) {
+            m_position += mass.position;
+            m_total_mass += mass.total;
         }
 
         Vec3d cog() const { return (m_total_mass > 0.0) ? (Vec3d)(m_position / m_total_mass) : Vec3d::Zero(); }
@@ -442,6 +461,17 @@ class GCodeViewer
                 min = std::min(min, value);
                 max = std::max(max, value);
             }
+            // Merges the other range as if its values were passed to update_from() one by one.
+            // Only the distinction of a single, two or more values is kept by count.
+            void update_from(const Range& other) {
+                if (other.count == 0)
+                    return;
+                update_from(other.min);
+                if (other.count > 1)
+                    update_from(other.max);
+                if (other.count > 2)
+                    count += other.count - 2;
+            }
             void reset() { min = FLT_MAX; max = -FLT_MAX; count = 0; }
 
             float step_size(EType type = EType::Linear) const;
@@ -478,8 +508,46 @@ class GCodeViewer
             }
         };
 
+        // Ranges of the properties of all the moves, gathered once when the G-code is loaded.
+        // The ranges depending on the visibility of the moves are kept apart, so that refresh() combines
+        // the legend ranges from them without iterating over the moves again.
+        struct MovesRanges
+        {
+            Range height;
+            Range width;
+            Range fan_speed;
+            Range temperature;
+            // Volumetric rate of the extrusions other than GCodeExtrusionRole::Custom.
+            Range volumetric_rate;
+            Range custom_volumetric_rate;
+            Range extrude_feedrate;
+            Range travel_feedrate;
+
+            void reset() {
+                height.reset();
+                width.reset();
+                fan_speed.reset();
+                temperature.reset();
+                volumetric_rate.reset();
+                custom_volumetric_rate.reset();
+                extrude_feedrate.reset();
+                travel_feedrate.reset();
+            }
+            void update_from(const MovesRanges& other) {
+                height.update_from(other.height);
+                width.update_from(other.width);
+                fan_speed.update_from(other.fan_speed);
+                temperature.update_from(other.temperature);
+                volumetric_rate.update_from(other.volumetric_rate);
+                custom_volumetric_rate.update_from(other.custom_volumetric_rate);
+                extrude_feedrate.update_from(other.extrude_feedrate);
+                travel_feedrate.update_from(other.travel_feedrate);
+            }
+        };
+
         unsigned int role_visibility_flags{ 0 };
         Ranges ranges;
+        MovesRanges moves_ranges;
 
         void reset_role_visibility_flags() {
             role_visibility_flags = 0;
@@ -685,6 +753,8 @@ public:
             std::vector<size_t> m_lines_ends;
             // current visible lines
             std::vector<Line> m_lines;
+            // id of the first line in m_lines
+            uint64_t m_lines_start_id{ 0 };
 
         public:
             GCodeWindow() = default;
@@ -694,6 +764,7 @@ public:
                 stop_mapping_file();
                 m_lines_ends.clear();
                 m_lines.clear();
+                m_lines_start_id = 0;
                 m_filename.clear();
             }
 
@@ -843,6 +914,7 @@ public:
 
 private:
     void load_toolpaths(const GCodeProcessorResult& gcode_result);
+    void load_moves_ranges(const GCodeProcessorResult& gcode_result);
     void load_shells(const Print& print);
     void render_toolpaths();
     void render_shells();
@@ -145,6 +145,7 @@ void GLCanvas3D::LayersEditing::select_object(const Model &model, int object_id)
         (model_object_new != nullptr && m_model_object->id() != model_object_new->id())) {
         m_layer_height_profile.clear();
         m_layer_height_profile_modified = false;
+        m_slicing_adaptive.clear();
         delete m_slicing_parameters;
         m_slicing_parameters   = nullptr;
         m_layers_texture.valid = false;
@@ -548,7 +549,9 @@ void GLCanvas3D::LayersEditing::reset_layer_height_profile(GLCanvas3D& canvas)
 void GLCanvas3D::LayersEditing::adaptive_layer_height_profile(GLCanvas3D& canvas, float quality_factor)
 {
     this->update_slicing_parameters();
-    m_layer_height_profile = layer_height_profile_adaptive(*m_slicing_parameters, *m_model_object, quality_factor);
+    if (! m_slicing_adaptive.prepared_for(*m_model_object))
+        m_slicing_adaptive.prepare(*m_model_object);
+    m_layer_height_profile = layer_height_profile_adaptive(*m_slicing_parameters, m_slicing_adaptive, quality_factor);
     const_cast<ModelObject*>(m_model_object)->layer_height_profile.set(m_layer_height_profile);
     m_layers_texture.valid = false;
     canvas.post_event(SimpleEvent(EVT_GLCANVAS_SCHEDULE_BACKGROUND_PROCESS));
@@ -999,6 +1002,15 @@ void GLCanvas3D::load_arrange_settings()
     std::string en_rot_sla_str =
         wxGetApp().app_config->get("arrange", "enable_rotation_sla");
 
+    std::string fast_fff_str =
+        wxGetApp().app_config->get("arrange", "fast_fff");
+
+    std::string fast_fff_seqp_str =
+        wxGetApp().app_config->get("arrange", "fast_fff_seq_print");
+
+    std::string fast_sla_str =
+        wxGetApp().app_config->get("arrange", "fast_sla");
+
 //    std::string alignment_fff_str =
 //        wxGetApp().app_config->get("arrange", "alignment_fff");
 
@@ -1039,6 +1051,15 @@ void GLCanvas3D::load_arrange_settings()
     if (!en_rot_sla_str.empty())
         m_arrange_settings_sla.enable_rotation = (en_rot_sla_str == "1" || en_rot_sla_str == "yes");
 
+    if (!fast_fff_str.empty())
+        m_arrange_settings_fff.fast = (fast_fff_str == "1" || fast_fff_str == "yes");
+
+    if (!fast_fff_seqp_str.empty())
+        m_arrange_settings_fff_seq_print.fast = (fast_fff_seqp_str == "1" || fast_fff_seqp_str == "yes");
+
+    if (!fast_sla_str.empty())
+        m_arrange_settings_sla.fast = (fast_sla_str == "1" || fast_sla_str == "yes");
+
 //    if (!alignment_sla_str.empty())
 //        m_arrange_settings_sla.alignment = std::stoi(alignment_sla_str);
 
@@ -4207,6 +4228,7 @@ bool GLCanvas3D::_render_arrange_menu(float pos_x)
     std::string dist_key = "min_object_distance";
     std::string dist_bed_key = "min_bed_distance";
     std::string rot_key = "enable_rotation";
+    std::string fast_key = "fast";
     std::string align_key = "alignment";
     std::string postfix;
 
@@ -4226,6 +4248,7 @@ bool GLCanvas3D::_render_arrange_menu(float pos_x)
     dist_key += postfix;
     dist_bed_key += postfix;
     rot_key += postfix;
+    fast_key += postfix;
     align_key += postfix;
 
     imgui->text(GUI::format_wxstr(_L("Press %1%left mouse button to enter the exact value"), shortkey_ctrl_prefix()));
@@ -4250,6 +4273,12 @@ bool GLCanvas3D::_render_arrange_menu(float pos_x)
         settings_changed = true;
     }
 
+    if (imgui->checkbox(_L("Fast arrangement (less dense)"), settings.fast)) {
+        settings_out.fast = settings.fast;
+        appcfg->set("arrange", fast_key.c_str(), settings_out.fast? "1" : "0");
+        settings_changed = true;
+    }
+
     Points bed = m_config ? get_bed_shape(*m_config) : Points{};
 
     if (arrangement::is_box(bed) && settings.alignment >= 0 &&
@@ -4275,6 +4304,7 @@ bool GLCanvas3D::_render_arrange_menu(float pos_x)
         appcfg->set("arrange", dist_key.c_str(), float_to_string_decimal_point(settings_out.distance));
         appcfg->set("arrange", dist_bed_key.c_str(), float_to_string_decimal_point(settings_out.distance_from_bed));
         appcfg->set("arrange", rot_key.c_str(), settings_out.enable_rotation? "1" : "0");
+        appcfg->set("arrange", fast_key.c_str(), settings_out.fast? "1" : "0");
         settings_changed = true;
     }
 
@@ -6526,8 +6556,13 @@ void GLCanvas3D::_load_print_object_toolpaths(const PrintObject& print_object, c
 	        for (size_t i = 0; i < vols.size(); ++i) {
 	            GLVolume &vol = *vols[i];
                 if (geometries[i].vertices_size_bytes() > MAX_VERTEX_BUFFER_SIZE) {
+                    const size_t vertices_size = geometries[i].vertices.size();
+                    const size_t indices_size  = geometries[i].indices.size();
                     vol.model.init_from(std::move(geometries[i]));
                     vols[i] = new_volume(vol.color);
+                    // The next volume will likely grow over the limit as well, allocate it at once.
+                    geometries[i].vertices.reserve(vertices_size);
+                    geometries[i].indices.reserve(indices_size);
                 }
 	        }
         }
@@ -20,6 +20,7 @@
 #include "GUI_Utils.hpp"
 
 #include "libslic3r/Slicing.hpp"
+#include "libslic3r/SlicingAdaptive.hpp"
 
 #include <float.h>
 
@@ -213,6 +214,8 @@ class GLCanvas3D
         SlicingParameters           *m_slicing_parameters{ nullptr };
         std::vector<double>         m_layer_height_profile;
         bool                        m_layer_height_profile_modified{ false };
+        // Faces of m_model_object sorted by their Z span, reused by adaptive_layer_height_profile() while the object meshes do not change.
+        SlicingAdaptive             m_slicing_adaptive;
 
         mutable float               m_adaptive_quality{ 0.5f };
         mutable HeightProfileSmoothingParams m_smooth_params;
@@ -463,6 +466,8 @@ public:
 //        float distance_sla       = 6.;
         float accuracy           = 0.65f; // Unused currently
         bool  enable_rotation    = false;
+        // Arrange the rasterized objects, fast but less dense.
+        bool  fast               = false;
         int   alignment          = 0;
     };
 
@@ -8,7 +8,11 @@
 
 #include <boost/nowide/fstream.hpp>
 #include <GL/glew.h>
+#include <algorithm>
 #include <cassert>
+#include <cstring>
+
+#include <boost/algorithm/string/predicate.hpp>
 
 #include <boost/log/trivial.hpp>
 
@@ -192,9 +196,36 @@ bool GLShaderProgram::init_from_texts(const std::string& name, const ShaderSourc
     // release shaders, they are no more needed
     release_shaders(shader_ids);
 
+    cache_uniform_locations();
+
     return true;
 }
 
+void GLShaderProgram::cache_uniform_locations()
+{
+    m_uniform_location_cache.clear();
+
+    GLint count = 0;
+    GLint max_length = 0;
+    glsafe(::glGetProgramiv(m_id, GL_ACTIVE_UNIFORMS, &count));
+    glsafe(::glGetProgramiv(m_id, GL_ACTIVE_UNIFORM_MAX_LENGTH, &max_length));
+    std::vector<char> name(std::max<size_t>(max_length, 1));
+    for (GLint i = 0; i < count; ++i) {
+        GLsizei length = 0;
+        GLint   size   = 0;
+        GLenum  type   = 0;
+        glsafe(::glGetActiveUniform(m_id, GLuint(i), GLsizei(name.size()), &length, &size, &type, name.data()));
+        std::string uniform(name.data(), size_t(length));
+        // Arrays are reported by the name of their first element.
+        if (boost::ends_with(uniform, "[0]"))
+            uniform.erase(uniform.size() - 3);
+        const int id = ::glGetUniformLocation(m_id, uniform.c_str());
+        m_uniform_location_cache.emplace_back(std::move(uniform), id);
+    }
+
+    std::sort(m_uniform_location_cache.begin(), m_uniform_location_cache.end());
+}
+
 void GLShaderProgram::start_using() const
 {
     assert(m_id > 0);
@@ -375,13 +406,14 @@ int GLShaderProgram::get_uniform_location(const char* name) const
         // Shader program not loaded. This should not happen.
         return -1;
 
-    auto it = std::find_if(m_uniform_location_cache.begin(), m_uniform_location_cache.end(), [name](const auto &p) { return p.first == name; });
-    if (it != m_uniform_location_cache.end())
+    auto it = std::lower_bound(m_uniform_location_cache.begin(), m_uniform_location_cache.end(), name,
+        [](const auto &p, const char *name) { return ::strcmp(p.first.c_str(), name) < 0; });
+    if (it != m_uniform_location_cache.end() && it->first == name)
         // Uniform ID cached.
         return it->second;
 
     int id = ::glGetUniformLocation(m_id, name);
-    const_cast<GLShaderProgram*>(this)->m_uniform_location_cache.push_back({ name, id });
+    const_cast<GLShaderProgram*>(this)->m_uniform_location_cache.insert(it, { name, id });
     return id;
 }
 
@@ -33,6 +33,8 @@ private:
     std::string m_name;
     unsigned int m_id{ 0 };
     std::vector<std::pair<std::string, int>> m_attrib_location_cache;
+    // Sorted by the uniform name. Filled in with all the active uniforms when the program is linked,
+    // the locations of the other names queried are added on demand.
     std::vector<std::pair<std::string, int>> m_uniform_location_cache;
 
 public:
@@ -100,7 +102,11 @@ public:
     // returns -1 if not found
     int get_attrib_location(const char* name) const;
     // returns -1 if not found
+    // The location may be resolved once and passed to set_uniform() in loops over many objects.
     int get_uniform_location(const char* name) const;
+
+private:
+    void cache_uniform_locations();
 };
 
 } // namespace Slic3r
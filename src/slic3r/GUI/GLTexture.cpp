@@ -26,9 +26,125 @@
 
 #include "libslic3r/Utils.hpp"
 
+#include <boost/functional/hash.hpp>
+#include <boost/log/trivial.hpp>
+#include <boost/nowide/cstdio.hpp>
+#include <boost/nowide/fstream.hpp>
+
 namespace Slic3r {
 namespace GUI {
 
+// Persistent cache of the DXT5 compressed levels of the textures, stored in the cache directory of the data directory.
+// The files are named by a hash of the contents of the source image and of the parameters the texture was loaded with.
+// Loading a texture again skips decoding / rasterizing the source image and the compression.
+namespace TextureCache {
+
+static constexpr const uint32_t file_magic   = 0x43545350; // "PSTC"
+static constexpr const uint32_t file_version = 1;
+
+struct Level
+{
+    unsigned int               w;
+    unsigned int               h;
+    std::vector<unsigned char> data;
+};
+
+// Returns zero if the source image could not be read.
+static size_t key(const std::string &filename, std::initializer_list<size_t> params)
+{
+    boost::nowide::ifstream in(filename, std::ios::binary);
+    if (! in)
+        return 0;
+    size_t seed = 0;
+    boost::hash_combine(seed, file_version);
+    for (size_t param : params)
+        boost::hash_combine(seed, param);
+    std::vector<char> buffer(1024 * 1024);
+    while (in) {
+        in.read(buffer.data(), buffer.size());
+        boost::hash_range(seed, buffer.begin(), buffer.begin() + in.gcount());
+    }
+    // Zero marks an invalid key.
+    return seed == 0 ? 1 : seed;
+}
+
+static boost::filesystem::path file_path(size_t key)
+{
+    char name[64];
+    sprintf(name, "%016llx.dxt", (unsigned long long)key);
+    return boost::filesystem::path(data_dir()) / "cache" / "textures" / name;
+}
+
+template<typename T>
+static inline void write_pod(FILE *f, const T &value) { ::fwrite(&value, sizeof(T), 1, f); }
+template<typename T>
+static inline bool read_pod(FILE *f, T &value) { return ::fread(&value, sizeof(T), 1, f) == 1; }
+
+static void store(size_t key, const std::vector<Level> &levels)
+{
+    boost::filesystem::path path     = file_path(key);
+    std::string             path_tmp = path.string() + ".tmp";
+    boost::system::error_code ec;
+    boost::filesystem::create_directories(path.parent_path(), ec);
+    {
+        FilePtr out{ boost::nowide::fopen(path_tmp.c_str(), "wb") };
+        if (out.f == nullptr) {
+            BOOST_LOG_TRIVIAL(error) << "Texture cache: Failed to open " << path_tmp << " for writing";
+            return;
+        }
+        write_pod(out.f, file_magic);
+        write_pod(out.f, file_version);
+        write_pod(out.f, uint64_t(key));
+        write_pod(out.f, uint32_t(levels.size()));
+        for (const Level &level : levels) {
+            write_pod(out.f, uint32_t(level.w));
+            write_pod(out.f, uint32_t(level.h));
+            write_pod(out.f, uint64_t(level.data.size()));
+            ::fwrite(level.data.data(), 1, level.data.size(), out.f);
+        }
+        if (::ferror(out.f)) {
+            out.close();
+            boost::nowide::remove(path_tmp.c_str());
+            BOOST_LOG_TRIVIAL(error) << "Texture cache: Failed to write " << path_tmp;
+            return;
+        }
+    }
+    if (rename_file(path_tmp, path.string())) {
+        boost::nowide::remove(path_tmp.c_str());
+        BOOST_LOG_TRIVIAL(error) << "Texture cache: Failed to rename " << path_tmp << " to " << path.string();
+    }
+}
+
+static bool load(size_t key, std::vector<Level> &levels)
+{
+    boost::filesystem::path path = file_path(key);
+    FilePtr in{ boost::nowide::fopen(path.string().c_str(), "rb") };
+    if (in.f == nullptr)
+        return false;
+    uint32_t magic, version, num_levels;
+    uint64_t stored_key;
+    if (! read_pod(in.f, magic) || magic != file_magic || ! read_pod(in.f, version) || version != file_version ||
+        ! read_pod(in.f, stored_key) || stored_key != uint64_t(key) || ! read_pod(in.f, num_levels) || num_levels == 0)
+        return false;
+    std::vector<Level> out(num_levels);
+    for (Level &level : out) {
+        uint32_t w, h;
+        uint64_t size;
+        // A DXT5 block of 4x4 pixels takes 16 bytes.
+        if (! read_pod(in.f, w) || ! read_pod(in.f, h) || ! read_pod(in.f, size) || size > uint64_t(w + 3) * uint64_t(h + 3))
+            return false;
+        level.w = w;
+        level.h = h;
+        level.data.assign(size_t(size), 0);
+        if (::fread(level.data.data(), 1, level.data.size(), in.f) != level.data.size())
+            return false;
+    }
+    levels = std::move(out);
+    return true;
+}
+
+} // namespace TextureCache
+
 void GLTexture::Compressor::reset()
 {
 	if (m_thread.joinable()) {
@@ -43,13 +159,14 @@ void GLTexture::Compressor::reset()
 	assert(m_num_levels_compressed == 0);
 }
 
-void GLTexture::Compressor::start_compressing()
+void GLTexture::Compressor::start_compressing(size_t cache_key)
 {
 	// The worker thread should be stopped already.
 	assert(! m_thread.joinable());
 	assert(! m_levels.empty());
 	assert(m_abort_compressing == false);
 	assert(m_num_levels_compressed == 0);
+	m_cache_key = cache_key;
 	if (! m_levels.empty()) {
 		std::thread thrd(&GLTexture::Compressor::compress, this);
     	m_thread = std::move(thrd);
@@ -103,6 +220,8 @@ void GLTexture::Compressor::compress()
     assert(m_num_levels_compressed == 0);
     assert(m_abort_compressing == false);
 
+    // Copies of the compressed levels for the texture cache, the calling thread releases the compressed data once sent to the GPU.
+    std::vector<TextureCache::Level> cache_levels;
     for (Level& level : m_levels) {
         if (m_abort_compressing)
             break;
@@ -116,8 +235,13 @@ void GLTexture::Compressor::compress()
 
         // we are done with the source data, we can discard it
         level.src_data.clear();
+        if (m_cache_key != 0)
+            cache_levels.push_back({ level.w, level.h, level.compressed_data });
         ++ m_num_levels_compressed;
     }
+
+    if (m_cache_key != 0 && ! m_abort_compressing && cache_levels.size() == m_levels.size())
+        TextureCache::store(m_cache_key, cache_levels);
 }
 
 GLTexture::Quad_UVs GLTexture::FullTextureUVs = { { 0.0f, 1.0f }, { 1.0f, 1.0f }, { 1.0f, 0.0f }, { 0.0f, 0.0f } };
@@ -311,6 +435,41 @@ bool GLTexture::load_from_svg_files_as_sprites_array(const std::vector<std::stri
     return true;
 }
 
+bool GLTexture::load_from_cache(size_t cache_key, const std::string& filename, bool apply_anisotropy)
+{
+    std::vector<TextureCache::Level> levels;
+    if (!TextureCache::load(cache_key, levels))
+        return false;
+
+    m_width = (int)levels.front().w;
+    m_height = (int)levels.front().h;
+
+    // sends data to gpu
+    glsafe(::glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+    glsafe(::glGenTextures(1, &m_id));
+    glsafe(::glBindTexture(GL_TEXTURE_2D, m_id));
+
+    if (apply_anisotropy) {
+        GLfloat max_anisotropy = OpenGLManager::get_gl_info().get_max_anisotropy();
+        if (max_anisotropy > 1.0f)
+            glsafe(::glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAX_ANISOTROPY_EXT, max_anisotropy));
+    }
+
+    for (size_t i = 0; i < levels.size(); ++i) {
+        const TextureCache::Level& level = levels[i];
+        glsafe(::glCompressedTexImage2D(GL_TEXTURE_2D, (GLint)i, GL_COMPRESSED_RGBA_S3TC_DXT5_EXT, (GLsizei)level.w, (GLsizei)level.h, 0, (GLsizei)level.data.size(), (const GLvoid*)level.data.data()));
+    }
+    glsafe(::glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, (GLint)levels.size() - 1));
+    glsafe(::glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, (levels.size() > 1) ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR));
+    glsafe(::glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR));
+
+    glsafe(::glBindTexture(GL_TEXTURE_2D, 0));
+
+    m_source = filename;
+
+    return true;
+}
+
 void GLTexture::reset()
 {
     if (m_id != 0)
@@ -399,6 +558,13 @@ bool GLTexture::load_from_png(const std::string& filename, bool use_mipmaps, ECo
 {
     const bool compression_enabled = (compression_type != None) && OpenGLManager::are_compressed_textures_supported();
 
+    size_t cache_key = 0;
+    if (compression_enabled && compression_type == MultiThreaded) {
+        cache_key = TextureCache::key(filename, { size_t(use_mipmaps), size_t(OpenGLManager::force_power_of_two_textures()), size_t(OpenGLManager::get_gl_info().get_max_tex_size()) });
+        if (cache_key != 0 && load_from_cache(cache_key, filename, apply_anisotropy))
+            return true;
+    }
+
     // Load a PNG with an alpha channel.
     wxImage image;
     if (!image.LoadFile(wxString::FromUTF8(filename.c_str()), wxBITMAP_TYPE_PNG)) {
@@ -544,7 +710,7 @@ bool GLTexture::load_from_png(const std::string& filename, bool use_mipmaps, ECo
 
     if (compression_type == MultiThreaded)
         // start asynchronous compression
-        m_compressor.start_compressing();
+        m_compressor.start_compressing(cache_key);
 
     return true;
 }
@@ -553,6 +719,13 @@ bool GLTexture::load_from_svg(const std::string& filename, bool use_mipmaps, boo
 {
     const bool compression_enabled = compress && OpenGLManager::are_compressed_textures_supported();
 
+    size_t cache_key = 0;
+    if (compression_enabled) {
+        cache_key = TextureCache::key(filename, { size_t(use_mipmaps), size_t(OpenGLManager::force_power_of_two_textures()), size_t(max_size_px) });
+        if (cache_key != 0 && load_from_cache(cache_key, filename, apply_anisotropy))
+            return true;
+    }
+
     NSVGimage* image = BitmapCache::nsvgParseFromFileWithReplace(filename.c_str(), "px", 96.0f, {});
     if (image == nullptr) {
         reset();
@@ -665,7 +838,7 @@ bool GLTexture::load_from_svg(const std::string& filename, bool use_mipmaps, boo
 
     if (compression_enabled)
         // start asynchronous compression
-        m_compressor.start_compressing();
+        m_compressor.start_compressing(cache_key);
 
     nsvgDeleteRasterizer(rast);
     nsvgDelete(image);
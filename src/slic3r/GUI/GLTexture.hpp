@@ -35,6 +35,8 @@ namespace GUI {
             // How many levels were compressed since the start of the background processing thread?
             // This atomic also works as a memory barrier for synchronizing results of the worker thread with the calling thread.
             std::atomic<unsigned int> m_num_levels_compressed;
+            // If not zero, the compressed levels are stored into the texture cache under this key once all of them are compressed.
+            size_t m_cache_key{ 0 };
 
         public:
             explicit Compressor(GLTexture& texture) : m_texture(texture), m_abort_compressing(false), m_num_levels_compressed(0) {}
@@ -44,7 +46,7 @@ namespace GUI {
 
             void add_level(unsigned int w, unsigned int h, const std::vector<unsigned char>& data) { m_levels.emplace_back(w, h, data); }
 
-            void start_compressing();
+            void start_compressing(size_t cache_key = 0);
 
             bool unsent_compressed_data_available() const;
             void send_compressed_data_to_gpu();
@@ -118,6 +120,8 @@ namespace GUI {
     private:
         bool load_from_png(const std::string& filename, bool use_mipmaps, ECompressionType compression_type, bool apply_anisotropy);
         bool load_from_svg(const std::string& filename, bool use_mipmaps, bool compress, bool apply_anisotropy, unsigned int max_size_px);
+        // Load the compressed levels stored by the Compressor into the texture cache, skipping the decoding and the compression.
+        bool load_from_cache(size_t cache_key, const std::string& filename, bool apply_anisotropy);
 
         friend class Compressor;
     };
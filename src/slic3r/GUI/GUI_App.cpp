@@ -47,6 +47,7 @@
 #include "libslic3r/I18N.hpp"
 #include "libslic3r/PresetBundle.hpp"
 #include "libslic3r/Color.hpp"
+#include "libslic3r/DeferredWriter.hpp"
 
 #include "GUI.hpp"
 #include "GUI_Utils.hpp"
@@ -833,6 +834,7 @@ void GUI_App::post_init()
 
     // Set PrusaSlicer version and save to PrusaSlicer.ini or PrusaSlicerGcodeViewer.ini.
     app_config->set("version", SLIC3R_VERSION);
+    log_startup_phase("post initialization finished");
 
 #ifdef _WIN32
     // Sets window property to mainframe so other instances can indentify it.
@@ -848,6 +850,7 @@ GUI_App::GUI_App(EAppMode mode)
     , m_em_unit(10)
     , m_imgui(new ImGuiWrapper())
 	, m_removable_drive_manager(std::make_unique<RemovableDriveManager>())
+	, m_deferred_writer(std::make_unique<DeferredWriter>())
 	, m_other_instance_message_handler(std::make_unique<OtherInstanceMessageHandler>())
     , m_downloader(std::make_unique<Downloader>())
 {
@@ -942,6 +945,7 @@ void GUI_App::init_app_config()
 
 	if (!app_config)
         app_config = new AppConfig(is_editor() ? AppConfig::EAppMode::Editor : AppConfig::EAppMode::GCodeViewer);
+    app_config->set_deferred_writer(m_deferred_writer.get());
 
 	// load settings
 	m_app_conf_exists = app_config->exists();
@@ -1083,6 +1087,15 @@ bool GUI_App::OnInit()
     }
 }
 
+void GUI_App::log_startup_phase(const char *phase)
+{
+    using namespace std::chrono;
+    const steady_clock::time_point now = steady_clock::now();
+    BOOST_LOG_TRIVIAL(info) << "Startup: " << phase << " in " << duration_cast<milliseconds>(now - m_startup_phase_time).count()
+                            << " ms, " << duration_cast<milliseconds>(now - m_startup_time).count() << " ms since start";
+    m_startup_phase_time = now;
+}
+
 bool GUI_App::on_init_inner()
 {
     // Set initialization of image handlers before any UI actions - See GH issue #7469
@@ -1133,8 +1146,11 @@ bool GUI_App::on_init_inner()
     // !!! Initialization of UI settings as a language, application color mode, fonts... have to be done before first UI action.
     // Like here, before the show InfoDialog in check_older_app_config()
 
+    log_startup_phase("application config loaded");
+
     // If load_language() fails, the application closes.
     load_language(wxString(), true);
+    log_startup_phase("language loaded");
 #ifdef _MSW_DARK_MODE
     bool init_dark_color_mode = app_config->get_bool("dark_color_mode");
     bool init_sys_menu_enabled = app_config->get_bool("sys_menu_enabled");
@@ -1297,6 +1313,7 @@ bool GUI_App::on_init_inner()
     } catch (const std::exception &ex) {
         delayed_error_load_presets = ex.what(); 
     }
+    log_startup_phase("presets loaded");
 
 #ifdef WIN32
 #if !wxVERSION_EQUAL_OR_GREATER_THAN(3,1,3)
@@ -1319,6 +1336,7 @@ bool GUI_App::on_init_inner()
     // hide settings tabs after first Layout
     if (is_editor())
         mainframe->select_tab(size_t(0));
+    log_startup_phase("main frame created");
 
     sidebar().obj_list()->init_objects(); // propagate model objects to object list
 //     update_mode(); // !!! do that later
@@ -1336,6 +1354,7 @@ bool GUI_App::on_init_inner()
     }
     else
         load_current_presets();
+    log_startup_phase("current presets applied");
 
     // Save the active profiles as a "saved into project".
     update_saved_preset_from_current_preset();
@@ -1352,6 +1371,7 @@ bool GUI_App::on_init_inner()
     obj_list()->set_min_height();
 
     update_mode(); // update view mode after fix of the object_list size
+    log_startup_phase("main frame shown");
 
 #ifdef __APPLE__
     other_instance_message_handler()->bring_instance_forward();
@@ -1382,7 +1402,7 @@ bool GUI_App::on_init_inner()
         }
 
         if (m_post_initialized && app_config->dirty())
-            app_config->save();
+            app_config->save_deferred();
     });
 
     m_initialized = true;
@@ -3180,7 +3200,7 @@ void GUI_App::window_pos_save(wxTopLevelWindow* window, const std::string &name)
     app_config->set(config_key, metrics.serialize());
     // save changed app_config here, before all action related to a close of application is processed
     if (app_config->dirty())
-        app_config->save();
+        app_config->save_deferred();
 }
 
 void GUI_App::window_pos_restore(wxTopLevelWindow* window, const std::string &name, bool default_maximized)
@@ -14,6 +14,7 @@
 #include <wx/string.h>
 #include <wx/snglinst.h>
 
+#include <chrono>
 #include <mutex>
 #include <stack>
 
@@ -33,6 +34,7 @@ class ModelObject;
 class PrintHostJobQueue;
 class Model;
 class AppUpdater;
+class DeferredWriter;
 
 namespace GUI{
 
@@ -128,6 +130,9 @@ private:
     EAppMode        m_app_mode{ EAppMode::Editor };
     bool            m_is_recreating_gui{ false };
     bool            m_opengl_initialized{ false };
+    // Start of the application and the last phase logged by log_startup_phase().
+    std::chrono::steady_clock::time_point m_startup_time { std::chrono::steady_clock::now() };
+    std::chrono::steady_clock::time_point m_startup_phase_time { m_startup_time };
 
     wxColour        m_color_label_modified;
     wxColour        m_color_label_sys;
@@ -161,6 +166,8 @@ private:
     OpenGLManager m_opengl_mgr;
 
     std::unique_ptr<RemovableDriveManager> m_removable_drive_manager;
+    // Writes the slic3r.ini and the project autosave on a background thread.
+    std::unique_ptr<DeferredWriter> m_deferred_writer;
 
     std::unique_ptr<ImGuiWrapper> m_imgui;
     std::unique_ptr<PrintHostJobQueue> m_printhost_job_queue;
@@ -329,6 +336,7 @@ public:
     std::vector<Tab *>      tabs_list;
 
 	RemovableDriveManager* removable_drive_manager() { return m_removable_drive_manager.get(); }
+	DeferredWriter* deferred_writer() { return m_deferred_writer.get(); }
 	OtherInstanceMessageHandler* other_instance_message_handler() { return m_other_instance_message_handler.get(); }
     wxSingleInstanceChecker* single_instance_checker() {return m_single_instance_checker.get();}
 
@@ -371,6 +379,8 @@ public:
 
 private:
     bool            on_init_inner();
+    // Log the duration of an application startup phase, which just finished, and the time since the start.
+    void            log_startup_phase(const char *phase);
 	void            init_app_config();
     // returns old config path to copy from if such exists,
     // returns an empty string if such config path does not exists or if it cannot be loaded.
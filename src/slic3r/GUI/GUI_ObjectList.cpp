@@ -3757,13 +3757,18 @@ void ObjectList::update_selections()
             }
         }
         else {
+        // Fetched once, not for each object with several instances.
+        wxDataViewItemArray current_sels;
+        bool                current_sels_valid = false;
         for (const auto& object : objects_content) {
             if (object.second.size() == 1)          // object with 1 instance                
                 sels.Add(m_objects_model->GetItemById(object.first));
             else if (object.second.size() > 1)      // object with several instances                
             {
-                wxDataViewItemArray current_sels;
-                GetSelections(current_sels);
+                if (! current_sels_valid) {
+                    GetSelections(current_sels);
+                    current_sels_valid = true;
+                }
                 const wxDataViewItem frst_inst_item = m_objects_model->GetItemByInstanceId(object.first, 0);
 
                 bool root_is_selected = false;
@@ -3830,26 +3835,16 @@ void ObjectList::update_selections()
             const auto& glv_obj_idx = gl_vol->object_idx();
             const auto& glv_ins_idx = gl_vol->instance_idx();
 
-            bool is_selected = false;
-
-            for (auto obj_ins : objects_content_list) {
-                if (obj_ins.first == glv_obj_idx) {
-                    if (obj_ins.second.find(glv_ins_idx) != obj_ins.second.end() &&
-                        !selection.is_from_single_instance() ) // a case when volumes of different types are selected
-                    {
-                        if (glv_ins_idx == 0 && (*m_objects)[glv_obj_idx]->instances.size() == 1)
-                            sels.Add(m_objects_model->GetItemById(glv_obj_idx));
-                        else
-                            sels.Add(m_objects_model->GetItemByInstanceId(glv_obj_idx, glv_ins_idx));
-
-                        is_selected = true;
-                        break;
-                    }
-                }
-            }
-
-            if (is_selected)
+            if (auto obj_ins = objects_content_list.find(glv_obj_idx); obj_ins != objects_content_list.end() &&
+                obj_ins->second.find(glv_ins_idx) != obj_ins->second.end() &&
+                !selection.is_from_single_instance() ) // a case when volumes of different types are selected
+            {
+                if (glv_ins_idx == 0 && (*m_objects)[glv_obj_idx]->instances.size() == 1)
+                    sels.Add(m_objects_model->GetItemById(glv_obj_idx));
+                else
+                    sels.Add(m_objects_model->GetItemByInstanceId(glv_obj_idx, glv_ins_idx));
                 continue;
+            }
 
             const auto& glv_vol_idx = gl_vol->volume_idx();
             if (glv_vol_idx == 0 && (*m_objects)[glv_obj_idx]->volumes.size() == 1)
@@ -4934,6 +4929,8 @@ void ObjectList::update_after_undo_redo()
      * from wxEVT_DATAVIEW_SELECTION_CHANGED emitted from DeleteAll(), 
      * wrap this two functions into m_prevent_list_events *
      * */
+    // Don't repaint the list for each of the (possibly thousands of) rebuilt items.
+    this->Freeze();
     m_prevent_list_events = true;
     this->UnselectAll();
     m_objects_model->DeleteAll();
@@ -4947,6 +4944,7 @@ void ObjectList::update_after_undo_redo()
         obj_idxs.push_back(obj_idx);
         ++obj_idx;
     }
+    this->Thaw();
 
     update_selections();
 
@@ -11,6 +11,8 @@
 
 #include <numeric>
 
+#include <tbb/parallel_for.h>
+
 #include <GL/glew.h>
 
 namespace Slic3r {
@@ -244,115 +246,127 @@ void GLGizmoFlatten::update_planes()
     // Let's prepare transformation of the normal vector from mesh to instance coordinates.
     const Matrix3d normal_matrix = inst_matrix.matrix().block(0, 0, 3, 3).inverse().transpose();
 
-    // Now we'll go through all the polygons, transform the points into xy plane to process them:
-    for (unsigned int polygon_id=0; polygon_id < m_planes.size(); ++polygon_id) {
-        Pointf3s& polygon = m_planes[polygon_id].vertices;
-        const Vec3d& normal = m_planes[polygon_id].normal;
-
-        // transform the normal according to the instance matrix:
-        const Vec3d normal_transformed = normal_matrix * normal;
-
-        // We are going to rotate about z and y to flatten the plane
-        Eigen::Quaterniond q;
-        Transform3d m = Transform3d::Identity();
-        m.matrix().block(0, 0, 3, 3) = q.setFromTwoVectors(normal_transformed, Vec3d::UnitZ()).toRotationMatrix();
-        polygon = transform(polygon, m);
-
-        // Now to remove the inner points. We'll misuse Geometry::convex_hull for that, but since
-        // it works in fixed point representation, we will rescale the polygon to avoid overflows.
-        // And yes, it is a nasty thing to do. Whoever has time is free to refactor.
-        Vec3d bb_size = BoundingBoxf3(polygon).size();
-        float sf = std::min(1./bb_size(0), 1./bb_size(1));
-        Transform3d tr = Geometry::scale_transform({ sf, sf, 1.f });
-        polygon = transform(polygon, tr);
-        polygon = Slic3r::Geometry::convex_hull(polygon);
-        polygon = transform(polygon, tr.inverse());
-
-        // Calculate area of the polygons and discard ones that are too small
-        float& area = m_planes[polygon_id].area;
-        area = 0.f;
-        for (unsigned int i = 0; i < polygon.size(); i++) // Shoelace formula
-            area += polygon[i](0)*polygon[i + 1 < polygon.size() ? i + 1 : 0](1) - polygon[i + 1 < polygon.size() ? i + 1 : 0](0)*polygon[i](1);
-        area = 0.5f * std::abs(area);
-
-        bool discard = false;
-        if (area < minimal_area)
-            discard = true;
-        else {
-            // We also check the inner angles and discard polygons with angles smaller than the following threshold
-            const double angle_threshold = ::cos(10.0 * (double)PI / 180.0);
-
-            for (unsigned int i = 0; i < polygon.size(); ++i) {
-                const Vec3d& prec = polygon[(i == 0) ? polygon.size() - 1 : i - 1];
-                const Vec3d& curr = polygon[i];
-                const Vec3d& next = polygon[(i == polygon.size() - 1) ? 0 : i + 1];
-
-                if ((prec - curr).normalized().dot((next - curr).normalized()) > angle_threshold) {
-                    discard = true;
-                    break;
+    // Now we'll go through all the polygons, transform the points into xy plane to process them.
+    // The polygons are processed independently, thus in parallel.
+    std::vector<char> keep_plane(m_planes.size(), false);
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, m_planes.size()), [&](const tbb::blocked_range<size_t> &range) {
+        for (size_t polygon_id = range.begin(); polygon_id < range.end(); ++ polygon_id) {
+            Pointf3s& polygon = m_planes[polygon_id].vertices;
+            const Vec3d& normal = m_planes[polygon_id].normal;
+
+            // transform the normal according to the instance matrix:
+            const Vec3d normal_transformed = normal_matrix * normal;
+
+            // We are going to rotate about z and y to flatten the plane
+            Eigen::Quaterniond q;
+            Transform3d m = Transform3d::Identity();
+            m.matrix().block(0, 0, 3, 3) = q.setFromTwoVectors(normal_transformed, Vec3d::UnitZ()).toRotationMatrix();
+            polygon = transform(polygon, m);
+
+            // Now to remove the inner points. We'll misuse Geometry::convex_hull for that, but since
+            // it works in fixed point representation, we will rescale the polygon to avoid overflows.
+            // And yes, it is a nasty thing to do. Whoever has time is free to refactor.
+            Vec3d bb_size = BoundingBoxf3(polygon).size();
+            float sf = std::min(1./bb_size(0), 1./bb_size(1));
+            Transform3d tr = Geometry::scale_transform({ sf, sf, 1.f });
+            polygon = transform(polygon, tr);
+            polygon = Slic3r::Geometry::convex_hull(polygon);
+            polygon = transform(polygon, tr.inverse());
+
+            // Calculate area of the polygons and discard ones that are too small
+            float& area = m_planes[polygon_id].area;
+            area = 0.f;
+            for (unsigned int i = 0; i < polygon.size(); i++) // Shoelace formula
+                area += polygon[i](0)*polygon[i + 1 < polygon.size() ? i + 1 : 0](1) - polygon[i + 1 < polygon.size() ? i + 1 : 0](0)*polygon[i](1);
+            area = 0.5f * std::abs(area);
+
+            bool discard = false;
+            if (area < minimal_area)
+                discard = true;
+            else {
+                // We also check the inner angles and discard polygons with angles smaller than the following threshold
+                const double angle_threshold = ::cos(10.0 * (double)PI / 180.0);
+
+                for (unsigned int i = 0; i < polygon.size(); ++i) {
+                    const Vec3d& prec = polygon[(i == 0) ? polygon.size() - 1 : i - 1];
+                    const Vec3d& curr = polygon[i];
+                    const Vec3d& next = polygon[(i == polygon.size() - 1) ? 0 : i + 1];
+
+                    if ((prec - curr).normalized().dot((next - curr).normalized()) > angle_threshold) {
+                        discard = true;
+                        break;
+                    }
                 }
             }
-        }
-
-        if (discard) {
-            m_planes[polygon_id--] = std::move(m_planes.back());
-            m_planes.pop_back();
-            continue;
-        }
 
-        // We will shrink the polygon a little bit so it does not touch the object edges:
-        Vec3d centroid = std::accumulate(polygon.begin(), polygon.end(), Vec3d(0.0, 0.0, 0.0));
-        centroid /= (double)polygon.size();
-        for (auto& vertex : polygon)
-            vertex = 0.9f*vertex + 0.1f*centroid;
-
-        // Polygon is now simple and convex, we'll round the corners to make them look nicer.
-        // The algorithm takes a vertex, calculates middles of respective sides and moves the vertex
-        // towards their average (controlled by 'aggressivity'). This is repeated k times.
-        // In next iterations, the neighbours are not always taken at the middle (to increase the
-        // rounding effect at the corners, where we need it most).
-        const unsigned int k = 10; // number of iterations
-        const float aggressivity = 0.2f;  // agressivity
-        const unsigned int N = polygon.size();
-        std::vector<std::pair<unsigned int, unsigned int>> neighbours;
-        if (k != 0) {
-            Pointf3s points_out(2*k*N); // vector long enough to store the future vertices
-            for (unsigned int j=0; j<N; ++j) {
-                points_out[j*2*k] = polygon[j];
-                neighbours.push_back(std::make_pair((int)(j*2*k-k) < 0 ? (N-1)*2*k+k : j*2*k-k, j*2*k+k));
-            }
+            if (discard)
+                continue;
+
+            // We will shrink the polygon a little bit so it does not touch the object edges:
+            Vec3d centroid = std::accumulate(polygon.begin(), polygon.end(), Vec3d(0.0, 0.0, 0.0));
+            centroid /= (double)polygon.size();
+            for (auto& vertex : polygon)
+                vertex = 0.9f*vertex + 0.1f*centroid;
+
+            // Polygon is now simple and convex, we'll round the corners to make them look nicer.
+            // The algorithm takes a vertex, calculates middles of respective sides and moves the vertex
+            // towards their average (controlled by 'aggressivity'). This is repeated k times.
+            // In next iterations, the neighbours are not always taken at the middle (to increase the
+            // rounding effect at the corners, where we need it most).
+            const unsigned int k = 10; // number of iterations
+            const float aggressivity = 0.2f;  // agressivity
+            const unsigned int N = polygon.size();
+            std::vector<std::pair<unsigned int, unsigned int>> neighbours;
+            if (k != 0) {
+                Pointf3s points_out(2*k*N); // vector long enough to store the future vertices
+                for (unsigned int j=0; j<N; ++j) {
+                    points_out[j*2*k] = polygon[j];
+                    neighbours.push_back(std::make_pair((int)(j*2*k-k) < 0 ? (N-1)*2*k+k : j*2*k-k, j*2*k+k));
+                }
 
-            for (unsigned int i=0; i<k; ++i) {
-                // Calculate middle of each edge so that neighbours points to something useful:
-                for (unsigned int j=0; j<N; ++j)
-                    if (i==0)
-                        points_out[j*2*k+k] = 0.5f * (points_out[j*2*k] + points_out[j==N-1 ? 0 : (j+1)*2*k]);
-                    else {
-                        float r = 0.2+0.3/(k-1)*i; // the neighbours are not always taken in the middle
-                        points_out[neighbours[j].first] = r*points_out[j*2*k] + (1-r) * points_out[neighbours[j].first-1];
-                        points_out[neighbours[j].second] = r*points_out[j*2*k] + (1-r) * points_out[neighbours[j].second+1];
+                for (unsigned int i=0; i<k; ++i) {
+                    // Calculate middle of each edge so that neighbours points to something useful:
+                    for (unsigned int j=0; j<N; ++j)
+                        if (i==0)
+                            points_out[j*2*k+k] = 0.5f * (points_out[j*2*k] + points_out[j==N-1 ? 0 : (j+1)*2*k]);
+                        else {
+                            float r = 0.2+0.3/(k-1)*i; // the neighbours are not always taken in the middle
+                            points_out[neighbours[j].first] = r*points_out[j*2*k] + (1-r) * points_out[neighbours[j].first-1];
+                            points_out[neighbours[j].second] = r*points_out[j*2*k] + (1-r) * points_out[neighbours[j].second+1];
+                        }
+                    // Now we have a triangle and valid neighbours, we can do an iteration:
+                    for (unsigned int j=0; j<N; ++j)
+                        points_out[2*k*j] = (1-aggressivity) * points_out[2*k*j] +
+                                            aggressivity*0.5f*(points_out[neighbours[j].first] + points_out[neighbours[j].second]);
+
+                    for (auto& n : neighbours) {
+                        ++n.first;
+                        --n.second;
                     }
-                // Now we have a triangle and valid neighbours, we can do an iteration:
-                for (unsigned int j=0; j<N; ++j)
-                    points_out[2*k*j] = (1-aggressivity) * points_out[2*k*j] +
-                                        aggressivity*0.5f*(points_out[neighbours[j].first] + points_out[neighbours[j].second]);
-
-                for (auto& n : neighbours) {
-                    ++n.first;
-                    --n.second;
                 }
+                polygon = points_out; // replace the coarse polygon with the smooth one that we just created
             }
-            polygon = points_out; // replace the coarse polygon with the smooth one that we just created
-        }
 
 
-        // Raise a bit above the object surface to avoid flickering:
-        for (auto& b : polygon)
-            b(2) += 0.1f;
+            // Raise a bit above the object surface to avoid flickering:
+            for (auto& b : polygon)
+                b(2) += 0.1f;
 
-        // Transform back to 3D (and also back to mesh coordinates)
-        polygon = transform(polygon, inst_matrix.inverse() * m.inverse());
-    }
+            // Transform back to 3D (and also back to mesh coordinates)
+            polygon = transform(polygon, inst_matrix.inverse() * m.inverse());
+            keep_plane[polygon_id] = true;
+        }
+    });
+
+    // Remove the discarded planes.
+    size_t num_planes = 0;
+    for (size_t i = 0; i < m_planes.size(); ++ i)
+        if (keep_plane[i]) {
+            if (num_planes != i)
+                m_planes[num_planes] = std::move(m_planes[i]);
+            ++ num_planes;
+        }
+    m_planes.resize(num_planes);
 
     // We'll sort the planes by area and only keep the 254 largest ones (because of the picking pass limitations):
     std::sort(m_planes.rbegin(), m_planes.rend(), [](const PlaneData& a, const PlaneData& b) { return a.area < b.area; });
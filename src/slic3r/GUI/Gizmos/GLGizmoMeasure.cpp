@@ -531,8 +531,8 @@ void GLGizmoMeasure::on_set_state()
         restore_scene_raycasters_state();
         m_editing_distance = false;
         m_is_editing_distance_first_frame = true;
-        m_measuring.reset();
-        m_raycaster.reset();
+        // m_measuring and m_raycaster are kept, they are reused by update_if_needed() if the gizmo is reopened
+        // over the same volumes with the same meshes and transformations.
     }
     else {
         m_mode = EMode::FeatureSelection;
@@ -1083,7 +1083,8 @@ void GLGizmoMeasure::update_if_needed()
         const ModelVolume* vol = obj->volumes[volume_idx];
         const VolumeCacheItem item = {
             obj, inst, vol,
-            Geometry::translation_transform(selection.get_first_volume()->get_sla_shift_z() * Vec3d::UnitZ()) * inst->get_matrix() * vol->get_matrix()
+            Geometry::translation_transform(selection.get_first_volume()->get_sla_shift_z() * Vec3d::UnitZ()) * inst->get_matrix() * vol->get_matrix(),
+            vol->get_mesh_shared_ptr()
         };
         volumes_cache.emplace_back(item);
     }
@@ -74,10 +74,12 @@ class GLGizmoMeasure : public GLGizmoBase
         const ModelInstance* instance{ nullptr };
         const ModelVolume* volume{ nullptr };
         Transform3d world_trafo;
+        // Detects a change of the mesh of the same ModelVolume. Holding the mesh avoids reuse of its address by another mesh.
+        std::shared_ptr<const TriangleMesh> mesh;
 
         bool operator == (const VolumeCacheItem& other) const {
             return this->object == other.object && this->instance == other.instance && this->volume == other.volume &&
-                this->world_trafo.isApprox(other.world_trafo);
+                this->mesh == other.mesh && this->world_trafo.isApprox(other.world_trafo);
         }
     };
 
@@ -17,6 +17,9 @@
 #include <memory>
 #include <optional>
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
 namespace Slic3r::GUI {
 
 std::shared_ptr<GLModel> GLGizmoPainterBase::s_sphere = nullptr;
@@ -922,10 +925,6 @@ void TriangleSelectorGUI::render(ImGuiWrapper* imgui, const Transform3d& matrix)
 
 void TriangleSelectorGUI::update_render_data()
 {
-    int              enf_cnt = 0;
-    int              blc_cnt = 0;
-    std::vector<int> seed_fill_cnt(m_iva_seed_fills.size(), 0);
-
     for (auto* iva : { &m_iva_enforcers, &m_iva_blockers }) {
         iva->reset();
     }
@@ -942,33 +941,51 @@ void TriangleSelectorGUI::update_render_data()
     for (auto& data : iva_seed_fills_data)
         data.format = { GLModel::Geometry::EPrimitiveType::Triangles, GLModel::Geometry::EVertexLayout::P3N3 };
 
+    // Sort the leaf triangles to be rendered into the enforcers, blockers and seed fill buckets first,
+    // so that the vertex buffers may be allocated at once and filled in parallel.
+    std::array<GLModel::Geometry*, 5> iva_data { &iva_enforcers_data, &iva_blockers_data, &iva_seed_fills_data[0], &iva_seed_fills_data[1], &iva_seed_fills_data[2] };
+    std::array<std::vector<int>, 5>   iva_triangles;
+    for (int tr_idx = 0; tr_idx < int(m_triangles.size()); ++ tr_idx) {
+        const Triangle &tr = m_triangles[tr_idx];
+        if (!tr.valid() || tr.is_split() || (tr.get_state() == EnforcerBlockerType::NONE && !tr.is_selected_by_seed_fill()))
+            continue;
+        iva_triangles[tr.is_selected_by_seed_fill()                   ? 2 + int(tr.get_state()) :
+                      tr.get_state() == EnforcerBlockerType::ENFORCER ? 0 : 1].emplace_back(tr_idx);
+    }
+
     // small value used to offset triangles along their normal to avoid z-fighting
     static const float offset = 0.001f;
 
-    for (const Triangle &tr : m_triangles) {
-        if (!tr.valid() || tr.is_split() || (tr.get_state() == EnforcerBlockerType::NONE && !tr.is_selected_by_seed_fill()))
+    for (size_t bucket_idx = 0; bucket_idx < iva_data.size(); ++ bucket_idx) {
+        const std::vector<int> &triangles = iva_triangles[bucket_idx];
+        if (triangles.empty())
             continue;
-
-        int tr_state = int(tr.get_state());
-        GLModel::Geometry &iva = tr.is_selected_by_seed_fill()                   ? iva_seed_fills_data[tr_state] :
-                                 tr.get_state() == EnforcerBlockerType::ENFORCER ? iva_enforcers_data :
-                                                                                   iva_blockers_data;
-        int                  &cnt = tr.is_selected_by_seed_fill()                   ? seed_fill_cnt[tr_state] :
-                                    tr.get_state() == EnforcerBlockerType::ENFORCER ? enf_cnt :
-                                                                                      blc_cnt;
-        const Vec3f          &v0  = m_vertices[tr.verts_idxs[0]].v;
-        const Vec3f          &v1  = m_vertices[tr.verts_idxs[1]].v;
-        const Vec3f          &v2  = m_vertices[tr.verts_idxs[2]].v;
-        //FIXME the normal may likely be pulled from m_triangle_selectors, but it may not be worth the effort
-        // or the current implementation may be more cache friendly.
-        const Vec3f           n   = (v1 - v0).cross(v2 - v1).normalized();
-        // small value used to offset triangles along their normal to avoid z-fighting
-        const Vec3f    offset_n   = offset * n;
-        iva.add_vertex(v0 + offset_n, n);
-        iva.add_vertex(v1 + offset_n, n);
-        iva.add_vertex(v2 + offset_n, n);
-        iva.add_triangle((unsigned int)cnt, (unsigned int)cnt + 1, (unsigned int)cnt + 2);
-        cnt += 3;
+        GLModel::Geometry &iva = *iva_data[bucket_idx];
+        const size_t vertex_stride = GLModel::Geometry::vertex_stride_floats(iva.format);
+        iva.vertices.assign(triangles.size() * 3 * vertex_stride, 0.f);
+        iva.indices.assign(triangles.size() * 3, 0);
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, triangles.size()), [this, &triangles, &iva, vertex_stride](const tbb::blocked_range<size_t> &range) {
+            for (size_t i = range.begin(); i < range.end(); ++ i) {
+                const Triangle &tr = m_triangles[triangles[i]];
+                const Vec3f    &v0 = m_vertices[tr.verts_idxs[0]].v;
+                const Vec3f    &v1 = m_vertices[tr.verts_idxs[1]].v;
+                const Vec3f    &v2 = m_vertices[tr.verts_idxs[2]].v;
+                //FIXME the normal may likely be pulled from m_triangle_selectors, but it may not be worth the effort
+                // or the current implementation may be more cache friendly.
+                const Vec3f     n  = (v1 - v0).cross(v2 - v1).normalized();
+                // small value used to offset triangles along their normal to avoid z-fighting
+                const Vec3f offset_n = offset * n;
+                float *dst = iva.vertices.data() + i * 3 * vertex_stride;
+                for (const Vec3f *v : { &v0, &v1, &v2 }) {
+                    const Vec3f p = *v + offset_n;
+                    std::copy(p.data(), p.data() + 3, dst);
+                    std::copy(n.data(), n.data() + 3, dst + 3);
+                    dst += vertex_stride;
+                }
+                for (unsigned int j = 0; j < 3; ++ j)
+                    iva.indices[i * 3 + j] = (unsigned int)(i * 3 + j);
+            }
+        });
     }
 
     if (!iva_enforcers_data.is_empty())
@@ -417,6 +417,10 @@ void ObjectClipper::set_position_by_ratio(double pos, bool keep_normal)
 
 void ObjectClipper::set_range_and_pos(const Vec3d& cpl_normal, double cpl_offset, double pos)
 {
+    // The cut gizmo sets the plane on every frame. Don't invalidate the canvas if the plane did not move,
+    // otherwise the canvas would be rendered again and again while the gizmo is open.
+    if (m_clp && *m_clp == ClippingPlane(cpl_normal, cpl_offset) && m_clp_ratio == pos)
+        return;
     m_clp.reset(new ClippingPlane(cpl_normal, cpl_offset));
     m_clp_ratio = pos;
     get_pool()->get_canvas()->set_as_dirty();
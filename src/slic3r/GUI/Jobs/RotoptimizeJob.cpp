@@ -5,6 +5,7 @@
 #include "libslic3r/MinAreaBoundingBox.hpp"
 #include "libslic3r/Model.hpp"
 #include "libslic3r/SLAPrint.hpp"
+#include "libslic3r/Execution/ExecutionTBB.hpp"
 
 #include "slic3r/GUI/Plater.hpp"
 #include "libslic3r/PresetBundle.hpp"
@@ -14,6 +15,9 @@
 
 #include <slic3r/GUI/I18N.hpp>
 
+#include <mutex>
+#include <numeric>
+
 namespace Slic3r { namespace GUI {
 
 void RotoptimizeJob::prepare()
@@ -49,35 +53,45 @@ void RotoptimizeJob::prepare()
 
 void RotoptimizeJob::process(Ctl &ctl)
 {
-    int prev_status = 0;
     auto statustxt = _u8L("Searching for optimal orientation");
     ctl.update_status(0, statustxt);
 
-    auto params =
-        sla::RotOptimizeParams{}
-            .accuracy(m_accuracy)
-            .print_config(&m_default_print_cfg)
-            .statucb([this, &prev_status, &ctl, &statustxt](int s)
-        {
-            if (s > 0 && s < 100)
-                ctl.update_status(prev_status + s / m_selected_object_ids.size(),
-                                  statustxt);
+    // The objects are optimized concurrently, each optimizer evaluating its candidate rotations in parallel
+    // on the same thread pool. The overall status is the average of the statuses of the particular objects.
+    const size_t objcount = m_selected_object_ids.size();
+    std::vector<int> statuses(objcount, 0);
+    std::mutex       status_mutex;
+    auto update_status = [&](size_t obj_idx, int s) {
+        std::lock_guard<std::mutex> lk(status_mutex);
+        statuses[obj_idx] = s;
+        ctl.update_status(std::accumulate(statuses.begin(), statuses.end(), 0) / int(objcount), statustxt);
+    };
+
+    execution::for_each(ex_tbb, size_t(0), objcount, [this, &ctl, &update_status](size_t obj_idx) {
+        if (ctl.was_canceled())
+            return;
+
+        ObjRot &objrot = m_selected_object_ids[obj_idx];
+        ModelObject *o = m_plater->model().objects[size_t(objrot.idx)];
+        if (!o) return;
 
-            return !ctl.was_canceled();
-        });
+        auto params =
+            sla::RotOptimizeParams{}
+                .accuracy(m_accuracy)
+                .print_config(&m_default_print_cfg)
+                .statucb([&ctl, &update_status, obj_idx](int s)
+            {
+                if (s > 0 && s < 100)
+                    update_status(obj_idx, s);
 
-
-    for (ObjRot &objrot : m_selected_object_ids) {
-        ModelObject *o = m_plater->model().objects[size_t(objrot.idx)];
-        if (!o) continue;
+                return !ctl.was_canceled();
+            });
 
         if (Methods[m_method_id].findfn)
             objrot.rot = Methods[m_method_id].findfn(*o, params);
 
-        prev_status += 100 / m_selected_object_ids.size();
-
-        if (ctl.was_canceled()) break;
-    }
+        update_status(obj_idx, 100);
+    });
 
     ctl.update_status(100, ctl.was_canceled() ?
                                _u8L("Orientation search canceled.") :
@@ -18,6 +18,7 @@
 #include <igl/unproject.h>
 
 #include <cstdint>
+#include <numeric>
 
 
 namespace Slic3r {
@@ -179,6 +180,67 @@ void MeshClipper::pass_mouse_click(const Vec3d& point_in)
     }
 }
 
+const indexed_triangle_set& MeshClipper::SortedFacets::facets_crossing(const indexed_triangle_set &mesh_in, const Vec3d &normal_in, float height)
+{
+    if (this->mesh != &mesh_in || this->normal != normal_in ||
+        this->facets.size() != mesh_in.indices.size() || this->vertex_map.size() != mesh_in.vertices.size()) {
+        // The mesh or the direction of the clipping plane changed, sort the facets again.
+        this->mesh   = &mesh_in;
+        this->normal = normal_in;
+        // slice_mesh() rotates the normal to Z, thus the heights are measured along the normalized normal.
+        const Vec3f n = normal_in.normalized().cast<float>();
+        std::vector<float> fmin(mesh_in.indices.size());
+        std::vector<float> fmax(mesh_in.indices.size());
+        for (size_t i = 0; i < mesh_in.indices.size(); ++ i) {
+            const Vec3i &face = mesh_in.indices[i];
+            const float  z0   = n.dot(mesh_in.vertices[face(0)]);
+            const float  z1   = n.dot(mesh_in.vertices[face(1)]);
+            const float  z2   = n.dot(mesh_in.vertices[face(2)]);
+            fmin[i] = std::min(z0, std::min(z1, z2));
+            fmax[i] = std::max(z0, std::max(z1, z2));
+        }
+        this->facets.resize(mesh_in.indices.size());
+        std::iota(this->facets.begin(), this->facets.end(), 0);
+        std::sort(this->facets.begin(), this->facets.end(), [&fmin](int l, int r) { return fmin[l] < fmin[r]; });
+        this->facets_min.resize(this->facets.size());
+        this->facets_max.resize(this->facets.size());
+        this->max_extent = 0.f;
+        for (size_t i = 0; i < this->facets.size(); ++ i) {
+            this->facets_min[i] = fmin[this->facets[i]];
+            this->facets_max[i] = fmax[this->facets[i]];
+            this->max_extent    = std::max(this->max_extent, this->facets_max[i] - this->facets_min[i]);
+        }
+        this->vertex_map.assign(mesh_in.vertices.size(), -1);
+    }
+
+    // Margin covering the rounding differences to slice_mesh(), which skips the extra facets not crossing the plane.
+    const float eps   = 1e-3f;
+    const auto  begin = std::lower_bound(this->facets_min.begin(), this->facets_min.end(), height - this->max_extent - eps);
+    const auto  end   = std::upper_bound(begin, this->facets_min.end(), height + eps);
+    this->its.clear();
+    for (auto it = begin; it != end; ++ it) {
+        const size_t i = it - this->facets_min.begin();
+        if (this->facets_max[i] < height - eps)
+            continue;
+        const Vec3i &face = mesh_in.indices[this->facets[i]];
+        Vec3i        face_out;
+        for (int j = 0; j < 3; ++ j) {
+            // Keep the vertices shared, slice_mesh() chains the intersection lines through the shared edges.
+            int &idx = this->vertex_map[face(j)];
+            if (idx == -1) {
+                idx = int(this->its.vertices.size());
+                this->its.vertices.emplace_back(mesh_in.vertices[face(j)]);
+            }
+            face_out(j) = idx;
+        }
+        this->its.indices.emplace_back(face_out);
+    }
+    for (auto it = begin; it != end; ++ it)
+        for (int j = 0; j < 3; ++ j)
+            this->vertex_map[mesh_in.indices[this->facets[it - this->facets_min.begin()]](j)] = -1;
+    return this->its;
+}
+
 void MeshClipper::recalculate_triangles()
 {
     m_result = ClipResult();
@@ -195,10 +257,10 @@ void MeshClipper::recalculate_triangles()
 
     if (m_csgmesh.empty()) {
         if (m_mesh)
-            expolys = union_ex(slice_mesh(*m_mesh, height_mesh, slicing_params));
+            expolys = union_ex(slice_mesh(m_sorted_facets.facets_crossing(*m_mesh, up, height_mesh), height_mesh, slicing_params));
 
         if (m_negative_mesh && !m_negative_mesh->empty()) {
-            const ExPolygons neg_expolys = union_ex(slice_mesh(*m_negative_mesh, height_mesh, slicing_params));
+            const ExPolygons neg_expolys = union_ex(slice_mesh(m_negative_sorted_facets.facets_crossing(*m_negative_mesh, up, height_mesh), height_mesh, slicing_params));
             expolys = diff_ex(expolys, neg_expolys);
         }
     } else {
@@ -490,6 +552,21 @@ bool MeshRaycaster::closest_hit(const Vec2d& mouse_pos, const Transform3d& trafo
     Vec3d direction;
     line_from_mouse_pos(mouse_pos, trafo, camera, point, direction);
 
+    if (clipping_plane == nullptr) {
+        // Only the closest hit is needed, which lets the AABB tree traversal skip the boxes behind it.
+        const AABBMesh::hit_result hit = m_emesh.query_ray_hit(point, direction.normalized());
+        if (!hit.is_hit())
+            return false; // no intersection found
+
+        position = hit.position().cast<float>();
+        normal = hit.normal().cast<float>();
+
+        if (facet_idx != nullptr)
+            *facet_idx = hit.face();
+
+        return true;
+    }
+
     const std::vector<AABBMesh::hit_result> hits = m_emesh.query_ray_hits(point, direction.normalized());
 
     if (hits.empty())
@@ -148,6 +148,29 @@ private:
     std::optional<ClipResult> m_result;
     bool m_fill_cut = true;
     double m_contour_width = 0.;
+
+    // Facets of a mesh sorted by the projection of their vertices to the normal of the clipping plane in mesh coords.
+    // Cached while the normal stays the same, so that moving the clipping plane along its normal (dragging the clipping
+    // plane slider) only slices the facets around the plane instead of the whole mesh.
+    struct SortedFacets {
+        const indexed_triangle_set *mesh { nullptr };
+        Vec3d                       normal { Vec3d::Zero() };
+        // Facet indices with the minimum and maximum projections of their vertices, sorted by the minimum.
+        std::vector<int>            facets;
+        std::vector<float>          facets_min;
+        std::vector<float>          facets_max;
+        // Maximum of facets_max - facets_min, bounding the range of facets_min to be searched for the facets crossing a plane.
+        float                       max_extent { 0.f };
+        // Index of a mesh vertex in the output mesh, -1 if not referenced. Reset after each query.
+        std::vector<int>            vertex_map;
+        // Facets crossing the last queried plane with their vertices.
+        indexed_triangle_set        its;
+
+        // Returns a subset of mesh containing the facets crossing the plane at the given height along normal.
+        const indexed_triangle_set& facets_crossing(const indexed_triangle_set &mesh, const Vec3d &normal, float height);
+    };
+    SortedFacets m_sorted_facets;
+    SortedFacets m_negative_sorted_facets;
 };
 
 
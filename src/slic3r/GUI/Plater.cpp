@@ -7,6 +7,7 @@
 #include <string>
 #include <regex>
 #include <future>
+#include <optional>
 #include <boost/algorithm/string.hpp>
 #include <boost/optional.hpp>
 #include <boost/filesystem/fstream.hpp>
@@ -15,6 +16,8 @@
 #include <boost/log/trivial.hpp>
 #include <boost/nowide/convert.hpp>
 
+#include <tbb/parallel_for.h>
+
 #include <wx/sizer.h>
 #include <wx/stattext.h>
 #include <wx/button.h>
@@ -2481,6 +2484,27 @@ std::vector<size_t> Plater::priv::load_files(const std::vector<fs::path>& input_
     const fs::path temp_path = wxStandardPaths::Get().GetTempDir().utf8_str().data();
 
     size_t input_files_size = input_files.size();
+
+    // Parse the plain mesh files (STL, OBJ) in parallel up front, the rest of the loading (dialogs, unit conversions, adding to the scene)
+    // is done sequentially below. Reading of a mesh does not create any ObjectBase, which is not thread safe.
+    std::vector<std::optional<TriangleMesh>> preloaded_meshes(input_files_size);
+    std::vector<std::exception_ptr>          preloaded_errors(input_files_size);
+    if (load_model && input_files_size > 1)
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, input_files_size, 1), [&input_files, &preloaded_meshes, &preloaded_errors](const tbb::blocked_range<size_t> &range) {
+            for (size_t i = range.begin(); i < range.end(); ++ i) {
+                fs::path path = input_files[i];
+#ifdef _WIN32
+                path.make_preferred();
+#endif // _WIN32
+                if (Model::is_mesh_file(path.string()))
+                    try {
+                        preloaded_meshes[i] = Model::read_mesh_from_file(path.string());
+                    } catch (...) {
+                        preloaded_errors[i] = std::current_exception();
+                    }
+            }
+        });
+
     for (size_t i = 0; i < input_files_size; ++i) {
 #ifdef _WIN32
         auto path = input_files[i];
@@ -2576,7 +2600,12 @@ std::vector<size_t> Plater::priv::load_files(const std::vector<fs::path>& input_
                 }
             }
             else {
-                model = Slic3r::Model::read_from_file(path.string(), nullptr, nullptr, only_if(load_config, Model::LoadAttribute::CheckVersion));
+                if (preloaded_errors[i])
+                    std::rethrow_exception(preloaded_errors[i]);
+                model = preloaded_meshes[i] ?
+                    Slic3r::Model::read_from_mesh(path.string(), std::move(*preloaded_meshes[i]), only_if(load_config, Model::LoadAttribute::CheckVersion)) :
+                    Slic3r::Model::read_from_file(path.string(), nullptr, nullptr, only_if(load_config, Model::LoadAttribute::CheckVersion));
+                preloaded_meshes[i].reset();
                 for (auto obj : model.objects)
                     if (obj->name.empty())
                         obj->name = fs::path(obj->input_file).filename().string();
@@ -2809,6 +2838,9 @@ std::vector<size_t> Plater::priv::load_model_objects(const ModelObjectPtrs& mode
         object->ensure_on_bed(allow_negative_z);
     }
 
+    // Files loaded one after another may contain the same meshes.
+    model.share_identical_meshes();
+
 #ifdef AUTOPLACEMENT_ON_LOAD
     // FIXME distance should be a config value /////////////////////////////////
     auto min_obj_distance = static_cast<coord_t>(6/SCALING_FACTOR);
@@ -4941,6 +4973,7 @@ void Plater::priv::take_snapshot(const std::string& snapshot_name, const UndoRed
     this->undo_redo_stack().release_least_recently_used();
 
     dirty_state.update_from_undo_redo_stack(m_undo_redo_stack_main.project_modified());
+    dirty_state.schedule_autosave();
 
     // Save the last active preset name of a particular printer technology.
     ((this->printer_technology == ptFFF) ? m_last_fff_printer_profile_name : m_last_sla_printer_profile_name) = wxGetApp().preset_bundle->printers.get_selected_preset_name();
@@ -5331,18 +5364,20 @@ void Plater::load_gcode(const wxString& filename)
 
     wxBusyCursor wait;
 
-    // process gcode
-    GCodeProcessor processor;
-    try
-    {
-        processor.process_file(filename.ToUTF8().data());
-    }
-    catch (const std::exception& ex)
-    {
-        show_error(this, ex.what());
-        return;
+    // process gcode, unless it was exported together with its processed result
+    if (! GCodeProcessor::load_result_cache(filename.ToUTF8().data(), p->gcode_result)) {
+        GCodeProcessor processor;
+        try
+        {
+            processor.process_file(filename.ToUTF8().data());
+        }
+        catch (const std::exception& ex)
+        {
+            show_error(this, ex.what());
+            return;
+        }
+        p->gcode_result = std::move(processor.extract_result());
     }
-    p->gcode_result = std::move(processor.extract_result());
 
     // show results
     try
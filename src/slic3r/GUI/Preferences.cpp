@@ -286,6 +286,18 @@ void PreferencesDialog::build()
 			L("If enabled, allows the Reload from disk command to automatically find and load the files when invoked."),
 			app_config->get_bool("export_sources_full_pathnames"));
 
+		append_bool_option(m_optgroup_general, "export_gcode_result_cache",
+			L("Export G-code preview cache"),
+			L("If enabled, the processed G-code preview is stored next to the exported G-code into a .cache file, "
+			  "so that the G-code is loaded into the G-code viewer without processing it again."),
+			app_config->get_bool("export_gcode_result_cache"));
+
+		append_bool_option(m_optgroup_general, "autosave_project",
+			L("Autosave modified project"),
+			L("If enabled, a modified project is saved in the background into the \"autosave\" folder of the configuration directory, "
+			  "shortly after it was last modified."),
+			app_config->get_bool("autosave_project"));
+
 #ifdef _WIN32
 		// Please keep in sync with ConfigWizard
 		append_bool_option(m_optgroup_general, "associate_3mf",
@@ -2,21 +2,42 @@
 
 #include "ProjectDirtyStateManager.hpp"
 #include "ImGuiWrapper.hpp"
+#include "GUI.hpp"
 #include "GUI_App.hpp"
 #include "MainFrame.hpp"
 #include "I18N.hpp"
 #include "Plater.hpp"
 
+#include "libslic3r/AppConfig.hpp"
+#include "libslic3r/DeferredWriter.hpp"
 #include "libslic3r/Model.hpp"
+#include "libslic3r/PresetBundle.hpp"
+#include "libslic3r/Utils.hpp"
+#include "libslic3r/Format/3mf.hpp"
 
 #include <boost/algorithm/string/predicate.hpp>
+#include <boost/filesystem/operations.hpp>
+#include <boost/filesystem/path.hpp>
+#include <boost/log/trivial.hpp>
 
 #include <algorithm>
 #include <assert.h>
+#include <chrono>
+#include <memory>
 
 namespace Slic3r {
 namespace GUI {
 
+// The modified project is saved once it was not modified for this time.
+static constexpr const std::chrono::seconds AUTOSAVE_DELAY { 10 };
+
+static std::string autosave_path()
+{
+    const wxString project = wxGetApp().plater()->get_project_filename(".3mf");
+    const std::string name = project.IsEmpty() ? std::string("Untitled") : into_path(project).stem().string();
+    return (boost::filesystem::path(data_dir()) / "autosave" / (name + ".3mf")).string();
+}
+
 void ProjectDirtyStateManager::update_from_undo_redo_stack(bool dirty)
 {
     if (m_plater_dirty != dirty) {
@@ -57,6 +78,40 @@ void ProjectDirtyStateManager::reset_after_save()
     m_project_config_dirty = false;
     m_custom_gcode_per_print_z_dirty = false;
     wxGetApp().mainframe->update_title();
+
+    // The saved project makes its autosave obsolete. Replaces the autosave still pending.
+    // The autosave may have been scheduled under the former project name, for example "Untitled" before the first save.
+    std::vector<std::string> paths { autosave_path() };
+    if (! m_autosave_path.empty() && m_autosave_path != paths.front())
+        paths.emplace_back(m_autosave_path);
+    m_autosave_path.clear();
+    for (const std::string &path : paths)
+        wxGetApp().deferred_writer()->schedule(path, [path]() {
+            boost::system::error_code ec;
+            boost::filesystem::remove(path, ec);
+        }, std::chrono::milliseconds(0));
+}
+
+void ProjectDirtyStateManager::schedule_autosave()
+{
+    GUI_App &app = wxGetApp();
+    if (! this->is_dirty() || ! app.app_config->get_bool("autosave_project"))
+        return;
+
+    // The background thread works on copies. The copied model shares the meshes with the current model.
+    auto model  = std::make_shared<Model>(app.model());
+    auto config = std::make_shared<DynamicPrintConfig>(app.preset_bundle->full_config_secure());
+    const std::string path = autosave_path();
+    m_autosave_path = path;
+    app.deferred_writer()->schedule(path, [model, config, path]() {
+        const std::string path_tmp = path + ".tmp";
+        boost::filesystem::create_directories(boost::filesystem::path(path).parent_path());
+        // Without a thumbnail, which could only be rendered on the UI thread.
+        if (store_3mf(path_tmp.c_str(), model.get(), config.get(), false))
+            rename_file(path_tmp, path);
+        else
+            BOOST_LOG_TRIVIAL(error) << "Autosaving the project into " << path << " failed";
+    }, AUTOSAVE_DELAY);
 }
 
 void ProjectDirtyStateManager::reset_initial_presets()
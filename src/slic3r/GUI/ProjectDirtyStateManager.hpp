@@ -15,6 +15,8 @@ public:
     void update_from_preview();
     void reset_after_save();
     void reset_initial_presets();
+    // Save the modified project into the autosave folder on the background thread, if enabled by the "autosave_project" option.
+    void schedule_autosave();
 
     bool is_dirty() const { return m_plater_dirty || m_project_config_dirty || m_presets_dirty || m_custom_gcode_per_print_z_dirty; }
     bool is_presets_dirty() const { return m_presets_dirty; }
@@ -36,6 +38,8 @@ private:
     std::array<std::string, Preset::TYPE_COUNT> m_initial_presets;
     DynamicPrintConfig                          m_initial_project_config;
     CustomGCode::Info                           m_initial_custom_gcode_per_print_z;
+    // Path of the last autosave scheduled. The project name may change by saving the project, thus the path is captured.
+    std::string                                 m_autosave_path;
 };
 
 } // namespace GUI
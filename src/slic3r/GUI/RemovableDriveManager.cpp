@@ -24,6 +24,11 @@
 #include <boost/system/error_code.hpp>
 #include <boost/filesystem/convenience.hpp>
 #include <boost/process.hpp>
+#ifdef __linux__
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#endif // __linux__
 #endif
 
 namespace Slic3r {
@@ -607,6 +612,10 @@ void RemovableDriveManager::init(wxEvtHandler *callback_evt_handler)
 	this->update();
 #else // REMOVABLE_DRIVE_MANAGER_OS_CALLBACKS
 	// Don't call update() manually, as the UI triggered APIs call this->update() anyways.
+#ifdef __linux__
+	if (::pipe2(m_stop_pipe, O_CLOEXEC) != 0)
+		m_stop_pipe[0] = m_stop_pipe[1] = -1;
+#endif // __linux__
 	m_thread = boost::thread((boost::bind(&RemovableDriveManager::thread_proc, this)));
 #endif // REMOVABLE_DRIVE_MANAGER_OS_CALLBACKS
 }
@@ -630,9 +639,22 @@ void RemovableDriveManager::shutdown()
 			m_stop = true;
 		}
 		m_thread_stop_condition.notify_all();
+#ifdef __linux__
+		if (m_stop_pipe[1] >= 0) {
+			const char stop = 1;
+			while (::write(m_stop_pipe[1], &stop, 1) < 0 && errno == EINTR) ;
+		}
+#endif // __linux__
 		// Wait for the worker thread to stop.
 		m_thread.join();
 		m_stop = false;
+#ifdef __linux__
+		for (int &fd : m_stop_pipe)
+			if (fd >= 0) {
+				::close(fd);
+				fd = -1;
+			}
+#endif // __linux__
 	}
 #endif // REMOVABLE_DRIVE_MANAGER_OS_CALLBACKS
 
@@ -704,6 +726,40 @@ void RemovableDriveManager::thread_proc()
     m_wakeup = true;
 #endif // _WIN32
 
+#ifdef __linux__
+	// The kernel signals a change of the mount table to the pollers of /proc/self/mountinfo by POLLPRI,
+	// thus the drives are enumerated only after something was mounted or unmounted.
+	// Chromium shares the removable drives with the Linux container differently, keep polling there.
+	// Fall back to polling if the mount table cannot be watched.
+	int mountinfo = -1;
+	if (m_stop_pipe[0] >= 0 && platform_flavor() != PlatformFlavor::LinuxOnChromium)
+		mountinfo = ::open("/proc/self/mountinfo", O_RDONLY | O_CLOEXEC);
+	if (mountinfo >= 0) {
+		bool stopped = false;
+		this->update();
+		for (;;) {
+			pollfd fds[2] = { { mountinfo, POLLPRI, 0 }, { m_stop_pipe[0], POLLIN, 0 } };
+			int    ret    = ::poll(fds, 2, -1);
+			if (ret < 0 && errno == EINTR)
+				continue;
+			if (ret < 0)
+				break;
+			if (fds[1].revents != 0) {
+				// Stop the worker thread.
+				stopped = true;
+				break;
+			}
+			if (fds[0].revents & (POLLPRI | POLLERR))
+				// Update m_current drives and send out update events.
+				this->update();
+		}
+		::close(mountinfo);
+		if (stopped)
+			return;
+		BOOST_LOG_TRIVIAL(error) << "RemovableDriveManager: Waiting for the mount table changes failed, polling the removable drives.";
+	}
+#endif // __linux__
+
 	for (;;) {
 		// Wait for 2 seconds before running the disk enumeration.
 		// Cancellable.
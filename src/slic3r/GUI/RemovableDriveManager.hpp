@@ -103,6 +103,10 @@ private:
 #ifdef _WIN32
     std::atomic<bool>		m_wakeup { false };
 #endif /* _WIN32 */
+#ifdef __linux__
+	// Wakes up the worker thread waiting for a change of the mount table to stop it.
+	int 					m_stop_pipe[2] { -1, -1 };
+#endif // __linux__
 #endif // REMOVABLE_DRIVE_MANAGER_OS_CALLBACKS
 
 	// Called from update() to enumerate removable drives.
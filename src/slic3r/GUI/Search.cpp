@@ -177,6 +177,33 @@ bool OptionsSearcher::search()
     return search(search_line, true);
 }
 
+static inline uint64_t char_bit(wchar_t c)
+{
+    return uint64_t(1) << (uint64_t(std::towlower(c)) % 64);
+}
+
+// Superset of the characters fts::fuzzy_match() may match a pattern character against:
+// each character of the string and the characters it folds to in ASCII.
+static uint64_t string_chars_mask(const std::wstring &str)
+{
+    uint64_t mask = 0;
+    wchar_t  tmp[4];
+    for (wchar_t c : str) {
+        mask |= char_bit(c);
+        for (const wchar_t *it = tmp, *end = fold_to_ascii(c, tmp); it != end; ++ it)
+            mask |= char_bit(*it);
+    }
+    return mask;
+}
+
+void Option::update_chars_mask()
+{
+    // The separators of the composed labels are matched as well.
+    chars_mask = string_chars_mask(L" : ");
+    for (const std::wstring *s : { &key, &label, &label_local, &group, &group_local, &category, &category_local })
+        chars_mask |= string_chars_mask(*s);
+}
+
 static bool fuzzy_match(const std::wstring &search_pattern, const std::wstring &label, int& out_score, std::vector<uint16_t> &out_matches)
 {
     uint16_t matches[fts::max_matches + 1]; // +1 for the stopper
@@ -244,6 +271,12 @@ bool OptionsSearcher::search(const std::string& search, bool force/* = false*/)
                 opt.group_local + sep + opt.label_local;
     };
 
+    std::wstring wsearch = boost::nowide::widen(search);
+    boost::trim_left(wsearch);
+    uint64_t search_mask = 0;
+    for (wchar_t c : wsearch)
+        search_mask |= char_bit(c);
+
     std::vector<uint16_t> matches, matches2;
     for (size_t i=0; i < options.size(); i++)
     {
@@ -254,8 +287,10 @@ bool OptionsSearcher::search(const std::string& search, bool force/* = false*/)
             continue;
         }
 
-        std::wstring wsearch       = boost::nowide::widen(search);
-        boost::trim_left(wsearch);
+        if ((opt.chars_mask & search_mask) != search_mask)
+            // Some character of the pattern is not contained in any of the searched strings.
+            continue;
+
         std::wstring label         = get_label(opt, false);
         std::wstring label_english = get_label_english(opt, false);
         int score = std::numeric_limits<int>::min();
@@ -323,6 +358,9 @@ void OptionsSearcher::check_and_update(PrinterTechnology pt_in, ConfigOptionMode
 
     options.insert(options.end(), preferences_options.begin(), preferences_options.end());
 
+    for (Option &opt : options)
+        opt.update_chars_mask();
+
     sort_options();
 
     search(search_line, true);
@@ -54,8 +54,12 @@ struct Option {
     std::wstring    group_local;
     std::wstring    category;
     std::wstring    category_local;
+    // Lower case and ASCII folded characters of all the searchable strings above, hashed into 64 bits.
+    // Options not containing all the characters of a search pattern are rejected without fuzzy matching.
+    uint64_t        chars_mask {0};
 
     std::string     opt_key() const;
+    void            update_chars_mask();
 };
 
 struct FoundOption {
@@ -706,12 +706,19 @@ void Tab::update_changed_tree_ui()
     auto selected_item = m_treectrl->GetSelection();
     auto selection = selected_item ? m_treectrl->GetItemText(selected_item) : "";
 
+    // Translate the page titles once, not for each tree item. This function is called after each value change.
+    std::vector<wxString> page_titles;
+    page_titles.reserve(m_pages.size());
+    for (auto page : m_pages)
+        page_titles.emplace_back(translate_category(page->title(), m_type));
+
     while (cur_item) {
         auto title = m_treectrl->GetItemText(cur_item);
-        for (auto page : m_pages)
+        for (size_t page_idx = 0; page_idx < m_pages.size(); ++ page_idx)
         {
-            if (translate_category(page->title(), m_type) != title)
+            if (page_titles[page_idx] != title)
                 continue;
+            PageShp page = m_pages[page_idx];
             bool sys_page = true;
             bool modified_page = false;
             if (page->title() == "General") {
@@ -1630,6 +1637,7 @@ void TabPrint::build()
         optgroup->append_single_option_line("slicing_mode");
         optgroup->append_single_option_line("resolution");
         optgroup->append_single_option_line("gcode_resolution");
+        optgroup->append_single_option_line("arc_fitting");
         optgroup->append_single_option_line("xy_size_compensation");
         optgroup->append_single_option_line("elefant_foot_compensation", "elephant-foot-compensation_114487");
 
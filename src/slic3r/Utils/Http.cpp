@@ -1,7 +1,9 @@
 #include "Http.hpp"
 
+#include <array>
 #include <cstdlib>
 #include <functional>
+#include <mutex>
 #include <thread>
 #include <deque>
 #include <sstream>
@@ -9,6 +11,7 @@
 #include <boost/filesystem/fstream.hpp>
 #include <boost/filesystem/path.hpp>
 #include <boost/filesystem.hpp>
+#include <boost/algorithm/string/trim.hpp>
 #include <boost/format.hpp>
 #include <boost/log/trivial.hpp>
 
@@ -92,10 +95,42 @@ struct CurlGlobalInit
                             "network connections. See logs for additional details.");
 
             BOOST_LOG_TRIVIAL(error) << ::curl_easy_strerror(ec);
+        } else if ((share = ::curl_share_init()) != nullptr) {
+            // Requests running one after the other (update checks, print host status polling) reuse the resolved
+            // addresses, the TLS sessions and the open connections instead of starting from scratch.
+            ::curl_share_setopt(share, CURLSHOPT_LOCKFUNC, share_lock);
+            ::curl_share_setopt(share, CURLSHOPT_UNLOCKFUNC, share_unlock);
+            ::curl_share_setopt(share, CURLSHOPT_USERDATA, this);
+            ::curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+            ::curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+#if LIBCURL_VERSION_NUM >= 0x074400
+            // Sharing of the connection cache is thread safe since curl 7.68.0
+            ::curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+#endif
         }
     }
 
-	~CurlGlobalInit() { ::curl_global_cleanup(); }
+	~CurlGlobalInit()
+    {
+        if (share)
+            ::curl_share_cleanup(share);
+        ::curl_global_cleanup();
+    }
+
+    // Shared by all the requests, see Http::priv::priv()
+    ::CURLSH *share = nullptr;
+
+private:
+    std::array<std::mutex, CURL_LOCK_DATA_LAST> share_mutexes;
+
+    static void share_lock(::CURL *, ::curl_lock_data data, ::curl_lock_access, void *userp)
+    {
+        static_cast<CurlGlobalInit*>(userp)->share_mutexes[data].lock();
+    }
+    static void share_unlock(::CURL *, ::curl_lock_data data, void *userp)
+    {
+        static_cast<CurlGlobalInit*>(userp)->share_mutexes[data].unlock();
+    }
 };
 
 std::unique_ptr<CurlGlobalInit> CurlGlobalInit::instance;
@@ -106,6 +141,8 @@ struct Http::priv
 		DEFAULT_TIMEOUT_CONNECT = 10,
         DEFAULT_TIMEOUT_MAX = 0,
 		DEFAULT_SIZE_LIMIT = 5 * 1024 * 1024,
+		// Upload chunk size, the curl default is 64kB.
+		UPLOAD_BUFFER_SIZE = 512 * 1024,
 	};
 
 	::CURL *curl;
@@ -128,12 +165,14 @@ struct Http::priv
 	Http::ErrorFn errorfn;
 	Http::ProgressFn progressfn;
 	Http::IPResolveFn ipresolvefn;
+	Http::HeaderFn headerfn;
 
 	priv(const std::string &url);
 	~priv();
 
 	static bool ca_file_supported(::CURL *curl);
 	static size_t writecb(void *data, size_t size, size_t nmemb, void *userp);
+	static size_t headercb(char *data, size_t size, size_t nitems, void *userp);
 	static int xfercb(void *userp, curl_off_t dltotal, curl_off_t dlnow, curl_off_t ultotal, curl_off_t ulnow);
 	static int xfercb_legacy(void *userp, double dltotal, double dlnow, double ultotal, double ulnow);
 	static size_t form_file_read_cb(char *buffer, size_t size, size_t nitems, void *userp);
@@ -166,11 +205,19 @@ Http::priv::priv(const std::string &url)
 		throw Slic3r::RuntimeError(std::string("Could not construct Curl object"));
 	}
 
+	if (CurlGlobalInit::instance->share)
+		::curl_easy_setopt(curl, CURLOPT_SHARE, CurlGlobalInit::instance->share);
+
 	set_timeout_connect(DEFAULT_TIMEOUT_CONNECT);
     set_timeout_max(DEFAULT_TIMEOUT_MAX);
 	::curl_easy_setopt(curl, CURLOPT_URL, url.c_str());   // curl makes a copy internally
 	::curl_easy_setopt(curl, CURLOPT_USERAGENT, SLIC3R_APP_NAME "/" SLIC3R_VERSION);
 	::curl_easy_setopt(curl, CURLOPT_ERRORBUFFER, &error_buffer.front());
+#if LIBCURL_VERSION_NUM >= 0x073E00
+	// Larger chunks read from the G-code file and sent per callback speed up uploads over high latency links
+	// such as Wi-Fi, and reduce the number of progress callbacks checking for cancellation.
+	::curl_easy_setopt(curl, CURLOPT_UPLOAD_BUFFERSIZE, long(UPLOAD_BUFFER_SIZE));
+#endif
 }
 
 Http::priv::~priv()
@@ -220,6 +267,22 @@ size_t Http::priv::writecb(void *data, size_t size, size_t nmemb, void *userp)
 	return realsize;
 }
 
+size_t Http::priv::headercb(char *data, size_t size, size_t nitems, void *userp)
+{
+	auto self = static_cast<priv*>(userp);
+	const size_t realsize = size * nitems;
+	// The status line and the empty line ending the header don't contain a colon.
+	std::string line(data, realsize);
+	if (size_t colon = line.find(':'); colon != std::string::npos) {
+		std::string name = line.substr(0, colon);
+		std::string value = line.substr(colon + 1);
+		boost::algorithm::trim(name);
+		boost::algorithm::trim(value);
+		self->headerfn(std::move(name), std::move(value));
+	}
+	return realsize;
+}
+
 int Http::priv::xfercb(void *userp, curl_off_t dltotal, curl_off_t dlnow, curl_off_t ultotal, curl_off_t ulnow)
 {
 	auto self = static_cast<priv*>(userp);
@@ -340,6 +403,10 @@ void Http::priv::http_perform()
 	::curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, writecb);
 	::curl_easy_setopt(curl, CURLOPT_WRITEDATA, static_cast<void*>(this));
 	::curl_easy_setopt(curl, CURLOPT_READFUNCTION, form_file_read_cb);
+	if (headerfn) {
+		::curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, headercb);
+		::curl_easy_setopt(curl, CURLOPT_HEADERDATA, static_cast<void*>(this));
+	}
 
 	::curl_easy_setopt(curl, CURLOPT_NOPROGRESS, 0L);
 #if LIBCURL_VERSION_MAJOR >= 7 && LIBCURL_VERSION_MINOR >= 32
@@ -473,6 +540,22 @@ Http& Http::remove_header(std::string name)
 	return *this;
 }
 
+Http& Http::accept_encoding()
+{
+	// An empty string enables all the encodings supported by curl.
+	if (p) { ::curl_easy_setopt(p->curl, CURLOPT_ACCEPT_ENCODING, ""); }
+	return *this;
+}
+
+Http& Http::if_modified_since(time_t time)
+{
+	if (p) {
+		::curl_easy_setopt(p->curl, CURLOPT_TIMECONDITION, long(CURL_TIMECOND_IFMODSINCE));
+		::curl_easy_setopt(p->curl, CURLOPT_TIMEVALUE, long(time));
+	}
+	return *this;
+}
+
 // Authorization by HTTP digest, based on RFC2617.
 Http& Http::auth_digest(const std::string &user, const std::string &password)
 {
@@ -580,6 +663,12 @@ Http& Http::on_ip_resolve(IPResolveFn fn)
 	return *this;
 }
 
+Http& Http::on_header(HeaderFn fn)
+{
+	if (p) { p->headerfn = std::move(fn); }
+	return *this;
+}
+
 Http::Ptr Http::perform()
 {
 	auto self = std::make_shared<Http>(std::move(*this));
@@ -1,6 +1,7 @@
 #ifndef slic3r_Http_hpp_
 #define slic3r_Http_hpp_
 
+#include <ctime>
 #include <memory>
 #include <string>
 #include <functional>
@@ -44,6 +45,9 @@ public:
 
 	typedef std::function<void(std::string/* address */)> IPResolveFn;
 
+	// Called for each header field of the response, with the name and the value trimmed.
+	typedef std::function<void(std::string /* name */, std::string /* value */)> HeaderFn;
+
 	Http(Http &&other);
 
 	// Note: strings are expected to be UTF-8-encoded
@@ -72,6 +76,11 @@ public:
 	Http& header(std::string name, const std::string &value);
 	// Removes a header field.
 	Http& remove_header(std::string name);
+	// Asks for a compressed response body (gzip, deflate), which is decompressed transparently.
+	Http& accept_encoding();
+	// Sets the If-Modified-Since header field, a response with status 304 and no body is received
+	// if the resource was not modified since the time.
+	Http& if_modified_since(time_t time);
 	// Authorization by HTTP digest, based on RFC2617.
 	Http& auth_digest(const std::string &user, const std::string &password);
     // Basic HTTP authorization
@@ -121,6 +130,8 @@ public:
 	// Callback called after succesful HTTP request (after on_complete callback)
 	// Called if curl_easy_getinfo resolved just used IP address.
 	Http& on_ip_resolve(IPResolveFn fn);
+	// Callback called for each header field of the response, before on_complete or on_error callback.
+	Http& on_header(HeaderFn fn);
 
 	// Starts performing the request in a background thread
 	Ptr perform();
@@ -1,6 +1,7 @@
 #include "PresetUpdater.hpp"
 
 #include <algorithm>
+#include <ctime>
 #include <thread>
 #include <unordered_map>
 #include <ostream>
@@ -53,6 +54,18 @@ static const char *INDEX_FILENAME = "index.idx";
 static const char *TMP_EXTENSION = ".download";
 
 namespace {
+// Does the file exist with exactly this content?
+bool file_content_equal(const fs::path &path, const std::string &content)
+{
+	boost::system::error_code ec;
+	if (fs::file_size(path, ec) != content.size() || ec)
+		return false;
+	fs::ifstream file(path, std::ios::in | std::ios::binary);
+	std::string data(content.size(), '\0');
+	file.read(data.data(), data.size());
+	return bool(file) && data == content;
+}
+
 void copy_file_fix(const fs::path &source, const fs::path &target)
 {
 	BOOST_LOG_TRIVIAL(debug) << format("PresetUpdater: Copying %1% -> %2%", source, target);
@@ -174,18 +187,27 @@ struct PresetUpdater::priv
 	priv();
 
 	void set_download_prefs(const AppConfig *app_config);
-	bool get_file(const std::string &url, const fs::path &target_path) const;
+	bool get_file(const std::string &url, const fs::path &target_path, bool *not_modified = nullptr) const;
 	void prune_tmps() const;
 	void sync_config(const VendorMap vendors, const std::string& index_archive_url);
 
+	// Bundles, whose resources were found complete by sync_config(), with the stamp of the files the check depended on.
+	// Parsing of these bundles is skipped by sync_config() until the files change.
+	std::map<std::string, std::string> checked_bundles;
+	void load_checked_bundles();
+	void save_checked_bundles() const;
+	bool bundle_checked(const fs::path &bundle_path, std::initializer_list<fs::path> files) const;
+	void set_bundle_checked(const fs::path &bundle_path, std::initializer_list<fs::path> files);
+
 	void check_install_indices() const;
 	Updates get_config_updates(const Semver& old_slic3r_version) const;
 	bool perform_updates(Updates &&updates, bool snapshot = true) const;
 	void set_waiting_updates(Updates u);
 	// checks existence and downloads resource to cache
-	void get_missing_resource(const std::string& vendor, const std::string& filename, const std::string& url) const; 
+	// returns false if the resource is missing and could not be downloaded
+	bool get_missing_resource(const std::string& vendor, const std::string& filename, const std::string& url) const; 
 	// checks existence and downloads resource to vendor or copy from cache to vendor
-	void get_or_copy_missing_resource(const std::string& vendor, const std::string& filename, const std::string& url) const;
+	bool get_or_copy_missing_resource(const std::string& vendor, const std::string& filename, const std::string& url) const;
 	void update_index_db();
 };
 
@@ -217,18 +239,42 @@ void PresetUpdater::priv::set_download_prefs(const AppConfig *app_config)
 }
 
 // Downloads a file (http get operation). Cancels if the Updater is being destroyed.
-bool PresetUpdater::priv::get_file(const std::string &url, const fs::path &target_path) const
+// If not_modified is passed, the file is downloaded only if it was modified on the server since it was downloaded into target_path,
+// as told by its ETag or by its modification time. Then *not_modified is set if the existing file is up to date.
+bool PresetUpdater::priv::get_file(const std::string &url, const fs::path &target_path, bool *not_modified) const
 {
 	bool res = false;
 	fs::path tmp_path = target_path;
 	tmp_path += format(".%1%%2%", get_current_pid(), TMP_EXTENSION);
+	fs::path etag_path = target_path;
+	etag_path += ".etag";
 
 	BOOST_LOG_TRIVIAL(info) << format("Get: `%1%`\n\t-> `%2%`\n\tvia tmp path `%3%`",
 		url,
 		target_path.string(),
 		tmp_path.string());
 
-	Http::get(url)
+	Http http = Http::get(url);
+	// The bundles are text files, which compress well.
+	http.accept_encoding();
+	if (not_modified != nullptr) {
+		*not_modified = false;
+		if (fs::exists(target_path)) {
+			std::string etag;
+			if (fs::exists(etag_path)) {
+				fs::ifstream file(etag_path);
+				std::getline(file, etag);
+			}
+			if (! etag.empty())
+				http.header("If-None-Match", etag);
+			http.if_modified_since(fs::last_write_time(target_path));
+		}
+	}
+	std::string new_etag;
+	http.on_header([&new_etag](std::string name, std::string value) {
+			if (boost::iequals(name, "ETag"))
+				new_etag = std::move(value);
+		})
         .on_progress([](Http::Progress, bool &cancel) {
 			if (cancel) { cancel = true; }
 		})
@@ -239,11 +285,29 @@ bool PresetUpdater::priv::get_file(const std::string &url, const fs::path &targe
 				http_status,
 				error);
 		})
-		.on_complete([&](std::string body, unsigned /* http_status */) {
+		.on_complete([&](std::string body, unsigned http_status) {
+			if (http_status == 304) {
+				// Only a conditional request is answered by "Not Modified".
+				if (not_modified != nullptr) {
+					BOOST_LOG_TRIVIAL(info) << format("Not modified: `%1%`", url);
+					*not_modified = true;
+					res = true;
+				}
+				return;
+			}
 			fs::fstream file(tmp_path, std::ios::out | std::ios::binary | std::ios::trunc);
 			file.write(body.c_str(), body.size());
 			file.close();
 			fs::rename(tmp_path, target_path);
+			if (not_modified != nullptr) {
+				boost::system::error_code ec;
+				if (new_etag.empty())
+					fs::remove(etag_path, ec);
+				else {
+					fs::ofstream etag_file(etag_path, std::ios::out | std::ios::trunc);
+					etag_file << new_etag;
+				}
+			}
 			res = true;
 		})
 		.perform_sync();
@@ -251,6 +315,54 @@ bool PresetUpdater::priv::get_file(const std::string &url, const fs::path &targe
 	return res;
 }
 
+// Identifies the state of the files by their sizes and modification times. Empty if any of the files is missing.
+static std::string files_stamp(std::initializer_list<fs::path> paths)
+{
+	std::string stamp;
+	for (const fs::path &path : paths) {
+		boost::system::error_code ec;
+		const uintmax_t size = fs::file_size(path, ec);
+		if (ec)
+			return {};
+		const std::time_t time = fs::last_write_time(path, ec);
+		if (ec)
+			return {};
+		stamp += format("%1%:%2%;", size, time);
+	}
+	return stamp;
+}
+
+void PresetUpdater::priv::load_checked_bundles()
+{
+	checked_bundles.clear();
+	fs::ifstream file(cache_path / "checked_bundles");
+	// Each line contains the stamp followed by the bundle path.
+	for (std::string line; std::getline(file, line);)
+		if (size_t space = line.find(' '); space != std::string::npos)
+			checked_bundles[line.substr(space + 1)] = line.substr(0, space);
+}
+
+void PresetUpdater::priv::save_checked_bundles() const
+{
+	fs::ofstream file(cache_path / "checked_bundles", std::ios::out | std::ios::trunc);
+	for (const auto &[path, stamp] : checked_bundles)
+		file << stamp << " " << path << "\n";
+}
+
+bool PresetUpdater::priv::bundle_checked(const fs::path &bundle_path, std::initializer_list<fs::path> files) const
+{
+	auto it = checked_bundles.find(bundle_path.string());
+	return it != checked_bundles.end() && it->second == files_stamp(files);
+}
+
+void PresetUpdater::priv::set_bundle_checked(const fs::path &bundle_path, std::initializer_list<fs::path> files)
+{
+	if (std::string stamp = files_stamp(files); stamp.empty())
+		checked_bundles.erase(bundle_path.string());
+	else
+		checked_bundles[bundle_path.string()] = std::move(stamp);
+}
+
 // Remove leftover paritally downloaded files, if any.
 void PresetUpdater::priv::prune_tmps() const
 {
@@ -261,10 +373,10 @@ void PresetUpdater::priv::prune_tmps() const
 		}
 }
 
-void PresetUpdater::priv::get_missing_resource(const std::string& vendor, const std::string& filename, const std::string& url) const
+bool PresetUpdater::priv::get_missing_resource(const std::string& vendor, const std::string& filename, const std::string& url) const
 {
 	if (filename.empty() || vendor.empty())
-		return;
+		return true;
 
 	if (!boost::starts_with(url, "http://files.prusa3d.com/wp-content/uploads/repository/") &&
 		!boost::starts_with(url, "https://files.prusa3d.com/wp-content/uploads/repository/"))
@@ -279,15 +391,15 @@ void PresetUpdater::priv::get_missing_resource(const std::string& vendor, const
 
 	if (fs::exists(file_in_vendor)) { // Already in vendor. No need to do anything.
 		BOOST_LOG_TRIVIAL(info) << "Resource " << vendor << " / " << filename << " found in vendor folder. No need to download.";
-		return;
+		return true;
 	}
 	if (fs::exists(file_in_rsrc)) { // In resources dir since installation. No need to do anything.
 		BOOST_LOG_TRIVIAL(info) << "Resource " << vendor << " / " << filename << " found in resources folder. No need to download.";
-		return;
+		return true;
 	}
 	if (fs::exists(file_in_cache)) { // In cache/venodr_name/ dir. No need to do anything.
 		BOOST_LOG_TRIVIAL(info) << "Resource " << vendor << " / " << filename << " found in cache folder. No need to download.";
-		return;
+		return true;
 	}
 
 	BOOST_LOG_TRIVIAL(info) << "Resources check could not find " << vendor << " / " << filename << " bed texture. Downloading.";
@@ -297,14 +409,13 @@ void PresetUpdater::priv::get_missing_resource(const std::string& vendor, const
 	if (!fs::exists(file_in_cache.parent_path()))
 		fs::create_directory(file_in_cache.parent_path());
 
-	get_file(resource_url, file_in_cache);
-	return;
+	return get_file(resource_url, file_in_cache);
 }
 
-void PresetUpdater::priv::get_or_copy_missing_resource(const std::string& vendor, const std::string& filename, const std::string& url) const
+bool PresetUpdater::priv::get_or_copy_missing_resource(const std::string& vendor, const std::string& filename, const std::string& url) const
 {
 	if (filename.empty() || vendor.empty())
-		return;
+		return true;
 
 	std::string escaped_filename = escape_string_url(filename);
 	const fs::path file_in_vendor(vendor_path / (vendor + "/" + filename));
@@ -313,11 +424,11 @@ void PresetUpdater::priv::get_or_copy_missing_resource(const std::string& vendor
 
 	if (fs::exists(file_in_vendor)) { // Already in vendor. No need to do anything.
 		BOOST_LOG_TRIVIAL(info) << "Resource " << vendor << " / " << filename << " found in vendor folder. No need to download.";
-		return;
+		return true;
 	}
 	if (fs::exists(file_in_rsrc)) { // In resources dir since installation. No need to do anything.
 		BOOST_LOG_TRIVIAL(info) << "Resource " << vendor << " / " << filename << " found in resources folder. No need to download.";
-		return;
+		return true;
 	}
 	if (!fs::exists(file_in_cache)) { // No file to copy. Download it to straight to the vendor dir.
 		if (!boost::starts_with(url, "http://files.prusa3d.com/wp-content/uploads/repository/") &&
@@ -332,8 +443,7 @@ void PresetUpdater::priv::get_or_copy_missing_resource(const std::string& vendor
 		if (!fs::exists(file_in_vendor.parent_path()))
 			fs::create_directory(file_in_vendor.parent_path());
 
-		get_file(resource_url, file_in_vendor);
-		return;
+		return get_file(resource_url, file_in_vendor);
 	}
 
 	if (!fs::exists(file_in_vendor.parent_path())) // create vendor_name dir in vendor 
@@ -341,6 +451,7 @@ void PresetUpdater::priv::get_or_copy_missing_resource(const std::string& vendor
 
 	BOOST_LOG_TRIVIAL(debug) << "Copiing: " << file_in_cache << " to " << file_in_vendor;
 	copy_file_fix(file_in_cache, file_in_vendor);
+	return true;
 }
 
 // Download vendor indices. Also download new bundles if an index indicates there's a new one available.
@@ -367,13 +478,16 @@ void PresetUpdater::priv::sync_config(const VendorMap vendors, const std::string
 		BOOST_LOG_TRIVIAL(error) << "Unsafe url path for vedor profiles archive zip. Download is rejected.";
 		return;
 	}
-	if (!get_file(index_archive_url, archive_path)) {
+	// The archive is downloaded only if it changed since the last download.
+	bool archive_not_modified = false;
+	if (!get_file(index_archive_url, archive_path, &archive_not_modified)) {
 		BOOST_LOG_TRIVIAL(error) << "Download of vedor profiles archive zip failed.";
 		return;
 	}
 	if (cancel) { 
 		return; 
 	}
+	load_checked_bundles();
 
 	enum class VendorStatus
 	{
@@ -384,11 +498,22 @@ void PresetUpdater::priv::sync_config(const VendorMap vendors, const std::string
 	};
 
 	std::vector<std::pair<std::string, VendorStatus>> vendors_with_status;
+	// Make the next run download the archive again if it could not be unzipped.
+	auto invalidate_archive = [&archive_path]() {
+		boost::system::error_code ec;
+		fs::remove(archive_path, ec);
+	};
 	// Unzip archive to cache / vendor
 	mz_zip_archive archive;
 	mz_zip_zero_struct(&archive);
-	if (!open_zip_reader(&archive, archive_path.string())) {
+	if (archive_not_modified) {
+		// The archive was unzipped when it was downloaded.
+		for (auto &dir_entry : boost::filesystem::directory_iterator(cache_vendor_path))
+			if (is_idx_file(dir_entry))
+				vendors_with_status.emplace_back(dir_entry.path().stem().string(), VendorStatus::IN_ARCHIVE); // asume for now its only in archive - if not, it will change later.
+	} else if (!open_zip_reader(&archive, archive_path.string())) {
 		BOOST_LOG_TRIVIAL(error) << "Couldn't open zipped bundle.";
+		invalidate_archive();
 		return;
 	} else {
 		mz_uint num_entries = mz_zip_reader_get_num_files(&archive);
@@ -411,6 +536,12 @@ void PresetUpdater::priv::sync_config(const VendorMap vendors, const std::string
 						continue;
 					}
 					fs::path target_path(cache_vendor_path / name);
+					if (file_content_equal(target_path, buffer)) {
+						// Keep the modification time of an unchanged file, so that the bundles depending on it are not checked again.
+						if (name.substr(name.size() - 3) == "idx")
+							vendors_with_status.emplace_back(name.substr(0, name.size() - 4), VendorStatus::IN_ARCHIVE);
+						continue;
+					}
 					fs::fstream file(tmp_path, std::ios::out | std::ios::binary | std::ios::trunc);
 					file.write(buffer.c_str(), buffer.size());
 					file.close();
@@ -419,12 +550,14 @@ void PresetUpdater::priv::sync_config(const VendorMap vendors, const std::string
 					if(!exists || ec) {
 						BOOST_LOG_TRIVIAL(error) << "Failed to find unzipped file at " << tmp_path << ". Terminating Preset updater synchorinzation." ;
 						close_zip_reader(&archive);
+						invalidate_archive();
 						return;
 					}
 					fs::rename(tmp_path, target_path, ec);
 					if (ec) {
 						BOOST_LOG_TRIVIAL(error) << "Failed to rename unzipped file at " << tmp_path << ". Terminating Preset updater synchorinzation. Error message: " << ec.message();
 						close_zip_reader(&archive);
+						invalidate_archive();
 						return;
 					}
 					// TODO: what if unexpected happens here (folder inside zip) - crash! 
@@ -558,6 +691,8 @@ void PresetUpdater::priv::sync_config(const VendorMap vendors, const std::string
 			const auto ini_path_in_archive = cache_vendor_path / (vendor.first + ".ini");
 			if (!fs::exists(idx_path_in_archive))
 				continue;
+			if (bundle_checked(ini_path_in_archive, { idx_path_in_archive, ini_path_in_archive }))
+				continue;
 			Index index;
 			try {
 				index.load(idx_path_in_archive);
@@ -604,20 +739,24 @@ void PresetUpdater::priv::sync_config(const VendorMap vendors, const std::string
 				BOOST_LOG_TRIVIAL(error) << format("Corrupted profile file for vendor %1% at %2%, message: %3%", vendor.first, ini_path_in_archive, e.what());
 				continue;
 			}
+			bool resources_complete = true;
 			for (const auto& model : vp.models) {
 				if (!model.thumbnail.empty()) {
 					try
 					{
-						get_missing_resource(vp.id, model.thumbnail, vp.config_update_url);
+						resources_complete &= get_missing_resource(vp.id, model.thumbnail, vp.config_update_url);
 					}
 					catch (const std::exception& e)
 					{
 						BOOST_LOG_TRIVIAL(error) << "Failed to get " << model.thumbnail << " for " << vp.id << " " << model.id << ": " << e.what();
+						resources_complete = false;
 					}
 				}
 				if (cancel)
 					return;
 			}
+			if (resources_complete)
+				set_bundle_checked(ini_path_in_archive, { idx_path_in_archive, ini_path_in_archive });
 		} else if (vendor.second == VendorStatus::IN_CACHE) {
 			// find those where archive index recommends other version than index in cache and get it if not present
 			const auto idx_path_in_archive = cache_vendor_path / (vendor.first + ".idx");
@@ -626,6 +765,8 @@ void PresetUpdater::priv::sync_config(const VendorMap vendors, const std::string
 
 			if (!fs::exists(idx_path_in_archive) || !fs::exists(idx_path_in_cache))
 					continue;
+			if (bundle_checked(ini_path_in_archive, { idx_path_in_archive, idx_path_in_cache, ini_path_in_archive }))
+				continue;
 
 			// Compare index in cache and recetly downloaded one as part of zip archive
 			Index index_cache;
@@ -720,20 +861,24 @@ void PresetUpdater::priv::sync_config(const VendorMap vendors, const std::string
 				BOOST_LOG_TRIVIAL(error) << format("Corrupted profile file for vendor %1% at %2%, message: %3%", vendor.first, ini_path_in_archive, e.what());
 				continue;
 			}
+			bool resources_complete = true;
 			for (const auto& model : vp.models) {
 				if (!model.thumbnail.empty()) {
 					try
 					{
-						get_missing_resource(vp.id, model.thumbnail, vp.config_update_url);
+						resources_complete &= get_missing_resource(vp.id, model.thumbnail, vp.config_update_url);
 					}
 					catch (const std::exception& e)
 					{
 						BOOST_LOG_TRIVIAL(error) << "Failed to get " << model.thumbnail << " for " << vp.id << " " << model.id << ": " << e.what();
+						resources_complete = false;
 					}
 				}
 				if (cancel)
 					return;
 			}
+			if (resources_complete)
+				set_bundle_checked(ini_path_in_archive, { idx_path_in_archive, idx_path_in_cache, ini_path_in_archive });
 		} else if (vendor.second == VendorStatus::INSTALLED || vendor.second == VendorStatus::NEW_VERSION) {
 			// Installed vendors need to check that no resource is missing. Do this only for files in vendor folder (not in resorces)
 			// VendorStatus::NEW_VERSION might seem like a mistake here since files are downloaded when preparing update higher in this function. 
@@ -741,6 +886,8 @@ void PresetUpdater::priv::sync_config(const VendorMap vendors, const std::string
 			const auto path_in_vendor = vendor_path / (vendor.first + ".ini");
 			if(!fs::exists(path_in_vendor))
 				continue;
+			if (bundle_checked(path_in_vendor, { path_in_vendor }))
+				continue;
 			VendorProfile vp;
 			try {
 				vp = VendorProfile::from_ini(path_in_vendor, true);
@@ -749,24 +896,29 @@ void PresetUpdater::priv::sync_config(const VendorMap vendors, const std::string
 				BOOST_LOG_TRIVIAL(error) << format("Corrupted profile file for vendor %1% at %2%, message: %3%", vendor.first, path_in_vendor, e.what());
 				continue;
 			}
+			bool resources_complete = true;
 			for (const auto& model : vp.models) {
 				for (const std::string& res : { model.bed_texture, model.bed_model, model.thumbnail }) {
 					if (!model.thumbnail.empty()) {
 						try
 						{
-							get_or_copy_missing_resource(vp.id, res, vp.config_update_url);
+							resources_complete &= get_or_copy_missing_resource(vp.id, res, vp.config_update_url);
 						}
 						catch (const std::exception& e)
 						{
 							BOOST_LOG_TRIVIAL(error) << "Failed to get " << model.thumbnail << " for " << vp.id << " " << model.id << ": " << e.what();
+							resources_complete = false;
 						}
 					}
 					if (cancel)
 						return;
 				}
 			}
+			if (resources_complete)
+				set_bundle_checked(path_in_vendor, { path_in_vendor });
 		}
 	}
+	save_checked_bundles();
 }
 
 // Install indicies from resources. Only installs those that are either missing or older than in resources.
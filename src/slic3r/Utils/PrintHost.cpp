@@ -1,5 +1,10 @@
 #include "PrintHost.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <map>
+#include <mutex>
 #include <vector>
 #include <thread>
 #include <exception>
@@ -20,6 +25,8 @@
 #include "Repetier.hpp"
 #include "MKS.hpp"
 #include "../GUI/PrintHostDialogs.hpp"
+#include "../GUI/GUI.hpp"
+#include "libslic3r/AppConfig.hpp"
 
 namespace fs = boost::filesystem;
 using boost::optional;
@@ -74,36 +81,53 @@ wxString PrintHost::format_error(const std::string &body, const std::string &err
 
 struct PrintHostJobQueue::priv
 {
-    // XXX: comment on how bg thread works
+    // Jobs are uploaded by a pool of background threads picking them up from channel_jobs.
+    // Uploads to distinct hosts run concurrently, uploads to a single host are serialized.
+    // Job ids are assigned at enqueueing and match the rows of the queue dialog.
+
+    struct Job
+    {
+        size_t       id = 0;
+        PrintHostJob job;
+    };
 
     PrintHostJobQueue *q;
 
-    Channel<PrintHostJob> channel_jobs;
+    Channel<Job> channel_jobs;
     Channel<size_t> channel_cancels;
-    size_t job_id = 0;
-    int prev_progress = -1;
-    fs::path source_to_remove;
+    size_t next_job_id = 0;
 
-    std::thread bg_thread;
-    bool bg_exit = false;
+    // Jobs enqueued and not finished yet by their ids, mapped to whether the job was cancelled after a background thread picked it up.
+    // A job is removed once finished, thus a cancel request arriving for a finished job is ignored.
+    std::mutex             cancelled_mutex;
+    std::map<size_t, bool> unfinished_jobs;
+
+    // Serializes uploads to a single host.
+    std::mutex                                         hosts_mutex;
+    std::map<std::string, std::shared_ptr<std::mutex>> host_mutexes;
+
+    std::vector<std::thread> bg_threads;
+    std::atomic<bool> bg_exit { false };
 
     PrintHostQueueDialog *queue_dialog;
 
     priv(PrintHostJobQueue *q) : q(q) {}
 
-    void emit_progress(int progress);
-    void emit_error(wxString error);
+    void emit_progress(size_t id, int progress);
+    void emit_error(size_t id, wxString error);
     void emit_cancel(size_t id);
-    void emit_info(wxString tag, wxString status);
+    void emit_info(size_t id, wxString tag, wxString status);
     void start_bg_thread();
     void stop_bg_thread();
     void bg_thread_main();
-    void progress_fn(Http::Progress progress, bool &cancel);
-    void error_fn(wxString error);
-    void info_fn(wxString tag, wxString status);
+    void process_cancels();
+    bool is_cancelled(size_t id);
+    void finish_job(size_t id);
+    void progress_fn(size_t id, int &prev_progress, Http::Progress progress, bool &cancel);
+    void error_fn(size_t id, wxString error);
+    void info_fn(size_t id, wxString tag, wxString status);
     void remove_source(const fs::path &path);
-    void remove_source();
-    void perform_job(PrintHostJob the_job);
+    void perform_job(size_t id, PrintHostJob the_job);
 };
 
 PrintHostJobQueue::PrintHostJobQueue(PrintHostQueueDialog *queue_dialog)
@@ -117,21 +141,21 @@ PrintHostJobQueue::~PrintHostJobQueue()
     if (p) { p->stop_bg_thread(); }
 }
 
-void PrintHostJobQueue::priv::emit_progress(int progress)
+void PrintHostJobQueue::priv::emit_progress(size_t id, int progress)
 {
-    auto evt = new PrintHostQueueDialog::Event(GUI::EVT_PRINTHOST_PROGRESS, queue_dialog->GetId(), job_id, progress);
+    auto evt = new PrintHostQueueDialog::Event(GUI::EVT_PRINTHOST_PROGRESS, queue_dialog->GetId(), id, progress);
     wxQueueEvent(queue_dialog, evt);
 }
 
-void PrintHostJobQueue::priv::emit_error(wxString error)
+void PrintHostJobQueue::priv::emit_error(size_t id, wxString error)
 {
-    auto evt = new PrintHostQueueDialog::Event(GUI::EVT_PRINTHOST_ERROR, queue_dialog->GetId(), job_id, std::move(error));
+    auto evt = new PrintHostQueueDialog::Event(GUI::EVT_PRINTHOST_ERROR, queue_dialog->GetId(), id, std::move(error));
     wxQueueEvent(queue_dialog, evt);
 }
 
-void PrintHostJobQueue::priv::emit_info(wxString tag, wxString status)
+void PrintHostJobQueue::priv::emit_info(size_t id, wxString tag, wxString status)
 {
-    auto evt = new PrintHostQueueDialog::Event(GUI::EVT_PRINTHOST_INFO, queue_dialog->GetId(), job_id, std::move(tag), std::move(status));
+    auto evt = new PrintHostQueueDialog::Event(GUI::EVT_PRINTHOST_INFO, queue_dialog->GetId(), id, std::move(tag), std::move(status));
     wxQueueEvent(queue_dialog, evt);
 }
 
@@ -143,20 +167,28 @@ void PrintHostJobQueue::priv::emit_cancel(size_t id)
 
 void PrintHostJobQueue::priv::start_bg_thread()
 {
-    if (bg_thread.joinable()) { return; }
+    if (! bg_threads.empty()) { return; }
+
+    int num_threads = 4;
+    if (const std::string threads = GUI::get_app_config()->get("print_host_upload_threads"); ! threads.empty())
+        num_threads = std::clamp(std::atoi(threads.c_str()), 1, 16);
 
     std::shared_ptr<priv> p2 = q->p;
-    bg_thread = std::thread([p2]() {
-        p2->bg_thread_main();
-    });
+    for (int i = 0; i < num_threads; ++ i)
+        bg_threads.emplace_back([p2]() {
+            p2->bg_thread_main();
+        });
 }
 
 void PrintHostJobQueue::priv::stop_bg_thread()
 {
-    if (bg_thread.joinable()) {
+    if (! bg_threads.empty()) {
         bg_exit = true;
-        channel_jobs.push(PrintHostJob()); // Push an empty job to wake up bg_thread in case it's sleeping
-        bg_thread.detach();                // Let the background thread go, it should exit on its own
+        for (std::thread &bg_thread : bg_threads) {
+            channel_jobs.push(Job()); // Push an empty job to wake up a bg_thread in case it's sleeping
+            bg_thread.detach();       // Let the background thread go, it should exit on its own
+        }
+        bg_threads.clear();
     }
 }
 
@@ -164,47 +196,102 @@ void PrintHostJobQueue::priv::bg_thread_main()
 {
     // bg thread entry point
 
+    size_t job_id = 0;
     try {
         // Pick up jobs from the job channel:
         while (! bg_exit) {
-            auto job = channel_jobs.pop();   // Sleeps in a cond var if there are no jobs
-            if (job.empty()) {
+            Job job = channel_jobs.pop();   // Sleeps in a cond var if there are no jobs
+            if (job.job.empty()) {
                 // This happens when the thread is being stopped
                 break;
             }
-
-            source_to_remove = job.upload_data.source_path;
+            job_id = job.id;
 
             BOOST_LOG_TRIVIAL(debug) << boost::format("PrintHostJobQueue/bg_thread: Received job: [%1%]: `%2%` -> `%3%`, cancelled: %4%")
-                % job_id
-                % job.upload_data.upload_path
-                % job.printhost->get_host()
-                % job.cancelled;
-
-            if (! job.cancelled) {
-                perform_job(std::move(job));
+                % job.id
+                % job.job.upload_data.upload_path
+                % job.job.printhost->get_host()
+                % job.job.cancelled;
+
+            const fs::path source_path = job.job.upload_data.source_path;
+            if (! job.job.cancelled) {
+                std::shared_ptr<std::mutex> host_mutex;
+                {
+                    std::lock_guard<std::mutex> lock(hosts_mutex);
+                    std::shared_ptr<std::mutex> &m = host_mutexes[job.job.printhost->get_host()];
+                    if (! m)
+                        m = std::make_shared<std::mutex>();
+                    host_mutex = m;
+                }
+                std::lock_guard<std::mutex> host_lock(*host_mutex);
+                // The job may have been cancelled while waiting for another upload to the same host.
+                process_cancels();
+                if (is_cancelled(job.id))
+                    emit_cancel(job.id);
+                else
+                    perform_job(job.id, std::move(job.job));
             }
 
-            remove_source();
-            job_id++;
+            remove_source(source_path);
+            finish_job(job.id);
         }
     } catch (const std::exception &e) {
-        emit_error(e.what());
+        finish_job(job_id);
+        emit_error(job_id, e.what());
     }
 
     // Cleanup leftover files, if any
-    remove_source();
     auto jobs = channel_jobs.lock_rw();
-    for (const PrintHostJob &job : *jobs) {
-        remove_source(job.upload_data.source_path);
+    for (const Job &job : *jobs) {
+        remove_source(job.job.upload_data.source_path);
     }
 }
 
-void PrintHostJobQueue::priv::progress_fn(Http::Progress progress, bool &cancel)
+void PrintHostJobQueue::priv::process_cancels()
+{
+    if (channel_cancels.size_hint() == 0)
+        return;
+
+    // Lock both queues
+    auto cancels = channel_cancels.lock_rw();
+    auto jobs = channel_jobs.lock_rw();
+
+    for (size_t cancel_id : *cancels) {
+        auto it = std::find_if(jobs->begin(), jobs->end(), [cancel_id](const Job &job) { return job.id == cancel_id && ! job.job.empty(); });
+        if (it != jobs->end()) {
+            // The job is still in the queue.
+            it->job.cancelled = true;
+            BOOST_LOG_TRIVIAL(debug) << boost::format("PrintHostJobQueue: Job id %1% cancelled") % cancel_id;
+            emit_cancel(cancel_id);
+        } else {
+            // The job was picked up already, or it is finished.
+            std::lock_guard<std::mutex> lock(cancelled_mutex);
+            if (auto it_unfinished = unfinished_jobs.find(cancel_id); it_unfinished != unfinished_jobs.end())
+                it_unfinished->second = true;
+        }
+    }
+
+    cancels->clear();
+}
+
+bool PrintHostJobQueue::priv::is_cancelled(size_t id)
+{
+    std::lock_guard<std::mutex> lock(cancelled_mutex);
+    auto it = unfinished_jobs.find(id);
+    return it != unfinished_jobs.end() && it->second;
+}
+
+void PrintHostJobQueue::priv::finish_job(size_t id)
+{
+    std::lock_guard<std::mutex> lock(cancelled_mutex);
+    unfinished_jobs.erase(id);
+}
+
+void PrintHostJobQueue::priv::progress_fn(size_t id, int &prev_progress, Http::Progress progress, bool &cancel)
 {
     if (cancel) {
         // When cancel is true from the start, Http indicates request has been cancelled
-        emit_cancel(job_id);
+        emit_cancel(id);
         return;
     }
 
@@ -213,68 +300,32 @@ void PrintHostJobQueue::priv::progress_fn(Http::Progress progress, bool &cancel)
         return;
     }
 
-    if (channel_cancels.size_hint() > 0) {
-        // Lock both queues
-        auto cancels = channel_cancels.lock_rw();
-        auto jobs = channel_jobs.lock_rw();
-
-        for (size_t cancel_id : *cancels) {
-            if (cancel_id == job_id) {
-                cancel = true;
-            } else if (cancel_id > job_id) {
-                const size_t idx = cancel_id - job_id - 1;
-                if (idx < jobs->size()) {
-                    jobs->at(idx).cancelled = true;
-                    BOOST_LOG_TRIVIAL(debug) << boost::format("PrintHostJobQueue: Job id %1% cancelled") % cancel_id;
-                    emit_cancel(cancel_id);
-                }
-            }
-        }
-
-        cancels->clear();
-    }
+    process_cancels();
+    if (is_cancelled(id))
+        cancel = true;
 
     if (! cancel) {
         int gui_progress = progress.ultotal > 0 ? 100*progress.ulnow / progress.ultotal : 0;
         if (gui_progress != prev_progress) {
-            emit_progress(gui_progress);
+            emit_progress(id, gui_progress);
             prev_progress = gui_progress;
         }
     }
 }
 
-void PrintHostJobQueue::priv::error_fn(wxString error)
+void PrintHostJobQueue::priv::error_fn(size_t id, wxString error)
 {
     // check if transfer was not canceled before error occured - than do not show the error
-    bool do_emit_err = true;
-    if (channel_cancels.size_hint() > 0) {
-        // Lock both queues
-        auto cancels = channel_cancels.lock_rw();
-        auto jobs = channel_jobs.lock_rw();
-
-        for (size_t cancel_id : *cancels) {
-            if (cancel_id == job_id) {
-                do_emit_err = false;
-                emit_cancel(job_id);
-            }
-            else if (cancel_id > job_id) {
-                const size_t idx = cancel_id - job_id - 1;
-                if (idx < jobs->size()) {
-                    jobs->at(idx).cancelled = true;
-                    BOOST_LOG_TRIVIAL(debug) << boost::format("PrintHostJobQueue: Job id %1% cancelled") % cancel_id;
-                    emit_cancel(cancel_id);
-                }
-            }
-        }
-        cancels->clear();
-    }
-    if (do_emit_err)
-        emit_error(std::move(error));
+    process_cancels();
+    if (is_cancelled(id))
+        emit_cancel(id);
+    else
+        emit_error(id, std::move(error));
 }
 
-void PrintHostJobQueue::priv::info_fn(wxString tag, wxString status)
+void PrintHostJobQueue::priv::info_fn(size_t id, wxString tag, wxString status)
 {
-    emit_info(tag, status);
+    emit_info(id, tag, status);
 }
 
 void PrintHostJobQueue::priv::remove_source(const fs::path &path)
@@ -288,24 +339,19 @@ void PrintHostJobQueue::priv::remove_source(const fs::path &path)
     }
 }
 
-void PrintHostJobQueue::priv::remove_source()
+void PrintHostJobQueue::priv::perform_job(size_t id, PrintHostJob the_job)
 {
-    remove_source(source_to_remove);
-    source_to_remove.clear();
-}
-
-void PrintHostJobQueue::priv::perform_job(PrintHostJob the_job)
-{
-    emit_progress(0);   // Indicate the upload is starting
+    emit_progress(id, 0);   // Indicate the upload is starting
 
+    int  prev_progress = -1;
     bool success = the_job.printhost->upload(std::move(the_job.upload_data),
-        [this](Http::Progress progress, bool &cancel)   { this->progress_fn(std::move(progress), cancel); },
-        [this](wxString error)                          { this->error_fn(std::move(error)); },
-        [this](wxString tag, wxString host)             { this->info_fn(std::move(tag), std::move(host)); }
+        [this, id, &prev_progress](Http::Progress progress, bool &cancel) { this->progress_fn(id, prev_progress, std::move(progress), cancel); },
+        [this, id](wxString error)                                        { this->error_fn(id, std::move(error)); },
+        [this, id](wxString tag, wxString host)                           { this->info_fn(id, std::move(tag), std::move(host)); }
     );
 
     if (success) {
-        emit_progress(100);
+        emit_progress(id, 100);
     }
 }
 
@@ -313,7 +359,12 @@ void PrintHostJobQueue::enqueue(PrintHostJob job)
 {
     p->start_bg_thread();
     p->queue_dialog->append_job(job);
-    p->channel_jobs.push(std::move(job));
+    const size_t id = p->next_job_id ++;
+    {
+        std::lock_guard<std::mutex> lock(p->cancelled_mutex);
+        p->unfinished_jobs.emplace(id, false);
+    }
+    p->channel_jobs.push(priv::Job{ id, std::move(job) });
 }
 
 void PrintHostJobQueue::cancel(size_t id)
@@ -7,6 +7,7 @@
 #include <typeinfo> 
 #include <cassert>
 #include <cstddef>
+#include <deque>
 
 #include <cereal/types/polymorphic.hpp>
 #include <cereal/types/map.hpp> 
@@ -24,6 +25,8 @@
 #include "slic3r/GUI/3DScene.hpp"
 
 #include <boost/foreach.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/iostreams/stream.hpp>
 
 #ifndef NDEBUG
 // #define SLIC3R_UNDOREDO_DEBUG
@@ -558,6 +561,7 @@ public:
 		m_current_time = 0;
 		m_saved_snapshot_time = size_t(-1);
 		m_selection.clear();
+		m_serialization_buffers.clear();
 	}
 
 	bool empty() const {
@@ -689,6 +693,10 @@ private:
 	size_t 													m_current_time;
 	// Last selection serialized or deserialized.
 	Selection 												m_selection;
+	// Serialization buffers of the mutable objects reused between snapshots, one per nesting level of save_mutable_object()
+	// (Model -> ModelObject -> ModelVolume). std::deque keeps the references to the outer levels valid when growing.
+	std::deque<std::string>									m_serialization_buffers;
+	size_t 													m_serialization_depth { 0 };
 };
 
 using InputArchive  = cereal::UserDataAdapter<StackImpl, cereal::BinaryInputArchive>;
@@ -836,13 +844,20 @@ template<typename T> ObjectID StackImpl::save_mutable_object(const T &object)
 			needs_to_save = ! object_history->try_save_timestamp(m_active_snapshot_time, m_current_time, timestamp);
 	}
 	if (needs_to_save) {
-		// Serialize the object into a string.
-		std::ostringstream oss;
+		// Serialize the object into a buffer retained from the previous snapshots, so that taking a snapshot
+		// of a larger project does not allocate and copy a new output stream for each of its mutable objects.
+		if (m_serialization_depth == m_serialization_buffers.size())
+			m_serialization_buffers.emplace_back();
+		std::string &buffer = m_serialization_buffers[m_serialization_depth ++];
+		// Leave the nesting level even if the serialization throws, so that the next snapshot starts at the outermost buffer.
+		ScopeGuard depth_guard([this]() { -- m_serialization_depth; });
+		buffer.clear();
 		{
-			Slic3r::UndoRedo::OutputArchive archive(*this, oss);
+			boost::iostreams::stream<boost::iostreams::back_insert_device<std::string>> os(buffer);
+			Slic3r::UndoRedo::OutputArchive archive(*this, os);
 			archive(object);
 		}
-		object_history->save(m_active_snapshot_time, m_current_time, oss.str());
+		object_history->save(m_active_snapshot_time, m_current_time, buffer);
 	}
 	return object.id();
 }
@@ -130,6 +130,19 @@ SCENARIO("Cooling unit tests", "[Cooling]") {
             bool ok = gcode.find("\nM107") > 0;
             REQUIRE(ok);      
         }
+        THEN("parsing the next layer ahead of emitting the previous one produces the same G-code") {
+            const std::string layer = gcode1 + "T1\nG1 X0 E1 F3000\nT0\n";
+            GCode gcodegen_ref;
+            auto  buffer_ref = make_cooling_buffer(gcodegen_ref, config, { 0, 1 });
+            std::string gcode_ref = buffer_ref->process_layer(layer, 0, true) + buffer_ref->process_layer(layer, 1, true);
+            GCode gcodegen_pipelined;
+            auto  buffer_pipelined = make_cooling_buffer(gcodegen_pipelined, config, { 0, 1 });
+            auto  parsed0 = buffer_pipelined->parse_layer(std::string(layer), 0, true);
+            auto  parsed1 = buffer_pipelined->parse_layer(std::string(layer), 1, true);
+            std::string gcode_pipelined = buffer_pipelined->apply_layer(std::move(parsed0));
+            gcode_pipelined += buffer_pipelined->apply_layer(std::move(parsed1));
+            REQUIRE(gcode_pipelined == gcode_ref);
+        }
     }
     WHEN("G-code block 2") {
         THEN("slowdown is computed on all objects printing at the same Z") {
@@ -713,3 +713,33 @@ bool test_if_solid_surface_filled(const ExPolygon& expolygon, double flow_spacin
 
     return uncovered.empty(); // solid surface is fully filled
 }
+
+TEST_CASE("Fill cache distinguishes layer parity", "[Fill]")
+{
+    REQUIRE(FillCache::cacheable(ipRectilinear));
+    REQUIRE(! FillCache::cacheable(ipGyroid));
+
+    FillCache::Key key;
+    key.pattern          = ipRectilinear;
+    key.expolygon        = ExPolygon(Polygon::new_scale({ { 0, 0 }, { 20, 0 }, { 20, 20 }, { 0, 20 } }));
+    key.bridge_angle     = -1.;
+    key.thickness_layers = 1;
+    key.odd_layer        = false;
+    key.angle            = float(M_PI / 4.);
+    key.spacing          = 0.45;
+    key.link_max_length  = 0;
+    key.params.density   = 0.2f;
+    key.update_hash();
+
+    FillCache::Key odd_key = key;
+    odd_key.odd_layer = true;
+    odd_key.update_hash();
+
+    FillCache cache;
+    cache.insert(FillCache::Key(key), std::make_shared<const FillCache::Value>(FillCache::Value{ { Polyline({ { 0, 0 }, { 10, 10 } }) }, 0.5 }));
+    std::shared_ptr<const FillCache::Value> cached = cache.find(key);
+    REQUIRE(cached);
+    REQUIRE(cached->polylines.size() == 1);
+    REQUIRE(cached->spacing == Approx(0.5));
+    REQUIRE(! cache.find(odd_key));
+}
@@ -96,6 +96,18 @@ SCENARIO("Find/Replace with plain text", "[GCodeFindReplace]") {
             GCodeFindReplace find_replace({ "move up\\nG1 X", "move down\\nG0 X", "w", "" });
             REQUIRE(find_replace.process_layer(gcode) == gcode);
         }
+        // Substitutions are applied in order, each one seeing the output of the previous ones.
+        WHEN("Replace \"move up\" with \"move down\", then regex \"move (down|up)\" with \"travel $1\"") {
+            GCodeFindReplace find_replace({ "move up", "move down", "", "", "move (down|up)", "travel ${1}", "r", "" });
+            std::string gcode_copy = gcode;
+            REQUIRE(find_replace.process_layer(std::move(gcode_copy)) ==
+                "G1 Z0; home\n"
+                // substituted twice
+                "G1 Z1; travel down\n"
+                "G1 X0 Y1 Z1; perimeter\n"
+                "G1 X13 Y32 Z1; infill\n"
+                "G1 X13 Y32 Z1; wipe\n");
+        }
     }
 
     GIVEN("G-code with decimals") {
@@ -627,3 +627,44 @@ SCENARIO("Seam alignment", "[Perimeters]")
         test(Slic3r::Test::TestMesh::small_dorito);
     }
 }
+
+TEST_CASE("Arachne perimeters are reused for identical outlines", "[Perimeters]")
+{
+    FullPrintConfig config;
+    config.set_deserialize_strict({ { "perimeter_generator", "arachne" }, { "perimeters", 3 } });
+
+    Flow flow(0.45f, 0.2f, 0.4f);
+    PerimeterGenerator::Parameters params(
+        0.2, // layer height
+        1,   // layer ID
+        flow, flow, flow, flow,
+        static_cast<const PrintRegionConfig&>(config),
+        static_cast<const PrintObjectConfig&>(config),
+        static_cast<const PrintConfig&>(config),
+        false); // spiral_vase
+    // 20x20mm square with a 5x5mm square hole.
+    ExPolygon expoly;
+    expoly.contour = Polygon::new_scale({ { 0, 0 }, { 20, 0 }, { 20, 20 }, { 0, 20 } });
+    expoly.holes.emplace_back(Polygon::new_scale({ { 5, 5 }, { 5, 10 }, { 10, 10 }, { 10, 5 } }));
+    Surface surface(stInternal, expoly);
+
+    auto generate = [&params, &surface]() {
+        ExtrusionEntityCollection loops;
+        ExtrusionEntityCollection gap_fill;
+        ExPolygons                fill_expolygons;
+        Polygons                  lower_layer_polygons_cache;
+        PerimeterGenerator::process_arachne(params, surface, nullptr, lower_layer_polygons_cache, loops, gap_fill, fill_expolygons);
+        return std::make_pair(loops.total_volume(), area(fill_expolygons));
+    };
+
+    auto uncached = generate();
+    PerimeterGenerator::ArachneCache cache;
+    params.arachne_cache = &cache;
+    auto first  = generate();
+    REQUIRE(cache.hits() == 0);
+    auto second = generate();
+    REQUIRE(cache.hits() == 1);
+    REQUIRE(uncached.first > 0.);
+    REQUIRE(first == uncached);
+    REQUIRE(second == uncached);
+}
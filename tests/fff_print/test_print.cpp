@@ -4,6 +4,8 @@
 #include "libslic3r/Print.hpp"
 #include "libslic3r/Layer.hpp"
 
+#include <tbb/task_arena.h>
+
 #include "test_data.hpp"
 
 using namespace Slic3r;
@@ -26,6 +28,33 @@ SCENARIO("PrintObject: Perimeter generation", "[PrintObject]") {
                 for (const Layer *layer : object.layers())
                     REQUIRE(layer->regions().front()->perimeters().items_count() == 3);
             }
+            THEN("Duration of the finished steps is recorded") {
+                REQUIRE(object.step_state_with_timestamp(posSlice).duration > 0.f);
+                REQUIRE(object.step_state_with_timestamp(posPerimeters).duration > 0.f);
+            }
+        }
+    }
+}
+
+SCENARIO("Print: Limited number of threads", "[Print]") {
+    GIVEN("20mm cube and default config") {
+        WHEN("The print is limited to a single thread") {
+            Slic3r::Print print;
+            Slic3r::Model model;
+            Slic3r::Test::init_print({TestMesh::cube_20x20x20}, print, model, { { "fill_density", 0 } });
+            print.set_max_threads(1);
+            int max_concurrency = 0;
+            print.set_status_callback([&max_concurrency](const PrintBase::SlicingStatus &) {
+                max_concurrency = std::max(max_concurrency, tbb::this_task_arena::max_concurrency());
+            });
+            print.process();
+            THEN("The print is processed inside an arena of a single thread") {
+                REQUIRE(max_concurrency == 1);
+            }
+            THEN("The print is processed completely") {
+                REQUIRE(print.is_step_done(psSkirtBrim));
+                REQUIRE(print.objects().front()->layers().size() == 66);
+            }
         }
     }
 }
@@ -87,3 +87,32 @@ SCENARIO("PrintObject: object layer heights", "[PrintObject]") {
 #endif
     }
 }
+
+SCENARIO("PrintObject: re-slicing with modified layer heights", "[PrintObject]") {
+    GIVEN("Sphere sliced with 0.2mm layers") {
+        Slic3r::Print print;
+        Slic3r::Model model;
+        auto          config = Slic3r::DynamicPrintConfig::full_print_config_with({
+            { "first_layer_height", 0.2 },
+            { "layer_height",       0.2 }
+        });
+        Slic3r::Test::init_print({ TestMesh::sphere_50mm }, print, model, config);
+        print.process();
+        WHEN("layer height is changed to 0.3mm and the object is sliced again") {
+            config.set_deserialize_strict({ { "layer_height", 0.3 } });
+            print.apply(model, config);
+            print.process();
+            Slic3r::Print print_fresh;
+            Slic3r::Test::init_and_process_print({ TestMesh::sphere_50mm }, print_fresh, config);
+            THEN("the layers match slicing from scratch") {
+                SpanOfConstPtrs<Layer> layers       = print.objects().front()->layers();
+                SpanOfConstPtrs<Layer> layers_fresh = print_fresh.objects().front()->layers();
+                REQUIRE(layers.size() == layers_fresh.size());
+                for (size_t i = 0; i < layers.size(); ++ i) {
+                    REQUIRE(layers[i]->slice_z == Approx(layers_fresh[i]->slice_z));
+                    REQUIRE(area(layers[i]->lslices) == Approx(area(layers_fresh[i]->lslices)));
+                }
+            }
+        }
+    }
+}
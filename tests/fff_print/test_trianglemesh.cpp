@@ -68,6 +68,11 @@ SCENARIO( "TriangleMesh: Basic mesh statistics") {
             REQUIRE(cube.size() == Vec3d(20,20,20));
         }
 
+        THEN( "Cube is a single manifold part.") {
+            REQUIRE(cube.stats().number_of_parts == 1);
+            REQUIRE(cube.stats().manifold());
+        }
+
     }
 }
 
@@ -276,6 +281,10 @@ SCENARIO( "TriangleMesh: Mesh merge functions") {
             THEN( "There are twice as many facets in the merged mesh as the original.") {
                 REQUIRE(cube.facets_count() == 2 * cube2.facets_count());
             }
+            THEN( "The merged mesh consists of two manifold parts.") {
+                REQUIRE(cube.stats().number_of_parts == 2);
+                REQUIRE(cube.stats().manifold());
+            }
         }
     }
 }
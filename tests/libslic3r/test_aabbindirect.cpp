@@ -61,6 +61,42 @@ TEST_CASE("Building a tree over a box, ray caster and closest query", "[AABBIndi
     REQUIRE(closest_point.z() == Approx(1.));
 }
 
+
+TEST_CASE("Ray packet first hits match single ray queries", "[AABBIndirect]")
+{
+    TriangleMesh tmesh = make_cube(1., 1., 1.);
+    tmesh.merge(make_sphere(0.4, 0.1));
+
+    auto tree = AABBTreeIndirect::build_aabb_tree_over_indexed_triangle_set(tmesh.its.vertices, tmesh.its.indices);
+
+    // More rays than fit into a single packet, some of them missing the mesh.
+    std::vector<Vec3d> origins;
+    std::vector<Vec3d> dirs;
+    for (int i = 0; i < 50; ++ i) {
+        double a = 2. * M_PI * i / 50.;
+        origins.emplace_back(0.5, 0.5, -5.);
+        dirs.emplace_back(Vec3d(0.005 * i * cos(a), 0.005 * i * sin(a), 1.).normalized() * (1. + 0.01 * i));
+    }
+
+    std::vector<igl::Hit> hits;
+    size_t num_hits = AABBTreeIndirect::intersect_rays_first_hit(tmesh.its.vertices, tmesh.its.indices, tree, origins, dirs, hits);
+    REQUIRE(hits.size() == origins.size());
+
+    size_t num_hits_single = 0;
+    for (size_t i = 0; i < origins.size(); ++ i) {
+        igl::Hit hit;
+        bool intersected = AABBTreeIndirect::intersect_ray_first_hit(tmesh.its.vertices, tmesh.its.indices, tree, origins[i], dirs[i], hit);
+        REQUIRE(intersected == (hits[i].id >= 0));
+        if (intersected) {
+            ++ num_hits_single;
+            REQUIRE(hits[i].id == hit.id);
+            REQUIRE(hits[i].t == Approx(hit.t));
+        }
+    }
+    REQUIRE(num_hits == num_hits_single);
+    REQUIRE(num_hits > 0);
+    REQUIRE(num_hits < origins.size());
+}
 TEST_CASE("Creating a several 2d lines, testing closest point query", "[AABBIndirect]")
 {
     std::vector<Linef> lines { };
@@ -107,6 +143,30 @@ TEST_CASE("Creating a several 2d lines, testing all lines in radius query", "[AA
     REQUIRE(indices.size() == 3);
 }
 
+TEST_CASE("Distance query with a hint line matches the plain query", "[AABBIndirect]")
+{
+    // A regular 64-gon of radius 10, queried along a spiral crossing the contour.
+    std::vector<Linef> lines;
+    for (size_t i = 0; i < 64; ++ i) {
+        double a0 = 2. * PI * double(i) / 64.;
+        double a1 = 2. * PI * double(i + 1) / 64.;
+        lines.emplace_back(Vec2d(10. * cos(a0), 10. * sin(a0)), Vec2d(10. * cos(a1), 10. * sin(a1)));
+    }
+    AABBTreeLines::LinesDistancer<Linef> distancer(lines);
+
+    size_t hint = size_t(-1);
+    for (size_t i = 0; i < 500; ++ i) {
+        double a = 0.05 * double(i);
+        double r = 5. + 0.02 * double(i);
+        Vec2d  p(r * cos(a), r * sin(a));
+        auto [dist, line_idx, nearest]                = distancer.distance_from_lines_extra<true>(p);
+        auto [dist_hint, line_idx_hint, nearest_hint] = distancer.distance_from_lines_extra<true>(p, hint);
+        REQUIRE(dist_hint == Approx(dist));
+        REQUIRE((nearest_hint - nearest).norm() == Approx(0.).margin(EPSILON));
+        hint = line_idx_hint;
+    }
+}
+
 TEST_CASE("Find the closest point from ExPolys", "[ClosestPoint]") {
     //////////////////////////////
     //  0 - 3
@@ -190,6 +190,15 @@ SCENARIO("Various Clipper operations - t/clipper.t", "[ClipperUtils]") {
         }
 
         ExPolygons expolygons { ExPolygon { square, hole_in_square } };
+        WHEN("offset_multiple by inwards and outwards deltas") {
+            std::vector<float> deltas { -1.f, 1.f, 0.5f };
+            std::vector<Polygons> offsets = offset_multiple(expolygons, deltas);
+            THEN("each offset matches a separate offset() call exactly") {
+                REQUIRE(offsets.size() == deltas.size());
+                for (size_t i = 0; i < deltas.size(); ++ i)
+                    REQUIRE(offsets[i] == offset(expolygons, deltas[i]));
+            }
+        }
         WHEN("Clipping line 1") {
             Polylines intersection = intersection_pl({ Polyline { { 15, 18 }, { 15, 15 } } }, expolygons);
             THEN("line is clipped to square with hole") {
@@ -216,6 +216,27 @@ SCENARIO("Config ini load/save interface", "[Config]") {
     }
 }
 
+SCENARIO("Static config diff", "[Config]") {
+    GIVEN("Two PrintRegionConfigs differing in two options") {
+        PrintRegionConfig config1;
+        PrintRegionConfig config2;
+        config2.perimeters.value += 1;
+        config2.infill_extruder.value += 1;
+        WHEN("diff is called on the static configs") {
+            t_config_option_keys diff = config1.diff(config2);
+            THEN("It matches the diff by option names.") {
+                REQUIRE(diff.size() == 2);
+                REQUIRE(diff == config1.diff(static_cast<const ConfigBase&>(config2)));
+            }
+        }
+        WHEN("diff is called on identical configs") {
+            THEN("No option differs.") {
+                REQUIRE(config1.diff(config1).empty());
+            }
+        }
+    }
+}
+
 SCENARIO("DynamicPrintConfig serialization", "[Config]") {
     WHEN("DynamicPrintConfig is serialized and deserialized") {
         FullPrintConfig full_print_config;
@@ -10,6 +10,7 @@
 #include "libslic3r/Geometry/ConvexHull.hpp"
 #include "libslic3r/ClipperUtils.hpp"
 #include "libslic3r/ShortestPath.hpp"
+#include "libslic3r/Arrange.hpp"
 
 //#include <random>
 //#include "libnest2d/tools/benchmark.h"
@@ -288,6 +289,42 @@ SCENARIO("Circle Fit, TaubinFit with Newton's method", "[Geometry]") {
     }
 }
 
+TEST_CASE("fit_arcs", "[Geometry]") {
+    SECTION("Points on a circular arc are replaced by a single arc") {
+        const Vec2d center { 10., 20. };
+        Vec2ds pts;
+        for (int i = 0; i <= 30; ++ i) {
+            const double a = 0.1 * i;
+            pts.emplace_back(center + 5. * Vec2d(cos(a), sin(a)));
+        }
+        const std::vector<Geometry::FittedArc> arcs = Geometry::fit_arcs(pts, 0.01);
+        REQUIRE(arcs.size() == 1);
+        REQUIRE(arcs.front().is_arc());
+        REQUIRE(arcs.front().end == pts.size() - 1);
+        REQUIRE(is_approx(arcs.front().center, center, 1e-6));
+        REQUIRE(arcs.front().angle == Approx(3.));
+        // Clockwise.
+        std::reverse(pts.begin(), pts.end());
+        REQUIRE(Geometry::fit_arcs(pts, 0.01).front().angle == Approx(-3.));
+    }
+    SECTION("Zig-zag is kept as straight segments") {
+        const Vec2ds pts { { 0., 0. }, { 1., 1. }, { 2., 0. }, { 3., 1. }, { 4., 0. }, { 5., 1. } };
+        const std::vector<Geometry::FittedArc> arcs = Geometry::fit_arcs(pts, 0.01);
+        REQUIRE(arcs.size() == pts.size() - 1);
+        REQUIRE(std::none_of(arcs.begin(), arcs.end(), [](const Geometry::FittedArc &arc) { return arc.is_arc(); }));
+    }
+    SECTION("Full circle is not replaced by a single arc") {
+        Vec2ds pts;
+        for (int i = 0; i <= 64; ++ i)
+            pts.emplace_back(5. * Vec2d(cos(2. * PI * i / 64), sin(2. * PI * i / 64)));
+        const std::vector<Geometry::FittedArc> arcs = Geometry::fit_arcs(pts, 0.01);
+        REQUIRE(arcs.size() > 1);
+        REQUIRE(arcs.back().end == pts.size() - 1);
+        for (const Geometry::FittedArc &arc : arcs)
+            REQUIRE(std::abs(arc.angle) < 2. * PI);
+    }
+}
+
 TEST_CASE("smallest_enclosing_circle_welzl", "[Geometry]") {
     // Some random points in plane.
     Points pts { 
@@ -788,3 +825,28 @@ TEST_CASE("Euler angles roundtrip", "[Geometry]") {
         REQUIRE(trafo1.isApprox(trafo2));
     }
 }
+
+TEST_CASE("Raster arrangement keeps the printer parts apart and on the bed", "[Geometry]") {
+    using namespace Slic3r::arrangement;
+
+    ArrangePolygons items;
+    for (const Polygon &part : PRINTER_PART_POLYGONS) {
+        ArrangePolygon item;
+        item.poly.contour = part;
+        items.emplace_back(std::move(item));
+    }
+
+    const BoundingBox bed(Point::new_scale(0., 0.), Point::new_scale(250., 210.));
+    ArrangeParams params(scaled(6.));
+    params.engine = ArrangeParams::Engine::Raster;
+    arrange(items, {}, bed, params);
+
+    for (size_t i = 0; i < items.size(); ++ i) {
+        REQUIRE(items[i].is_arranged());
+        const ExPolygon poly = items[i].transformed_poly();
+        REQUIRE(bed.contains(get_extents(poly)));
+        for (size_t j = i + 1; j < items.size(); ++ j)
+            if (items[i].bed_idx == items[j].bed_idx)
+                REQUIRE(intersection(ExPolygons{ poly }, ExPolygons{ items[j].transformed_poly() }).empty());
+    }
+}
@@ -2,6 +2,7 @@
 
 #include "libslic3r/KDTreeIndirect.hpp"
 #include "libslic3r/Execution/ExecutionSeq.hpp"
+#include "libslic3r/Execution/ExecutionTBB.hpp"
 #include "libslic3r/BoundingBox.hpp"
 #include "libslic3r/PointGrid.hpp"
 
@@ -85,6 +86,38 @@ TEST_CASE("Test kdtree query for a Box", "[KDTreeIndirect]")
     REQUIRE(call_count < pgrid.point_count());
 }
 
+TEST_CASE("Parallel kdtree build and batched queries", "[KDTreeIndirect]")
+{
+    auto vol = BoundingBox3Base<Vec3f>{{0.f, 0.f, 0.f}, {10.f, 10.f, 10.f}};
+
+    auto pgrid = point_grid(ex_seq, vol, Vec3f{0.2f, 0.2f, 0.2f});
+
+    REQUIRE(!pgrid.empty());
+
+    auto coordfn = [&pgrid] (size_t i, size_t D) { return pgrid.get(i)(int(D)); };
+    KDTreeIndirect<3, float, decltype(coordfn)> tree{coordfn, pgrid.point_count()};
+    KDTreeIndirect<3, float, decltype(coordfn)> tree_parallel{ex_tbb, coordfn, pgrid.point_count()};
+
+    std::vector<Vec3f> queries;
+    for (float x = 0.05f; x < 10.f; x += 0.73f)
+        for (float y = 0.05f; y < 10.f; y += 0.91f)
+            queries.emplace_back(x, y, 10.f - x);
+
+    std::vector<size_t> closest = find_closest_point(ex_tbb, tree_parallel, queries);
+    REQUIRE(closest.size() == queries.size());
+    for (size_t i = 0; i < queries.size(); ++ i)
+        REQUIRE(closest[i] == find_closest_point(tree, queries[i]));
+
+    std::vector<std::vector<size_t>> nearby = find_nearby_points(ex_tbb, tree_parallel, queries, 0.5f);
+    REQUIRE(nearby.size() == queries.size());
+    for (size_t i = 0; i < queries.size(); ++ i) {
+        std::vector<size_t> expected = find_nearby_points(tree, queries[i], 0.5f);
+        std::sort(expected.begin(), expected.end());
+        std::sort(nearby[i].begin(), nearby[i].end());
+        REQUIRE(nearby[i] == expected);
+    }
+}
+
 //TEST_CASE("Test kdtree query for a Sphere", "[KDTreeIndirect]") {
 //    auto vol = BoundingBox3Base<Vec3f>{{0.f, 0.f, 0.f}, {10.f, 10.f, 10.f}};
 
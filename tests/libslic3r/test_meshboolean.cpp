@@ -3,6 +3,7 @@
 
 #include <libslic3r/TriangleMesh.hpp>
 #include <libslic3r/MeshBoolean.hpp>
+#include <libslic3r/CSGMesh/SliceCSGMesh.hpp>
 
 using namespace Slic3r;
 
@@ -49,3 +50,93 @@ TEST_CASE("Add TriangleMeshes", "[MeshBoolean]")
     //its_write_obj(tm1.its, "test_add.obj");
     CHECK(tm1.its.indices.size() > init_size);
 }
+
+TEST_CASE("Slicing CSG parts with negative volumes", "[MeshBoolean]")
+{
+    indexed_triangle_set cube = its_make_cube(20., 20., 20.);
+    indexed_triangle_set hole = its_make_cube(5., 5., 30.);
+
+    auto translation = [](float x, float y, float z) { return Transform3f(Eigen::Translation3f(x, y, z)); };
+
+    // Area of the slices in mm^2
+    auto areas = [](const std::vector<ExPolygons> &slices) {
+        std::vector<double> out;
+        for (const ExPolygons &slice : slices) {
+            double a = 0.;
+            for (const ExPolygon &expoly : slice)
+                a += expoly.area() * SCALING_FACTOR * SCALING_FACTOR;
+            out.emplace_back(a);
+        }
+        return out;
+    };
+
+    std::vector<float> slicegrid { 5.f, 15.f };
+
+    SECTION("A run of negative parts") {
+        std::vector<csg::CSGPart> parts;
+        parts.emplace_back(&cube);
+        parts.emplace_back(&hole, csg::CSGType::Difference, translation(2.f, 2.f, -5.f));
+        parts.emplace_back(&hole, csg::CSGType::Difference, translation(12.f, 12.f, -5.f));
+
+        std::vector<ExPolygons> slices = csg::slice_csgmesh_ex(range(parts), slicegrid, MeshSlicingParamsEx{});
+        REQUIRE(slices.size() == slicegrid.size());
+        for (const ExPolygons &slice : slices) {
+            REQUIRE(slice.size() == 1);
+            REQUIRE(slice.front().holes.size() == 2);
+        }
+        for (double a : areas(slices))
+            REQUIRE(a == Approx(400. - 2. * 25.));
+    }
+
+    SECTION("A run of negative parts closing a group") {
+        std::vector<csg::CSGPart> parts;
+        parts.emplace_back(&cube);
+        parts.back().stack_operation = csg::CSGStackOp::Push;
+        parts.emplace_back(&hole, csg::CSGType::Difference, translation(2.f, 2.f, -5.f));
+        parts.emplace_back(&hole, csg::CSGType::Difference, translation(12.f, 12.f, -5.f));
+        parts.back().stack_operation = csg::CSGStackOp::Pop;
+        // Placed after the group, thus not subtracted from.
+        parts.emplace_back(&cube, csg::CSGType::Union, translation(30.f, 0.f, 0.f));
+
+        std::vector<ExPolygons> slices = csg::slice_csgmesh_ex(range(parts), slicegrid, MeshSlicingParamsEx{});
+        REQUIRE(slices.size() == slicegrid.size());
+        for (double a : areas(slices))
+            REQUIRE(a == Approx(400. - 2. * 25. + 400.));
+    }
+}
+
+TEST_CASE("Booleans of meshes apart", "[MeshBoolean]")
+{
+    indexed_triangle_set cube = its_make_cube(10., 10., 10.);
+    indexed_triangle_set apart = its_make_cube(5., 5., 5.);
+    its_translate(apart, Vec3f(20.f, 0.f, 0.f));
+
+    SECTION("Difference keeps the first mesh") {
+        indexed_triangle_set A = cube;
+        MeshBoolean::cgal::minus(A, apart);
+        REQUIRE(A.indices.size() == cube.indices.size());
+        REQUIRE(its_volume(A) == Approx(1000.));
+    }
+
+    SECTION("Union contains both meshes") {
+        indexed_triangle_set A = cube;
+        MeshBoolean::cgal::plus(A, apart);
+        REQUIRE(A.indices.size() == cube.indices.size() + apart.indices.size());
+        REQUIRE(its_volume(A) == Approx(1000. + 125.));
+    }
+
+    SECTION("Intersection is empty") {
+        indexed_triangle_set A = cube;
+        MeshBoolean::cgal::intersect(A, apart);
+        REQUIRE(A.empty());
+    }
+
+    SECTION("Touching meshes are not apart") {
+        indexed_triangle_set touching = its_make_cube(5., 5., 5.);
+        its_translate(touching, Vec3f(10.f, 0.f, 0.f));
+        indexed_triangle_set A = cube;
+        MeshBoolean::cgal::plus(A, touching);
+        REQUIRE(its_volume(A) == Approx(1000. + 125.));
+        REQUIRE(! MeshBoolean::cgal::does_self_intersect(TriangleMesh{A}));
+    }
+}
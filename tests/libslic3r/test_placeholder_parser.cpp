@@ -36,6 +36,8 @@ SCENARIO("Placeholder parser scripting", "[PlaceholderParser]") {
     SECTION("nested config options (legacy syntax)") { REQUIRE(parser.process("[temperature_[foo]]") == "357"); }
     SECTION("array reference") { REQUIRE(parser.process("{temperature[foo]}") == "357"); }
     SECTION("whitespaces and newlines are maintained") { REQUIRE(parser.process("test [ temperature_ [foo] ] \n hu") == "test 357 \n hu"); }
+    SECTION("plain text is maintained") { REQUIRE(parser.process("G28 ; home\nG1 Z5 \n") == "G28 ; home\nG1 Z5 \n"); }
+    SECTION("leading whitespaces of plain text are skipped") { REQUIRE(parser.process(" \n\tG28\n") == "G28\n"); }
     SECTION("nullable is not null") { REQUIRE(parser.process("{is_nil(filament_retract_length[0])}") == "false"); }
     SECTION("nullable is null") { REQUIRE(parser.process("{is_nil(filament_retract_length[1])}") == "true"); }
     SECTION("nullable is not null 2") { REQUIRE(parser.process("{is_nil(filament_retract_length[2])}") == "false"); }
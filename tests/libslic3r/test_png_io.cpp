@@ -53,3 +53,26 @@ TEST_CASE("PNG read", "[PNG]") {
         REQUIRE(sum == rstsum);
     }
 }
+
+TEST_CASE("PNG fast encoder roundtrip", "[PNG]") {
+    // Large enough to be compressed in multiple chunks.
+    const size_t w = 2000, h = 1500;
+    std::vector<uint8_t> pixels(w * h);
+    for (size_t r = 0; r < h; ++r)
+        for (size_t c = 0; c < w; ++c)
+            pixels[r * w + c] = (r / 100 + c / 100) % 2 ? 255 : uint8_t((r * 7 + c) % 256);
+
+    for (bool flip : { false, true }) {
+        std::vector<uint8_t> enc = png::encode_png(pixels.data(), w, h, 1, png::EncodeMode::Fast, flip);
+        REQUIRE(png::is_png({enc.data(), enc.size()}));
+
+        png::ImageGreyscale img;
+        REQUIRE(png::decode_png({enc.data(), enc.size()}, img));
+        REQUIRE(img.rows == h);
+        REQUIRE(img.cols == w);
+
+        for (size_t r = 0; r < h; ++r)
+            REQUIRE(std::equal(img.buf.begin() + r * w, img.buf.begin() + (r + 1) * w,
+                               pixels.begin() + (flip ? h - 1 - r : r) * w));
+    }
+}
@@ -26,3 +26,20 @@ SCENARIO("Simplify polyline", "[Polyline]")
         }
     }
 }
+
+TEST_CASE("Douglas-Peucker in place matches the copying variant", "[Polyline]")
+{
+    Points pts;
+    for (int i = 0; i < 1000; ++ i)
+        pts.emplace_back(i * 100, ((i * 7919) % 13 - 6) * (i % 5 == 0 ? 200 : 10));
+    // Repeated points produce degenerate anchor / floater segments.
+    pts.insert(pts.begin() + 500, 3, pts[500]);
+    for (double tolerance : { 0., 50., 500., 5000. }) {
+        Points simplified = MultiPoint::_douglas_peucker(pts, tolerance);
+        Points inplace    = pts;
+        MultiPoint::_douglas_peucker_inplace(inplace, tolerance);
+        REQUIRE(inplace == simplified);
+        REQUIRE(simplified.front() == pts.front());
+        REQUIRE(simplified.back()  == pts.back());
+    }
+}
@@ -1,6 +1,9 @@
 #include <catch2/catch.hpp>
 
 #include "libslic3r/libslic3r.h"
+#include "libslic3r/DeferredWriter.hpp"
+
+#include <atomic>
 
 SCENARIO("Test fast_round_up()") {
     using namespace Slic3r;
@@ -33,3 +36,36 @@ SCENARIO("Test fast_round_up()") {
         REQUIRE(fast_round_up<int>(-1.51) == -2);
     }
 }
+
+TEST_CASE("DeferredWriter coalesces jobs of the same key", "[Utils]") {
+    using namespace Slic3r;
+    std::atomic<int> a_runs { 0 }, b_runs { 0 };
+    int a_value = 0;
+    {
+        DeferredWriter writer;
+        for (int i = 1; i <= 10; ++ i)
+            writer.schedule("a", [&a_runs, &a_value, i]() { ++ a_runs; a_value = i; }, std::chrono::seconds(60));
+        writer.schedule("b", [&b_runs]() { ++ b_runs; }, std::chrono::seconds(60));
+        writer.flush();
+        REQUIRE(a_runs == 1);
+        REQUIRE(a_value == 10);
+        REQUIRE(b_runs == 1);
+        // Pending jobs are executed when the writer is destroyed.
+        writer.schedule("b", [&b_runs]() { ++ b_runs; }, std::chrono::seconds(60));
+    }
+    REQUIRE(b_runs == 2);
+}
+
+TEST_CASE("DeferredWriter flushes a single key", "[Utils]") {
+    using namespace Slic3r;
+    std::atomic<int> a_runs { 0 }, b_runs { 0 };
+    {
+        DeferredWriter writer;
+        writer.schedule("a", [&a_runs]() { ++ a_runs; }, std::chrono::seconds(60));
+        writer.schedule("b", [&b_runs]() { ++ b_runs; }, std::chrono::seconds(60));
+        writer.flush("a");
+        REQUIRE(a_runs == 1);
+        REQUIRE(b_runs == 0);
+    }
+    REQUIRE(b_runs == 1);
+}
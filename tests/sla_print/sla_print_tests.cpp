@@ -7,6 +7,7 @@
 
 #include <libslic3r/TriangleMeshSlicer.hpp>
 #include <libslic3r/SLA/SupportTreeMesher.hpp>
+#include <libslic3r/SLA/SpatIndex.hpp>
 #include <libslic3r/BranchingTree/PointCloud.hpp>
 
 namespace {
@@ -261,6 +262,58 @@ TEST_CASE("halfcone test", "[halfcone]") {
     its_write_obj(m, "Halfcone.obj");
 }
 
+TEST_CASE("Instanced support primitives match the generated meshes", "[SupportTreeMesher]") {
+    sla::PrimitiveMeshCache cache{45};
+
+    auto check = [&cache](const auto &primitive) {
+        indexed_triangle_set ref = sla::get_mesh(primitive, 45);
+        indexed_triangle_set m;
+        sla::its_append(m, cache.instance(primitive));
+
+        REQUIRE(m.indices == ref.indices);
+        REQUIRE(m.vertices.size() == ref.vertices.size());
+        for (size_t i = 0; i < m.vertices.size(); ++i)
+            REQUIRE((m.vertices[i] - ref.vertices[i]).norm() < 1e-4f);
+    };
+
+    check(sla::Bridge{Vec3d{1., 2., 3.}, Vec3d{5., -2., 10.}, 0.5});
+    check(sla::DiffBridge{Vec3d{1., 1., 1.}, Vec3d{10., 10., 10.}, 0.25, 0.5});
+    check(sla::Junction{Vec3d{3., 4., 5.}, 0.8});
+    check(sla::Head{1., 0.4, 2., 0.2, Vec3d{0.3, 0.2, -1.}.normalized(), Vec3d{1., 2., 3.}});
+}
+
+TEST_CASE("Bulk loaded point index answers batched queries", "[SpatIndex]") {
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> dist(-10., 10.);
+
+    std::vector<sla::PointIndexEl> els;
+    std::vector<Vec3d> pts;
+    for (unsigned i = 0; i < 1000; ++i) {
+        els.emplace_back(Vec3d{dist(rng), dist(rng), dist(rng)}, i);
+        pts.emplace_back(Vec3d{dist(rng), dist(rng), dist(rng)});
+    }
+
+    sla::PointIndex inserted;
+    for (const sla::PointIndexEl &el : els)
+        inserted.insert(el);
+
+    const sla::PointIndex bulk(els);
+    REQUIRE(bulk.size() == els.size());
+
+    std::vector<std::vector<sla::PointIndexEl>> res = bulk.nearest(pts, 3);
+    REQUIRE(res.size() == pts.size());
+
+    auto ids = [](std::vector<sla::PointIndexEl> v) {
+        std::vector<unsigned> ret;
+        for (const sla::PointIndexEl &el : v) ret.emplace_back(el.second);
+        std::sort(ret.begin(), ret.end());
+        return ret;
+    };
+
+    for (size_t i = 0; i < pts.size(); ++i)
+        REQUIRE(ids(res[i]) == ids(inserted.nearest(pts[i], 3)));
+}
+
 TEST_CASE("Test concurrency")
 {
     std::vector<double> vals = grid(0., 100., 10.);